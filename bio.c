@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,78 +17,331 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Locking: each hash bucket has a lock protecting its chain
+// and the refcnt of the buffers on it, so a cache hit takes
+// only its bucket's lock.  bcache.lock serializes misses and
+// protects the LRU list, which brelse() updates after dropping
+// the bucket lock.  The LRU list holds every buffer, in order
+// of last release; buffers in use are skipped when recycling.
+// Lock order is bcache.lock, then a bucket lock.
+//
+// The cache grows and shrinks a page at a time.  Buffers come
+// in groups of BPG (PGSIZE/bsize) sharing one kalloc() page
+// for their data.
+// A miss adds a group while the cache holds fewer pages than
+// are left free and fewer than NBUFMAX buffers, and breclaim()
+// gives unused groups back when kallocswap() runs short of
+// memory, down to NBUF buffers, enough for the log to pin two
+// transactions' blocks.  If every buffer is in use, bget()
+// adds a group with kallocswap(), or failing that waits for a
+// buffer to be released.
+//
+// Blocks are read and written by the driver that bdevsw
+// holds for their device (ide.c or virtio.c).
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bstat.h"
+
+#define BPG (bcache.bpg)  // buffers per group
+#define NGROUP (NBUFMAX / BPG)
+#define MINGROUP ((NBUF + BPG - 1) / BPG)
+
+// Block size, from the root file system's superblock (see
+// bsetsize).  Until it is known, blocks are one sector.
+uint bsize = SECTSIZE;
+
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;  // chain through hnext
+  uint hits;
+};
 
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf buf[NBUFMAX];
+  char *page[NBUFMAX];  // data of buf[g*BPG..], 0 if group unused
+  int ngroup;           // groups in use
+  int bpg;
+  struct bucket bucket[NBHASH];
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
+  // Linked list of all buffers in use groups, through
+  // prev/next.  head.next is least recently released.
   struct buf head;
+
+  uint misses;
+  uint evictions;
 } bcache;
 
+struct bdevsw bdevsw[NBDEV];
+
+// Add a group of buffers using the page mem at the least
+// recently used end of the list.  Returns 0, or -1 if the
+// cache is at NBUFMAX; mem is the caller's again then.
+// Caller must hold bcache.lock, except in binit.
+static int
+bgrowpage(char *mem)
+{
+  struct buf *b;
+  int g;
+
+  for(g = 0; g < NGROUP; g++)
+    if(bcache.page[g] == 0)
+      break;
+  if(g == NGROUP)
+    return -1;
+  bcache.page[g] = mem;
+  bcache.ngroup++;
+  for(b = &bcache.buf[g*BPG]; b < &bcache.buf[(g+1)*BPG]; b++){
+    b->data = (uchar*)mem;
+    mem += bsize;
+    b->dev = 0;
+    b->blockno = 0;
+    b->flags = 0;
+    b->refcnt = 0;
+    b->next = bcache.head.next;
+    b->prev = &bcache.head;
+    bcache.head.next->prev = b;
+    bcache.head.next = b;
+  }
+  return 0;
+}
+
+// Add a group of buffers if there is a page free.
+// Returns 0, or -1 if not.
+// Caller must hold bcache.lock, except in binit.
+static int
+bgrow(void)
+{
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  if(bgrowpage(mem) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
 
   initlock(&bcache.lock, "bcache");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBHASH; bk++)
+    initlock(&bk->lock, "bcache.bucket");
 
-  // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  for(b = bcache.buf; b < bcache.buf+NBUFMAX; b++)
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  bcache.bpg = PGSIZE/bsize;
+  while(bcache.ngroup < MINGROUP)
+    if(bgrow() < 0)
+      panic("binit");
+}
+
+// Switch to blocks of size bytes.  Called once the root file
+// system's superblock has been read (see iinit), while no
+// buffer is in use.  Everything cached is dropped, since the
+// block numbers change meaning.
+void
+bsetsize(uint size)
+{
+  struct buf *b;
+  struct bucket *bk;
+  int g;
+
+  if(size < SECTSIZE || size > MAXBSIZE || (size & (size - 1)) != 0)
+    panic("bsetsize");
+  acquire(&bcache.lock);
+  for(b = bcache.head.next; b != &bcache.head; b = b->next)
+    if(b->refcnt != 0 || (b->flags & B_DIRTY))
+      panic("bsetsize: busy");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBHASH; bk++){
+    acquire(&bk->lock);
+    bk->head = 0;
+    release(&bk->lock);
+  }
+  for(g = 0; g < NGROUP; g++){
+    if(bcache.page[g]){
+      kfree(bcache.page[g]);
+      bcache.page[g] = 0;
+    }
+  }
+  bcache.ngroup = 0;
+  bcache.head.prev = &bcache.head;
+  bcache.head.next = &bcache.head;
+
+  bsize = size;
+  bcache.bpg = PGSIZE/bsize;
+  while(bcache.ngroup < MINGROUP)
+    if(bgrow() < 0)
+      panic("bsetsize: no memory");
+  release(&bcache.lock);
+}
+
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev*31 + blockno) % NBHASH];
+}
+
+// Look for the block on its bucket's chain.
+// Caller must hold bk->lock.
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Remove b from the chain of bucket bk, if it is on it.
+// Caller must hold bk->lock.
+static void
+bunhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+    if(*pp == b){
+      *pp = b->hnext;
+      return;
+    }
   }
 }
 
+// Take the least recently released unused buffer off its
+// hash chain.  Returns 0 if every buffer is in use.
+// Caller must hold bcache.lock.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b;
+  struct bucket *bk;
+
+  // Blocks that log.c has modified but not yet written home
+  // are pinned (see bpin), so they have refcnt > 0 too.
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+    bk = bhash(b->dev, b->blockno);
+    acquire(&bk->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      bunhash(bk, b);
+      release(&bk->lock);
+      return b;
+    }
+    release(&bk->lock);
+  }
+  return 0;
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// For read-ahead (ahead != 0), return 0 instead if the block
+// is already cached or there is no buffer to spare for it.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
   struct buf *b;
+  struct bucket *bk;
+  char *mem;
 
-  acquire(&bcache.lock);
+  bk = bhash(dev, blockno);
+  acquire(&bk->lock);
+  if((b = blookup(bk, dev, blockno)) != 0 && !ahead){
+    b->refcnt++;
+    bk->hits++;
+  }
+  release(&bk->lock);
+  if(b){
+    if(ahead)
+      return 0;
+    acquiresleep(&b->lock);
+    return b;
+  }
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
+  // Not cached.  Only one miss at a time, so check again:
+  // another process may have read the block meanwhile.
+  acquire(&bcache.lock);
+  if(bcache.ngroup*BPG < NBUFMAX && bcache.ngroup < kfreepages())
+    bgrow();
+  for(;;){
+    acquire(&bk->lock);
+    if((b = blookup(bk, dev, blockno)) != 0 && !ahead){
       b->refcnt++;
+      bk->hits++;
+    }
+    release(&bk->lock);
+    if(b){
       release(&bcache.lock);
+      if(ahead)
+        return 0;
       acquiresleep(&b->lock);
       return b;
     }
-  }
-
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+    if((b = bvictim()) != 0)
+      break;
+    // Every buffer is in use: add a group if the cap allows,
+    // otherwise wait for brelse().  The buffers may all be
+    // pinned by the log until a commit that waits for this
+    // operation, so make room by paging out before waiting.
+    if(bgrow() == 0)
+      continue;
+    if(ahead){
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      return 0;
     }
+    if(bcache.ngroup < NGROUP){
+      release(&bcache.lock);
+      mem = kallocswap();
+      acquire(&bcache.lock);
+      if(mem){
+        if(bgrowpage(mem) < 0)
+          kfree(mem);
+        continue;
+      }
+    }
+    sleep(&bcache, &bcache.lock);
   }
-  panic("bget: no buffers");
+  bcache.misses++;
+  if(b->flags & B_VALID)
+    bcache.evictions++;
+
+  // Move it to the recently used end, so the next miss
+  // starts its search with older buffers.
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  b->next = &bcache.head;
+  b->prev = bcache.head.prev;
+  bcache.head.prev->next = b;
+  bcache.head.prev = b;
+
+  acquire(&bk->lock);
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->hnext = bk->head;
+  bk->head = b;
+  release(&bk->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -97,13 +350,33 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
-    iderw(b);
+    bdevsw[b->dev].rw(b);
   }
   return b;
 }
 
+// Start reading the indicated block into the cache, without
+// waiting for it, if it is not cached already.  The disk
+// interrupt handler releases the buffer when the read is done
+// (see breaddone); anyone who wants the block before then
+// waits for the buffer's lock in bget.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  b->done = breaddone;
+  bdevsw[b->dev].submit(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -111,32 +384,154 @@ bwrite(struct buf *b)
   if(!holdingsleep(&b->lock))
     panic("bwrite");
   b->flags |= B_DIRTY;
-  iderw(b);
+  bdevsw[b->dev].rw(b);
+}
+
+// Drop a reference to b.  When it is the last, move b to the
+// recently used end of the LRU list.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
+  int unused;
+
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
+  unused = --b->refcnt == 0;
+  release(&bk->lock);
+  if(!unused)
+    return;
+
+  // No one is waiting for it.  If it has been recycled
+  // since, it is already at the recently used end.
+  acquire(&bcache.lock);
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  b->next = &bcache.head;
+  b->prev = bcache.head.prev;
+  bcache.head.prev->next = b;
+  bcache.head.prev = b;
+  wakeup(&bcache);
+  release(&bcache.lock);
+}
+
+// Drop a reference to b and unlock it.  The body of brelse,
+// which breaddone also uses: it runs in the disk interrupt
+// handler, which does not hold b->lock itself.
+static void
+bunlock(struct buf *b)
+{
+  releasesleep(&b->lock);
+  bput(b);
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Move to the recently used end of the LRU list.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bunlock(b);
+}
 
-  releasesleep(&b->lock);
+// Called by the disk interrupt handler when the read started
+// by breadahead finishes, in place of the reader's brelse.
+void
+breaddone(struct buf *b)
+{
+  bunlock(b);
+}
+
+// Keep b in the cache, without locking it, until bunpin.
+// Used by log.c for blocks that are not yet written home.
+void
+bpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
+  b->refcnt++;
+  release(&bk->lock);
+}
+
+void
+bunpin(struct buf *b)
+{
+  bput(b);
+}
+
+// Give a group of unused buffers back to kalloc.  Used by
+// kallocswap() when memory runs out.
+// Returns 1 if a page was freed, 0 if not.
+int
+breclaim(void)
+{
+  struct buf *b, *end;
+  struct bucket *bk;
+  char *mem;
+  int g;
 
   acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  for(g = 0; g < NGROUP && bcache.ngroup > MINGROUP; g++){
+    if(bcache.page[g] == 0)
+      continue;
+    // Drop the group's blocks from the cache, giving up if
+    // one is in use.  Those dropped stay usable.
+    end = &bcache.buf[(g+1)*BPG];
+    for(b = &bcache.buf[g*BPG]; b < end; b++){
+      bk = bhash(b->dev, b->blockno);
+      acquire(&bk->lock);
+      if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+        release(&bk->lock);
+        break;
+      }
+      bunhash(bk, b);
+      b->flags = 0;
+      release(&bk->lock);
+    }
+    if(b < end)
+      continue;
+    for(b = &bcache.buf[g*BPG]; b < end; b++){
+      b->next->prev = b->prev;
+      b->prev->next = b->next;
+      b->data = 0;
+    }
+    mem = bcache.page[g];
+    bcache.page[g] = 0;
+    bcache.ngroup--;
+    release(&bcache.lock);
+    kfree(mem);
+    return 1;
   }
-  
   release(&bcache.lock);
+  return 0;
 }
-// Blank page.
 
+void
+getbstat(struct bstat *st)
+{
+  struct bucket *bk;
+
+  acquire(&bcache.lock);
+  st->nbuf = bcache.ngroup*BPG;
+  st->maxbuf = NGROUP*BPG;
+  st->misses = bcache.misses;
+  st->evictions = bcache.evictions;
+  st->hits = 0;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBHASH; bk++){
+    acquire(&bk->lock);
+    st->hits += bk->hits;
+    release(&bk->lock);
+  }
+  release(&bcache.lock);
+}
+
+// Report the request queue statistics of the root disk.
+void
+getdiskstat(struct diskstat *st)
+{
+  bdevsw[ROOTDEV].stat(st);
+}
+// Blank page.
@@ -0,0 +1,10 @@
+// Buffer cache statistics, returned by getbstat().
+// Both the kernel and user programs use this header file.
+
+struct bstat {
+  uint nbuf;       // buffers in the cache now
+  uint maxbuf;     // most buffers the cache may grow to
+  uint hits;       // lookups that found the block cached
+  uint misses;     // lookups that had to take a buffer
+  uint evictions;  // misses that recycled a buffer holding another block
+};
@@ -6,9 +6,23 @@ struct buf {
   uint refcnt;
   struct buf *prev; // LRU cache list
   struct buf *next;
+  struct buf *hnext; // hash chain
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint qtime;        // ticks when queued
+  void (*done)(struct buf*);  // called when a submit() request finishes
+  uchar *data;       // bsize bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
 
+// Block device drivers, indexed by buf dev.
+struct diskstat;
+struct bdevsw {
+  void (*rw)(struct buf*);         // sync b with disk and wait, like iderw
+  void (*submit)(struct buf*);     // start rw; b->done finishes it; may
+                                   // sleep for queue room, not for b
+  void (*stat)(struct diskstat*);  // request queue statistics
+};
+
+extern struct bdevsw bdevsw[];
+
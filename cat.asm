@@ -0,0 +1,1203 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+
+  // Have the kernel copy files and pipes straight to stdout;
+  // read and write anything it cannot.
+  while((n = splice(fd, 1, 4096)) > 0)
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	68 00 10 00 00       	push   $0x1000
+  10:	6a 01                	push   $0x1
+  12:	56                   	push   %esi
+  13:	e8 ca 03 00 00       	call   3e2 <splice>
+  18:	83 c4 10             	add    $0x10,%esp
+  1b:	85 c0                	test   %eax,%eax
+  1d:	7f e9                	jg     8 <cat+0x8>
+    ;
+  if(n == 0)
+  1f:	74 49                	je     6a <cat+0x6a>
+    return;
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  21:	83 ec 04             	sub    $0x4,%esp
+  24:	68 00 02 00 00       	push   $0x200
+  29:	68 c0 0a 00 00       	push   $0xac0
+  2e:	56                   	push   %esi
+  2f:	e8 96 02 00 00       	call   2ca <read>
+  34:	89 c3                	mov    %eax,%ebx
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	85 c0                	test   %eax,%eax
+  3b:	7e 2b                	jle    68 <cat+0x68>
+    if (write(1, buf, n) != n) {
+  3d:	83 ec 04             	sub    $0x4,%esp
+  40:	53                   	push   %ebx
+  41:	68 c0 0a 00 00       	push   $0xac0
+  46:	6a 01                	push   $0x1
+  48:	e8 85 02 00 00       	call   2d2 <write>
+  4d:	83 c4 10             	add    $0x10,%esp
+  50:	39 d8                	cmp    %ebx,%eax
+  52:	74 cd                	je     21 <cat+0x21>
+      printf(1, "cat: write error\n");
+  54:	83 ec 08             	sub    $0x8,%esp
+  57:	68 3c 07 00 00       	push   $0x73c
+  5c:	6a 01                	push   $0x1
+  5e:	e8 2c 04 00 00       	call   48f <printf>
+      exit();
+  63:	e8 4a 02 00 00       	call   2b2 <exit>
+    }
+  }
+  if(n < 0){
+  68:	78 07                	js     71 <cat+0x71>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  6d:	5b                   	pop    %ebx
+  6e:	5e                   	pop    %esi
+  6f:	5d                   	pop    %ebp
+  70:	c3                   	ret
+    printf(1, "cat: read error\n");
+  71:	83 ec 08             	sub    $0x8,%esp
+  74:	68 4e 07 00 00       	push   $0x74e
+  79:	6a 01                	push   $0x1
+  7b:	e8 0f 04 00 00       	call   48f <printf>
+    exit();
+  80:	e8 2d 02 00 00       	call   2b2 <exit>
+
+00000085 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  85:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  89:	83 e4 f0             	and    $0xfffffff0,%esp
+  8c:	ff 71 fc             	push   -0x4(%ecx)
+  8f:	55                   	push   %ebp
+  90:	89 e5                	mov    %esp,%ebp
+  92:	57                   	push   %edi
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	51                   	push   %ecx
+  96:	83 ec 18             	sub    $0x18,%esp
+  99:	8b 01                	mov    (%ecx),%eax
+  9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  9e:	8b 51 04             	mov    0x4(%ecx),%edx
+  a1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  a4:	83 f8 01             	cmp    $0x1,%eax
+  a7:	7e 07                	jle    b0 <main+0x2b>
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  a9:	be 01 00 00 00       	mov    $0x1,%esi
+  ae:	eb 26                	jmp    d6 <main+0x51>
+    cat(0);
+  b0:	83 ec 0c             	sub    $0xc,%esp
+  b3:	6a 00                	push   $0x0
+  b5:	e8 46 ff ff ff       	call   0 <cat>
+    exit();
+  ba:	e8 f3 01 00 00       	call   2b2 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	50                   	push   %eax
+  c3:	e8 38 ff ff ff       	call   0 <cat>
+    close(fd);
+  c8:	89 1c 24             	mov    %ebx,(%esp)
+  cb:	e8 0a 02 00 00       	call   2da <close>
+  for(i = 1; i < argc; i++){
+  d0:	83 c6 01             	add    $0x1,%esi
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d9:	39 c6                	cmp    %eax,%esi
+  db:	7d 31                	jge    10e <main+0x89>
+    if((fd = open(argv[i], 0)) < 0){
+  dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e0:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	6a 00                	push   $0x0
+  e8:	ff 37                	push   (%edi)
+  ea:	e8 03 02 00 00       	call   2f2 <open>
+  ef:	89 c3                	mov    %eax,%ebx
+  f1:	83 c4 10             	add    $0x10,%esp
+  f4:	85 c0                	test   %eax,%eax
+  f6:	79 c7                	jns    bf <main+0x3a>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  f8:	83 ec 04             	sub    $0x4,%esp
+  fb:	ff 37                	push   (%edi)
+  fd:	68 5f 07 00 00       	push   $0x75f
+ 102:	6a 01                	push   $0x1
+ 104:	e8 86 03 00 00       	call   48f <printf>
+      exit();
+ 109:	e8 a4 01 00 00       	call   2b2 <exit>
+  }
+  exit();
+ 10e:	e8 9f 01 00 00       	call   2b2 <exit>
+
+00000113 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 113:	55                   	push   %ebp
+ 114:	89 e5                	mov    %esp,%ebp
+ 116:	56                   	push   %esi
+ 117:	53                   	push   %ebx
+ 118:	8b 75 08             	mov    0x8(%ebp),%esi
+ 11b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 11e:	89 f0                	mov    %esi,%eax
+ 120:	89 d1                	mov    %edx,%ecx
+ 122:	83 c2 01             	add    $0x1,%edx
+ 125:	89 c3                	mov    %eax,%ebx
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	0f b6 09             	movzbl (%ecx),%ecx
+ 12d:	88 0b                	mov    %cl,(%ebx)
+ 12f:	84 c9                	test   %cl,%cl
+ 131:	75 ed                	jne    120 <strcpy+0xd>
+    ;
+  return os;
+}
+ 133:	89 f0                	mov    %esi,%eax
+ 135:	5b                   	pop    %ebx
+ 136:	5e                   	pop    %esi
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+
+00000139 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 139:	55                   	push   %ebp
+ 13a:	89 e5                	mov    %esp,%ebp
+ 13c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 142:	eb 06                	jmp    14a <strcmp+0x11>
+    p++, q++;
+ 144:	83 c1 01             	add    $0x1,%ecx
+ 147:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 14a:	0f b6 01             	movzbl (%ecx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	74 04                	je     155 <strcmp+0x1c>
+ 151:	3a 02                	cmp    (%edx),%al
+ 153:	74 ef                	je     144 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 155:	0f b6 c0             	movzbl %al,%eax
+ 158:	0f b6 12             	movzbl (%edx),%edx
+ 15b:	29 d0                	sub    %edx,%eax
+}
+ 15d:	5d                   	pop    %ebp
+ 15e:	c3                   	ret
+
+0000015f <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 15f:	55                   	push   %ebp
+ 160:	89 e5                	mov    %esp,%ebp
+ 162:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 165:	b8 00 00 00 00       	mov    $0x0,%eax
+ 16a:	eb 03                	jmp    16f <strlen+0x10>
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 173:	75 f7                	jne    16c <strlen+0xd>
+    ;
+  return n;
+}
+ 175:	5d                   	pop    %ebp
+ 176:	c3                   	ret
+
+00000177 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 177:	55                   	push   %ebp
+ 178:	89 e5                	mov    %esp,%ebp
+ 17a:	57                   	push   %edi
+ 17b:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 17e:	89 d7                	mov    %edx,%edi
+ 180:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 183:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 186:	fc                   	cld
+ 187:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 189:	89 d0                	mov    %edx,%eax
+ 18b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 18e:	c9                   	leave
+ 18f:	c3                   	ret
+
+00000190 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 19a:	eb 03                	jmp    19f <strchr+0xf>
+ 19c:	83 c0 01             	add    $0x1,%eax
+ 19f:	0f b6 10             	movzbl (%eax),%edx
+ 1a2:	84 d2                	test   %dl,%dl
+ 1a4:	74 06                	je     1ac <strchr+0x1c>
+    if(*s == c)
+ 1a6:	38 ca                	cmp    %cl,%dl
+ 1a8:	75 f2                	jne    19c <strchr+0xc>
+ 1aa:	eb 05                	jmp    1b1 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1b1:	5d                   	pop    %ebp
+ 1b2:	c3                   	ret
+
+000001b3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1b3:	55                   	push   %ebp
+ 1b4:	89 e5                	mov    %esp,%ebp
+ 1b6:	57                   	push   %edi
+ 1b7:	56                   	push   %esi
+ 1b8:	53                   	push   %ebx
+ 1b9:	83 ec 1c             	sub    $0x1c,%esp
+ 1bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1c4:	89 de                	mov    %ebx,%esi
+ 1c6:	83 c3 01             	add    $0x1,%ebx
+ 1c9:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cc:	7d 2e                	jge    1fc <gets+0x49>
+    cc = read(0, &c, 1);
+ 1ce:	83 ec 04             	sub    $0x4,%esp
+ 1d1:	6a 01                	push   $0x1
+ 1d3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1d6:	50                   	push   %eax
+ 1d7:	6a 00                	push   $0x0
+ 1d9:	e8 ec 00 00 00       	call   2ca <read>
+    if(cc < 1)
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	85 c0                	test   %eax,%eax
+ 1e3:	7e 17                	jle    1fc <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1e5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e9:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1ec:	3c 0a                	cmp    $0xa,%al
+ 1ee:	0f 94 c2             	sete   %dl
+ 1f1:	3c 0d                	cmp    $0xd,%al
+ 1f3:	0f 94 c0             	sete   %al
+ 1f6:	08 c2                	or     %al,%dl
+ 1f8:	74 ca                	je     1c4 <gets+0x11>
+    buf[i++] = c;
+ 1fa:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1fc:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 200:	89 f8                	mov    %edi,%eax
+ 202:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 205:	5b                   	pop    %ebx
+ 206:	5e                   	pop    %esi
+ 207:	5f                   	pop    %edi
+ 208:	5d                   	pop    %ebp
+ 209:	c3                   	ret
+
+0000020a <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+ 20d:	56                   	push   %esi
+ 20e:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20f:	83 ec 08             	sub    $0x8,%esp
+ 212:	6a 00                	push   $0x0
+ 214:	ff 75 08             	push   0x8(%ebp)
+ 217:	e8 d6 00 00 00       	call   2f2 <open>
+  if(fd < 0)
+ 21c:	83 c4 10             	add    $0x10,%esp
+ 21f:	85 c0                	test   %eax,%eax
+ 221:	78 24                	js     247 <stat+0x3d>
+ 223:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 225:	83 ec 08             	sub    $0x8,%esp
+ 228:	ff 75 0c             	push   0xc(%ebp)
+ 22b:	50                   	push   %eax
+ 22c:	e8 d9 00 00 00       	call   30a <fstat>
+ 231:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 233:	89 1c 24             	mov    %ebx,(%esp)
+ 236:	e8 9f 00 00 00       	call   2da <close>
+  return r;
+ 23b:	83 c4 10             	add    $0x10,%esp
+}
+ 23e:	89 f0                	mov    %esi,%eax
+ 240:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 243:	5b                   	pop    %ebx
+ 244:	5e                   	pop    %esi
+ 245:	5d                   	pop    %ebp
+ 246:	c3                   	ret
+    return -1;
+ 247:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 24c:	eb f0                	jmp    23e <stat+0x34>
+
+0000024e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 24e:	55                   	push   %ebp
+ 24f:	89 e5                	mov    %esp,%ebp
+ 251:	53                   	push   %ebx
+ 252:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 255:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 25a:	eb 10                	jmp    26c <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 25c:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 25f:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 262:	83 c1 01             	add    $0x1,%ecx
+ 265:	0f be c0             	movsbl %al,%eax
+ 268:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 26c:	0f b6 01             	movzbl (%ecx),%eax
+ 26f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 272:	80 fb 09             	cmp    $0x9,%bl
+ 275:	76 e5                	jbe    25c <atoi+0xe>
+  return n;
+}
+ 277:	89 d0                	mov    %edx,%eax
+ 279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 27c:	c9                   	leave
+ 27d:	c3                   	ret
+
+0000027e <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 27e:	55                   	push   %ebp
+ 27f:	89 e5                	mov    %esp,%ebp
+ 281:	56                   	push   %esi
+ 282:	53                   	push   %ebx
+ 283:	8b 75 08             	mov    0x8(%ebp),%esi
+ 286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 289:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 28c:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	eb 0d                	jmp    29d <memmove+0x1f>
+    *dst++ = *src++;
+ 290:	0f b6 01             	movzbl (%ecx),%eax
+ 293:	88 02                	mov    %al,(%edx)
+ 295:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 298:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 29b:	89 d8                	mov    %ebx,%eax
+ 29d:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2a0:	85 c0                	test   %eax,%eax
+ 2a2:	7f ec                	jg     290 <memmove+0x12>
+  return vdst;
+}
+ 2a4:	89 f0                	mov    %esi,%eax
+ 2a6:	5b                   	pop    %ebx
+ 2a7:	5e                   	pop    %esi
+ 2a8:	5d                   	pop    %ebp
+ 2a9:	c3                   	ret
+
+000002aa <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2aa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+000002b2 <exit>:
+SYSCALL(exit)
+ 2b2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+000002ba <wait>:
+SYSCALL(wait)
+ 2ba:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+000002c2 <pipe>:
+SYSCALL(pipe)
+ 2c2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <read>:
+SYSCALL(read)
+ 2ca:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <write>:
+SYSCALL(write)
+ 2d2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <close>:
+SYSCALL(close)
+ 2da:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <kill>:
+SYSCALL(kill)
+ 2e2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <exec>:
+SYSCALL(exec)
+ 2ea:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <open>:
+SYSCALL(open)
+ 2f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <mknod>:
+SYSCALL(mknod)
+ 2fa:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <unlink>:
+SYSCALL(unlink)
+ 302:	b8 12 00 00 00       	mov    $0x12,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <fstat>:
+SYSCALL(fstat)
+ 30a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <link>:
+SYSCALL(link)
+ 312:	b8 13 00 00 00       	mov    $0x13,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <mkdir>:
+SYSCALL(mkdir)
+ 31a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <chdir>:
+SYSCALL(chdir)
+ 322:	b8 09 00 00 00       	mov    $0x9,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <dup>:
+SYSCALL(dup)
+ 32a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <getpid>:
+SYSCALL(getpid)
+ 332:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <sbrk>:
+SYSCALL(sbrk)
+ 33a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <sleep>:
+SYSCALL(sleep)
+ 342:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <uptime>:
+SYSCALL(uptime)
+ 34a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <setpri>:
+SYSCALL(setpri)
+ 352:	b8 16 00 00 00       	mov    $0x16,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <getpri>:
+SYSCALL(getpri)
+ 35a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <fork2>:
+SYSCALL(fork2)
+ 362:	b8 18 00 00 00       	mov    $0x18,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <getpinfo>:
+SYSCALL(getpinfo)
+ 36a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <mmap>:
+SYSCALL(mmap)
+ 372:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <munmap>:
+SYSCALL(munmap)
+ 37a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <shmat>:
+SYSCALL(shmat)
+ 382:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <shmdt>:
+SYSCALL(shmdt)
+ 38a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <getvmstat>:
+SYSCALL(getvmstat)
+ 392:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <getbstat>:
+SYSCALL(getbstat)
+ 39a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 3a2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <fsync>:
+SYSCALL(fsync)
+ 3aa:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <getdcstat>:
+SYSCALL(getdcstat)
+ 3b2:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <pread>:
+SYSCALL(pread)
+ 3ba:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <pwrite>:
+SYSCALL(pwrite)
+ 3c2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <readv>:
+SYSCALL(readv)
+ 3ca:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <writev>:
+SYSCALL(writev)
+ 3d2:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <sendfile>:
+SYSCALL(sendfile)
+ 3da:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <splice>:
+SYSCALL(splice)
+ 3e2:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3ea:	55                   	push   %ebp
+ 3eb:	89 e5                	mov    %esp,%ebp
+ 3ed:	83 ec 1c             	sub    $0x1c,%esp
+ 3f0:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3f8:	52                   	push   %edx
+ 3f9:	50                   	push   %eax
+ 3fa:	e8 d3 fe ff ff       	call   2d2 <write>
+}
+ 3ff:	83 c4 10             	add    $0x10,%esp
+ 402:	c9                   	leave
+ 403:	c3                   	ret
+
+00000404 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 404:	55                   	push   %ebp
+ 405:	89 e5                	mov    %esp,%ebp
+ 407:	57                   	push   %edi
+ 408:	56                   	push   %esi
+ 409:	53                   	push   %ebx
+ 40a:	83 ec 2c             	sub    $0x2c,%esp
+ 40d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 410:	89 d0                	mov    %edx,%eax
+ 412:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 414:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 418:	0f 95 c1             	setne  %cl
+ 41b:	c1 ea 1f             	shr    $0x1f,%edx
+ 41e:	84 d1                	test   %dl,%cl
+ 420:	74 44                	je     466 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 422:	f7 d8                	neg    %eax
+ 424:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 426:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 42d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 432:	89 c8                	mov    %ecx,%eax
+ 434:	ba 00 00 00 00       	mov    $0x0,%edx
+ 439:	f7 f6                	div    %esi
+ 43b:	89 df                	mov    %ebx,%edi
+ 43d:	83 c3 01             	add    $0x1,%ebx
+ 440:	0f b6 92 d4 07 00 00 	movzbl 0x7d4(%edx),%edx
+ 447:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 44b:	89 ca                	mov    %ecx,%edx
+ 44d:	89 c1                	mov    %eax,%ecx
+ 44f:	39 f2                	cmp    %esi,%edx
+ 451:	73 df                	jae    432 <printint+0x2e>
+  if(neg)
+ 453:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 457:	74 31                	je     48a <printint+0x86>
+    buf[i++] = '-';
+ 459:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 45e:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 461:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 464:	eb 17                	jmp    47d <printint+0x79>
+    x = xx;
+ 466:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 468:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 46f:	eb bc                	jmp    42d <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 471:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 476:	89 f0                	mov    %esi,%eax
+ 478:	e8 6d ff ff ff       	call   3ea <putc>
+  while(--i >= 0)
+ 47d:	83 eb 01             	sub    $0x1,%ebx
+ 480:	79 ef                	jns    471 <printint+0x6d>
+}
+ 482:	83 c4 2c             	add    $0x2c,%esp
+ 485:	5b                   	pop    %ebx
+ 486:	5e                   	pop    %esi
+ 487:	5f                   	pop    %edi
+ 488:	5d                   	pop    %ebp
+ 489:	c3                   	ret
+ 48a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 48d:	eb ee                	jmp    47d <printint+0x79>
+
+0000048f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 48f:	55                   	push   %ebp
+ 490:	89 e5                	mov    %esp,%ebp
+ 492:	57                   	push   %edi
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+ 495:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 498:	8d 45 10             	lea    0x10(%ebp),%eax
+ 49b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 49e:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 4a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4a8:	eb 14                	jmp    4be <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4aa:	89 fa                	mov    %edi,%edx
+ 4ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4af:	e8 36 ff ff ff       	call   3ea <putc>
+ 4b4:	eb 05                	jmp    4bb <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 4b6:	83 fe 25             	cmp    $0x25,%esi
+ 4b9:	74 25                	je     4e0 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 4bb:	83 c3 01             	add    $0x1,%ebx
+ 4be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c1:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4c5:	84 c0                	test   %al,%al
+ 4c7:	0f 84 20 01 00 00    	je     5ed <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 4cd:	0f be f8             	movsbl %al,%edi
+ 4d0:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4d3:	85 f6                	test   %esi,%esi
+ 4d5:	75 df                	jne    4b6 <printf+0x27>
+      if(c == '%'){
+ 4d7:	83 f8 25             	cmp    $0x25,%eax
+ 4da:	75 ce                	jne    4aa <printf+0x1b>
+        state = '%';
+ 4dc:	89 c6                	mov    %eax,%esi
+ 4de:	eb db                	jmp    4bb <printf+0x2c>
+      if(c == 'd'){
+ 4e0:	83 f8 25             	cmp    $0x25,%eax
+ 4e3:	0f 84 cf 00 00 00    	je     5b8 <printf+0x129>
+ 4e9:	0f 8c dd 00 00 00    	jl     5cc <printf+0x13d>
+ 4ef:	83 f8 78             	cmp    $0x78,%eax
+ 4f2:	0f 8f d4 00 00 00    	jg     5cc <printf+0x13d>
+ 4f8:	83 f8 63             	cmp    $0x63,%eax
+ 4fb:	0f 8c cb 00 00 00    	jl     5cc <printf+0x13d>
+ 501:	83 e8 63             	sub    $0x63,%eax
+ 504:	83 f8 15             	cmp    $0x15,%eax
+ 507:	0f 87 bf 00 00 00    	ja     5cc <printf+0x13d>
+ 50d:	ff 24 85 7c 07 00 00 	jmp    *0x77c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 514:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 517:	8b 17                	mov    (%edi),%edx
+ 519:	83 ec 0c             	sub    $0xc,%esp
+ 51c:	6a 01                	push   $0x1
+ 51e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	e8 d9 fe ff ff       	call   404 <printint>
+        ap++;
+ 52b:	83 c7 04             	add    $0x4,%edi
+ 52e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 531:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 534:	be 00 00 00 00       	mov    $0x0,%esi
+ 539:	eb 80                	jmp    4bb <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 53b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 53e:	8b 17                	mov    (%edi),%edx
+ 540:	83 ec 0c             	sub    $0xc,%esp
+ 543:	6a 00                	push   $0x0
+ 545:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 54a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54d:	e8 b2 fe ff ff       	call   404 <printint>
+        ap++;
+ 552:	83 c7 04             	add    $0x4,%edi
+ 555:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 558:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55b:	be 00 00 00 00       	mov    $0x0,%esi
+ 560:	e9 56 ff ff ff       	jmp    4bb <printf+0x2c>
+        s = (char*)*ap;
+ 565:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 568:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 56a:	83 c0 04             	add    $0x4,%eax
+ 56d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 570:	85 f6                	test   %esi,%esi
+ 572:	75 15                	jne    589 <printf+0xfa>
+          s = "(null)";
+ 574:	be 74 07 00 00       	mov    $0x774,%esi
+ 579:	eb 0e                	jmp    589 <printf+0xfa>
+          putc(fd, *s);
+ 57b:	0f be d2             	movsbl %dl,%edx
+ 57e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 581:	e8 64 fe ff ff       	call   3ea <putc>
+          s++;
+ 586:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 589:	0f b6 16             	movzbl (%esi),%edx
+ 58c:	84 d2                	test   %dl,%dl
+ 58e:	75 eb                	jne    57b <printf+0xec>
+      state = 0;
+ 590:	be 00 00 00 00       	mov    $0x0,%esi
+ 595:	e9 21 ff ff ff       	jmp    4bb <printf+0x2c>
+        putc(fd, *ap);
+ 59a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 59d:	0f be 17             	movsbl (%edi),%edx
+ 5a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a3:	e8 42 fe ff ff       	call   3ea <putc>
+        ap++;
+ 5a8:	83 c7 04             	add    $0x4,%edi
+ 5ab:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 5ae:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b3:	e9 03 ff ff ff       	jmp    4bb <printf+0x2c>
+        putc(fd, c);
+ 5b8:	89 fa                	mov    %edi,%edx
+ 5ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bd:	e8 28 fe ff ff       	call   3ea <putc>
+      state = 0;
+ 5c2:	be 00 00 00 00       	mov    $0x0,%esi
+ 5c7:	e9 ef fe ff ff       	jmp    4bb <printf+0x2c>
+        putc(fd, '%');
+ 5cc:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d4:	e8 11 fe ff ff       	call   3ea <putc>
+        putc(fd, c);
+ 5d9:	89 fa                	mov    %edi,%edx
+ 5db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5de:	e8 07 fe ff ff       	call   3ea <putc>
+      state = 0;
+ 5e3:	be 00 00 00 00       	mov    $0x0,%esi
+ 5e8:	e9 ce fe ff ff       	jmp    4bb <printf+0x2c>
+    }
+  }
+}
+ 5ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5f0:	5b                   	pop    %ebx
+ 5f1:	5e                   	pop    %esi
+ 5f2:	5f                   	pop    %edi
+ 5f3:	5d                   	pop    %ebp
+ 5f4:	c3                   	ret
+
+000005f5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5f5:	55                   	push   %ebp
+ 5f6:	89 e5                	mov    %esp,%ebp
+ 5f8:	57                   	push   %edi
+ 5f9:	56                   	push   %esi
+ 5fa:	53                   	push   %ebx
+ 5fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 601:	a1 c0 0c 00 00       	mov    0xcc0,%eax
+ 606:	eb 02                	jmp    60a <free+0x15>
+ 608:	89 d0                	mov    %edx,%eax
+ 60a:	39 c8                	cmp    %ecx,%eax
+ 60c:	73 04                	jae    612 <free+0x1d>
+ 60e:	3b 08                	cmp    (%eax),%ecx
+ 610:	72 12                	jb     624 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 612:	8b 10                	mov    (%eax),%edx
+ 614:	39 d0                	cmp    %edx,%eax
+ 616:	72 f0                	jb     608 <free+0x13>
+ 618:	39 c8                	cmp    %ecx,%eax
+ 61a:	72 08                	jb     624 <free+0x2f>
+ 61c:	39 d1                	cmp    %edx,%ecx
+ 61e:	72 04                	jb     624 <free+0x2f>
+ 620:	89 d0                	mov    %edx,%eax
+ 622:	eb e6                	jmp    60a <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 624:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 627:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 62a:	8b 10                	mov    (%eax),%edx
+ 62c:	39 d7                	cmp    %edx,%edi
+ 62e:	74 19                	je     649 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 630:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 633:	8b 50 04             	mov    0x4(%eax),%edx
+ 636:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 639:	39 ce                	cmp    %ecx,%esi
+ 63b:	74 1b                	je     658 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 63d:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 63f:	a3 c0 0c 00 00       	mov    %eax,0xcc0
+}
+ 644:	5b                   	pop    %ebx
+ 645:	5e                   	pop    %esi
+ 646:	5f                   	pop    %edi
+ 647:	5d                   	pop    %ebp
+ 648:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 649:	03 72 04             	add    0x4(%edx),%esi
+ 64c:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 64f:	8b 10                	mov    (%eax),%edx
+ 651:	8b 12                	mov    (%edx),%edx
+ 653:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 656:	eb db                	jmp    633 <free+0x3e>
+    p->s.size += bp->s.size;
+ 658:	03 53 fc             	add    -0x4(%ebx),%edx
+ 65b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 65e:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 661:	89 10                	mov    %edx,(%eax)
+ 663:	eb da                	jmp    63f <free+0x4a>
+
+00000665 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 665:	55                   	push   %ebp
+ 666:	89 e5                	mov    %esp,%ebp
+ 668:	53                   	push   %ebx
+ 669:	83 ec 04             	sub    $0x4,%esp
+ 66c:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 66e:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 673:	77 05                	ja     67a <morecore+0x15>
+    nu = 4096;
+ 675:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 67a:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 681:	83 ec 0c             	sub    $0xc,%esp
+ 684:	50                   	push   %eax
+ 685:	e8 b0 fc ff ff       	call   33a <sbrk>
+  if(p == (char*)-1)
+ 68a:	83 c4 10             	add    $0x10,%esp
+ 68d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 690:	74 1c                	je     6ae <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 692:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 695:	83 c0 08             	add    $0x8,%eax
+ 698:	83 ec 0c             	sub    $0xc,%esp
+ 69b:	50                   	push   %eax
+ 69c:	e8 54 ff ff ff       	call   5f5 <free>
+  return freep;
+ 6a1:	a1 c0 0c 00 00       	mov    0xcc0,%eax
+ 6a6:	83 c4 10             	add    $0x10,%esp
+}
+ 6a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6ac:	c9                   	leave
+ 6ad:	c3                   	ret
+    return 0;
+ 6ae:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6b3:	eb f4                	jmp    6a9 <morecore+0x44>
+
+000006b5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 6b5:	55                   	push   %ebp
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	53                   	push   %ebx
+ 6b9:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bf:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6c2:	c1 eb 03             	shr    $0x3,%ebx
+ 6c5:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6c8:	8b 0d c0 0c 00 00    	mov    0xcc0,%ecx
+ 6ce:	85 c9                	test   %ecx,%ecx
+ 6d0:	74 04                	je     6d6 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d2:	8b 01                	mov    (%ecx),%eax
+ 6d4:	eb 4a                	jmp    720 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6d6:	c7 05 c0 0c 00 00 c4 	movl   $0xcc4,0xcc0
+ 6dd:	0c 00 00 
+ 6e0:	c7 05 c4 0c 00 00 c4 	movl   $0xcc4,0xcc4
+ 6e7:	0c 00 00 
+    base.s.size = 0;
+ 6ea:	c7 05 c8 0c 00 00 00 	movl   $0x0,0xcc8
+ 6f1:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6f4:	b9 c4 0c 00 00       	mov    $0xcc4,%ecx
+ 6f9:	eb d7                	jmp    6d2 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6fb:	74 19                	je     716 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6fd:	29 da                	sub    %ebx,%edx
+ 6ff:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 702:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 705:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 708:	89 0d c0 0c 00 00    	mov    %ecx,0xcc0
+      return (void*)(p + 1);
+ 70e:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 714:	c9                   	leave
+ 715:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 716:	8b 10                	mov    (%eax),%edx
+ 718:	89 11                	mov    %edx,(%ecx)
+ 71a:	eb ec                	jmp    708 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 71c:	89 c1                	mov    %eax,%ecx
+ 71e:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 720:	8b 50 04             	mov    0x4(%eax),%edx
+ 723:	39 da                	cmp    %ebx,%edx
+ 725:	73 d4                	jae    6fb <malloc+0x46>
+    if(p == freep)
+ 727:	39 05 c0 0c 00 00    	cmp    %eax,0xcc0
+ 72d:	75 ed                	jne    71c <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 72f:	89 d8                	mov    %ebx,%eax
+ 731:	e8 2f ff ff ff       	call   665 <morecore>
+ 736:	85 c0                	test   %eax,%eax
+ 738:	75 e2                	jne    71c <malloc+0x67>
+ 73a:	eb d5                	jmp    711 <malloc+0x5c>
@@ -0,0 +1,218 @@
+// Directory entry cache.
+//
+// The dcache remembers the results of dirlookup(): which inode
+// a name in a directory refers to, and where its entry is, or
+// that the directory has no such name (a negative entry), so
+// that namex() can resolve hot paths without locking each
+// directory and reading its blocks.
+//
+// Interface:
+// * dclookup looks a name up.
+// * dcenter records what dirlookup found, or that it found
+//   nothing.
+// * dirlink and dirunlink update the cache as they change a
+//   directory; when a directory's entries move (see dxsplit)
+//   or it is freed, dcpurge drops all of its names.
+//
+// Entries are keyed by (dev, directory inum, name) and only
+// change while the directory is locked, so a hit seen under
+// the directory's lock is exact.  namex() also uses hits
+// without the lock; that is no different from having looked
+// the name up just before a concurrent link or unlink.  To
+// keep the inode from being freed before namex() gets to it,
+// dclookup takes the reference itself, under dcache.lock:
+// unlink drops the name from the cache before the link count.
+//
+// There are NDENTRY entries on NDHASH hash chains, recycled
+// least recently used first.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "dcstat.h"
+
+struct dentry {
+  uint dev;
+  uint dir;             // inum of the directory, 0 if unused
+  char name[DIRSIZ];
+  uint inum;            // 0 for a negative entry
+  uint off;             // offset of the entry in dir
+  struct dentry *hnext; // hash chain
+  struct dentry *prev;  // LRU list
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry dentry[NDENTRY];
+  struct dentry *hash[NDHASH];
+
+  // All entries, through prev/next.
+  // head.next is least recently used.
+  struct dentry head;
+
+  struct dcstat stat;
+} dcache;
+
+void
+dcinit(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.head.prev = &dcache.head;
+  dcache.head.next = &dcache.head;
+  for(d = dcache.dentry; d < dcache.dentry+NDENTRY; d++){
+    d->next = dcache.head.next;
+    d->prev = &dcache.head;
+    dcache.head.next->prev = d;
+    dcache.head.next = d;
+  }
+}
+
+static struct dentry**
+dchash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return &dcache.hash[h % NDHASH];
+}
+
+// Find the entry for name in dir.
+// Caller must hold dcache.lock.
+static struct dentry*
+dcfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = *dchash(dev, dir, name); d; d = d->hnext)
+    if(d->dev == dev && d->dir == dir && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Move d to the recently used end of the LRU list.
+// Caller must hold dcache.lock.
+static void
+dctouch(struct dentry *d)
+{
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = &dcache.head;
+  d->prev = dcache.head.prev;
+  dcache.head.prev->next = d;
+  dcache.head.prev = d;
+}
+
+// Take d off its hash chain and make it unused, moving it
+// to the least recently used end to be taken first.
+// Caller must hold dcache.lock.
+static void
+dcdrop(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = dchash(d->dev, d->dir, d->name); *pp; pp = &(*pp)->hnext){
+    if(*pp == d){
+      *pp = d->hnext;
+      break;
+    }
+  }
+  d->dir = 0;
+  dcache.stat.nentry--;
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.head.next;
+  d->prev = &dcache.head;
+  dcache.head.next->prev = d;
+  dcache.head.next = d;
+}
+
+// Look up name in directory dir of dev.  Returns 1 and sets
+// *ipp to a referenced, unlocked inode, and *off (if not 0),
+// if it is there; 0 if it is known not to be; and -1 if the
+// cache does not know.
+int
+dclookup(uint dev, uint dir, char *name, struct inode **ipp, uint *off)
+{
+  struct dentry *d;
+  uint inum;
+  int r;
+
+  acquire(&dcache.lock);
+  inum = 0;
+  if((d = dcfind(dev, dir, name)) == 0){
+    dcache.stat.misses++;
+    r = -1;
+  } else if(d->inum == 0){
+    dcache.stat.neghits++;
+    dctouch(d);
+    r = 0;
+  } else {
+    dcache.stat.hits++;
+    inum = d->inum;
+    if(off)
+      *off = d->off;
+    dctouch(d);
+    r = 1;
+  }
+  release(&dcache.lock);
+  // iget() may sleep.  The caller holds dir locked, so the
+  // entry cannot change meanwhile.
+  if(r == 1)
+    *ipp = iget(dev, inum);
+  return r;
+}
+
+// Record that name in dir refers to inum, with its entry at
+// off; or, if inum is 0, that dir has no such name.
+void
+dcenter(uint dev, uint dir, char *name, uint inum, uint off)
+{
+  struct dentry *d, **hp;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dev, dir, name)) == 0){
+    d = dcache.head.next;
+    if(d->dir)
+      dcdrop(d);
+    d->dev = dev;
+    d->dir = dir;
+    strncpy(d->name, name, DIRSIZ);
+    hp = dchash(dev, dir, name);
+    d->hnext = *hp;
+    *hp = d;
+    dcache.stat.nentry++;
+  }
+  d->inum = inum;
+  d->off = off;
+  dctouch(d);
+  release(&dcache.lock);
+}
+
+// Forget every name in directory dir.
+void
+dcpurge(uint dev, uint dir)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.dentry; d < dcache.dentry+NDENTRY; d++)
+    if(d->dir == dir && d->dev == dev)
+      dcdrop(d);
+  release(&dcache.lock);
+}
+
+void
+getdcstat(struct dcstat *st)
+{
+  acquire(&dcache.lock);
+  *st = dcache.stat;
+  release(&dcache.lock);
+}
@@ -0,0 +1,9 @@
+// Directory entry cache statistics, returned by getdcstat().
+// Both the kernel and user programs use this header file.
+
+struct dcstat {
+  uint nentry;   // entries in use
+  uint hits;     // lookups that found the name
+  uint neghits;  // lookups that found the name known to be absent
+  uint misses;   // lookups the cache could not answer
+};
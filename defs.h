@@ -1,21 +1,39 @@
+struct bstat;
+struct diskstat;
+struct dcstat;
+struct pcidev;
 struct buf;
 struct context;
 struct file;
 struct inode;
+struct iovec;
+struct page;
 struct pipe;
 struct proc;
+struct shm;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
 struct pstat;
+struct vma;
+struct vmstat;
 
 // bio.c
+extern uint     bsize;
 void            binit(void);
+void            bsetsize(uint);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            breadahead(uint, uint);
+void            breaddone(struct buf*);
+void            bpin(struct buf*);
+void            bunpin(struct buf*);
+int             breclaim(void);
+void            getbstat(struct bstat*);
+void            getdiskstat(struct diskstat*);
 
 // console.c
 void            consoleinit(void);
@@ -23,25 +41,46 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// dcache.c
+void            dcinit(void);
+int             dclookup(uint, uint, char*, struct inode**, uint*);
+void            dcenter(uint, uint, char*, uint, uint);
+void            dcpurge(uint, uint);
+void            getdcstat(struct dcstat*);
+
 // exec.c
 int             exec(char*, char**);
 
 // file.c
 struct file*    filealloc(void);
 void            fileclose(struct file*);
+int             fdgrow(struct proc*);
+void            fdfreetab(struct proc*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filepread(struct file*, char*, int n, uint);
+int             filereadv(struct file*, struct iovec*, int);
+int             filesplice(struct file*, uint*, struct file*, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritei(struct inode*, char*, uint*, int n);
+int             filepwrite(struct file*, char*, int n, uint);
+int             filewritev(struct file*, struct iovec*, int);
+void            fileflush(struct inode*);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+uint            bmap(struct inode*, uint);
+void            bsuminit(int dev);
 int             dirlink(struct inode*, char*, uint);
+void            dirunlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+struct inode*   iget(uint, uint);
 void            iinit(int dev);
+int             ireclaim(void);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
@@ -58,6 +97,8 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idesubmit(struct buf*);
+void            idegetstat(struct diskstat*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -67,6 +108,12 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+int             kfreepages(void);
+char*           kallocsuper(void);
+void            kfreesuper(char*);
+void            krefsuper(char*);
+void            kref(char*);
+int             krefcount(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -85,9 +132,25 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_sync(void);
+void            log_writedata(struct buf*);
+void            log_free(uint);
 void            begin_op();
+void            begin_opn(int);
+int             log_maxop(void);
 void            end_op();
 
+// mmap.c
+int             mmap(uint, int, int, struct file*, uint);
+int             munmap(uint, uint);
+struct vma*     vmaalloc(struct proc*, uint, uint);
+uint            vmaend(struct proc*, uint);
+struct vma*     vmafind(struct proc*, uint);
+int             vmacheck(struct proc*, uint, uint, int);
+int             vmafault(struct proc*, uint, int);
+int             vmafork(struct proc*, struct proc*);
+void            vmaunmapall(struct proc*);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
@@ -96,16 +159,41 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pagecache.c
+void            pcinit(void);
+struct page*    pcget(struct inode*, uint);
+void            pcput(struct page*);
+int             pccached(uint, uint, uint);
+void            pcwrite(struct inode*, char*, uint, uint);
+void            pcinval(uint, uint);
+int             pcreclaim(void);
+int             pcdelay(struct inode*, char*, uint, uint);
+void            pcclean(struct inode*, uint);
+void            flusherinit(void);
+
+// memide.c
+void            memideinit(void);
+
+// pci.c
+int             pcifind(int, int, struct pcidev*);
+int             pcifindclass(int, int, struct pcidev*);
+void            pcienable(struct pcidev*, int);
+uint            pciiobase(struct pcidev*, int);
+uint            pciread(struct pcidev*, int);
+void            pciwrite(struct pcidev*, int, uint);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
+int             pipereadv(struct pipe*, struct iovec*, int);
 int             pipewrite(struct pipe*, char*, int);
 
 // proc.c
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             kthread(char*, void(*)(void));
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
@@ -124,10 +212,27 @@ int		setpri(int, int);
 int		getpri(int);
 int		fork2(int);
 int		getpinfo(struct pstat*);
+int             swapvictim(char*, uint);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// shm.c
+void            shminit(void);
+int             shmat(char*, int);
+int             shmanon(int, int);
+int             shmdt(uint);
+void            shmdup(struct shm*);
+void            shmclose(struct shm*);
+
+// swap.c
+void            swapinit(int);
+int             swapout(void);
+void            swapread(uint, char*);
+void            swapfree(uint);
+char*           kallocswap(void);
+void            getvmstat(struct vmstat*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
@@ -155,6 +260,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argroptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -174,6 +280,10 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// virtio.c
+void            virtioinit(void);
+void            virtiointr(void);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -188,7 +298,12 @@ pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
+int             copysuper(pde_t*, pde_t*, uint, int);
 void            clearpteu(pde_t *pgdir, char *uva);
+pte_t*          walkpgdir(pde_t*, const void*, int);
+int             mappages(pde_t*, void*, uint, uint, int);
+int             pagefault(uint, uint);
+int             uvmcheck(uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,12 @@
+// Disk request queue statistics, returned by getdiskstat().
+// Both the kernel and user programs use this header file.
+
+struct diskstat {
+  uint reqs;       // requests finished
+  uint writes;     // of which wrote to the disk
+  uint cmds;       // disk commands issued
+  uint merged;     // requests that shared a command with the one before
+  uint depth;      // requests queued now
+  uint maxdepth;   // most requests ever queued at once
+  uint waitticks;  // total ticks from queueing to finishing, over all reqs
+};
@@ -1,19 +1,50 @@
 //
 // File descriptors
 //
+// File structures come from slabs: kalloc()'d pages, each
+// holding a header and FPS structures, with the free ones on
+// a list in the header.  filealloc() takes one from the first
+// slab that has any, adding a slab if none does; fileclose()
+// puts it back on its own slab's list (found by rounding its
+// address down to the page) and gives the page back once the
+// slab is unused, unless it is the only one.  Slabs with free
+// structures are kept at the front of the list.  At most NFILE
+// files are open at once.
+//
+// Each process's descriptor table starts as the NOFILE slots
+// in its struct proc and is moved to a page of NOFILEMAX slots
+// the first time it fills (see fdgrow).  A bitmap of the slots
+// in use, p->fdmap, lets fdalloc() find the lowest free one a
+// word at a time.
+//
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "proc.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
+#include "page.h"
+
+struct fslab {
+  struct fslab *next;
+  int nused;
+  struct file *free;  // through f->next
+  struct file file[];
+};
+
+#define FPS ((PGSIZE - sizeof(struct fslab)) / sizeof(struct file))
 
 struct devsw devsw[NDEV];
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
+  struct fslab *slab;  // list of slabs, those with free files first
+  int nfile;           // files in use
 } ftable;
 
 void
@@ -22,24 +53,87 @@ fileinit(void)
   initlock(&ftable.lock, "ftable");
 }
 
+// Add an empty slab at the front of the list.
+// Caller must hold ftable.lock.
+static struct fslab*
+fslaballoc(void)
+{
+  struct fslab *s;
+  struct file *f;
+
+  if((s = (struct fslab*)kalloc()) == 0)
+    return 0;
+  memset(s, 0, PGSIZE);
+  for(f = s->file + FPS - 1; f >= s->file; f--){
+    f->next = s->free;
+    s->free = f;
+  }
+  s->next = ftable.slab;
+  ftable.slab = s;
+  return s;
+}
+
 // Allocate a file structure.
 struct file*
 filealloc(void)
 {
+  struct fslab *s, **ps;
   struct file *f;
 
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
+  if(ftable.nfile >= NFILE)
+    goto bad;
+  s = ftable.slab;
+  if((s == 0 || s->free == 0) && (s = fslaballoc()) == 0)
+    goto bad;
+  f = s->free;
+  s->free = f->next;
+  s->nused++;
+  ftable.nfile++;
+  if(s->free == 0 && s->next && s->next->free){
+    // Full: move it behind the slabs that have room.
+    ftable.slab = s->next;
+    for(ps = &ftable.slab; *ps && (*ps)->free; ps = &(*ps)->next)
+      ;
+    s->next = *ps;
+    *ps = s;
   }
+  f->ref = 1;
+  release(&ftable.lock);
+  return f;
+
+bad:
   release(&ftable.lock);
   return 0;
 }
 
+// Return f to its slab.
+// Caller must hold ftable.lock.
+static void
+filefree(struct file *f)
+{
+  struct fslab *s, **ps;
+  int wasfull;
+
+  s = (struct fslab*)PGROUNDDOWN((uint)f);
+  wasfull = s->free == 0;
+  f->next = s->free;
+  s->free = f;
+  s->nused--;
+  ftable.nfile--;
+  if(wasfull || (s->nused == 0 && ftable.slab->next)){
+    for(ps = &ftable.slab; *ps != s; ps = &(*ps)->next)
+      ;
+    *ps = s->next;
+    if(s->nused == 0 && ftable.slab){
+      kfree((char*)s);
+      return;
+    }
+    s->next = ftable.slab;
+    ftable.slab = s;
+  }
+}
+
 // Increment ref count for file f.
 struct file*
 filedup(struct file *f)
@@ -68,6 +162,7 @@ fileclose(struct file *f)
   ff = *f;
   f->ref = 0;
   f->type = FD_NONE;
+  filefree(f);
   release(&ftable.lock);
 
   if(ff.type == FD_PIPE)
@@ -112,45 +207,367 @@ fileread(struct file *f, char *addr, int n)
   panic("fileread");
 }
 
-// Write to file f.
+// Read from file f at offset off, leaving f->off alone.
 int
-filewrite(struct file *f, char *addr, int n)
+filepread(struct file *f, char *addr, int n, uint off)
 {
   int r;
 
-  if(f->writable == 0)
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  r = readi(f->ip, addr, off, n);
+  iunlock(f->ip);
+  return r;
+}
+
+// Read from file f into each of the iovcnt buffers of iov in
+// turn, stopping at the first short read.  An inode is locked
+// once for all of them; a pipe only waits for the first byte
+// (see pipereadv).
+int
+filereadv(struct file *f, struct iovec *iov, int iovcnt)
+{
+  int i, r, tot;
+
+  if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
+    return pipereadv(f->pipe, iov, iovcnt);
+  tot = 0;
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
+    ilock(f->ip);
+    for(i = 0; i < iovcnt; i++){
+      if((r = readi(f->ip, iov[i].base, f->off, iov[i].len)) < 0){
+        if(tot == 0)
+          tot = -1;
+        break;
+      }
+      f->off += r;
+      tot += r;
+      if(r < iov[i].len)
+        break;
+    }
+    iunlock(f->ip);
+    return tot;
+  }
+  panic("filereadv");
+}
+
+// Write the iovcnt buffers of iov, one after another, to ip
+// at offset *off, advancing *off past each piece as it is
+// written.  Returns the total length, or -1 on error.
+static int
+filewriteiov(struct inode *ip, struct iovec *iov, int iovcnt, uint *off)
+{
+  int r, n, n1, i, k, m, flush;
+  uint voff;
+
+  // write as many blocks at a time as one system call may
+  // put in the log, reserving room for them plus the
+  // i-node, the extent blocks along the right edge of the
+  // extent tree and a new chain of them, two allocation
+  // bitmap blocks, and 1 block of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  // A transaction may take pieces of several buffers.
+  int slop = 4 + 2*MAXDEPTH + 1;
+  int max = (log_maxop() - slop) * bsize;
+
+  n = 0;
+  for(i = 0; i < iovcnt; i++)
+    n += iov[i].len;
+  i = 0;      // next byte of the whole write
 
-      if(r < 0)
+  // Appends to a regular file only go into the page cache,
+  // to be written back later (see pcdelay).  A write that
+  // starts before the end of the file on disk and reaches
+  // past it must wait for the delayed data to go first, as
+  // must what pcdelay has no room for.
+  flush = 0;
+  ilock(ip);
+  if(ip->type == T_FILE && *off <= ip->size && *off + n >= *off){
+    if(*off >= ip->dsize){
+      for(k = 0; k < iovcnt && i < n; k++){
+        r = pcdelay(ip, iov[k].base, *off, iov[k].len);
+        *off += r;
+        i += r;
+        if(r != iov[k].len)
+          break;
+      }
+      flush = i < n;
+    } else
+      flush = *off + n > ip->dsize && ip->size > ip->dsize;
+  }
+  iunlock(ip);
+  if(flush)
+    fileflush(ip);
+  if(i == n)
+    return n;
+  for(voff = i; voff > 0 && voff >= iov->len; iov++)
+    voff -= iov->len;   // skip what pcdelay took
+
+  r = 0;
+  while(i < n){
+    n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_opn((n1 + bsize - 1) / bsize + slop);
+    ilock(ip);
+    if(*off > ip->dsize && *off <= ip->size){
+      // Another writer delayed an append since the flush above.
+      iunlock(ip);
+      end_op();
+      fileflush(ip);
+      continue;
+    }
+    for(k = 0; k < n1; k += m){
+      while(voff == iov->len){
+        iov++;
+        voff = 0;
+      }
+      m = iov->len - voff;
+      if(m > n1 - k)
+        m = n1 - k;
+      if((r = writei(ip, (char*)iov->base + voff, *off, m)) > 0)
+        *off += r;
+      if(r != m)
         break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+      voff += m;
+    }
+    iunlock(ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    if(k != n1)
+      panic("short filewrite");
+    i += n1;
+  }
+  return i == n ? n : -1;
+}
+
+// Write ip's delayed appends (see pcdelay) to disk, as many
+// blocks at a time as the log allows.
+void
+fileflush(struct inode *ip)
+{
+  struct page *pg;
+  uint off, end, m;
+  int slop = 4 + 2*MAXDEPTH + 1;  // as in filewriteiov
+  int max = (log_maxop() - slop) * bsize;
+
+  for(;;){
+    begin_opn(log_maxop());
+    ilock(ip);
+    if(ip->dsize == ip->size){
+      iunlock(ip);
+      end_op();
+      return;
     }
-    return i == n ? n : -1;
+    end = ip->size;
+    if(end - ip->dsize > max)
+      end = ip->dsize + max;
+    while((off = ip->dsize) < end){
+      m = end - off;
+      if(m > PGSIZE - off%PGSIZE)
+        m = PGSIZE - off%PGSIZE;
+      // Dirty pages stay cached, so this finds the data.
+      if((pg = pcget(ip, off/PGSIZE)) == 0)
+        panic("fileflush");
+      if(writei(ip, pg->data + off%PGSIZE, off, m) != m)
+        panic("fileflush: writei");
+      pcput(pg);
+    }
+    iunlock(ip);
+    end_op();
   }
+}
+
+// Write n bytes from addr to ip at offset *off,
+// advancing *off past each piece as it is written.
+// Returns n, or -1 on error.
+int
+filewritei(struct inode *ip, char *addr, uint *off, int n)
+{
+  struct iovec iov;
+
+  iov.base = addr;
+  iov.len = n;
+  return filewriteiov(ip, &iov, 1, off);
+}
+
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+  if(f->writable == 0)
+    return -1;
+  if(f->type == FD_PIPE)
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+    return filewritei(f->ip, addr, &f->off, n);
   panic("filewrite");
 }
 
+// Write to file f at offset off, leaving f->off alone.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  return filewritei(f->ip, addr, &off, n);
+}
+
+// Write the iovcnt buffers of iov to file f, in as few
+// transactions as the log allows.
+int
+filewritev(struct file *f, struct iovec *iov, int iovcnt)
+{
+  int i, r, tot;
+
+  if(f->writable == 0)
+    return -1;
+  if(f->type == FD_PIPE){
+    tot = 0;
+    for(i = 0; i < iovcnt; i++){
+      if((r = pipewrite(f->pipe, iov[i].base, iov[i].len)) < 0)
+        return -1;
+      tot += r;
+    }
+    return tot;
+  }
+  if(f->type == FD_INODE)
+    return filewriteiov(f->ip, iov, iovcnt, &f->off);
+  panic("filewritev");
+}
+
+
+// Copy up to n bytes from in to out inside the kernel.
+// A file (which in must be, if it is not a pipe) is read at
+// *inoff, which is advanced, straight out of its page-cache
+// pages; a pipe is read into a page of the kernel's, once, as
+// read() would.  Either is written to out, a pipe or an inode,
+// from there.  Returns the number of bytes copied, or -1 if
+// nothing could be.
+int
+filesplice(struct file *in, uint *inoff, struct file *out, int n)
+{
+  struct inode *ip;
+  struct page *pg;
+  char *bounce, *src;
+  uint off;
+  int tot, m, r, err;
+
+  if(!in->readable || !out->writable || n < 0 || in == out)
+    return -1;
+  if(out->type != FD_PIPE && out->type != FD_INODE)
+    return -1;
+  ip = in->ip;
+  if(in->type == FD_INODE){
+    ilock(ip);
+    r = ip->type;
+    iunlock(ip);
+    if(r != T_FILE)
+      return -1;
+  } else if(in->type != FD_PIPE)
+    return -1;
+
+  bounce = 0;
+  err = 0;
+  tot = 0;
+  while(tot < n){
+    m = n - tot;
+    pg = 0;
+    if(in->type == FD_PIPE){
+      if(bounce == 0 && (bounce = kalloc()) == 0){
+        err = 1;
+        break;
+      }
+      if(m > PGSIZE)
+        m = PGSIZE;
+      if((m = piperead(in->pipe, bounce, m)) <= 0){
+        err = m < 0;
+        break;
+      }
+      src = bounce;
+    } else {
+      // Hold the page, not the inode, while writing it out,
+      // so that out may be the same file.
+      off = *inoff;
+      ilock(ip);
+      if(off >= ip->size){
+        iunlock(ip);
+        break;
+      }
+      if(m > ip->size - off)
+        m = ip->size - off;
+      if(m > PGSIZE - off%PGSIZE)
+        m = PGSIZE - off%PGSIZE;
+      if((pg = pcget(ip, off/PGSIZE)) != 0)
+        src = pg->data + off%PGSIZE;
+      else {
+        // No memory for the page cache; try a page of our own.
+        if(bounce == 0)
+          bounce = kalloc();
+        if((src = bounce) != 0)
+          readi(ip, bounce, off, m);
+      }
+      iunlock(ip);
+      if(src == 0){
+        err = 1;
+        break;
+      }
+    }
+
+    if(out->type == FD_PIPE)
+      r = pipewrite(out->pipe, src, m);
+    else
+      r = filewritei(out->ip, src, &out->off, m);
+    if(pg)
+      pcput(pg);
+    if(r != m){
+      err = 1;
+      break;
+    }
+    tot += m;
+    if(in->type == FD_PIPE)
+      break;  // as much as one read() would return
+    *inoff += m;
+  }
+  if(bounce)
+    kfree(bounce);
+  return tot == 0 && err ? -1 : tot;
+}
+
+// Move p's descriptor table to a page of NOFILEMAX slots.
+// Returns 0, or -1 if it is already there or there is no
+// memory for it.
+int
+fdgrow(struct proc *p)
+{
+  struct file **ofile;
+
+  if(p->nofile >= NOFILEMAX || NOFILEMAX*sizeof(ofile[0]) > PGSIZE)
+    return -1;
+  if((ofile = (struct file**)kalloc()) == 0)
+    return -1;
+  memset(ofile, 0, PGSIZE);
+  memmove(ofile, p->ofile, p->nofile*sizeof(ofile[0]));
+  p->ofile = ofile;
+  p->nofile = NOFILEMAX;
+  return 0;
+}
+
+// Give back p's grown descriptor table, which must be empty,
+// returning it to its first NOFILE slots.
+void
+fdfreetab(struct proc *p)
+{
+  if(p->ofile != p->ofile0)
+    kfree((char*)p->ofile);
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
+  memset(p->fdmap, 0, sizeof(p->fdmap));
+}
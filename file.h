@@ -6,6 +6,7 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  struct file *next;  // free list of its slab (see file.c)
 };
 
 
@@ -14,6 +15,11 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext;   // icache hash chain
+  struct inode *prev;    // icache LRU list
+  struct inode *next;
+  struct inode *wbnext;  // write-back list (see pcdelay)
+  int wbqueued;          // on it; protected by its lock
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +28,14 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint dsize;         // size on disk; the rest is in dirty cached pages
+  ushort depth;
+  ushort nextent;
+  struct extent ext[NEXTENT];
+
+  uint raoff;         // where the last read ended (see readahead)
+  uint rawin;         // read-ahead window, in blocks
+  uint rablock;       // first block not yet read ahead
 };
 
 // table mapping major device number to
@@ -20,6 +20,7 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "page.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
@@ -27,52 +28,198 @@ static void itrunc(struct inode*);
 // only one device
 struct superblock sb; 
 
-// Read the super block.
+// Read the super block, from the second sector of the disk.
 void
 readsb(int dev, struct superblock *sb)
 {
   struct buf *bp;
 
-  bp = bread(dev, 1);
-  memmove(sb, bp->data, sizeof(*sb));
+  bp = bread(dev, SECTSIZE/bsize);
+  memmove(sb, bp->data + SECTSIZE%bsize, sizeof(*sb));
   brelse(bp);
 }
 
-// Zero a block.
+// Zero a block.  If it will hold file data it is
+// not journaled (see log_writedata).
 static void
-bzero(int dev, int bno)
+bzero(int dev, int bno, int data)
 {
   struct buf *bp;
 
   bp = bread(dev, bno);
-  memset(bp->data, 0, BSIZE);
-  log_write(bp);
+  memset(bp->data, 0, bsize);
+  if(data)
+    log_writedata(bp);
+  else
+    log_write(bp);
   brelse(bp);
 }
 
 // Blocks.
+//
+// balloc keeps an in-memory summary of the free map (bsum):
+// how many blocks each bitmap block has free, so that full
+// ones are skipped without being read, and a next-fit cursor
+// where allocations with no goal start, so that they do not
+// rescan the front of the disk each time.  Both are built by
+// bsuminit when the file system is mounted, once the log has
+// been recovered.
+//
+// A file being appended to also reserves the RSVBLOCKS blocks
+// after its last one (see brsv): other files' allocations pass
+// over them while any free block is left elsewhere, so that
+// files written at the same time do not interleave.
+// Reservations are only kept in memory, and are dropped when
+// the file's last reference goes away.
+
+struct rsv {
+  struct inode *ip;  // 0 if unused
+  uint start;        // reserved blocks [start, start+RSVBLOCKS)
+};
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+struct {
+  struct spinlock lock;
+  ushort *nfree;   // free blocks per bitmap block
+  uint cursor;     // next-fit start for allocations with no goal
+  struct rsv rsv[NINODEMAX];  // one per cached inode, at most
+  int nrsv;        // rsv[nrsv..] are unused
+} bsum;
+
+// Count the free blocks of each bitmap block.
+void
+bsuminit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi, n;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
+  initlock(&bsum.lock, "bsum");
+  n = (sb.size + BPB(sb) - 1)/BPB(sb);
+  if(n*sizeof(bsum.nfree[0]) > PGSIZE || (bsum.nfree = (ushort*)kalloc()) == 0)
+    panic("bsuminit");
+  for(b = 0; b < sb.size; b += BPB(sb)){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
+    n = 0;
+    for(bi = 0; bi < BPB(sb) && b + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        n++;
+    bsum.nfree[b/BPB(sb)] = n;
+    brelse(bp);
+  }
+  bsum.cursor = sb.bmapstart;
+}
+
+// Is block b reserved by a file other than ip?
+// Caller must hold bsum.lock.
+static int
+breserved(uint b, struct inode *ip)
+{
+  struct rsv *r;
+
+  for(r = bsum.rsv; r < &bsum.rsv[bsum.nrsv]; r++)
+    if(r->ip && r->ip != ip && b >= r->start && b < r->start + RSVBLOCKS)
+      return 1;
+  return 0;
+}
+
+// Reserve the blocks after b, just added to the end of ip,
+// in place of what ip had reserved before.
+static void
+brsv(struct inode *ip, uint b)
+{
+  struct rsv *r, *empty;
+
+  acquire(&bsum.lock);
+  empty = 0;
+  for(r = bsum.rsv; r < &bsum.rsv[bsum.nrsv]; r++){
+    if(r->ip == ip)
+      break;
+    if(empty == 0 && r->ip == 0)
+      empty = r;
+  }
+  if(r == &bsum.rsv[bsum.nrsv]){
+    r = empty;
+    if(r == 0 && bsum.nrsv < NINODEMAX)
+      r = &bsum.rsv[bsum.nrsv++];
+  }
+  if(r){
+    r->ip = ip;
+    r->start = b + 1;
+  }
+  release(&bsum.lock);
+}
+
+// Drop ip's reservation, if it has one.
+static void
+brsvdrop(struct inode *ip)
+{
+  struct rsv *r;
+
+  acquire(&bsum.lock);
+  for(r = bsum.rsv; r < &bsum.rsv[bsum.nrsv]; r++)
+    if(r->ip == ip)
+      r->ip = 0;
+  while(bsum.nrsv > 0 && bsum.rsv[bsum.nrsv-1].ip == 0)
+    bsum.nrsv--;
+  release(&bsum.lock);
+}
+
+// Allocate a zeroed disk block for ip (0 for none), for file
+// data if data is set.  Takes the first free block at or
+// after goal, wrapping around, so that a file grown one block
+// at a time can ask for the block after its last and stay
+// contiguous.  With no goal, starts at the next-fit cursor.
+// Blocks other files have reserved are only taken when there
+// are no others.
+static uint
+balloc(uint dev, int data, uint goal, struct inode *ip)
+{
+  int b, bi, m, k, any, nextfit, nfree, taken;
+  struct buf *bp;
+
+  acquire(&bsum.lock);
+  nextfit = goal == 0 || goal >= sb.size;
+  if(nextfit)
+    goal = bsum.cursor;
+  release(&bsum.lock);
+
+  for(any = 0; any < 2; any++){
+    b = goal - goal%BPB(sb);
+    bi = goal%BPB(sb);
+    // Each bitmap block once, and the first again for the
+    // bits before goal.
+    for(k = 0; k <= (sb.size + BPB(sb) - 1)/BPB(sb); k++){
+      acquire(&bsum.lock);
+      nfree = bsum.nfree[b/BPB(sb)];
+      release(&bsum.lock);
+      if(nfree > 0){
+        bp = bread(dev, BBLOCK(b, sb));
+        for(; bi < BPB(sb) && b + bi < sb.size; bi++){
+          m = 1 << (bi % 8);
+          if((bp->data[bi/8] & m) != 0)  // Is block free?
+            continue;
+          acquire(&bsum.lock);
+          taken = any || !breserved(b + bi, ip);
+          if(taken){
+            bsum.nfree[b/BPB(sb)]--;
+            if(nextfit)
+              bsum.cursor = b + bi + 1;
+          }
+          release(&bsum.lock);
+          if(taken){
+            bp->data[bi/8] |= m;  // Mark block in use.
+            log_write(bp);
+            brelse(bp);
+            bzero(dev, b + bi, data);
+            return b + bi;
+          }
+        }
         brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
       }
+      bi = 0;
+      b += BPB(sb);
+      if(b >= sb.size)
+        b = 0;
     }
-    brelse(bp);
   }
   panic("balloc: out of blocks");
 }
@@ -86,13 +233,17 @@ bfree(int dev, uint b)
 
   readsb(dev, &sb);
   bp = bread(dev, BBLOCK(b, sb));
-  bi = b % BPB;
+  bi = b % BPB(sb);
   m = 1 << (bi % 8);
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  acquire(&bsum.lock);
+  bsum.nfree[b/BPB(sb)]++;
+  release(&bsum.lock);
+  log_free(b);
 }
 
 // Inodes.
@@ -120,18 +271,18 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, and iput() frees if
 //   the reference and link counts have fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() finds or
-//   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to the entry (open files and current
+//   directories). iget() finds or creates a cache entry and
+//   increments its ref; iput() decrements ref.  An entry whose
+//   ref is zero stays cached, still valid, until iget()
+//   recycles it for another inode, least recently used first.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid when it frees the inode.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,39 +306,96 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The icache is a hash table, like the buffer cache (see
+// bio.c).  Each hash bucket has a lock protecting its chain
+// and the ref, dev and inum of the inodes on it, so iget() of
+// a cached inode, idup() and iput() take only their bucket's
+// lock.  icache.lock serializes misses, which recycle or add
+// entries, and protects the LRU list.  Lock order is
+// icache.lock, then a bucket lock.
+//
+// The cache starts with NINODE entries and grows by a page of
+// IPG entries at a time, up to NINODEMAX, when every entry is
+// in use.  NINODEMAX covers every open file and each process's
+// working directory and lookups, so iget() only has to wait
+// for an iput() if memory and swap are both exhausted.
+// ireclaim() gives back groups whose entries are all
+// unreferenced when kallocswap() runs short.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
-// dev, and inum.  One must hold ip->lock in order to
+// dev, inum and the cache links.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define IPG (PGSIZE / sizeof(struct inode))  // inodes per group
+#define NIGROUP ((NINODEMAX + IPG - 1) / IPG)
+
+struct ibucket {
+  struct spinlock lock;
+  struct inode *head;  // chain through hnext
+};
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *group[NIGROUP];  // 0 if not allocated
+  int ngroup;                    // groups allocated
+  struct ibucket bucket[NIHASH];
+
+  // All entries, through prev/next.
+  // head.next is least recently released.
+  struct inode head;
 } icache;
 
+// Make the page mem a group of inodes, at the least recently
+// used end of the list.
+// Caller must hold icache.lock, except in iinit, and check
+// that ngroup < NIGROUP.
+static void
+igrow(char *mem)
+{
+  struct inode *ip, *g;
+  int i;
+
+  for(i = 0; icache.group[i]; i++)
+    ;
+  g = (struct inode*)mem;
+  memset(g, 0, PGSIZE);
+  icache.group[i] = g;
+  icache.ngroup++;
+  for(ip = g; ip < g + IPG; ip++){
+    initsleeplock(&ip->lock, "inode");
+    ip->next = icache.head.next;
+    ip->prev = &icache.head;
+    icache.head.next->prev = ip;
+    icache.head.next = ip;
+  }
+}
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
+  struct ibucket *bk;
+  char *mem;
+
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
+  for(bk = icache.bucket; bk < icache.bucket+NIHASH; bk++)
+    initlock(&bk->lock, "icache.bucket");
+  icache.head.prev = &icache.head;
+  icache.head.next = &icache.head;
+  while(icache.ngroup*IPG < NINODE){
+    if((mem = kalloc()) == 0)
+      panic("iinit");
+    igrow(mem);
   }
 
   readsb(dev, &sb);
+  if(sb.bsize != bsize)
+    bsetsize(sb.bsize);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
+ inodestart %d bmap start %d bsize %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+          sb.bmapstart, sb.bsize);
 }
 
-static struct inode* iget(uint dev, uint inum);
-
 // Allocate an inode on device dev.
 // Mark it as allocated by  giving it type type.
 // Returns an unlocked but allocated and referenced inode.
@@ -200,7 +408,7 @@ ialloc(uint dev, short type)
 
   for(inum = 1; inum < sb.ninodes; inum++){
     bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
+    dip = (struct dinode*)bp->data + inum%IPB(sb);
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
@@ -224,48 +432,180 @@ iupdate(struct inode *ip)
   struct dinode *dip;
 
   bp = bread(ip->dev, IBLOCK(ip->inum, sb));
-  dip = (struct dinode*)bp->data + ip->inum%IPB;
+  dip = (struct dinode*)bp->data + ip->inum%IPB(sb);
   dip->type = ip->type;
   dip->major = ip->major;
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
-  dip->size = ip->size;
-  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+  dip->size = ip->dsize;
+  dip->depth = ip->depth;
+  dip->nextent = ip->nextent;
+  memmove(dip->ext, ip->ext, sizeof(ip->ext));
   log_write(bp);
   brelse(bp);
 }
 
+static struct ibucket*
+ihash(uint dev, uint inum)
+{
+  return &icache.bucket[(dev*31 + inum) % NIHASH];
+}
+
+// Look for the inode on its bucket's chain and reference it.
+// Caller must hold bk->lock.
+static struct inode*
+ilookup(struct ibucket *bk, uint dev, uint inum)
+{
+  struct inode *ip;
+
+  for(ip = bk->head; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      ip->ref++;
+      return ip;
+    }
+  }
+  return 0;
+}
+
+// If ip is unreferenced, take it off its hash chain, leaving
+// it unused.  Returns 1 if ip is unused now, 0 if in use.
+// Caller must hold icache.lock.
+static int
+ievict(struct inode *ip)
+{
+  struct inode **pp;
+  struct ibucket *bk;
+
+  if(ip->inum == 0)
+    return 1;  // never used
+  bk = ihash(ip->dev, ip->inum);
+  acquire(&bk->lock);
+  if(ip->ref != 0){
+    release(&bk->lock);
+    return 0;
+  }
+  for(pp = &bk->head; *pp != ip; pp = &(*pp)->hnext)
+    ;
+  *pp = ip->hnext;
+  ip->inum = 0;
+  release(&bk->lock);
+  return 1;
+}
+
+// Take the least recently released unreferenced inode off
+// its hash chain.  Returns 0 if every inode is in use.
+// Caller must hold icache.lock.
+static struct inode*
+ivictim(void)
+{
+  struct inode *ip;
+
+  for(ip = icache.head.next; ip != &icache.head; ip = ip->next)
+    if(ievict(ip))
+      return ip;
+  return 0;
+}
+
+// Give a group of unreferenced inodes back to kalloc, if the
+// cache has more than NINODE.  Used by kallocswap() when
+// memory runs out.
+// Returns 1 if a page was freed, 0 if not.
+int
+ireclaim(void)
+{
+  struct inode *g, *ip;
+  int i;
+
+  acquire(&icache.lock);
+  for(i = 0; i < NIGROUP && (icache.ngroup-1)*IPG >= NINODE; i++){
+    if((g = icache.group[i]) == 0)
+      continue;
+    // Drop the group's inodes from the cache, giving up if
+    // one is in use.  Those dropped stay usable.
+    for(ip = g; ip < g + IPG; ip++)
+      if(!ievict(ip))
+        break;
+    if(ip < g + IPG)
+      continue;
+    for(ip = g; ip < g + IPG; ip++){
+      ip->next->prev = ip->prev;
+      ip->prev->next = ip->next;
+    }
+    icache.group[i] = 0;
+    icache.ngroup--;
+    release(&icache.lock);
+    kfree((char*)g);
+    return 1;
+  }
+  release(&icache.lock);
+  return 0;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
-static struct inode*
+struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
-
+  struct inode *ip;
+  struct ibucket *bk;
+  char *mem;
+
+  bk = ihash(dev, inum);
+  acquire(&bk->lock);
+  ip = ilookup(bk, dev, inum);
+  release(&bk->lock);
+  if(ip)
+    return ip;
+
+  // Not cached.  Only one miss at a time, so check again:
+  // another process may have added it meanwhile, also while
+  // this one slept below.
   acquire(&icache.lock);
-
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(;;){
+    acquire(&bk->lock);
+    ip = ilookup(bk, dev, inum);
+    release(&bk->lock);
+    if(ip){
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
+    if((ip = ivictim()) != 0)
+      break;
+    // Every entry is in use: add a group, or wait for iput().
+    if(icache.ngroup < NIGROUP){
+      release(&icache.lock);
+      mem = kallocswap();
+      acquire(&icache.lock);
+      if(mem && icache.ngroup < NIGROUP){
+        igrow(mem);
+        continue;
+      }
+      if(mem){
+        kfree(mem);
+        continue;
+      }
+    }
+    sleep(&icache, &icache.lock);
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  // Move it to the recently used end, so the next miss
+  // starts its search with older entries.
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+  ip->next = &icache.head;
+  ip->prev = icache.head.prev;
+  icache.head.prev->next = ip;
+  icache.head.prev = ip;
 
-  ip = empty;
+  acquire(&bk->lock);
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->hnext = bk->head;
+  bk->head = ip;
+  release(&bk->lock);
   release(&icache.lock);
 
   return ip;
@@ -276,9 +616,12 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *bk;
+
+  bk = ihash(ip->dev, ip->inum);
+  acquire(&bk->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&bk->lock);
   return ip;
 }
 
@@ -297,14 +640,17 @@ ilock(struct inode *ip)
 
   if(ip->valid == 0){
     bp = bread(ip->dev, IBLOCK(ip->inum, sb));
-    dip = (struct dinode*)bp->data + ip->inum%IPB;
+    dip = (struct dinode*)bp->data + ip->inum%IPB(sb);
     ip->type = dip->type;
     ip->major = dip->major;
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
-    ip->size = dip->size;
-    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+    ip->size = ip->dsize = dip->size;
+    ip->depth = dip->depth;
+    ip->nextent = dip->nextent;
+    memmove(ip->ext, dip->ext, sizeof(ip->ext));
     brelse(bp);
+    ip->raoff = ip->rawin = ip->rablock = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -331,14 +677,20 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *bk;
+  int last;
+
+  bk = ihash(ip->dev, ip->inum);
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&bk->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&bk->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
+      if(ip->type == T_DIR)
+        dcpurge(ip->dev, ip->inum);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
@@ -346,8 +698,35 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
+  acquire(&bk->lock);
+  last = ip->ref == 1;
+  if(!last)
+    ip->ref--;
+  release(&bk->lock);
+  if(!last)
+    return;
+
+  // Drop the block reservation while our reference still
+  // keeps the slot from being recycled for another inode.
+  brsvdrop(ip);
+
+  // Perhaps the last reference: hold icache.lock too, so that
+  // the entry cannot be recycled or reclaimed before it is
+  // back on the list.
   acquire(&icache.lock);
-  ip->ref--;
+  acquire(&bk->lock);
+  last = --ip->ref == 0;
+  release(&bk->lock);
+  if(last){
+    // Keep it cached, at the recently used end.
+    ip->next->prev = ip->prev;
+    ip->prev->next = ip->next;
+    ip->next = &icache.head;
+    ip->prev = icache.head.prev;
+    icache.head.prev->next = ip;
+    icache.head.prev = ip;
+    wakeup(&icache);
+  }
   release(&icache.lock);
 }
 
@@ -362,40 +741,175 @@ iunlockput(struct inode *ip)
 // Inode content
 //
 // The content (data) associated with each inode is stored
-// in blocks on the disk. The first NDIRECT block numbers
-// are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// in blocks on the disk, described by a list of extents (see
+// struct extent in fs.h).  Files have no holes and only grow
+// at the end, so the extents are in file order and the tree
+// only ever changes along its right edge.
+
+// Number of blocks in ip.
+static uint
+extblocks(struct inode *ip)
+{
+  uint i, n;
+
+  n = 0;
+  for(i = 0; i < ip->nextent; i++)
+    n += ip->ext[i].len;
+  return n;
+}
+
+// Add a block at the end of ip.
+// Asks for the block after the file's last, so that it
+// extends the last extent.  Otherwise the block starts a
+// new extent, in the last extent block, or in a new one
+// hung from the lowest level of the right edge with room,
+// pushing the inode's extents down into a block of their
+// own first if the tree is full.
+static void
+extappend(struct inode *ip)
+{
+  struct buf *bp[MAXDEPTH+1];
+  struct extent *e[MAXDEPTH+1], *last;
+  uint *n[MAXDEPTH+1];
+  uint nroot, max, addr, child, nb;
+  struct extblock *eb;
+  struct buf *cbp;
+  int d, l, i;
+
+  addr = 0;
+again:
+  // Walk the right edge of the tree.
+  d = ip->depth;
+  nroot = ip->nextent;
+  e[0] = ip->ext;
+  n[0] = &nroot;
+  for(l = 1; l <= d; l++){
+    bp[l] = bread(ip->dev, e[l-1][*n[l-1]-1].start);
+    eb = (struct extblock*)bp[l]->data;
+    e[l] = eb->ext;
+    n[l] = &eb->n;
+  }
+
+  last = *n[d] ? &e[d][*n[d]-1] : 0;
+  if(addr == 0){
+    addr = balloc(ip->dev, ip->type != T_DIR, last ? last->start + last->len : 0, ip);
+    if(ip->type == T_FILE)
+      brsv(ip, addr);
+  }
+  if(last && last->start + last->len == addr){
+    last->len++;
+    l = d;
+  } else {
+    for(l = d; l >= 0; l--){
+      max = l ? EPB(sb) : NEXTENT;
+      if(*n[l] < max)
+        break;
+    }
+    if(l < 0){
+      // Full: move the inode's extents into a new block
+      // and try again one level deeper.
+      for(l = 1; l <= d; l++)
+        brelse(bp[l]);
+      if(d == MAXDEPTH)
+        panic("extappend: file too big");
+      nb = balloc(ip->dev, 0, 0, ip);
+      cbp = bread(ip->dev, nb);
+      eb = (struct extblock*)cbp->data;
+      eb->n = ip->nextent;
+      memmove(eb->ext, ip->ext, ip->nextent*sizeof(struct extent));
+      log_write(cbp);
+      brelse(cbp);
+      ip->ext[0].start = nb;
+      ip->ext[0].len = extblocks(ip);
+      ip->nextent = 1;
+      ip->depth++;
+      goto again;
+    }
+    // Hang a chain of new blocks from level l, ending in
+    // a leaf holding the new extent.
+    child = addr;
+    for(i = d; i > l; i--){
+      nb = balloc(ip->dev, 0, 0, ip);
+      cbp = bread(ip->dev, nb);
+      eb = (struct extblock*)cbp->data;
+      eb->n = 1;
+      eb->ext[0].start = child;
+      eb->ext[0].len = 1;
+      log_write(cbp);
+      brelse(cbp);
+      child = nb;
+    }
+    e[l][*n[l]].start = child;
+    e[l][*n[l]].len = 1;
+    (*n[l])++;
+  }
+
+  // The edge above level l now covers one more block.
+  for(i = 0; i < l; i++)
+    e[i][*n[i]-1].len++;
+  ip->nextent = nroot;
+  for(i = 1; i <= d; i++){
+    if(i <= l)
+      log_write(bp[i]);
+    brelse(bp[i]);
+  }
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
-static uint
+uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  struct extent *e;
+  struct extblock *eb;
   struct buf *bp;
+  uint i, n, addr;
+  int d;
 
-  if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
-    return addr;
-  }
-  bn -= NDIRECT;
+  while(bn >= extblocks(ip))
+    extappend(ip);
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  e = ip->ext;
+  n = ip->nextent;
+  bp = 0;
+  for(d = ip->depth; ; d--){
+    for(i = 0; i < n && bn >= e[i].len; i++)
+      bn -= e[i].len;
+    if(i == n)
+      panic("bmap: extents");
+    addr = e[i].start;
+    if(bp)
+      brelse(bp);
+    if(d == 0)
+      return addr + bn;
     bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+    eb = (struct extblock*)bp->data;
+    e = eb->ext;
+    n = eb->n;
+  }
+}
+
+// Free the blocks of the n extents at e, d levels above the
+// file's own.
+static void
+extfree(struct inode *ip, struct extent *e, uint n, int d)
+{
+  struct extblock *eb;
+  struct buf *bp;
+  uint i, j;
+
+  for(i = 0; i < n; i++){
+    if(d == 0){
+      for(j = 0; j < e[i].len; j++)
+        bfree(ip->dev, e[i].start + j);
+      continue;
     }
+    bp = bread(ip->dev, e[i].start);
+    eb = (struct extblock*)bp->data;
+    extfree(ip, eb->ext, eb->n, d-1);
     brelse(bp);
-    return addr;
+    bfree(ip->dev, e[i].start);
   }
-
-  panic("bmap: out of range");
 }
 
 // Truncate inode (discard contents).
@@ -406,31 +920,36 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
-
-  for(i = 0; i < NDIRECT; i++){
-    if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
-      ip->addrs[i] = 0;
-    }
-  }
+  brsvdrop(ip);
+  extfree(ip, ip->ext, ip->nextent, ip->depth);
+  memset(ip->ext, 0, sizeof(ip->ext));
+  ip->nextent = 0;
+  ip->depth = 0;
+
+  pcinval(ip->dev, ip->inum);
+  ip->size = ip->dsize = 0;
+  iupdate(ip);
+}
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
-    }
+// Count the file's own extents among the n at e, d levels
+// above them.
+static uint
+extcount(struct inode *ip, struct extent *e, uint n, int d)
+{
+  struct extblock *eb;
+  struct buf *bp;
+  uint i, cnt;
+
+  if(d == 0)
+    return n;
+  cnt = 0;
+  for(i = 0; i < n; i++){
+    bp = bread(ip->dev, e[i].start);
+    eb = (struct extblock*)bp->data;
+    cnt += extcount(ip, eb->ext, eb->n, d-1);
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
-
-  ip->size = 0;
-  iupdate(ip);
+  return cnt;
 }
 
 // Copy stat information from inode.
@@ -443,15 +962,52 @@ stati(struct inode *ip, struct stat *st)
   st->type = ip->type;
   st->nlink = ip->nlink;
   st->size = ip->size;
+  st->nextent = extcount(ip, ip->ext, ip->nextent, ip->depth);
+}
+
+// Sequential read-ahead.  A read of ip that starts where the
+// last one ended doubles the read-ahead window (up to RAMAX
+// blocks); any other read closes it.  Blocks in the window
+// after this read that have not been asked for yet, and are
+// not in the page cache, are read into the buffer cache
+// without waiting, so that later reads find them there.
+// Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end, last;
+
+  if(off != ip->raoff){
+    ip->rawin = 0;
+    ip->rablock = 0;
+  } else if(ip->rawin < RAMAX)
+    ip->rawin = ip->rawin ? 2*ip->rawin : 4;
+  ip->raoff = off + n;
+  if(ip->rawin == 0)
+    return;
+
+  end = (off + n + bsize - 1) / bsize;
+  last = end + ip->rawin;
+  if(last > (ip->dsize + bsize - 1) / bsize)
+    last = (ip->dsize + bsize - 1) / bsize;
+  bn = ip->rablock > end ? ip->rablock : end;
+  for(; bn < last; bn++)
+    if(!pccached(ip->dev, ip->inum, bn*bsize/PGSIZE))
+      breadahead(ip->dev, bmap(ip, bn));
+  if(bn > ip->rablock)
+    ip->rablock = bn;
 }
 
 // Read data from inode.
+// Copies out of the page cache, going to the
+// buffer cache only if no page can be had.
 // Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  struct page *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -463,11 +1019,18 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return -1;
   if(off + n > ip->size)
     n = ip->size - off;
+  readahead(ip, off, n);
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
+    if((pg = pcget(ip, off/PGSIZE)) != 0){
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      memmove(dst, pg->data + off%PGSIZE, m);
+      pcput(pg);
+      continue;
+    }
+    bp = bread(ip->dev, bmap(ip, off/bsize));
+    m = min(n - tot, bsize - off%bsize);
+    memmove(dst, bp->data + off%bsize, m);
     brelse(bp);
   }
   return n;
@@ -489,19 +1052,35 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if((off + n + bsize - 1)/bsize > MAXFILE(sb))
     return -1;
+  // Moving dsize past off would drop delayed data below it;
+  // callers flush it first (see filewriteiov).
+  if(off > ip->dsize)
+    panic("writei: delayed data");
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    bp = bread(ip->dev, bmap(ip, off/bsize));
+    m = min(n - tot, bsize - off%bsize);
+    memmove(bp->data + off%bsize, src, m);
+    if(ip->type == T_DIR)
+      log_write(bp);
+    else
+      log_writedata(bp);  // ordered, not journaled
     brelse(bp);
+    pcwrite(ip, src, off, m);
   }
 
-  if(n > 0 && off > ip->size){
-    ip->size = off;
+  if(n > 0 && off > ip->dsize){
+    // Delayed writes (see pcdelay) now on disk need not stay
+    // cached.
+    for(m = ip->dsize/PGSIZE; m < off/PGSIZE; m++)
+      pcclean(ip, m);
+    if(off >= ip->size)
+      pcclean(ip, off/PGSIZE);
+    ip->dsize = off;
+    if(off > ip->size)
+      ip->size = off;
     iupdate(ip);
   }
   return n;
@@ -515,17 +1094,251 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Hashed directories (see struct dxroot in fs.h).  A lookup
+// reads the index in block 0 and then a single leaf.  When a
+// one-block directory fills up, dxconvert moves its entries to
+// a leaf and puts the index in block 0; when a leaf fills up,
+// dxsplit moves the upper half of its hashes to a new leaf.
+// Directories that were already bigger than a block when
+// this came in stay linear.
+//
+// Changes go through writei, which keeps the page cache up
+// to date, so reads can go to the buffer cache or readi.
+
+// Hash of a directory entry name, for the index.
+static uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+static void
+dirwrite(struct inode *dp, void *p, uint off)
+{
+  if(writei(dp, p, off, sizeof(struct dirent)) != sizeof(struct dirent))
+    panic("dirwrite");
+}
+
+static void
+dirread(struct inode *dp, void *p, uint off)
+{
+  if(readi(dp, p, off, sizeof(struct dirent)) != sizeof(struct dirent))
+    panic("dirread");
+}
+
+// Add a zeroed block at the end of dp, whose size is a whole
+// number of blocks, and return its number.
+static uint
+dirgrow(struct inode *dp)
+{
+  uint bn;
+
+  bn = dp->size / bsize;
+  bmap(dp, bn);
+  dp->size += bsize;
+  dp->dsize = dp->size;
+  iupdate(dp);
+  return bn;
+}
+
+// Is dp a hashed directory?
+static int
+dxhashed(struct inode *dp)
+{
+  struct dxroot r;
+
+  if(dp->size < 2*bsize)
+    return 0;
+  dirread(dp, &r, DXROOT*sizeof(struct dirent));
+  return r.inum == 0 && r.magic == DXMAGIC;
+}
+
+// Find the leaf of hashed directory dp for hash h.  Returns
+// its index entry's number, and sets *leaf to its block.
+static int
+dxfind(struct inode *dp, uint h, uint *leaf)
+{
+  struct buf *bp;
+  struct dxroot *r;
+  struct dxentry *e;
+  int lo, hi, mid;
+
+  bp = bread(dp->dev, bmap(dp, 0));
+  r = (struct dxroot*)bp->data + DXROOT;
+  e = (struct dxentry*)(r + 1);
+  lo = 0;
+  hi = r->n - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(e[mid].hash <= h)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  *leaf = e[lo].block;
+  brelse(bp);
+  return lo;
+}
+
+// Look for name in block bn of dp.  If there, return its
+// offset in dp and set *inum; otherwise return -1.  With
+// name 0, look for a free slot instead.
+static int
+dirscan(struct inode *dp, uint bn, char *name, uint *inum)
+{
+  struct buf *bp;
+  struct dirent *de;
+  int i, off;
+
+  off = -1;
+  bp = bread(dp->dev, bmap(dp, bn));
+  de = (struct dirent*)bp->data;
+  for(i = 0; i < bsize/sizeof(*de); i++){
+    if(name == 0 ? de[i].inum == 0 :
+       de[i].inum != 0 && namecmp(name, de[i].name) == 0){
+      off = bn*bsize + i*sizeof(*de);
+      if(inum)
+        *inum = de[i].inum;
+      break;
+    }
+  }
+  brelse(bp);
+  return off;
+}
+
+// Turn the one-block directory dp into a hashed one with a
+// single leaf.  Entries keep their slots, in the leaf.
+static void
+dxconvert(struct inode *dp)
+{
+  struct dirent de, zero;
+  struct dxroot r;
+  struct dxentry e;
+  uint off, leaf;
+
+  dcpurge(dp->dev, dp->inum);  // entries move
+  leaf = dirgrow(dp);
+  memset(&zero, 0, sizeof(zero));
+  for(off = DXROOT*sizeof(de); off < bsize; off += sizeof(de)){
+    dirread(dp, &de, off);
+    if(de.inum == 0)
+      continue;
+    dirwrite(dp, &de, leaf*bsize + off);
+    dirwrite(dp, &zero, off);
+  }
+  memset(&r, 0, sizeof(r));
+  r.magic = DXMAGIC;
+  r.n = 1;
+  dirwrite(dp, &r, DXROOT*sizeof(de));
+  memset(&e, 0, sizeof(e));
+  e.hash = 0;
+  e.block = leaf;
+  dirwrite(dp, &e, (DXROOT+1)*sizeof(de));
+}
+
+// Split the full leaf of index entry i of dp, moving the
+// entries with the upper half of its hashes to a new leaf.
+// Returns 0, or -1 if the index is full or every entry has
+// the same hash.
+static int
+dxsplit(struct inode *dp, int i, uint leaf)
+{
+  struct dirent de, zero;
+  struct dxroot r;
+  struct dxentry e;
+  struct buf *bp;
+  uint *hash, n, j, k, h, split, nleaf, off;
+
+  dirread(dp, &r, DXROOT*sizeof(de));
+  if(r.n >= DXMAX(sb))
+    return -1;
+
+  // Find the median hash.
+  if((hash = (uint*)kallocswap()) == 0)
+    return -1;
+  bp = bread(dp->dev, bmap(dp, leaf));
+  n = 0;
+  for(j = 0; j < bsize/sizeof(de); j++)
+    if(((struct dirent*)bp->data)[j].inum != 0)
+      hash[n++] = dirhash(((struct dirent*)bp->data)[j].name);
+  brelse(bp);
+  for(j = 1; j < n; j++){
+    h = hash[j];
+    for(k = j; k > 0 && hash[k-1] > h; k--)
+      hash[k] = hash[k-1];
+    hash[k] = h;
+  }
+  // Equal hashes must stay in one leaf.
+  for(j = n/2; j < n && hash[j] == hash[0]; j++)
+    ;
+  split = j < n ? hash[j] : 0;
+  kfree((char*)hash);
+  if(split == 0)
+    return -1;
+
+  dcpurge(dp->dev, dp->inum);  // entries move
+  nleaf = dirgrow(dp);
+  memset(&zero, 0, sizeof(zero));
+  for(j = 0; j < bsize/sizeof(de); j++){
+    off = leaf*bsize + j*sizeof(de);
+    dirread(dp, &de, off);
+    if(de.inum == 0 || dirhash(de.name) < split)
+      continue;
+    dirwrite(dp, &de, nleaf*bsize + j*sizeof(de));
+    dirwrite(dp, &zero, off);
+  }
+
+  // Insert the new leaf's index entry after i.
+  for(k = r.n; k > i+1; k--){
+    dirread(dp, &e, (DXROOT+1+k-1)*sizeof(de));
+    dirwrite(dp, &e, (DXROOT+1+k)*sizeof(de));
+  }
+  memset(&e, 0, sizeof(e));
+  e.hash = split;
+  e.block = nleaf;
+  dirwrite(dp, &e, (DXROOT+1+i+1)*sizeof(de));
+  r.n++;
+  dirwrite(dp, &r, DXROOT*sizeof(de));
+  return 0;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
+  uint off, inum, leaf;
+  int hoff;
   struct dirent de;
+  struct inode *ip;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  switch(dclookup(dp->dev, dp->inum, name, &ip, poff)){
+  case 1:
+    return ip;
+  case 0:
+    return 0;
+  }
+
+  if(dxhashed(dp) && namecmp(name, ".") != 0 && namecmp(name, "..") != 0){
+    dxfind(dp, dirhash(name), &leaf);
+    if((hoff = dirscan(dp, leaf, name, &inum)) < 0)
+      goto notfound;
+    dcenter(dp->dev, dp->inum, name, inum, hoff);
+    if(poff)
+      *poff = hoff;
+    return iget(dp->dev, inum);
+  }
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -533,21 +1346,27 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       continue;
     if(namecmp(name, de.name) == 0){
       // entry matches path element
+      inum = de.inum;
+      dcenter(dp->dev, dp->inum, name, inum, off);
       if(poff)
         *poff = off;
-      inum = de.inum;
       return iget(dp->dev, inum);
     }
   }
 
+notfound:
+  dcenter(dp->dev, dp->inum, name, 0, 0);
   return 0;
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is already there, or if dp is hashed and
+// the leaf for name cannot be split (see dxsplit).
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, i;
+  uint leaf;
   struct dirent de;
   struct inode *ip;
 
@@ -557,22 +1376,52 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  if(dxhashed(dp)){
+    i = dxfind(dp, dirhash(name), &leaf);
+    if((off = dirscan(dp, leaf, 0, 0)) < 0){
+      if(dxsplit(dp, i, leaf) < 0)
+        return -1;
+      dxfind(dp, dirhash(name), &leaf);
+      if((off = dirscan(dp, leaf, 0, 0)) < 0)
+        panic("dirlink: split");
+    }
+  } else {
+    // Look for an empty dirent.
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
+    // Full first block: hash rather than grow.
+    if(off == bsize && dp->size == bsize){
+      dxconvert(dp);
+      return dirlink(dp, name, inum);
+    }
   }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcenter(dp->dev, dp->inum, name, inum, off);
 
   return 0;
 }
 
+// Remove the entry for name, which dirlookup found at off,
+// from the directory dp.
+void
+dirunlink(struct inode *dp, char *name, uint off)
+{
+  struct dirent de;
+
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+  dcenter(dp->dev, dp->inum, name, 0, 0);
+}
+
 // Paths
 
 // Copy the next path element from path into name.
@@ -627,6 +1476,19 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
+    // Names the dcache knows need no lock on the directory;
+    // only directories have names there.
+    if(!(nameiparent && *path == '\0')){
+      switch(dclookup(ip->dev, ip->inum, name, &next, 0)){
+      case 1:
+        iput(ip);
+        ip = next;
+        continue;
+      case 0:
+        iput(ip);
+        return 0;
+      }
+    }
     ilock(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
@@ -3,11 +3,16 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#define SECTSIZE 512   // disk sector size, and smallest block size
+#define MAXBSIZE 4096  // largest block size: one page
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
-//                                          free bit map | data blocks]
+//                              free bit map | data blocks | swap area ]
+//
+// The super block is in the second sector, whatever the block
+// size: with blocks bigger than a sector it shares block 0 with
+// the boot block.
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -19,11 +24,33 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint swapstart;    // Block number of first swap block
+  uint nswap;        // Number of swap blocks (not counted in size)
+  uint bsize;        // Block size (bytes): a power of two, at most MAXBSIZE
+};
+
+// A file's content is a list of extents, runs of consecutive
+// disk blocks, in file order.  Up to NEXTENT of them fit in the
+// inode.  A file with more has an extent tree: the inode's
+// extents instead point at extent blocks, depth levels of them,
+// each extent naming a block and how many file blocks lie
+// beneath it.  The last level's extents are the file's own.
+struct extent {
+  uint start;           // First disk block (or extent block)
+  uint len;             // Number of file blocks
 };
 
-#define NDIRECT 12
-#define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+// Extent block.
+struct extblock {
+  uint n;               // Extents in use
+  uint pad;
+  struct extent ext[];  // EPB(sb) of them
+};
+
+#define NEXTENT  6
+#define EPB(sb)  (((sb).bsize - sizeof(struct extblock)) / sizeof(struct extent))
+#define MAXDEPTH 3
+#define MAXFILE(sb)  (NEXTENT*EPB(sb)*EPB(sb)*EPB(sb))  // in blocks, however fragmented
 
 // On-disk inode structure
 struct dinode {
@@ -32,20 +59,22 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  ushort depth;         // Levels of extent blocks
+  ushort nextent;       // Extents in use in ext[]
+  struct extent ext[NEXTENT];
 };
 
 // Inodes per block.
-#define IPB           (BSIZE / sizeof(struct dinode))
+#define IPB(sb)       ((sb).bsize / sizeof(struct dinode))
 
 // Block containing inode i
-#define IBLOCK(i, sb)     ((i) / IPB + sb.inodestart)
+#define IBLOCK(i, sb)     ((i) / IPB(sb) + (sb).inodestart)
 
 // Bitmap bits per block
-#define BPB           (BSIZE*8)
+#define BPB(sb)       ((sb).bsize*8)
 
 // Block of free map containing bit for block b
-#define BBLOCK(b, sb) (b/BPB + sb.bmapstart)
+#define BBLOCK(b, sb) ((b)/BPB(sb) + (sb).bmapstart)
 
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
@@ -55,3 +84,31 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// A directory that outgrows one block is hashed: block 0 keeps
+// "." and "..", then a dxroot and an index of dxentry records,
+// sorted by hash, one per leaf block.  A leaf holds the entries
+// whose name hash (see dirhash) is at least its index entry's
+// and below the next one's; leaves are plain dirent blocks.
+// The index records have inum 0, so programs that read a
+// directory as a list of dirents pass over them.
+#define DXMAGIC 0xd1c7
+#define DXROOT  2    // slot of the dxroot in block 0
+
+struct dxroot {
+  ushort inum;       // Always 0
+  ushort magic;      // DXMAGIC
+  uint n;            // Index entries in use
+  uint pad[2];
+};
+
+struct dxentry {
+  ushort inum;       // Always 0
+  ushort pad;
+  uint hash;         // Smallest name hash in the leaf
+  uint block;        // Leaf's block number in the directory
+  uint pad2;
+};
+
+// Most leaves a hashed directory can have.
+#define DXMAX(sb) ((sb).bsize/sizeof(struct dirent) - DXROOT - 1)
+
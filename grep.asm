@@ -0,0 +1,1385 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <matchstar>:
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8b 75 08             	mov    0x8(%ebp),%esi
+   c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+   f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+  12:	83 ec 08             	sub    $0x8,%esp
+  15:	53                   	push   %ebx
+  16:	57                   	push   %edi
+  17:	e8 2c 00 00 00       	call   48 <matchhere>
+  1c:	83 c4 10             	add    $0x10,%esp
+  1f:	85 c0                	test   %eax,%eax
+  21:	75 18                	jne    3b <matchstar+0x3b>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+  23:	0f b6 13             	movzbl (%ebx),%edx
+  26:	84 d2                	test   %dl,%dl
+  28:	74 16                	je     40 <matchstar+0x40>
+  2a:	83 c3 01             	add    $0x1,%ebx
+  2d:	0f be d2             	movsbl %dl,%edx
+  30:	39 f2                	cmp    %esi,%edx
+  32:	74 de                	je     12 <matchstar+0x12>
+  34:	83 fe 2e             	cmp    $0x2e,%esi
+  37:	74 d9                	je     12 <matchstar+0x12>
+  39:	eb 05                	jmp    40 <matchstar+0x40>
+      return 1;
+  3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+  40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  43:	5b                   	pop    %ebx
+  44:	5e                   	pop    %esi
+  45:	5f                   	pop    %edi
+  46:	5d                   	pop    %ebp
+  47:	c3                   	ret
+
+00000048 <matchhere>:
+{
+  48:	55                   	push   %ebp
+  49:	89 e5                	mov    %esp,%ebp
+  4b:	83 ec 08             	sub    $0x8,%esp
+  4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(re[0] == '\0')
+  51:	0f b6 02             	movzbl (%edx),%eax
+  54:	84 c0                	test   %al,%al
+  56:	74 68                	je     c0 <matchhere+0x78>
+  if(re[1] == '*')
+  58:	0f b6 4a 01          	movzbl 0x1(%edx),%ecx
+  5c:	80 f9 2a             	cmp    $0x2a,%cl
+  5f:	74 1d                	je     7e <matchhere+0x36>
+  if(re[0] == '$' && re[1] == '\0')
+  61:	3c 24                	cmp    $0x24,%al
+  63:	74 31                	je     96 <matchhere+0x4e>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  68:	0f b6 09             	movzbl (%ecx),%ecx
+  6b:	84 c9                	test   %cl,%cl
+  6d:	74 58                	je     c7 <matchhere+0x7f>
+  6f:	3c 2e                	cmp    $0x2e,%al
+  71:	74 35                	je     a8 <matchhere+0x60>
+  73:	38 c8                	cmp    %cl,%al
+  75:	74 31                	je     a8 <matchhere+0x60>
+  return 0;
+  77:	b8 00 00 00 00       	mov    $0x0,%eax
+  7c:	eb 47                	jmp    c5 <matchhere+0x7d>
+    return matchstar(re[0], re+2, text);
+  7e:	83 ec 04             	sub    $0x4,%esp
+  81:	ff 75 0c             	push   0xc(%ebp)
+  84:	83 c2 02             	add    $0x2,%edx
+  87:	52                   	push   %edx
+  88:	0f be c0             	movsbl %al,%eax
+  8b:	50                   	push   %eax
+  8c:	e8 6f ff ff ff       	call   0 <matchstar>
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	eb 2f                	jmp    c5 <matchhere+0x7d>
+  if(re[0] == '$' && re[1] == '\0')
+  96:	84 c9                	test   %cl,%cl
+  98:	75 cb                	jne    65 <matchhere+0x1d>
+    return *text == '\0';
+  9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9d:	80 38 00             	cmpb   $0x0,(%eax)
+  a0:	0f 94 c0             	sete   %al
+  a3:	0f b6 c0             	movzbl %al,%eax
+  a6:	eb 1d                	jmp    c5 <matchhere+0x7d>
+    return matchhere(re+1, text+1);
+  a8:	83 ec 08             	sub    $0x8,%esp
+  ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ae:	83 c0 01             	add    $0x1,%eax
+  b1:	50                   	push   %eax
+  b2:	83 c2 01             	add    $0x1,%edx
+  b5:	52                   	push   %edx
+  b6:	e8 8d ff ff ff       	call   48 <matchhere>
+  bb:	83 c4 10             	add    $0x10,%esp
+  be:	eb 05                	jmp    c5 <matchhere+0x7d>
+    return 1;
+  c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  c5:	c9                   	leave
+  c6:	c3                   	ret
+  return 0;
+  c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  cc:	eb f7                	jmp    c5 <matchhere+0x7d>
+
+000000ce <match>:
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	56                   	push   %esi
+  d2:	53                   	push   %ebx
+  d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '^')
+  d9:	80 3e 5e             	cmpb   $0x5e,(%esi)
+  dc:	75 14                	jne    f2 <match+0x24>
+    return matchhere(re+1, text);
+  de:	83 ec 08             	sub    $0x8,%esp
+  e1:	53                   	push   %ebx
+  e2:	83 c6 01             	add    $0x1,%esi
+  e5:	56                   	push   %esi
+  e6:	e8 5d ff ff ff       	call   48 <matchhere>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	eb 22                	jmp    112 <match+0x44>
+  }while(*text++ != '\0');
+  f0:	89 d3                	mov    %edx,%ebx
+    if(matchhere(re, text))
+  f2:	83 ec 08             	sub    $0x8,%esp
+  f5:	53                   	push   %ebx
+  f6:	56                   	push   %esi
+  f7:	e8 4c ff ff ff       	call   48 <matchhere>
+  fc:	83 c4 10             	add    $0x10,%esp
+  ff:	85 c0                	test   %eax,%eax
+ 101:	75 0a                	jne    10d <match+0x3f>
+  }while(*text++ != '\0');
+ 103:	8d 53 01             	lea    0x1(%ebx),%edx
+ 106:	80 3b 00             	cmpb   $0x0,(%ebx)
+ 109:	75 e5                	jne    f0 <match+0x22>
+ 10b:	eb 05                	jmp    112 <match+0x44>
+      return 1;
+ 10d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 112:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 115:	5b                   	pop    %ebx
+ 116:	5e                   	pop    %esi
+ 117:	5d                   	pop    %ebp
+ 118:	c3                   	ret
+
+00000119 <grep>:
+{
+ 119:	55                   	push   %ebp
+ 11a:	89 e5                	mov    %esp,%ebp
+ 11c:	57                   	push   %edi
+ 11d:	56                   	push   %esi
+ 11e:	53                   	push   %ebx
+ 11f:	83 ec 1c             	sub    $0x1c,%esp
+ 122:	8b 7d 08             	mov    0x8(%ebp),%edi
+  m = 0;
+ 125:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 12c:	eb 52                	jmp    180 <grep+0x67>
+      p = q+1;
+ 12e:	8d 73 01             	lea    0x1(%ebx),%esi
+    while((q = strchr(p, '\n')) != 0){
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 0a                	push   $0xa
+ 136:	56                   	push   %esi
+ 137:	e8 e3 01 00 00       	call   31f <strchr>
+ 13c:	89 c3                	mov    %eax,%ebx
+ 13e:	83 c4 10             	add    $0x10,%esp
+ 141:	85 c0                	test   %eax,%eax
+ 143:	74 2d                	je     172 <grep+0x59>
+      *q = 0;
+ 145:	c6 03 00             	movb   $0x0,(%ebx)
+      if(match(pattern, p)){
+ 148:	83 ec 08             	sub    $0x8,%esp
+ 14b:	56                   	push   %esi
+ 14c:	57                   	push   %edi
+ 14d:	e8 7c ff ff ff       	call   ce <match>
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	85 c0                	test   %eax,%eax
+ 157:	74 d5                	je     12e <grep+0x15>
+        *q = '\n';
+ 159:	c6 03 0a             	movb   $0xa,(%ebx)
+        write(1, p, q+1 - p);
+ 15c:	8d 43 01             	lea    0x1(%ebx),%eax
+ 15f:	83 ec 04             	sub    $0x4,%esp
+ 162:	29 f0                	sub    %esi,%eax
+ 164:	50                   	push   %eax
+ 165:	56                   	push   %esi
+ 166:	6a 01                	push   $0x1
+ 168:	e8 f4 02 00 00       	call   461 <write>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	eb bc                	jmp    12e <grep+0x15>
+    if(p == buf)
+ 172:	81 fe c0 0c 00 00    	cmp    $0xcc0,%esi
+ 178:	74 41                	je     1bb <grep+0xa2>
+    if(m > 0){
+ 17a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 17e:	7f 44                	jg     1c4 <grep+0xab>
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 180:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 185:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 188:	29 c8                	sub    %ecx,%eax
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	50                   	push   %eax
+ 18e:	8d 81 c0 0c 00 00    	lea    0xcc0(%ecx),%eax
+ 194:	50                   	push   %eax
+ 195:	ff 75 0c             	push   0xc(%ebp)
+ 198:	e8 bc 02 00 00       	call   459 <read>
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 41                	jle    1e5 <grep+0xcc>
+    m += n;
+ 1a4:	01 45 e4             	add    %eax,-0x1c(%ebp)
+ 1a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    buf[m] = '\0';
+ 1aa:	c6 82 c0 0c 00 00 00 	movb   $0x0,0xcc0(%edx)
+    p = buf;
+ 1b1:	be c0 0c 00 00       	mov    $0xcc0,%esi
+    while((q = strchr(p, '\n')) != 0){
+ 1b6:	e9 76 ff ff ff       	jmp    131 <grep+0x18>
+      m = 0;
+ 1bb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 1c2:	eb b6                	jmp    17a <grep+0x61>
+      m -= p - buf;
+ 1c4:	89 f0                	mov    %esi,%eax
+ 1c6:	2d c0 0c 00 00       	sub    $0xcc0,%eax
+ 1cb:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+ 1ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      memmove(buf, p, m);
+ 1d1:	83 ec 04             	sub    $0x4,%esp
+ 1d4:	51                   	push   %ecx
+ 1d5:	56                   	push   %esi
+ 1d6:	68 c0 0c 00 00       	push   $0xcc0
+ 1db:	e8 2d 02 00 00       	call   40d <memmove>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+ 1e3:	eb 9b                	jmp    180 <grep+0x67>
+}
+ 1e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1e8:	5b                   	pop    %ebx
+ 1e9:	5e                   	pop    %esi
+ 1ea:	5f                   	pop    %edi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+
+000001ed <main>:
+{
+ 1ed:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1f1:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1f4:	ff 71 fc             	push   -0x4(%ecx)
+ 1f7:	55                   	push   %ebp
+ 1f8:	89 e5                	mov    %esp,%ebp
+ 1fa:	57                   	push   %edi
+ 1fb:	56                   	push   %esi
+ 1fc:	53                   	push   %ebx
+ 1fd:	51                   	push   %ecx
+ 1fe:	83 ec 18             	sub    $0x18,%esp
+ 201:	8b 01                	mov    (%ecx),%eax
+ 203:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 206:	8b 51 04             	mov    0x4(%ecx),%edx
+ 209:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(argc <= 1){
+ 20c:	83 f8 01             	cmp    $0x1,%eax
+ 20f:	7e 52                	jle    263 <main+0x76>
+  pattern = argv[1];
+ 211:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 214:	8b 40 04             	mov    0x4(%eax),%eax
+ 217:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(argc <= 2){
+ 21a:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+ 21e:	7e 57                	jle    277 <main+0x8a>
+  for(i = 2; i < argc; i++){
+ 220:	be 02 00 00 00       	mov    $0x2,%esi
+ 225:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 228:	39 c6                	cmp    %eax,%esi
+ 22a:	7d 71                	jge    29d <main+0xb0>
+    if((fd = open(argv[i], 0)) < 0){
+ 22c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22f:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+ 232:	83 ec 08             	sub    $0x8,%esp
+ 235:	6a 00                	push   $0x0
+ 237:	ff 37                	push   (%edi)
+ 239:	e8 43 02 00 00       	call   481 <open>
+ 23e:	89 c3                	mov    %eax,%ebx
+ 240:	83 c4 10             	add    $0x10,%esp
+ 243:	85 c0                	test   %eax,%eax
+ 245:	78 40                	js     287 <main+0x9a>
+    grep(pattern, fd);
+ 247:	83 ec 08             	sub    $0x8,%esp
+ 24a:	50                   	push   %eax
+ 24b:	ff 75 dc             	push   -0x24(%ebp)
+ 24e:	e8 c6 fe ff ff       	call   119 <grep>
+    close(fd);
+ 253:	89 1c 24             	mov    %ebx,(%esp)
+ 256:	e8 0e 02 00 00       	call   469 <close>
+  for(i = 2; i < argc; i++){
+ 25b:	83 c6 01             	add    $0x1,%esi
+ 25e:	83 c4 10             	add    $0x10,%esp
+ 261:	eb c2                	jmp    225 <main+0x38>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 263:	83 ec 08             	sub    $0x8,%esp
+ 266:	68 cc 08 00 00       	push   $0x8cc
+ 26b:	6a 02                	push   $0x2
+ 26d:	e8 ac 03 00 00       	call   61e <printf>
+    exit();
+ 272:	e8 ca 01 00 00       	call   441 <exit>
+    grep(pattern, 0);
+ 277:	83 ec 08             	sub    $0x8,%esp
+ 27a:	6a 00                	push   $0x0
+ 27c:	50                   	push   %eax
+ 27d:	e8 97 fe ff ff       	call   119 <grep>
+    exit();
+ 282:	e8 ba 01 00 00       	call   441 <exit>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 287:	83 ec 04             	sub    $0x4,%esp
+ 28a:	ff 37                	push   (%edi)
+ 28c:	68 ec 08 00 00       	push   $0x8ec
+ 291:	6a 01                	push   $0x1
+ 293:	e8 86 03 00 00       	call   61e <printf>
+      exit();
+ 298:	e8 a4 01 00 00       	call   441 <exit>
+  exit();
+ 29d:	e8 9f 01 00 00       	call   441 <exit>
+
+000002a2 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	56                   	push   %esi
+ 2a6:	53                   	push   %ebx
+ 2a7:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2ad:	89 f0                	mov    %esi,%eax
+ 2af:	89 d1                	mov    %edx,%ecx
+ 2b1:	83 c2 01             	add    $0x1,%edx
+ 2b4:	89 c3                	mov    %eax,%ebx
+ 2b6:	83 c0 01             	add    $0x1,%eax
+ 2b9:	0f b6 09             	movzbl (%ecx),%ecx
+ 2bc:	88 0b                	mov    %cl,(%ebx)
+ 2be:	84 c9                	test   %cl,%cl
+ 2c0:	75 ed                	jne    2af <strcpy+0xd>
+    ;
+  return os;
+}
+ 2c2:	89 f0                	mov    %esi,%eax
+ 2c4:	5b                   	pop    %ebx
+ 2c5:	5e                   	pop    %esi
+ 2c6:	5d                   	pop    %ebp
+ 2c7:	c3                   	ret
+
+000002c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c8:	55                   	push   %ebp
+ 2c9:	89 e5                	mov    %esp,%ebp
+ 2cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 2d1:	eb 06                	jmp    2d9 <strcmp+0x11>
+    p++, q++;
+ 2d3:	83 c1 01             	add    $0x1,%ecx
+ 2d6:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 2d9:	0f b6 01             	movzbl (%ecx),%eax
+ 2dc:	84 c0                	test   %al,%al
+ 2de:	74 04                	je     2e4 <strcmp+0x1c>
+ 2e0:	3a 02                	cmp    (%edx),%al
+ 2e2:	74 ef                	je     2d3 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 2e4:	0f b6 c0             	movzbl %al,%eax
+ 2e7:	0f b6 12             	movzbl (%edx),%edx
+ 2ea:	29 d0                	sub    %edx,%eax
+}
+ 2ec:	5d                   	pop    %ebp
+ 2ed:	c3                   	ret
+
+000002ee <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2ee:	55                   	push   %ebp
+ 2ef:	89 e5                	mov    %esp,%ebp
+ 2f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f9:	eb 03                	jmp    2fe <strlen+0x10>
+ 2fb:	83 c0 01             	add    $0x1,%eax
+ 2fe:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 302:	75 f7                	jne    2fb <strlen+0xd>
+    ;
+  return n;
+}
+ 304:	5d                   	pop    %ebp
+ 305:	c3                   	ret
+
+00000306 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 306:	55                   	push   %ebp
+ 307:	89 e5                	mov    %esp,%ebp
+ 309:	57                   	push   %edi
+ 30a:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 30d:	89 d7                	mov    %edx,%edi
+ 30f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 312:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 315:	fc                   	cld
+ 316:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 318:	89 d0                	mov    %edx,%eax
+ 31a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 31d:	c9                   	leave
+ 31e:	c3                   	ret
+
+0000031f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 31f:	55                   	push   %ebp
+ 320:	89 e5                	mov    %esp,%ebp
+ 322:	8b 45 08             	mov    0x8(%ebp),%eax
+ 325:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 329:	eb 03                	jmp    32e <strchr+0xf>
+ 32b:	83 c0 01             	add    $0x1,%eax
+ 32e:	0f b6 10             	movzbl (%eax),%edx
+ 331:	84 d2                	test   %dl,%dl
+ 333:	74 06                	je     33b <strchr+0x1c>
+    if(*s == c)
+ 335:	38 ca                	cmp    %cl,%dl
+ 337:	75 f2                	jne    32b <strchr+0xc>
+ 339:	eb 05                	jmp    340 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 33b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+
+00000342 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 342:	55                   	push   %ebp
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	57                   	push   %edi
+ 346:	56                   	push   %esi
+ 347:	53                   	push   %ebx
+ 348:	83 ec 1c             	sub    $0x1c,%esp
+ 34b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 34e:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 353:	89 de                	mov    %ebx,%esi
+ 355:	83 c3 01             	add    $0x1,%ebx
+ 358:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 35b:	7d 2e                	jge    38b <gets+0x49>
+    cc = read(0, &c, 1);
+ 35d:	83 ec 04             	sub    $0x4,%esp
+ 360:	6a 01                	push   $0x1
+ 362:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 365:	50                   	push   %eax
+ 366:	6a 00                	push   $0x0
+ 368:	e8 ec 00 00 00       	call   459 <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 17                	jle    38b <gets+0x49>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 37b:	3c 0a                	cmp    $0xa,%al
+ 37d:	0f 94 c2             	sete   %dl
+ 380:	3c 0d                	cmp    $0xd,%al
+ 382:	0f 94 c0             	sete   %al
+ 385:	08 c2                	or     %al,%dl
+ 387:	74 ca                	je     353 <gets+0x11>
+    buf[i++] = c;
+ 389:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 38b:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 38f:	89 f8                	mov    %edi,%eax
+ 391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 394:	5b                   	pop    %ebx
+ 395:	5e                   	pop    %esi
+ 396:	5f                   	pop    %edi
+ 397:	5d                   	pop    %ebp
+ 398:	c3                   	ret
+
+00000399 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+ 39c:	56                   	push   %esi
+ 39d:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 39e:	83 ec 08             	sub    $0x8,%esp
+ 3a1:	6a 00                	push   $0x0
+ 3a3:	ff 75 08             	push   0x8(%ebp)
+ 3a6:	e8 d6 00 00 00       	call   481 <open>
+  if(fd < 0)
+ 3ab:	83 c4 10             	add    $0x10,%esp
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	78 24                	js     3d6 <stat+0x3d>
+ 3b2:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 3b4:	83 ec 08             	sub    $0x8,%esp
+ 3b7:	ff 75 0c             	push   0xc(%ebp)
+ 3ba:	50                   	push   %eax
+ 3bb:	e8 d9 00 00 00       	call   499 <fstat>
+ 3c0:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3c2:	89 1c 24             	mov    %ebx,(%esp)
+ 3c5:	e8 9f 00 00 00       	call   469 <close>
+  return r;
+ 3ca:	83 c4 10             	add    $0x10,%esp
+}
+ 3cd:	89 f0                	mov    %esi,%eax
+ 3cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d2:	5b                   	pop    %ebx
+ 3d3:	5e                   	pop    %esi
+ 3d4:	5d                   	pop    %ebp
+ 3d5:	c3                   	ret
+    return -1;
+ 3d6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3db:	eb f0                	jmp    3cd <stat+0x34>
+
+000003dd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3dd:	55                   	push   %ebp
+ 3de:	89 e5                	mov    %esp,%ebp
+ 3e0:	53                   	push   %ebx
+ 3e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 3e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 3e9:	eb 10                	jmp    3fb <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 3eb:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 3ee:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 3f1:	83 c1 01             	add    $0x1,%ecx
+ 3f4:	0f be c0             	movsbl %al,%eax
+ 3f7:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 3fb:	0f b6 01             	movzbl (%ecx),%eax
+ 3fe:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 401:	80 fb 09             	cmp    $0x9,%bl
+ 404:	76 e5                	jbe    3eb <atoi+0xe>
+  return n;
+}
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 40b:	c9                   	leave
+ 40c:	c3                   	ret
+
+0000040d <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 40d:	55                   	push   %ebp
+ 40e:	89 e5                	mov    %esp,%ebp
+ 410:	56                   	push   %esi
+ 411:	53                   	push   %ebx
+ 412:	8b 75 08             	mov    0x8(%ebp),%esi
+ 415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 418:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 41b:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 41d:	eb 0d                	jmp    42c <memmove+0x1f>
+    *dst++ = *src++;
+ 41f:	0f b6 01             	movzbl (%ecx),%eax
+ 422:	88 02                	mov    %al,(%edx)
+ 424:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 427:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 42a:	89 d8                	mov    %ebx,%eax
+ 42c:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 42f:	85 c0                	test   %eax,%eax
+ 431:	7f ec                	jg     41f <memmove+0x12>
+  return vdst;
+}
+ 433:	89 f0                	mov    %esi,%eax
+ 435:	5b                   	pop    %ebx
+ 436:	5e                   	pop    %esi
+ 437:	5d                   	pop    %ebp
+ 438:	c3                   	ret
+
+00000439 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 439:	b8 01 00 00 00       	mov    $0x1,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <exit>:
+SYSCALL(exit)
+ 441:	b8 02 00 00 00       	mov    $0x2,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <wait>:
+SYSCALL(wait)
+ 449:	b8 03 00 00 00       	mov    $0x3,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <pipe>:
+SYSCALL(pipe)
+ 451:	b8 04 00 00 00       	mov    $0x4,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <read>:
+SYSCALL(read)
+ 459:	b8 05 00 00 00       	mov    $0x5,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <write>:
+SYSCALL(write)
+ 461:	b8 10 00 00 00       	mov    $0x10,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <close>:
+SYSCALL(close)
+ 469:	b8 15 00 00 00       	mov    $0x15,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <kill>:
+SYSCALL(kill)
+ 471:	b8 06 00 00 00       	mov    $0x6,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <exec>:
+SYSCALL(exec)
+ 479:	b8 07 00 00 00       	mov    $0x7,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <open>:
+SYSCALL(open)
+ 481:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <mknod>:
+SYSCALL(mknod)
+ 489:	b8 11 00 00 00       	mov    $0x11,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <unlink>:
+SYSCALL(unlink)
+ 491:	b8 12 00 00 00       	mov    $0x12,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <fstat>:
+SYSCALL(fstat)
+ 499:	b8 08 00 00 00       	mov    $0x8,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <link>:
+SYSCALL(link)
+ 4a1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <mkdir>:
+SYSCALL(mkdir)
+ 4a9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <chdir>:
+SYSCALL(chdir)
+ 4b1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <dup>:
+SYSCALL(dup)
+ 4b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <getpid>:
+SYSCALL(getpid)
+ 4c1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <sbrk>:
+SYSCALL(sbrk)
+ 4c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <sleep>:
+SYSCALL(sleep)
+ 4d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <uptime>:
+SYSCALL(uptime)
+ 4d9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <setpri>:
+SYSCALL(setpri)
+ 4e1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <getpri>:
+SYSCALL(getpri)
+ 4e9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <fork2>:
+SYSCALL(fork2)
+ 4f1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <getpinfo>:
+SYSCALL(getpinfo)
+ 4f9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <mmap>:
+SYSCALL(mmap)
+ 501:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <munmap>:
+SYSCALL(munmap)
+ 509:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <shmat>:
+SYSCALL(shmat)
+ 511:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <shmdt>:
+SYSCALL(shmdt)
+ 519:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <getvmstat>:
+SYSCALL(getvmstat)
+ 521:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <getbstat>:
+SYSCALL(getbstat)
+ 529:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 531:	b8 20 00 00 00       	mov    $0x20,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <fsync>:
+SYSCALL(fsync)
+ 539:	b8 21 00 00 00       	mov    $0x21,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <getdcstat>:
+SYSCALL(getdcstat)
+ 541:	b8 22 00 00 00       	mov    $0x22,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <pread>:
+SYSCALL(pread)
+ 549:	b8 23 00 00 00       	mov    $0x23,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <pwrite>:
+SYSCALL(pwrite)
+ 551:	b8 24 00 00 00       	mov    $0x24,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <readv>:
+SYSCALL(readv)
+ 559:	b8 25 00 00 00       	mov    $0x25,%eax
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <writev>:
+SYSCALL(writev)
+ 561:	b8 26 00 00 00       	mov    $0x26,%eax
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <sendfile>:
+SYSCALL(sendfile)
+ 569:	b8 27 00 00 00       	mov    $0x27,%eax
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <splice>:
+SYSCALL(splice)
+ 571:	b8 28 00 00 00       	mov    $0x28,%eax
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 579:	55                   	push   %ebp
+ 57a:	89 e5                	mov    %esp,%ebp
+ 57c:	83 ec 1c             	sub    $0x1c,%esp
+ 57f:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 582:	6a 01                	push   $0x1
+ 584:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 587:	52                   	push   %edx
+ 588:	50                   	push   %eax
+ 589:	e8 d3 fe ff ff       	call   461 <write>
+}
+ 58e:	83 c4 10             	add    $0x10,%esp
+ 591:	c9                   	leave
+ 592:	c3                   	ret
+
+00000593 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 593:	55                   	push   %ebp
+ 594:	89 e5                	mov    %esp,%ebp
+ 596:	57                   	push   %edi
+ 597:	56                   	push   %esi
+ 598:	53                   	push   %ebx
+ 599:	83 ec 2c             	sub    $0x2c,%esp
+ 59c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 59f:	89 d0                	mov    %edx,%eax
+ 5a1:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 5a3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 5a7:	0f 95 c1             	setne  %cl
+ 5aa:	c1 ea 1f             	shr    $0x1f,%edx
+ 5ad:	84 d1                	test   %dl,%cl
+ 5af:	74 44                	je     5f5 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 5b1:	f7 d8                	neg    %eax
+ 5b3:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 5b5:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 5c1:	89 c8                	mov    %ecx,%eax
+ 5c3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c8:	f7 f6                	div    %esi
+ 5ca:	89 df                	mov    %ebx,%edi
+ 5cc:	83 c3 01             	add    $0x1,%ebx
+ 5cf:	0f b6 92 64 09 00 00 	movzbl 0x964(%edx),%edx
+ 5d6:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 5da:	89 ca                	mov    %ecx,%edx
+ 5dc:	89 c1                	mov    %eax,%ecx
+ 5de:	39 f2                	cmp    %esi,%edx
+ 5e0:	73 df                	jae    5c1 <printint+0x2e>
+  if(neg)
+ 5e2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 5e6:	74 31                	je     619 <printint+0x86>
+    buf[i++] = '-';
+ 5e8:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 5ed:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 5f0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5f3:	eb 17                	jmp    60c <printint+0x79>
+    x = xx;
+ 5f5:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 5f7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5fe:	eb bc                	jmp    5bc <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 600:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 605:	89 f0                	mov    %esi,%eax
+ 607:	e8 6d ff ff ff       	call   579 <putc>
+  while(--i >= 0)
+ 60c:	83 eb 01             	sub    $0x1,%ebx
+ 60f:	79 ef                	jns    600 <printint+0x6d>
+}
+ 611:	83 c4 2c             	add    $0x2c,%esp
+ 614:	5b                   	pop    %ebx
+ 615:	5e                   	pop    %esi
+ 616:	5f                   	pop    %edi
+ 617:	5d                   	pop    %ebp
+ 618:	c3                   	ret
+ 619:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 61c:	eb ee                	jmp    60c <printint+0x79>
+
+0000061e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 61e:	55                   	push   %ebp
+ 61f:	89 e5                	mov    %esp,%ebp
+ 621:	57                   	push   %edi
+ 622:	56                   	push   %esi
+ 623:	53                   	push   %ebx
+ 624:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 627:	8d 45 10             	lea    0x10(%ebp),%eax
+ 62a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 62d:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 632:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 637:	eb 14                	jmp    64d <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 639:	89 fa                	mov    %edi,%edx
+ 63b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63e:	e8 36 ff ff ff       	call   579 <putc>
+ 643:	eb 05                	jmp    64a <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 645:	83 fe 25             	cmp    $0x25,%esi
+ 648:	74 25                	je     66f <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 64a:	83 c3 01             	add    $0x1,%ebx
+ 64d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 650:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 654:	84 c0                	test   %al,%al
+ 656:	0f 84 20 01 00 00    	je     77c <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 65c:	0f be f8             	movsbl %al,%edi
+ 65f:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 662:	85 f6                	test   %esi,%esi
+ 664:	75 df                	jne    645 <printf+0x27>
+      if(c == '%'){
+ 666:	83 f8 25             	cmp    $0x25,%eax
+ 669:	75 ce                	jne    639 <printf+0x1b>
+        state = '%';
+ 66b:	89 c6                	mov    %eax,%esi
+ 66d:	eb db                	jmp    64a <printf+0x2c>
+      if(c == 'd'){
+ 66f:	83 f8 25             	cmp    $0x25,%eax
+ 672:	0f 84 cf 00 00 00    	je     747 <printf+0x129>
+ 678:	0f 8c dd 00 00 00    	jl     75b <printf+0x13d>
+ 67e:	83 f8 78             	cmp    $0x78,%eax
+ 681:	0f 8f d4 00 00 00    	jg     75b <printf+0x13d>
+ 687:	83 f8 63             	cmp    $0x63,%eax
+ 68a:	0f 8c cb 00 00 00    	jl     75b <printf+0x13d>
+ 690:	83 e8 63             	sub    $0x63,%eax
+ 693:	83 f8 15             	cmp    $0x15,%eax
+ 696:	0f 87 bf 00 00 00    	ja     75b <printf+0x13d>
+ 69c:	ff 24 85 0c 09 00 00 	jmp    *0x90c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 6a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6a6:	8b 17                	mov    (%edi),%edx
+ 6a8:	83 ec 0c             	sub    $0xc,%esp
+ 6ab:	6a 01                	push   $0x1
+ 6ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b5:	e8 d9 fe ff ff       	call   593 <printint>
+        ap++;
+ 6ba:	83 c7 04             	add    $0x4,%edi
+ 6bd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 6c0:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 6c3:	be 00 00 00 00       	mov    $0x0,%esi
+ 6c8:	eb 80                	jmp    64a <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 6ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6cd:	8b 17                	mov    (%edi),%edx
+ 6cf:	83 ec 0c             	sub    $0xc,%esp
+ 6d2:	6a 00                	push   $0x0
+ 6d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6dc:	e8 b2 fe ff ff       	call   593 <printint>
+        ap++;
+ 6e1:	83 c7 04             	add    $0x4,%edi
+ 6e4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 6e7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ea:	be 00 00 00 00       	mov    $0x0,%esi
+ 6ef:	e9 56 ff ff ff       	jmp    64a <printf+0x2c>
+        s = (char*)*ap;
+ 6f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6f7:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 6f9:	83 c0 04             	add    $0x4,%eax
+ 6fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 6ff:	85 f6                	test   %esi,%esi
+ 701:	75 15                	jne    718 <printf+0xfa>
+          s = "(null)";
+ 703:	be 02 09 00 00       	mov    $0x902,%esi
+ 708:	eb 0e                	jmp    718 <printf+0xfa>
+          putc(fd, *s);
+ 70a:	0f be d2             	movsbl %dl,%edx
+ 70d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 710:	e8 64 fe ff ff       	call   579 <putc>
+          s++;
+ 715:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 718:	0f b6 16             	movzbl (%esi),%edx
+ 71b:	84 d2                	test   %dl,%dl
+ 71d:	75 eb                	jne    70a <printf+0xec>
+      state = 0;
+ 71f:	be 00 00 00 00       	mov    $0x0,%esi
+ 724:	e9 21 ff ff ff       	jmp    64a <printf+0x2c>
+        putc(fd, *ap);
+ 729:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 72c:	0f be 17             	movsbl (%edi),%edx
+ 72f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 732:	e8 42 fe ff ff       	call   579 <putc>
+        ap++;
+ 737:	83 c7 04             	add    $0x4,%edi
+ 73a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 73d:	be 00 00 00 00       	mov    $0x0,%esi
+ 742:	e9 03 ff ff ff       	jmp    64a <printf+0x2c>
+        putc(fd, c);
+ 747:	89 fa                	mov    %edi,%edx
+ 749:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74c:	e8 28 fe ff ff       	call   579 <putc>
+      state = 0;
+ 751:	be 00 00 00 00       	mov    $0x0,%esi
+ 756:	e9 ef fe ff ff       	jmp    64a <printf+0x2c>
+        putc(fd, '%');
+ 75b:	ba 25 00 00 00       	mov    $0x25,%edx
+ 760:	8b 45 08             	mov    0x8(%ebp),%eax
+ 763:	e8 11 fe ff ff       	call   579 <putc>
+        putc(fd, c);
+ 768:	89 fa                	mov    %edi,%edx
+ 76a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76d:	e8 07 fe ff ff       	call   579 <putc>
+      state = 0;
+ 772:	be 00 00 00 00       	mov    $0x0,%esi
+ 777:	e9 ce fe ff ff       	jmp    64a <printf+0x2c>
+    }
+  }
+}
+ 77c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 77f:	5b                   	pop    %ebx
+ 780:	5e                   	pop    %esi
+ 781:	5f                   	pop    %edi
+ 782:	5d                   	pop    %ebp
+ 783:	c3                   	ret
+
+00000784 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 784:	55                   	push   %ebp
+ 785:	89 e5                	mov    %esp,%ebp
+ 787:	57                   	push   %edi
+ 788:	56                   	push   %esi
+ 789:	53                   	push   %ebx
+ 78a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 78d:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 790:	a1 c0 10 00 00       	mov    0x10c0,%eax
+ 795:	eb 02                	jmp    799 <free+0x15>
+ 797:	89 d0                	mov    %edx,%eax
+ 799:	39 c8                	cmp    %ecx,%eax
+ 79b:	73 04                	jae    7a1 <free+0x1d>
+ 79d:	3b 08                	cmp    (%eax),%ecx
+ 79f:	72 12                	jb     7b3 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a1:	8b 10                	mov    (%eax),%edx
+ 7a3:	39 d0                	cmp    %edx,%eax
+ 7a5:	72 f0                	jb     797 <free+0x13>
+ 7a7:	39 c8                	cmp    %ecx,%eax
+ 7a9:	72 08                	jb     7b3 <free+0x2f>
+ 7ab:	39 d1                	cmp    %edx,%ecx
+ 7ad:	72 04                	jb     7b3 <free+0x2f>
+ 7af:	89 d0                	mov    %edx,%eax
+ 7b1:	eb e6                	jmp    799 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7b3:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7b6:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7b9:	8b 10                	mov    (%eax),%edx
+ 7bb:	39 d7                	cmp    %edx,%edi
+ 7bd:	74 19                	je     7d8 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7bf:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7c2:	8b 50 04             	mov    0x4(%eax),%edx
+ 7c5:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 7c8:	39 ce                	cmp    %ecx,%esi
+ 7ca:	74 1b                	je     7e7 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 7cc:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 7ce:	a3 c0 10 00 00       	mov    %eax,0x10c0
+}
+ 7d3:	5b                   	pop    %ebx
+ 7d4:	5e                   	pop    %esi
+ 7d5:	5f                   	pop    %edi
+ 7d6:	5d                   	pop    %ebp
+ 7d7:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 7d8:	03 72 04             	add    0x4(%edx),%esi
+ 7db:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7de:	8b 10                	mov    (%eax),%edx
+ 7e0:	8b 12                	mov    (%edx),%edx
+ 7e2:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 7e5:	eb db                	jmp    7c2 <free+0x3e>
+    p->s.size += bp->s.size;
+ 7e7:	03 53 fc             	add    -0x4(%ebx),%edx
+ 7ea:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7ed:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 7f0:	89 10                	mov    %edx,(%eax)
+ 7f2:	eb da                	jmp    7ce <free+0x4a>
+
+000007f4 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7f4:	55                   	push   %ebp
+ 7f5:	89 e5                	mov    %esp,%ebp
+ 7f7:	53                   	push   %ebx
+ 7f8:	83 ec 04             	sub    $0x4,%esp
+ 7fb:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7fd:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 802:	77 05                	ja     809 <morecore+0x15>
+    nu = 4096;
+ 804:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 809:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 810:	83 ec 0c             	sub    $0xc,%esp
+ 813:	50                   	push   %eax
+ 814:	e8 b0 fc ff ff       	call   4c9 <sbrk>
+  if(p == (char*)-1)
+ 819:	83 c4 10             	add    $0x10,%esp
+ 81c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 81f:	74 1c                	je     83d <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 821:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 824:	83 c0 08             	add    $0x8,%eax
+ 827:	83 ec 0c             	sub    $0xc,%esp
+ 82a:	50                   	push   %eax
+ 82b:	e8 54 ff ff ff       	call   784 <free>
+  return freep;
+ 830:	a1 c0 10 00 00       	mov    0x10c0,%eax
+ 835:	83 c4 10             	add    $0x10,%esp
+}
+ 838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 83b:	c9                   	leave
+ 83c:	c3                   	ret
+    return 0;
+ 83d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 842:	eb f4                	jmp    838 <morecore+0x44>
+
+00000844 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 844:	55                   	push   %ebp
+ 845:	89 e5                	mov    %esp,%ebp
+ 847:	53                   	push   %ebx
+ 848:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 84b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84e:	8d 58 07             	lea    0x7(%eax),%ebx
+ 851:	c1 eb 03             	shr    $0x3,%ebx
+ 854:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 857:	8b 0d c0 10 00 00    	mov    0x10c0,%ecx
+ 85d:	85 c9                	test   %ecx,%ecx
+ 85f:	74 04                	je     865 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 861:	8b 01                	mov    (%ecx),%eax
+ 863:	eb 4a                	jmp    8af <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 865:	c7 05 c0 10 00 00 c4 	movl   $0x10c4,0x10c0
+ 86c:	10 00 00 
+ 86f:	c7 05 c4 10 00 00 c4 	movl   $0x10c4,0x10c4
+ 876:	10 00 00 
+    base.s.size = 0;
+ 879:	c7 05 c8 10 00 00 00 	movl   $0x0,0x10c8
+ 880:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 883:	b9 c4 10 00 00       	mov    $0x10c4,%ecx
+ 888:	eb d7                	jmp    861 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 88a:	74 19                	je     8a5 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 88c:	29 da                	sub    %ebx,%edx
+ 88e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 891:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 894:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 897:	89 0d c0 10 00 00    	mov    %ecx,0x10c0
+      return (void*)(p + 1);
+ 89d:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 8a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8a3:	c9                   	leave
+ 8a4:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 8a5:	8b 10                	mov    (%eax),%edx
+ 8a7:	89 11                	mov    %edx,(%ecx)
+ 8a9:	eb ec                	jmp    897 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ab:	89 c1                	mov    %eax,%ecx
+ 8ad:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 8af:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b2:	39 da                	cmp    %ebx,%edx
+ 8b4:	73 d4                	jae    88a <malloc+0x46>
+    if(p == freep)
+ 8b6:	39 05 c0 10 00 00    	cmp    %eax,0x10c0
+ 8bc:	75 ed                	jne    8ab <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 8be:	89 d8                	mov    %ebx,%eax
+ 8c0:	e8 2f ff ff ff       	call   7f4 <morecore>
+ 8c5:	85 c0                	test   %eax,%eax
+ 8c7:	75 e2                	jne    8ab <malloc+0x67>
+ 8c9:	eb d5                	jmp    8a0 <malloc+0x5c>
@@ -1,4 +1,7 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.  Uses bus-master DMA through the PIIX
+// controller when there is one, PIO otherwise.  A block may
+// be several sectors; for PIO the disk is then put in multiple
+// mode, so that it interrupts once per block, not per sector.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +15,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "diskstat.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,15 +28,48 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_SETMUL 0xc6
+
+// Bus-master IDE registers, from the controller's BAR4.
+#define BM_CMD        0     // command
+#define BM_STATUS     2     // status
+#define BM_PRDT       4     // physical address of the PRD table
+#define BM_START      0x01  // command: start transfer
+#define BM_READ       0x08  // command: disk to memory
+#define BM_ERR        0x02  // status: error
+#define BM_INTR       0x04  // status: interrupt (write 1 to clear)
+#define BM_DMA0       0x20  // status: drive 0 can do DMA
+#define BM_DMA1       0x40  // status: drive 1 can do DMA
+
+// Physical region descriptor: one piece of a DMA transfer.
+// No piece may cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last descriptor in the table
+
+#define IDEMAXRUN     16    // most requests merged into one command
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The first idenrun bufs on the queue are being moved by one
+// disk command; the rest are kept in C-LOOK elevator order
+// (see idesort).
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenrun;
+static struct diskstat idestat;
 
 static int havedisk1;
+static int idemult[2];  // sectors per interrupt set on each disk, 0 if none
+static uint idebm;  // bus-master register base, or 0 to use PIO
+static struct prd prdt[IDEMAXRUN] __attribute__((aligned(IDEMAXRUN*sizeof(struct prd))));
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -50,12 +88,19 @@ idewait(int checkerr)
 void
 ideinit(void)
 {
+  struct pcidev pd;
   int i;
 
   initlock(&idelock, "ide");
   ioapicenable(IRQ_IDE, ncpu - 1);
   idewait(0);
 
+  for(i = 0; i < NBDEV; i++){
+    bdevsw[i].rw = iderw;
+    bdevsw[i].submit = idesubmit;
+    bdevsw[i].stat = idegetstat;
+  }
+
   // Check if disk 1 is present
   outb(0x1f6, 0xe0 | (1<<4));
   for(i=0; i<1000; i++){
@@ -67,43 +112,133 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // Use DMA if there is a bus-master IDE controller
+  // (programming interface bit 7).
+  if(pcifindclass(0x01, 0x01, &pd) == 0 && (pd.progif & 0x80) &&
+     (idebm = pciiobase(&pd, 4)) != 0){
+    pcienable(&pd, PCI_CMD_IO|PCI_CMD_MASTER);
+    outb(idebm+BM_CMD, 0);
+    outb(idebm+BM_STATUS, BM_INTR|BM_ERR|BM_DMA0|BM_DMA1);
+  }
+}
+
+// Have disk dev move n sectors per interrupt in the
+// multiple-sector PIO commands, if it is not set up so.
+// Interrupts are off meanwhile: ideintr would take this
+// command's for a transfer's.
+// Caller must hold idelock.
+static void
+idesetmult(int dev, int n)
+{
+  if(idemult[dev] == n)
+    return;
+  idewait(0);
+  outb(0x3f6, 2);  // no interrupts
+  outb(0x1f2, n);
+  outb(0x1f6, 0xe0 | (dev<<4));
+  outb(0x1f7, IDE_CMD_SETMUL);
+  if(idewait(1) < 0)
+    panic("ide: no multiple mode");
+  idemult[dev] = n;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, along with any bufs queued after
+// it for the blocks that follow b's on the disk.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *q;
+  int i, n;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector_per_block =  bsize/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if(sector >= (FSSIZE + NSWAP)*(MAXBSIZE/SECTOR_SIZE))
+    panic("incorrect blockno");
+  if(!idebm && sector_per_block > 1)
+    idesetmult(b->dev&1, sector_per_block);
+
+  // Merge a run of adjacent requests into one command.
+  // With PIO the disk interrupts once per block (a DRQ block
+  // in multiple mode); DMA interrupts once at the end.
+  n = 1;
+  for(q = b; n < IDEMAXRUN && q->qnext; q = q->qnext, n++){
+    if(q->qnext->dev != b->dev || q->qnext->blockno != q->blockno + 1)
+      break;
+    if((q->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+  }
+  idenrun = n;
+  idestat.cmds++;
+  idestat.merged += n - 1;
+
+  if(idebm){
+    // One descriptor per buf: a buf's data never crosses a
+    // page, let alone 64KB.
+    for(i = 0, q = b; i < n; i++, q = q->qnext){
+      prdt[i].addr = V2P(q->data);
+      prdt[i].len = bsize;
+      prdt[i].flags = (i == n-1) ? PRD_EOT : 0;
+    }
+    outl(idebm+BM_PRDT, V2P(prdt));
+    outb(idebm+BM_STATUS, BM_INTR|BM_ERR);
+    outb(idebm+BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+  }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, n * sector_per_block);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(idebm){
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(idebm+BM_CMD, inb(idebm+BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    outsl(0x1f0, b->data, bsize/4);
   } else {
     outb(0x1f7, read_cmd);
   }
 }
 
+// Take the finished request b off the head of idequeue and
+// wake the process waiting for it.  A buf with a done callback
+// is added to *donelist instead, for the caller to finish
+// once it has released idelock.
+// Caller must hold idelock.
+static void
+idedone(struct buf *b, struct buf **donelist)
+{
+  idequeue = b->qnext;
+  idenrun--;
+  if(b->flags & B_DIRTY)
+    idestat.writes++;
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  idestat.reqs++;
+  idestat.depth--;
+  idestat.waitticks += ticks - b->qtime;
+  if(b->done){
+    b->qnext = *donelist;
+    *donelist = b;
+  } else
+    wakeup(b);
+}
+
 // Interrupt handler.
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *donelist;
+  void (*done)(struct buf*);
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -112,32 +247,85 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
+  donelist = 0;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idebm){
+    // The whole command is done.
+    if((inb(idebm+BM_STATUS) & BM_INTR) == 0){
+      release(&idelock);
+      return;
+    }
+    outb(idebm+BM_CMD, 0);
+    outb(idebm+BM_STATUS, BM_INTR|BM_ERR);
+    idewait(1);  // reading the status acknowledges the disk
+    while(idenrun > 0)
+      idedone(idequeue, &donelist);
+  } else {
+    // Read data if needed.
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+      insl(0x1f0, b->data, bsize/4);
+    idedone(b, &donelist);
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // The command goes on with the next buf; a write
+    // must hand the disk its data.
+    if(idenrun > 0 && (idequeue->flags & B_DIRTY)){
+      idewait(0);
+      outsl(0x1f0, idequeue->data, bsize/4);
+    }
+  }
 
   // Start disk on next buf in queue.
-  if(idequeue != 0)
+  if(idenrun == 0 && idequeue != 0)
     idestart(idequeue);
 
   release(&idelock);
+
+  // Finish asynchronous requests outside idelock.
+  while((b = donelist) != 0){
+    donelist = b->qnext;
+    done = b->done;
+    b->done = 0;
+    done(b);
+  }
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Insert b into idequeue behind the active command.  The
+// elevator sweeps upward from the block the disk is at: first
+// the requests at or above it in ascending order, then it
+// jumps back to the lowest (C-LOOK).
+// Caller must hold idelock.
+static void
+idesort(struct buf *b)
 {
-  struct buf **pp;
+  struct buf **pp, *last;
+  int i;
+
+  pp = &idequeue;
+  last = 0;
+  for(i = 0; i < idenrun; i++){
+    last = *pp;
+    pp = &last->qnext;
+  }
+  if(last != 0){
+    if(b->blockno > last->blockno){
+      while(*pp && (*pp)->blockno > last->blockno && (*pp)->blockno <= b->blockno)
+        pp = &(*pp)->qnext;
+    } else {
+      while(*pp && (*pp)->blockno > last->blockno)
+        pp = &(*pp)->qnext;
+      while(*pp && (*pp)->blockno <= b->blockno)
+        pp = &(*pp)->qnext;
+    }
+  }
+  b->qnext = *pp;
+  *pp = b;
+}
 
+// Add b to idequeue, starting the disk if it is idle.
+// Caller must hold idelock.
+static void
+idequeueadd(struct buf *b)
+{
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -145,23 +333,50 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  b->qtime = ticks;
+  idesort(b);
+  if(++idestat.depth > idestat.maxdepth)
+    idestat.maxdepth = idestat.depth;
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idenrun == 0)
+    idestart(idequeue);
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  acquire(&idelock);  //DOC:acquire-lock
+  b->done = 0;
+  idequeueadd(b);
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
+  release(&idelock);
+}
 
+// Start reading or writing buf like iderw, but return at once.
+// When the request finishes the interrupt handler calls
+// b->done(b), if it is set, which then owns b.
+void
+idesubmit(struct buf *b)
+{
+  acquire(&idelock);
+  idequeueadd(b);
+  release(&idelock);
+}
+
+// Copy the disk queue statistics to st.
+void
+idegetstat(struct diskstat *st)
+{
+  acquire(&idelock);
+  *st = idestat;
   release(&idelock);
 }
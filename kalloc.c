@@ -21,8 +21,18 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;  // number of pages on freelist
+  ushort ref[PHYSTOP/PGSIZE];  // mappings of each physical page
 } kmem;
 
+// 4MB pages for MAP_HUGE regions.  They are carved out of
+// the top of physical memory, [SUPERSTART, PHYSTOP), which
+// main() keeps off the 4096-byte free list.
+struct {
+  struct spinlock lock;
+  uchar ref[NSUPERPG];  // mappings of each 4MB page; 0 if free
+} superpg;
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -41,6 +51,7 @@ kinit2(void *vstart, void *vend)
 {
   freerange(vstart, vend);
   kmem.use_lock = 1;
+  initlock(&superpg.lock, "superpg");
 }
 
 void
@@ -55,6 +66,8 @@ freerange(void *vstart, void *vend)
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// If kref() has been used to share the page, only
+// drop one reference.
 void
 kfree(char *v)
 {
@@ -63,6 +76,18 @@ kfree(char *v)
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] > 1){
+    kmem.ref[V2P(v)/PGSIZE]--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  kmem.ref[V2P(v)/PGSIZE] = 0;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
@@ -71,6 +96,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -86,10 +112,108 @@ kalloc(void)
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Add a reference to the page at v, so that
+// it is only freed by the matching extra kfree().
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kref");
+  acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] < 1)
+    panic("kref: free page");
+  kmem.ref[V2P(v)/PGSIZE]++;
+  release(&kmem.lock);
+}
+
+// Return the number of references to the page at v.
+int
+krefcount(char *v)
+{
+  int n;
+
+  acquire(&kmem.lock);
+  n = kmem.ref[V2P(v)/PGSIZE];
+  release(&kmem.lock);
+  return n;
+}
+
+// Return the number of free pages.
+int
+kfreepages(void)
+{
+  int n;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  n = kmem.nfree;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return n;
+}
+
+// Allocate one 4MB page of physical memory, aligned to 4MB.
+// Returns 0 if none is free.
+char*
+kallocsuper(void)
+{
+  int i;
+
+  acquire(&superpg.lock);
+  for(i = 0; i < NSUPERPG; i++){
+    if(superpg.ref[i] == 0){
+      superpg.ref[i] = 1;
+      release(&superpg.lock);
+      return P2V(SUPERSTART + i*SUPERPGSIZE);
+    }
+  }
+  release(&superpg.lock);
+  return 0;
+}
+
+static int
+superindex(char *v)
+{
+  if((uint)v % SUPERPGSIZE || V2P(v) < SUPERSTART || V2P(v) >= PHYSTOP)
+    panic("superindex");
+  return (V2P(v) - SUPERSTART) / SUPERPGSIZE;
+}
+
+// Drop a reference to the 4MB page at v, freeing it
+// when it was the last.
+void
+kfreesuper(char *v)
+{
+  int i;
+
+  i = superindex(v);
+  acquire(&superpg.lock);
+  if(superpg.ref[i] < 1)
+    panic("kfreesuper");
+  superpg.ref[i]--;
+  release(&superpg.lock);
+}
+
+// Add a reference to the 4MB page at v.
+void
+krefsuper(char *v)
+{
+  int i;
+
+  i = superindex(v);
+  acquire(&superpg.lock);
+  if(superpg.ref[i] < 1)
+    panic("krefsuper");
+  superpg.ref[i]++;
+  release(&superpg.lock);
+}
@@ -1,6 +1,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -9,16 +11,38 @@
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
-// any reasoning required about whether a commit might
-// write an uncommitted system call's updates to disk.
+// calls. A transaction is only closed when there are no FS
+// system calls active in it. Thus there is never any reasoning
+// required about whether a commit might write an uncommitted
+// system call's updates to disk.
 //
 // A system call should call begin_op()/end_op() to mark
-// its start and end. Usually begin_op() just increments
-// the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// its start and end. begin_op() reserves room in the log for
+// MAXOPBLOCKS blocks; begin_opn(n) reserves n, for calls that
+// write more (see filewritei). Usually begin_op() just counts
+// the in-progress FS system call and its reservation and
+// returns. But if the log might run out, it sleeps until the
+// open transaction has been closed. Each block a call logs
+// uses up one block of its reservation, and end_op() gives
+// back what is left.
+//
+// Commits are done by a kernel thread (committer), so end_op()
+// does not wait for the disk.  The committer closes the open
+// transaction once its last system call ends, copies the blocks
+// it changed, and lets new system calls start a new transaction
+// while it writes the copies to the log and to their home
+// locations.  System calls that run while a commit is in
+// progress all join the next one.  Use log_sync() to wait for
+// changes to reach the disk.
+//
+// File data is not journaled (ordered mode, as in ext3):
+// log_writedata() records a data block, and the commit writes
+// it straight to its home location before the header that
+// commits the metadata pointing at it.  A data block freed
+// earlier in the same transaction (see log_free) may still hold
+// metadata the disk needs until the commit, so it is journaled
+// after all.  Data blocks count against the log space like
+// journaled ones, so that there is always room for that.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -27,7 +51,6 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -41,19 +64,52 @@ struct log {
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int closing;     // committer is closing the transaction, please wait.
+  int reserved;    // blocks reserved by FS sys calls and not yet logged
+  int waiting;     // begin_op calls waiting for log space
   int dev;
   struct logheader lh;
+  struct buf *pin[LOGSIZE];  // cache bufs of lh.block, pinned
+  int ndata;                 // ordered data blocks
+  int data[LOGSIZE];
+  struct buf *datapin[LOGSIZE];
+  int nfreed;                // blocks freed in this transaction
+  int freed[LOGSIZE];
+  int freedall;              // freed[] overflowed; journal all data
+  uint opened;     // sequence number of the open transaction
+  uint committed;  // last transaction known to be on disk
+  uint syncing;    // close transaction syncing early, for log_sync
+  int nio;         // commit writes in flight
 };
 struct log log;
 
+// The transaction being committed: copies of the blocks it
+// changed, taken when it was closed, and private bufs to
+// write them with, bypassing the cache.  data[] holds the
+// journaled blocks of lh, then the ordered data blocks; the
+// block size is only known at boot, so initlog allocates it.
+static struct {
+  struct logheader lh;
+  int ndata;
+  int dblock[LOGSIZE];
+  int npin;
+  struct buf *pin[LOGSIZE];
+  uchar *data[LOGSIZE];
+  uchar *head;
+  struct buf io[LOGSIZE];
+} snap;
+
 static void recover_from_log(void);
 static void commit();
+static void committer(void);
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
+  char *mem;
+  int i;
+
+  if (sizeof(struct logheader) >= bsize)
     panic("initlog: too big logheader");
 
   struct superblock sb;
@@ -62,7 +118,24 @@ initlog(int dev)
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  if(log.size - 1 > LOGSIZE || log.size - 1 < 2*MAXOPBLOCKS)
+    panic("initlog: bad log size");
+  log.opened = 1;
+  for(i = 0; i < LOGSIZE; i++)
+    initsleeplock(&snap.io[i].lock, "logio");
+  mem = 0;
+  for(i = 0; i < log.size; i++){
+    if(i % (PGSIZE/bsize) == 0 && (mem = kalloc()) == 0)
+      panic("initlog: no memory");
+    if(i == 0)
+      snap.head = (uchar*)mem;
+    else
+      snap.data[i-1] = (uchar*)mem;
+    mem += bsize;
+  }
   recover_from_log();
+  if(kthread("committer", committer) < 0)
+    panic("initlog: committer");
 }
 
 // Copy committed blocks from log to their home location
@@ -74,7 +147,7 @@ install_trans(void)
   for (tail = 0; tail < log.lh.n; tail++) {
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
     struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+    memmove(dbuf->data, lbuf->data, bsize);  // copy block to dst
     bwrite(dbuf);  // write dst to disk
     brelse(lbuf);
     brelse(dbuf);
@@ -96,8 +169,6 @@ read_head(void)
 }
 
 // Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
 static void
 write_head(void)
 {
@@ -121,89 +192,256 @@ recover_from_log(void)
   write_head(); // clear the log
 }
 
-// called at the start of each FS system call.
+// called at the start of each FS system call that
+// writes at most n blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n > log_maxop())
+    panic("begin_opn: too many blocks");
+
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.ndata + log.reserved + n > log.size - 1){
       // this op might exhaust log space; wait for commit.
+      log.waiting++;
+      wakeup(&log.lh);
       sleep(&log, &log.lock);
+      log.waiting--;
     } else {
       log.outstanding += 1;
+      log.reserved += n;
+      myproc()->logres = n;
       release(&log.lock);
       break;
     }
   }
 }
 
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
+// The most blocks one FS system call may reserve: half
+// the log, so that two can run at once.
+int
+log_maxop(void)
+{
+  return (log.size - 1) / 2;
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// lets the committer close the transaction if this was
+// the last outstanding operation.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
+  log.reserved -= myproc()->logres;
+  myproc()->logres = 0;
+  // begin_op() may be waiting for log space, and
+  // this op's unused reservation is free again; the
+  // committer may be waiting for the transaction to drain.
+  wakeup(&log);
+  wakeup(&log.lh);
+  release(&log.lock);
+}
+
+// Wait until every change made by system calls that have
+// already ended is on disk.
+void
+log_sync(void)
+{
+  uint want;
+
+  acquire(&log.lock);
+  want = log.lh.n + log.ndata > 0 ? log.opened : log.opened - 1;
+  if(want == log.opened){
+    // Don't wait for a lull in system calls to close it.
+    log.syncing = want;
+    wakeup(&log.lh);
   }
+  while(log.committed < want)
+    sleep(&log.committed, &log.lock);
   release(&log.lock);
+}
+
+// Is blockno in the first n entries of list?
+static int
+inlist(int *list, int n, int blockno)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(list[i] == blockno)
+      return 1;
+  return 0;
+}
+
+// Move the open transaction to snap, and start a new one.
+// Caller must hold log.lock, with no FS system calls active.
+static void
+close_trans(void)
+{
+  int i, b;
+
+  snap.lh = log.lh;
+  snap.npin = 0;
+  for(i = 0; i < log.lh.n; i++)
+    snap.pin[snap.npin++] = log.pin[i];
+  snap.ndata = 0;
+  for(i = 0; i < log.ndata; i++){
+    b = log.data[i];
+    snap.pin[snap.npin++] = log.datapin[i];
+    if(log.freedall || inlist(log.freed, log.nfreed, b)){
+      if(!inlist(snap.lh.block, snap.lh.n, b))
+        snap.lh.block[snap.lh.n++] = b;
+    } else
+      snap.dblock[snap.ndata++] = b;
+  }
+  log.lh.n = 0;
+  log.ndata = 0;
+  log.nfreed = 0;
+  log.freedall = 0;
+  log.opened++;
+}
+
+// Kernel thread that commits transactions, one at a time.
+static void
+committer(void)
+{
+  int i;
+  struct buf *b;
+
+  acquire(&log.lock);
+  for(;;){
+    // Commit once the open transaction's system calls have
+    // ended, or sooner if someone is waiting for log space
+    // or in log_sync().
+    while(log.lh.n + log.ndata == 0 ||
+          (log.outstanding > 0 && log.waiting == 0 &&
+           log.syncing != log.opened))
+      sleep(&log.lh, &log.lock);
+
+    // Close it: keep new system calls out until the ones
+    // in it are done.
+    log.closing = 1;
+    while(log.outstanding > 0)
+      sleep(&log, &log.lock);
+    close_trans();
+    release(&log.lock);
+
+    // Nothing changes the blocks while it is closed.
+    for(i = 0; i < snap.lh.n + snap.ndata; i++){
+      if(i < snap.lh.n)
+        b = bread(log.dev, snap.lh.block[i]);
+      else
+        b = bread(log.dev, snap.dblock[i - snap.lh.n]);
+      memmove(snap.data[i], b->data, bsize);
+      brelse(b);
+    }
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
     acquire(&log.lock);
-    log.committing = 0;
+    log.closing = 0;
     wakeup(&log);
     release(&log.lock);
+
+    commit();
+
+    acquire(&log.lock);
+    log.committed++;
+    wakeup(&log.committed);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Called by the disk driver when a commit write finishes.
 static void
-write_log(void)
+logiodone(struct buf *b)
 {
-  int tail;
+  releasesleep(&b->lock);
+  acquire(&log.lock);
+  if(--log.nio == 0)
+    wakeup(&log.nio);
+  release(&log.lock);
+}
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+// Start writing data to block blockno, with b.
+static void
+logio(struct buf *b, uint blockno, uchar *data)
+{
+  acquiresleep(&b->lock);
+  b->dev = log.dev;
+  b->blockno = blockno;
+  b->data = data;
+  b->flags = B_DIRTY;
+  b->done = logiodone;
+  acquire(&log.lock);
+  log.nio++;
+  release(&log.lock);
+  bdevsw[b->dev].submit(b);
+}
+
+// Wait for the writes started by logio.
+static void
+logwait(void)
+{
+  acquire(&log.lock);
+  while(log.nio > 0)
+    sleep(&log.nio, &log.lock);
+  release(&log.lock);
+}
+
+// Write the snapshot's header, with n blocks, to disk.
+static void
+logwritehead(int n)
+{
+  struct logheader *hb = (struct logheader *) snap.head;
+  int i;
+
+  hb->n = n;
+  for (i = 0; i < n; i++) {
+    hb->block[i] = snap.lh.block[i];
   }
+  logio(&snap.io[0], log.start, snap.head);
+  logwait();
 }
 
+// Write the closed transaction in snap to disk.  Each pass
+// goes to the disk driver all at once, so it can sort and
+// merge the writes.
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
-  }
+  int i;
+
+  // Write the copies to the log, and the data home.
+  for(i = 0; i < snap.lh.n; i++)
+    logio(&snap.io[i], log.start+i+1, snap.data[i]);
+  for(i = snap.lh.n; i < snap.lh.n + snap.ndata; i++)
+    logio(&snap.io[i], snap.dblock[i - snap.lh.n], snap.data[i]);
+  logwait();
+  logwritehead(snap.lh.n);  // the real commit
+
+  // Now install writes to home locations.
+  for(i = 0; i < snap.lh.n; i++)
+    logio(&snap.io[i], snap.lh.block[i], snap.data[i]);
+  logwait();
+  logwritehead(0);  // Erase the transaction from the log
+
+  // The cache may drop the blocks now.
+  for(i = 0; i < snap.npin; i++)
+    bunpin(snap.pin[i]);
 }
 
 // Caller has modified b->data and is done with the buffer.
-// Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// Record the block number and pin it in the cache until the
+// committer has written it home.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -215,7 +453,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n + log.ndata >= log.size - 1)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -226,9 +464,61 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n){
+    bpin(b);  // prevent eviction
+    log.pin[i] = b;
     log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
+    if(myproc()->logres > 0){
+      myproc()->logres--;
+      log.reserved--;
+    }
+  }
+  release(&log.lock);
+}
+
+// Like log_write(), for a block of file data.  The commit
+// writes it home before the metadata, without journaling it.
+void
+log_writedata(struct buf *b)
+{
+  int i;
+
+  if (log.lh.n + log.ndata >= log.size - 1)
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+    panic("log_writedata outside of trans");
+
+  acquire(&log.lock);
+  if(inlist(log.lh.block, log.lh.n, b->blockno)){
+    // Already journaled in this transaction.
+    release(&log.lock);
+    return;
+  }
+  for (i = 0; i < log.ndata; i++) {
+    if (log.data[i] == b->blockno)   // absorption
+      break;
+  }
+  if (i == log.ndata){
+    bpin(b);
+    log.data[i] = b->blockno;
+    log.datapin[i] = b;
+    log.ndata++;
+    if(myproc()->logres > 0){
+      myproc()->logres--;
+      log.reserved--;
+    }
+  }
   release(&log.lock);
 }
 
+// Note that block b was freed in the open transaction.
+void
+log_free(uint b)
+{
+  acquire(&log.lock);
+  if(log.nfreed < LOGSIZE)
+    log.freed[log.nfreed++] = b;
+  else
+    log.freedall = 1;
+  release(&log.lock);
+}
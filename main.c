@@ -29,10 +29,15 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcinit();        // page cache
+  dcinit();        // directory entry cache
+  shminit();       // shared-memory segments
   fileinit();      // file table
   ideinit();       // disk 
+  virtioinit();    // virtio disk, if any
+  memideinit();    // in-memory disk, if any
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2(P2V(4*1024*1024), P2V(SUPERSTART)); // must come after startothers()
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
@@ -0,0 +1,98 @@
+// Fake IDE disk; stores blocks in memory.
+// Useful for running kernel without scratch disk, and for
+// timing the file system without any device latency.
+//
+// kernelmemfs links a file system image (memfs.img) into the
+// kernel; when it is there it becomes the root disk in place
+// of whatever ideinit() or virtioinit() set up (see bdevsw).
+// Changes last until the machine is turned off.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "diskstat.h"
+
+// Weak, so that kernels without an image still link.
+extern uchar _binary_memfs_img_start[] __attribute__((weak));
+extern uchar _binary_memfs_img_size[] __attribute__((weak));
+
+static struct spinlock memlock;
+static uint disksize;  // bytes
+static uchar *memdisk;
+static struct diskstat memstat;
+
+static void memiderw(struct buf*);
+static void memidesubmit(struct buf*);
+static void memidegetstat(struct diskstat*);
+
+void
+memideinit(void)
+{
+  if(_binary_memfs_img_start == 0)
+    return;
+  initlock(&memlock, "memide");
+  memdisk = _binary_memfs_img_start;
+  disksize = (uint)_binary_memfs_img_size;
+  bdevsw[ROOTDEV].rw = memiderw;
+  bdevsw[ROOTDEV].submit = memidesubmit;
+  bdevsw[ROOTDEV].stat = memidegetstat;
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+static void
+memiderw(struct buf *b)
+{
+  uchar *p;
+
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if((b->blockno + 1) * bsize > disksize)
+    panic("iderw: block out of range");
+
+  p = memdisk + b->blockno*bsize;
+
+  acquire(&memlock);
+  if(b->flags & B_DIRTY){
+    b->flags &= ~B_DIRTY;
+    memmove(p, b->data, bsize);
+    memstat.writes++;
+  } else
+    memmove(b->data, p, bsize);
+  b->flags |= B_VALID;
+  memstat.reqs++;
+  memstat.cmds++;
+  release(&memlock);
+}
+
+// There is nothing to wait for: finish at once.
+static void
+memidesubmit(struct buf *b)
+{
+  void (*done)(struct buf*);
+
+  done = b->done;
+  b->done = 0;
+  memiderw(b);
+  if(done)
+    done(b);
+}
+
+static void
+memidegetstat(struct diskstat *st)
+{
+  acquire(&memlock);
+  *st = memstat;
+  release(&memlock);
+}
@@ -18,17 +18,23 @@
 #define NINODES 200
 
 // Disk layout:
-// [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
-
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
-int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+// [ boot block | sb block | log | inode blocks | free bit map | data blocks | swap ]
+// With blocks bigger than a sector, the boot and super blocks
+// share block 0.
+
+uint bsize = 1024;  // block size (-b)
+int nboot;    // Number of blocks holding the boot and super blocks
+int nbitmap;
+int ninodeblocks;
+int nlog = 64;  // log blocks, including the header (-l)
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
+int nswappg = NSWAP;  // Swap pages (-s)
+int nswap;    // Swap blocks, one 4096-byte page per slot
 
 int fsfd;
 struct superblock sb;
-char zeroes[BSIZE];
+char zeroes[MAXBSIZE];
 uint freeinode = 1;
 uint freeblock;
 
@@ -40,6 +46,11 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+uint extmap(struct dinode *din, uint fbn);
+void dxbuild(uint rootino, struct dirent *de, int n);
+
+struct dirent rootents[NINODES];  // the root's entries but "." and ".."
+int nrootent;
 
 // convert to intel byte order
 ushort
@@ -69,20 +80,46 @@ main(int argc, char *argv[])
 {
   int i, cc, fd;
   uint rootino, inum, off;
-  struct dirent de;
-  char buf[BSIZE];
+  struct dirent dot, *de;
+  char buf[MAXBSIZE];
   struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  // -s npages: size of the swap area (0 for none).
+  // -l nblocks: size of the log, including its header block.
+  // -b bytes: block size.
+  while(argc > 1 && argv[1][0] == '-'){
+    if(strcmp(argv[1], "-s") == 0 && argc > 2){
+      nswappg = atoi(argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if(strcmp(argv[1], "-b") == 0 && argc > 2){
+      bsize = atoi(argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if(strcmp(argv[1], "-l") == 0 && argc > 2){
+      nlog = atoi(argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else
+      argc = 0;
+  }
+  if(argc < 2 || nswappg < 0 || nlog < 2*MAXOPBLOCKS+1 || nlog > LOGSIZE+1 ||
+     bsize < SECTSIZE || bsize > MAXBSIZE || (bsize & (bsize - 1)) != 0){
+    fprintf(stderr, "Usage: mkfs [-s swappages] [-l logblocks] [-b blocksize] fs.img files...\n");
     exit(1);
   }
 
-  assert((BSIZE % sizeof(struct dinode)) == 0);
-  assert((BSIZE % sizeof(struct dirent)) == 0);
+  sb.bsize = xint(bsize);
+  nboot = (2*SECTSIZE + bsize - 1) / bsize;
+  nbitmap = FSSIZE/(bsize*8) + 1;
+  ninodeblocks = NINODES / IPB(sb) + 1;
+  nswap = nswappg * (4096 / bsize);
+
+  assert((bsize % sizeof(struct dinode)) == 0);
+  assert((bsize % sizeof(struct dirent)) == 0);
 
   fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
   if(fsfd < 0){
@@ -90,42 +127,43 @@ main(int argc, char *argv[])
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
-  nmeta = 2 + nlog + ninodeblocks + nbitmap;
+  nmeta = nboot + nlog + ninodeblocks + nbitmap;
   nblocks = FSSIZE - nmeta;
 
   sb.size = xint(FSSIZE);
   sb.nblocks = xint(nblocks);
   sb.ninodes = xint(NINODES);
   sb.nlog = xint(nlog);
-  sb.logstart = xint(2);
-  sb.inodestart = xint(2+nlog);
-  sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.logstart = xint(nboot);
+  sb.inodestart = xint(nboot+nlog);
+  sb.bmapstart = xint(nboot+nlog+ninodeblocks);
+  sb.swapstart = xint(FSSIZE);
+  sb.nswap = xint(nswap);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d swap %d bsize %u\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE, nswap, bsize);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
+  for(i = 0; i < FSSIZE + nswap; i++)
     wsect(i, zeroes);
 
   memset(buf, 0, sizeof(buf));
-  memmove(buf, &sb, sizeof(sb));
-  wsect(1, buf);
+  memmove(buf + SECTSIZE%bsize, &sb, sizeof(sb));
+  wsect(SECTSIZE/bsize, buf);
 
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
+  bzero(&dot, sizeof(dot));
+  dot.inum = xshort(rootino);
+  strcpy(dot.name, ".");
+  iappend(rootino, &dot, sizeof(dot));
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  bzero(&dot, sizeof(dot));
+  dot.inum = xshort(rootino);
+  strcpy(dot.name, "..");
+  iappend(rootino, &dot, sizeof(dot));
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -144,10 +182,11 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    assert(nrootent < NINODES);
+    de = &rootents[nrootent++];
+    bzero(de, sizeof(*de));
+    de->inum = xshort(inum);
+    strncpy(de->name, argv[i], DIRSIZ);
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +194,20 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  // The root directory is hashed if its entries do not fit
+  // in one block.
+  if(2 + nrootent > bsize/sizeof(struct dirent)){
+    dxbuild(rootino, rootents, nrootent);
+  } else {
+    iappend(rootino, rootents, nrootent*sizeof(struct dirent));
+
+    // fix size of root inode dir
+    rinode(rootino, &din);
+    off = xint(din.size);
+    off = ((off + bsize - 1)/bsize) * bsize;
+    din.size = xint(off);
+    winode(rootino, &din);
+  }
 
   balloc(freeblock);
 
@@ -170,11 +217,11 @@ main(int argc, char *argv[])
 void
 wsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, sec * bsize, 0) != sec * bsize){
     perror("lseek");
     exit(1);
   }
-  if(write(fsfd, buf, BSIZE) != BSIZE){
+  if(write(fsfd, buf, bsize) != bsize){
     perror("write");
     exit(1);
   }
@@ -183,13 +230,13 @@ wsect(uint sec, void *buf)
 void
 winode(uint inum, struct dinode *ip)
 {
-  char buf[BSIZE];
+  char buf[MAXBSIZE];
   uint bn;
   struct dinode *dip;
 
   bn = IBLOCK(inum, sb);
   rsect(bn, buf);
-  dip = ((struct dinode*)buf) + (inum % IPB);
+  dip = ((struct dinode*)buf) + (inum % IPB(sb));
   *dip = *ip;
   wsect(bn, buf);
 }
@@ -197,24 +244,24 @@ winode(uint inum, struct dinode *ip)
 void
 rinode(uint inum, struct dinode *ip)
 {
-  char buf[BSIZE];
+  char buf[MAXBSIZE];
   uint bn;
   struct dinode *dip;
 
   bn = IBLOCK(inum, sb);
   rsect(bn, buf);
-  dip = ((struct dinode*)buf) + (inum % IPB);
+  dip = ((struct dinode*)buf) + (inum % IPB(sb));
   *ip = *dip;
 }
 
 void
 rsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, sec * bsize, 0) != sec * bsize){
     perror("lseek");
     exit(1);
   }
-  if(read(fsfd, buf, BSIZE) != BSIZE){
+  if(read(fsfd, buf, bsize) != bsize){
     perror("read");
     exit(1);
   }
@@ -237,12 +284,12 @@ ialloc(ushort type)
 void
 balloc(int used)
 {
-  uchar buf[BSIZE];
+  uchar buf[MAXBSIZE];
   int i;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
+  assert(used < bsize*8);
+  bzero(buf, bsize);
   for(i = 0; i < used; i++){
     buf[i/8] = buf[i/8] | (0x1 << (i%8));
   }
@@ -252,41 +299,56 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the disk block holding block fbn of din, adding one
+// at the end of the file if fbn is just past it.  mkfs writes
+// each file in one go from consecutive free blocks, so the
+// extents in the inode itself are always enough.
+uint
+extmap(struct dinode *din, uint fbn)
+{
+  uint i, n, len;
+  struct extent *e;
+
+  assert(xshort(din->depth) == 0);
+  e = din->ext;
+  n = xshort(din->nextent);
+  for(i = 0; i < n; i++){
+    len = xint(e[i].len);
+    if(fbn < len)
+      return xint(e[i].start) + fbn;
+    fbn -= len;
+  }
+  assert(fbn == 0);
+  if(n > 0 && xint(e[n-1].start) + xint(e[n-1].len) == freeblock){
+    e[n-1].len = xint(xint(e[n-1].len) + 1);
+  } else {
+    assert(n < NEXTENT);
+    e[n].start = xint(freeblock);
+    e[n].len = xint(1);
+    din->nextent = xshort(n + 1);
+  }
+  return freeblock++;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
   char *p = (char*)xp;
   uint fbn, off, n1;
   struct dinode din;
-  char buf[BSIZE];
-  uint indirect[NINDIRECT];
+  char buf[MAXBSIZE];
   uint x;
 
   rinode(inum, &din);
   off = xint(din.size);
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
-    fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
-    n1 = min(n, (fbn + 1) * BSIZE - off);
+    fbn = off / bsize;
+    assert(fbn < MAXFILE(sb));
+    x = extmap(&din, fbn);
+    n1 = min(n, (fbn + 1) * bsize - off);
     rsect(x, buf);
-    bcopy(p, buf + off - (fbn * BSIZE), n1);
+    bcopy(p, buf + off - (fbn * bsize), n1);
     wsect(x, buf);
     n -= n1;
     off += n1;
@@ -295,3 +357,76 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Must match dirhash() in fs.c.
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+int
+hashcmp(const void *a, const void *b)
+{
+  uint ha = dirhash(((struct dirent*)a)->name);
+  uint hb = dirhash(((struct dirent*)b)->name);
+
+  return ha < hb ? -1 : ha > hb;
+}
+
+// Append the n entries at de to the root directory, which
+// holds just "." and "..", as a hashed directory (see struct
+// dxroot in fs.h).  Leaves are filled three quarters full,
+// leaving room to create files before one has to be split.
+void
+dxbuild(uint rootino, struct dirent *de, int n)
+{
+  struct dxroot r;
+  struct dxentry e;
+  char zero[MAXBSIZE];
+  int start[MAXBSIZE/sizeof(struct dirent)];
+  int i, j, k, nleaf, per;
+  struct dinode din;
+
+  qsort(de, n, sizeof(*de), hashcmp);
+  per = bsize/sizeof(struct dirent) * 3/4;
+  nleaf = 0;
+  for(i = 0; i < n; i = j){
+    // Equal hashes must share a leaf.
+    for(j = i + per; j < n && j > i + 1 && dirhash(de[j].name) == dirhash(de[j-1].name); j--)
+      ;
+    if(j > n)
+      j = n;
+    assert(j == n || dirhash(de[j].name) != dirhash(de[j-1].name));
+    assert(nleaf < DXMAX(sb));
+    start[nleaf++] = i;
+  }
+  start[nleaf] = n;
+
+  bzero(&r, sizeof(r));
+  r.magic = xshort(DXMAGIC);
+  r.n = xint(nleaf);
+  iappend(rootino, &r, sizeof(r));
+  for(k = 0; k < nleaf; k++){
+    bzero(&e, sizeof(e));
+    e.hash = xint(k == 0 ? 0 : dirhash(de[start[k]].name));
+    e.block = xint(k + 1);
+    iappend(rootino, &e, sizeof(e));
+  }
+
+  bzero(zero, sizeof(zero));
+  for(k = 0; k <= nleaf; k++){
+    // Pad the block before leaf k.
+    rinode(rootino, &din);
+    if(xint(din.size) % bsize)
+      iappend(rootino, zero, bsize - xint(din.size) % bsize);
+    if(k < nleaf)
+      iappend(rootino, &de[start[k]], (start[k+1] - start[k])*sizeof(*de));
+  }
+}
@@ -0,0 +1,13 @@
+// mmap() protection and flags.
+// Both the kernel and user programs use this header file.
+
+#define PROT_NONE     0x0
+#define PROT_READ     0x1
+#define PROT_WRITE    0x2
+
+#define MAP_SHARED    0x01  // changes are shared and written back to the file
+#define MAP_PRIVATE   0x02  // changes are private to this process
+#define MAP_ANONYMOUS 0x20  // no file; pages start out zeroed
+#define MAP_HUGE      0x40  // anonymous only; use 4MB pages where possible
+
+#define MAP_FAILED    ((void*)-1)
@@ -0,0 +1,415 @@
+//
+// Memory-mapped regions: mmap() and munmap().
+//
+// Each process has a small table of regions (struct vma in
+// proc.h) above MMAPBASE.  mmap() only records the region;
+// pages are faulted in on first touch by vmafault().
+//
+// * Anonymous pages are fresh zeroed pages.  MAP_SHARED
+//   anonymous regions are unnamed shared-memory segments (see
+//   shm.c), mapped whole by mmap() so that fork() shares every
+//   page, touched or not.
+// * MAP_PRIVATE file pages are copies of page-cache pages.
+// * MAP_SHARED file pages are the page-cache pages themselves,
+//   shared through kalloc reference counts (see kref), so
+//   read() and write() see changes at once.  Dirty shared pages
+//   are written back to the file through the log when they are
+//   unmapped.
+// * MAP_HUGE anonymous regions are 4MB aligned and use 4MB
+//   pages (see kallocsuper) while there are any free.
+// * Shared-memory segments (see shm.c) are MAP_SHARED regions
+//   whose pages are all mapped when they are attached.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "page.h"
+#include "mman.h"
+
+// Return the region of p containing va, or 0.
+struct vma*
+vmafind(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->start && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Return the end of the region containing va, or 0.
+uint
+vmaend(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  if((v = vmafind(p, va)) == 0)
+    return 0;
+  return v->end;
+}
+
+// Find room for len bytes at or above MMAPBASE, starting
+// at a multiple of align.
+static uint
+vmaspace(struct proc *p, uint len, uint align)
+{
+  struct vma *v;
+  uint a;
+
+  a = MMAPBASE;
+again:
+  if(a + len < a || a + len > KERNBASE)
+    return 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->start && a < v->end && a + len > v->start){
+      a = (v->end + align - 1) & ~(align - 1);
+      goto again;
+    }
+  }
+  return a;
+}
+
+// Allocate a region of len bytes (a multiple of PGSIZE)
+// in p's address space, aligned to align (a power of two
+// multiple of PGSIZE).  Returns it with start and end set
+// and the other fields zero, or 0.
+struct vma*
+vmaalloc(struct proc *p, uint len, uint align)
+{
+  struct vma *v;
+  uint a;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->start == 0){
+      if((a = vmaspace(p, len, align)) == 0)
+        return 0;
+      memset(v, 0, sizeof(*v));
+      v->start = a;
+      v->end = a + len;
+      return v;
+    }
+  }
+  return 0;
+}
+
+// Map len bytes of f at offset off (or anonymous memory if f
+// is 0) into the current process.  Returns the address of
+// the new region, or -1.
+int
+mmap(uint len, int prot, int flags, struct file *f, uint off)
+{
+  struct vma *v;
+  int type;
+
+  if(len == 0 || off % PGSIZE != 0)
+    return -1;
+  if(((flags & MAP_SHARED) != 0) == ((flags & MAP_PRIVATE) != 0))
+    return -1;
+  if(f){
+    if(f->type != FD_INODE || !f->readable)
+      return -1;
+    if((flags & MAP_SHARED) && (prot & PROT_WRITE) && !f->writable)
+      return -1;
+    ilock(f->ip);
+    type = f->ip->type;
+    iunlock(f->ip);
+    if(type != T_FILE)
+      return -1;
+  }
+
+  if(f == 0 && (flags & MAP_SHARED)){
+    if(flags & MAP_HUGE)
+      return -1;
+    return shmanon(PGROUNDUP(len) / PGSIZE, prot);
+  }
+  if(flags & MAP_HUGE){
+    if(f)
+      return -1;
+    v = vmaalloc(myproc(), SUPERPGROUNDUP(len), SUPERPGSIZE);
+  } else
+    v = vmaalloc(myproc(), PGROUNDUP(len), PGSIZE);
+  if(v == 0)
+    return -1;
+  v->prot = prot;
+  v->flags = flags;
+  v->f = f ? filedup(f) : 0;
+  v->off = off;
+  return v->start;
+}
+
+// Write a dirty MAP_SHARED page at va of region v back to its file.
+static void
+vmawriteback(struct vma *v, uint va, char *mem)
+{
+  struct inode *ip = v->f->ip;
+  uint off, n, size;
+
+  off = v->off + (va - v->start);
+  ilock(ip);
+  size = ip->size;
+  iunlock(ip);
+  if(off >= size)
+    return;
+  n = size - off;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  filewritei(ip, mem, &off, n);
+}
+
+// Unmap the pages of region v in [start, end), writing back
+// dirty shared file pages.
+static void
+vmaunmappages(struct proc *p, struct vma *v, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+  char *mem;
+
+  for(a = start; a < end; a += PGSIZE){
+    if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || (*pte & PTE_P) == 0)
+      continue;
+    if(*pte & PTE_PS){
+      kfreesuper(P2V(PTE_ADDR(*pte)));
+      *pte = 0;
+      a += SUPERPGSIZE - PGSIZE;
+      continue;
+    }
+    mem = P2V(PTE_ADDR(*pte));
+    if(v->f && (v->flags & MAP_SHARED) && (*pte & PTE_D))
+      vmawriteback(v, a, mem);
+    *pte = 0;
+    kfree(mem);
+  }
+}
+
+// Remove [addr, addr+len) from the current process's regions.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v, *nv;
+  uint end, a, b;
+
+  if(addr % PGSIZE != 0 || len == 0)
+    return -1;
+  end = PGROUNDUP(addr + len);
+  if(end < addr || end > KERNBASE)
+    return -1;
+
+  // MAP_HUGE regions can only be cut at 4MB boundaries.
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->start == 0 || addr >= v->end || end <= v->start)
+      continue;
+    a = addr > v->start ? addr : v->start;
+    b = end < v->end ? end : v->end;
+    if((v->flags & MAP_HUGE) && (a % SUPERPGSIZE || b % SUPERPGSIZE))
+      return -1;
+  }
+
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->start == 0 || addr >= v->end || end <= v->start)
+      continue;
+    a = addr > v->start ? addr : v->start;
+    b = end < v->end ? end : v->end;
+    if(a > v->start && b < v->end){
+      // Punching a hole: the top part needs a region of its own.
+      for(nv = curproc->vma; nv < &curproc->vma[NVMA]; nv++)
+        if(nv->start == 0)
+          break;
+      if(nv == &curproc->vma[NVMA])
+        return -1;
+      *nv = *v;
+      nv->start = b;
+      nv->off = v->off + (b - v->start);
+      if(nv->f)
+        filedup(nv->f);
+      if(nv->shm)
+        shmdup(nv->shm);
+      v->end = b;
+    }
+    vmaunmappages(curproc, v, a, b);
+    if(a == v->start && b == v->end){
+      if(v->f)
+        fileclose(v->f);
+      if(v->shm)
+        shmclose(v->shm);
+      memset(v, 0, sizeof(*v));
+    } else if(a == v->start){
+      v->off += b - v->start;
+      v->start = b;
+    } else {
+      v->end = a;
+    }
+  }
+  switchuvm(curproc);
+  return 0;
+}
+
+// Unmap every region of p.  Used by exit() and exec().
+void
+vmaunmapall(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->start == 0)
+      continue;
+    vmaunmappages(p, v, v->start, v->end);
+    if(v->f)
+      fileclose(v->f);
+    if(v->shm)
+      shmclose(v->shm);
+    memset(v, 0, sizeof(*v));
+  }
+}
+
+// Fault in the page at va of p.  Returns 0 on success,
+// -1 if va is not in a region or the access is not allowed.
+int
+vmafault(struct proc *p, uint va, int write)
+{
+  struct vma *v;
+  struct page *pg;
+  struct inode *ip;
+  pte_t *pte;
+  char *mem;
+  int perm;
+
+  va = PGROUNDDOWN(va);
+  if((v = vmafind(p, va)) == 0 || v->shm)
+    return -1;  // shared memory is mapped when attached
+  if((v->prot & PROT_READ) == 0 || (write && (v->prot & PROT_WRITE) == 0))
+    return -1;
+  if((pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+
+  perm = PTE_U;
+  if(v->prot & PROT_WRITE)
+    perm |= PTE_W;
+
+  if((v->flags & MAP_HUGE) && pte == 0 && (mem = kallocsuper()) != 0){
+    memset(mem, 0, SUPERPGSIZE);
+    p->pgdir[PDX(va)] = V2P(mem) | perm | PTE_P | PTE_PS;
+    return 0;
+  }
+  // Otherwise (no free 4MB page, or part of this 4MB is
+  // already mapped with small pages) use a 4096-byte page.
+
+  if(v->f == 0){
+    if((mem = kallocswap()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+  } else {
+    ip = v->f->ip;
+    ilock(ip);
+    pg = pcget(ip, (v->off + (va - v->start)) / PGSIZE);
+    iunlock(ip);
+    if(pg == 0)
+      return -1;
+    if(v->flags & MAP_SHARED){
+      mem = pg->data;
+      kref(mem);
+    } else if((mem = kallocswap()) != 0){
+      memmove(mem, pg->data, PGSIZE);
+    }
+    pcput(pg);
+    if(mem == 0)
+      return -1;
+  }
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Check that p may access [va, va+n) through its regions,
+// faulting pages in so that the kernel can use them directly.
+int
+vmacheck(struct proc *p, uint va, uint n, int write)
+{
+  struct vma *v;
+  pte_t *pte;
+  uint a, last;
+
+  if(va + n < va)
+    return -1;
+  last = PGROUNDDOWN(n ? va + n - 1 : va);
+  for(a = PGROUNDDOWN(va); ; a += PGSIZE){
+    if((v = vmafind(p, a)) == 0)
+      return -1;
+    if((v->prot & PROT_READ) == 0 || (write && (v->prot & PROT_WRITE) == 0))
+      return -1;
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if((pte == 0 || (*pte & PTE_P) == 0) && vmafault(p, a, write) < 0)
+      return -1;
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
+// Give child np copies of p's regions.  Shared pages are
+// mapped in both; private pages are copied.
+int
+vmafork(struct proc *np, struct proc *p)
+{
+  struct vma *v, *nv;
+  pte_t *pte;
+  uint a;
+  char *mem;
+
+  for(v = p->vma, nv = np->vma; v < &p->vma[NVMA]; v++, nv++){
+    if(v->start == 0)
+      continue;
+    *nv = *v;
+    if(nv->f)
+      filedup(nv->f);
+    if(nv->shm)
+      shmdup(nv->shm);
+    for(a = v->start; a < v->end; a += PGSIZE){
+      if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || (*pte & PTE_P) == 0)
+        continue;
+      if(*pte & PTE_PS){
+        if(copysuper(p->pgdir, np->pgdir, a, v->flags & MAP_SHARED) < 0)
+          goto bad;
+        a += SUPERPGSIZE - PGSIZE;
+        continue;
+      }
+      if(v->flags & MAP_SHARED){
+        mem = P2V(PTE_ADDR(*pte));
+        kref(mem);
+      } else {
+        if((mem = kallocswap()) == 0)
+          goto bad;
+        memmove(mem, P2V(PTE_ADDR(*pte)), PGSIZE);
+      }
+      if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_FLAGS(*pte) & ~(PTE_A|PTE_D)) < 0){
+        kfree(mem);
+        goto bad;
+      }
+    }
+  }
+  return 0;
+
+bad:
+  // The caller frees np->pgdir, and with it the pages.
+  for(nv = np->vma; nv < &np->vma[NVMA]; nv++){
+    if(nv->start && nv->f)
+      fileclose(nv->f);
+    if(nv->start && nv->shm)
+      shmclose(nv->shm);
+    memset(nv, 0, sizeof(*nv));
+  }
+  return -1;
+}
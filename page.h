@@ -0,0 +1,13 @@
+struct page {
+  uint dev;
+  uint inum;
+  uint pgno;          // page number within the file
+  int ref;            // protected by pcache.lock
+  int dirty;          // holds delayed writes; protected by pcache.lock
+  int dead;           // dropped by pcinval; freed by the last pcput
+  char *data;         // PGSIZE bytes from kalloc()
+  struct page *hnext; // hash chain
+  struct page *prev;  // LRU list of unreferenced pages
+  struct page *next;
+};
+
@@ -0,0 +1,484 @@
+// Page cache.
+//
+// The page cache holds whole pages of file content, indexed
+// by (dev, inum, page number).  readi() copies out of cached
+// pages rather than going to the buffer cache one block at a
+// time, and writei() updates any cached page it writes
+// through, so the two caches never disagree.
+//
+// Interface:
+// * To get the page holding part of a file, call pcget.
+// * When done with the page, call pcput.
+// * After changing file content, call pcwrite.
+// * When a file is truncated, call pcinval.
+//
+// mmap() shares cached pages with user address spaces by
+// taking extra kalloc references on pg->data (see kref).
+//
+// The cache has no fixed size.  It takes pages from kalloc()
+// while it holds fewer pages than are left free, and recycles
+// the least recently used unreferenced page otherwise, so it
+// shrinks again as processes use more memory.  kallocswap()
+// also takes pages back with pcreclaim() before it pages out
+// user memory.
+//
+// Page contents are only filled and modified while the
+// inode is locked, so pcache.lock protects just the hash
+// chains, the LRU list and the reference counts.
+//
+// Write-back: appends to regular files (see filewriteiov) are
+// only copied into cached pages by pcdelay, which marks them
+// dirty.  ip->size grows, but ip->dsize, the size on disk,
+// does not, and no blocks are allocated yet.  A dirty page
+// keeps a reference, so it stays cached, and its inode is put
+// on the write-back list, which keeps one too.  The flusher
+// thread writes the list's inodes back every FLUSHTICKS ticks,
+// or sooner when memory runs short, with fileflush, which
+// allocates the blocks for all the delayed data at once; many
+// small appends become a few large contiguous writes.  fsync
+// calls fileflush itself.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "file.h"
+#include "page.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+struct {
+  struct spinlock lock;
+  struct page *hash[NPCHASH];
+  struct page *free;  // unused page descriptors
+
+  // Unreferenced pages, through prev/next.
+  // head.next is least recently used.
+  struct page head;
+  int npages;         // pages holding file data
+  int ndirty;         // pages holding delayed writes
+} pcache;
+
+// Inodes with delayed writes, each holding a reference.
+struct {
+  struct spinlock lock;
+  struct inode *head;  // through ip->wbnext
+  int kick;            // memory is short: flush now
+} wb;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+  pcache.head.prev = &pcache.head;
+  pcache.head.next = &pcache.head;
+  initlock(&wb.lock, "wb");
+}
+
+static uint
+pchash(uint dev, uint inum, uint pgno)
+{
+  return (dev*31 + inum*17 + pgno) % NPCHASH;
+}
+
+// Find the cached page, if any.  Caller must hold pcache.lock.
+static struct page*
+pclookup(uint dev, uint inum, uint pgno)
+{
+  struct page *pg;
+
+  for(pg = pcache.hash[pchash(dev, inum, pgno)]; pg; pg = pg->hnext)
+    if(pg->dev == dev && pg->inum == inum && pg->pgno == pgno)
+      return pg;
+  return 0;
+}
+
+static void
+pcunhash(struct page *pg)
+{
+  struct page **pp;
+
+  for(pp = &pcache.hash[pchash(pg->dev, pg->inum, pg->pgno)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == pg){
+      *pp = pg->hnext;
+      return;
+    }
+  }
+  panic("pcunhash");
+}
+
+static void
+lruremove(struct page *pg)
+{
+  pg->next->prev = pg->prev;
+  pg->prev->next = pg->next;
+}
+
+// Take the least recently used unreferenced page out of
+// the cache.  Returns its descriptor, still owning its data,
+// or 0 if every page is in use.  Pages that are mapped into
+// some process by mmap() stay cached until unmapped.
+// Caller must hold pcache.lock.
+static struct page*
+pcevict(void)
+{
+  struct page *pg;
+
+  for(pg = pcache.head.next; pg != &pcache.head; pg = pg->next){
+    if(krefcount(pg->data) == 1){
+      lruremove(pg);
+      pcunhash(pg);
+      return pg;
+    }
+  }
+  return 0;
+}
+
+// Get a free page descriptor, carving a fresh page
+// into descriptors if necessary.  Caller must hold pcache.lock.
+static struct page*
+pcdesc(void)
+{
+  struct page *pg;
+  char *mem;
+
+  if(pcache.free == 0){
+    if((mem = kalloc()) == 0)
+      return 0;
+    for(pg = (struct page*)mem; pg + 1 <= (struct page*)(mem + PGSIZE); pg++){
+      pg->hnext = pcache.free;
+      pcache.free = pg;
+    }
+  }
+  pg = pcache.free;
+  pcache.free = pg->hnext;
+  return pg;
+}
+
+// Read page pgno of ip from disk into pg->data.
+// Caller must hold ip->lock.
+static void
+pcfill(struct inode *ip, struct page *pg)
+{
+  uint off, end;
+  struct buf *bp;
+
+  memset(pg->data, 0, PGSIZE);
+  off = pg->pgno * PGSIZE;
+  end = min(ip->dsize, off + PGSIZE);
+  for(; off < end; off += bsize){
+    bp = bread(ip->dev, bmap(ip, off/bsize));
+    memmove(pg->data + off%PGSIZE, bp->data, min(bsize, end - off));
+    brelse(bp);
+  }
+}
+
+// Return a referenced page holding page pgno of ip's content,
+// reading it from disk if it is not cached.  Returns 0 if
+// no memory can be found for a new page; callers fall back
+// to the buffer cache.  Caller must hold ip->lock.
+struct page*
+pcget(struct inode *ip, uint pgno)
+{
+  struct page *pg, *old;
+  char *stale;
+
+  acquire(&pcache.lock);
+  if((pg = pclookup(ip->dev, ip->inum, pgno)) != 0){
+    if(pg->ref++ == 0)
+      lruremove(pg);
+    release(&pcache.lock);
+    return pg;
+  }
+
+  // Not cached.  Recycle the least recently used page if the
+  // cache has grown as large as free memory, and give back a
+  // second one so the cache shrinks under memory pressure.
+  stale = 0;
+  if(pcache.npages >= kfreepages()){
+    if((pg = pcevict()) == 0){
+      release(&pcache.lock);
+      return 0;
+    }
+    if(pcache.npages > kfreepages() && (old = pcevict()) != 0){
+      stale = old->data;
+      old->hnext = pcache.free;
+      pcache.free = old;
+      pcache.npages--;
+    }
+  } else {
+    if((pg = pcdesc()) == 0){
+      release(&pcache.lock);
+      return 0;
+    }
+    if((pg->data = kalloc()) == 0){
+      pg->hnext = pcache.free;
+      pcache.free = pg;
+      release(&pcache.lock);
+      return 0;
+    }
+    pcache.npages++;
+  }
+  pg->dev = ip->dev;
+  pg->inum = ip->inum;
+  pg->pgno = pgno;
+  pg->ref = 1;
+  pg->dirty = 0;
+  pg->dead = 0;
+  pg->hnext = pcache.hash[pchash(pg->dev, pg->inum, pgno)];
+  pcache.hash[pchash(pg->dev, pg->inum, pgno)] = pg;
+  release(&pcache.lock);
+
+  if(stale)
+    kfree(stale);
+  pcfill(ip, pg);
+  return pg;
+}
+
+// Is page pgno of inode inum on dev cached?
+int
+pccached(uint dev, uint inum, uint pgno)
+{
+  int r;
+
+  acquire(&pcache.lock);
+  r = pclookup(dev, inum, pgno) != 0;
+  release(&pcache.lock);
+  return r;
+}
+
+// Release a page obtained from pcget.
+// Move it to the most recently used end of the LRU list,
+// or free it if pcinval dropped it while it was in use.
+void
+pcput(struct page *pg)
+{
+  char *mem;
+
+  mem = 0;
+  acquire(&pcache.lock);
+  if(pg->ref < 1)
+    panic("pcput");
+  if(--pg->ref == 0 && pg->dead){
+    mem = pg->data;
+    pg->hnext = pcache.free;
+    pcache.free = pg;
+    pcache.npages--;
+  } else if(pg->ref == 0){
+    pg->next = &pcache.head;
+    pg->prev = pcache.head.prev;
+    pcache.head.prev->next = pg;
+    pcache.head.prev = pg;
+  }
+  release(&pcache.lock);
+  if(mem)
+    kfree(mem);
+}
+
+// Copy n bytes written at offset off of ip into any cached
+// pages covering them.  Caller must hold ip->lock.
+void
+pcwrite(struct inode *ip, char *src, uint off, uint n)
+{
+  uint tot, m;
+  struct page *pg;
+
+  for(tot = 0; tot < n; tot += m, off += m, src += m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    acquire(&pcache.lock);
+    if((pg = pclookup(ip->dev, ip->inum, off/PGSIZE)) != 0 && pg->ref++ == 0)
+      lruremove(pg);
+    release(&pcache.lock);
+    if(pg){
+      memmove(pg->data + off%PGSIZE, src, m);
+      pcput(pg);
+    }
+  }
+}
+
+// Give the least recently used unreferenced page back to
+// kalloc.  Used by kallocswap() when memory runs out.
+// Returns 1 if a page was freed, 0 if not.
+int
+pcreclaim(void)
+{
+  struct page *pg;
+  char *mem;
+
+  acquire(&pcache.lock);
+  if((pg = pcevict()) == 0){
+    if(pcache.ndirty > 0)
+      wb.kick = 1;
+    release(&pcache.lock);
+    return 0;
+  }
+  mem = pg->data;
+  pg->hnext = pcache.free;
+  pcache.free = pg;
+  pcache.npages--;
+  release(&pcache.lock);
+  kfree(mem);
+  return 1;
+}
+
+// Drop every cached page of inode inum on dev.
+// Called when the inode's content is discarded.  Delayed
+// writes are dropped with it.  A page still in use is only
+// unhashed, so no later pcget can find it, and is freed by
+// its last pcput.
+void
+pcinval(uint dev, uint inum)
+{
+  struct page *pg, **pp, *dead;
+  int i;
+
+  dead = 0;
+  acquire(&pcache.lock);
+  for(i = 0; i < NPCHASH; i++){
+    for(pp = &pcache.hash[i]; (pg = *pp) != 0; ){
+      if(pg->dev != dev || pg->inum != inum){
+        pp = &pg->hnext;
+        continue;
+      }
+      *pp = pg->hnext;
+      if(pg->dirty){
+        pg->dirty = 0;
+        pcache.ndirty--;
+        pg->ref--;
+      }
+      if(pg->ref > 0){
+        pg->dead = 1;
+        continue;
+      }
+      lruremove(pg);
+      pg->hnext = dead;
+      dead = pg;
+      pcache.npages--;
+    }
+  }
+  release(&pcache.lock);
+
+  for(pg = dead; pg; pg = pg->hnext)
+    kfree(pg->data);
+
+  acquire(&pcache.lock);
+  while((pg = dead) != 0){
+    dead = pg->hnext;
+    pg->hnext = pcache.free;
+    pcache.free = pg;
+  }
+  release(&pcache.lock);
+}
+
+// Put ip on the write-back list, if it is not there.
+static void
+wbqueue(struct inode *ip)
+{
+  acquire(&wb.lock);
+  if(!ip->wbqueued){
+    ip->wbqueued = 1;
+    ip->wbnext = wb.head;
+    wb.head = idup(ip);
+  }
+  release(&wb.lock);
+}
+
+// Copy n bytes written at offset off of ip, which must be at
+// or past ip->dsize and not past ip->size, into its cached
+// pages and leave them there, dirty, for the flusher.
+// Returns how many bytes it took: fewer than n if NDIRTY
+// pages are dirty already or there is no memory for a page.
+// Caller must hold ip->lock.
+int
+pcdelay(struct inode *ip, char *src, uint off, uint n)
+{
+  uint tot, m;
+  struct page *pg;
+  int keep;
+
+  for(tot = 0; tot < n; tot += m, off += m, src += m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    if((pg = pcget(ip, off/PGSIZE)) == 0)
+      break;
+    acquire(&pcache.lock);
+    keep = !pg->dirty;
+    if(keep && pcache.ndirty >= NDIRTY){
+      wb.kick = 1;
+      release(&pcache.lock);
+      pcput(pg);
+      break;
+    }
+    if(keep){
+      pg->dirty = 1;
+      pcache.ndirty++;
+    }
+    release(&pcache.lock);
+    memmove(pg->data + off%PGSIZE, src, m);
+    if(!keep)
+      pcput(pg);
+    if(off + m > ip->size)
+      ip->size = off + m;
+  }
+  if(tot > 0)
+    wbqueue(ip);
+  return tot;
+}
+
+// Page pgno of ip is on disk now: if it was dirty, drop the
+// reference that kept it cached.  Caller must hold ip->lock.
+void
+pcclean(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+
+  acquire(&pcache.lock);
+  if((pg = pclookup(ip->dev, ip->inum, pgno)) == 0 || !pg->dirty){
+    release(&pcache.lock);
+    return;
+  }
+  pg->dirty = 0;
+  pcache.ndirty--;
+  release(&pcache.lock);
+  pcput(pg);
+}
+
+// Kernel thread that writes delayed data back.
+static void
+flusher(void)
+{
+  struct inode *ip;
+  uint t0;
+
+  for(;;){
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < FLUSHTICKS && !wb.kick)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    acquire(&wb.lock);
+    wb.kick = 0;
+    while((ip = wb.head) != 0){
+      wb.head = ip->wbnext;
+      ip->wbqueued = 0;
+      release(&wb.lock);
+      fileflush(ip);
+      begin_op();
+      iput(ip);
+      end_op();
+      acquire(&wb.lock);
+    }
+    release(&wb.lock);
+  }
+}
+
+void
+flusherinit(void)
+{
+  if(kthread("flusher", flusher) < 0)
+    panic("flusherinit");
+}
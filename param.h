@@ -1,14 +1,33 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
-#define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NOFILE       16  // open files per process, to start with
+#define NOFILEMAX  1024  // open files per process, at most
+#define NVMA         16  // mmap regions per process
+#define NFILE      2000  // open files per system
+#define NINODE       50  // minimum size of inode cache
+#define NINODEMAX  (NFILE+3*NPROC+NDIRTY)  // maximum size of inode cache
+#define NIHASH      251  // hash buckets in the inode cache
 #define NDEV         10  // maximum major device number
+#define NBDEV         2  // maximum block device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define MAXOPBLOCKS  16  // max # of blocks any FS op writes
+#define LOGSIZE      126  // max data blocks in on-disk log (see mkfs -l)
+#define NBUF         (2*LOGSIZE+MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define NBUFMAX      512  // maximum size of disk block cache
+#define NBHASH       31  // hash buckets in the disk block cache
+#define NDENTRY      128  // directory entry cache size
+#define NDHASH       61  // hash buckets in the directory entry cache
+#define RAMAX        32  // maximum read-ahead window, in blocks
+#define RSVBLOCKS    16  // blocks reserved ahead of a file being appended to
+#define FSSIZE       2000  // size of file system in blocks
+#define NSWAP        1024  // pages of swap space, after the file system
+#define NPCHASH      61  // hash buckets in the page cache
+#define NDIRTY      128  // most dirty pages in the page cache
+#define FLUSHTICKS  100  // how long delayed writes may stay in memory
+#define NSUPERPG      4  // 4MB pages reserved for MAP_HUGE regions
+#define NSHM         16  // shared-memory segments per system
+#define SHMMAXPG     64  // maximum pages in a shared-memory segment
+#define SHMNAME      16  // maximum length of a segment name
 #define NLAYER       4
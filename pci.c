@@ -0,0 +1,110 @@
+// PCI configuration space access (mechanism #1) and
+// a simple scan of the bus for device drivers.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_ADDR  0xcf8
+#define PCI_DATA  0xcfc
+
+static uint
+confaddr(uint bus, uint dev, uint func, int off)
+{
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+}
+
+static uint
+confread(uint bus, uint dev, uint func, int off)
+{
+  outl(PCI_ADDR, confaddr(bus, dev, func, off));
+  return inl(PCI_DATA);
+}
+
+// Read the 32-bit configuration register at off of pd.
+uint
+pciread(struct pcidev *pd, int off)
+{
+  return confread(pd->bus, pd->dev, pd->func, off);
+}
+
+// Write the 32-bit configuration register at off of pd.
+void
+pciwrite(struct pcidev *pd, int off, uint v)
+{
+  outl(PCI_ADDR, confaddr(pd->bus, pd->dev, pd->func, off));
+  outl(PCI_DATA, v);
+}
+
+// Return the I/O port base of pd's base address register n,
+// or 0 if it is a memory BAR.
+uint
+pciiobase(struct pcidev *pd, int n)
+{
+  uint bar;
+
+  bar = pciread(pd, PCI_BAR0 + 4*n);
+  if((bar & 1) == 0)
+    return 0;
+  return bar & ~3;
+}
+
+// Turn on the PCI_CMD_* bits in flags for pd.
+void
+pcienable(struct pcidev *pd, int flags)
+{
+  pciwrite(pd, PCI_COMMAND, (pciread(pd, PCI_COMMAND) & 0xffff) | flags);
+}
+
+// Scan the bus for the first function whose IDs and class
+// match; -1 matches anything.  Fills in *pd and returns 0,
+// or returns -1 if there is none.
+static int
+pciscan(int vendor, int device, int class, int subclass, struct pcidev *pd)
+{
+  uint bus, dev, func, id, cl, nfunc;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        id = confread(bus, dev, func, 0);
+        if((id & 0xffff) == 0xffff)
+          continue;
+        if(func == 0 && (confread(bus, dev, 0, PCI_HEADER) & 0x800000))
+          nfunc = 8;  // multi-function device
+        cl = confread(bus, dev, func, PCI_CLASS);
+        if((vendor != -1 && (id & 0xffff) != vendor) ||
+           (device != -1 && (id >> 16) != device) ||
+           (class != -1 && (cl >> 24) != class) ||
+           (subclass != -1 && ((cl >> 16) & 0xff) != subclass))
+          continue;
+        pd->bus = bus;
+        pd->dev = dev;
+        pd->func = func;
+        pd->vendor = id & 0xffff;
+        pd->device = id >> 16;
+        pd->class = cl >> 24;
+        pd->subclass = (cl >> 16) & 0xff;
+        pd->progif = (cl >> 8) & 0xff;
+        return 0;
+      }
+    }
+  }
+  return -1;
+}
+
+// Find the PCI function with the given vendor and device IDs.
+int
+pcifind(int vendor, int device, struct pcidev *pd)
+{
+  return pciscan(vendor, device, -1, -1, pd);
+}
+
+// Find the first PCI function of the given class and subclass.
+int
+pcifindclass(int class, int subclass, struct pcidev *pd)
+{
+  return pciscan(-1, -1, class, subclass, pd);
+}
@@ -0,0 +1,23 @@
+// PCI configuration space.
+
+#define PCI_COMMAND   0x04   // command register (16 bits)
+#define PCI_CLASS     0x08   // class, subclass, prog-if, revision
+#define PCI_HEADER    0x0c   // header type in bits 16-23
+#define PCI_BAR0      0x10   // base address registers, 4 bytes apart
+#define PCI_INTLINE   0x3c   // interrupt line in bits 0-7
+
+#define PCI_CMD_IO     0x1   // respond to I/O space accesses
+#define PCI_CMD_MEM    0x2   // respond to memory space accesses
+#define PCI_CMD_MASTER 0x4   // allow bus-master DMA
+
+// A PCI function, as found by pcifind().
+struct pcidev {
+  uint bus;
+  uint dev;
+  uint func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar progif;
+};
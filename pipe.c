@@ -7,6 +7,7 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
 
 #define PIPESIZE 512
 
@@ -117,3 +118,30 @@ piperead(struct pipe *p, char *addr, int n)
   release(&p->lock);
   return i;
 }
+
+// Read into the iovcnt buffers of iov in turn.  Like piperead,
+// waits only until the pipe has some data, then takes what is
+// there, so it never blocks with part of the buffers filled.
+int
+pipereadv(struct pipe *p, struct iovec *iov, int iovcnt)
+{
+  int i, j, tot;
+
+  acquire(&p->lock);
+  while(p->nread == p->nwrite && p->writeopen){
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock);
+  }
+  tot = 0;
+  for(i = 0; i < iovcnt && p->nread != p->nwrite; i++){
+    for(j = 0; j < iov[i].len && p->nread != p->nwrite; j++)
+      ((char*)iov[i].base)[j] = p->data[p->nread++ % PIPESIZE];
+    tot += j;
+  }
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return tot;
+}
@@ -169,6 +169,60 @@ int getpinfo(struct pstat* pstate) {
 	return 0;
 }
 
+// Choose a user page to page out, with a clock sweep over
+// the page tables of processes that are not running (other
+// than the caller) and not pinned: a page whose accessed bit
+// is set gets it cleared and a second chance.  Point the
+// victim's PTE at swap slot slot, then, with ptable.lock
+// released, copy the page to dst and free it.  The caller
+// holds swapbuf.lock, so a fault on the page waits in
+// swapread() until the slot has been written.
+// Returns 1 if a page was taken, 0 if none could be.
+int
+swapvictim(char *dst, uint slot)
+{
+  static struct proc *p = ptable.proc;
+  static uint va;
+  pte_t *pte;
+  char *mem;
+  int i;
+
+  acquire(&ptable.lock);
+  // Two passes over every process: the first may only clear
+  // accessed bits.
+  for(i = 0; i <= 2*NPROC; i++){
+    if((p->state == RUNNABLE || p->state == SLEEPING || p == myproc()) &&
+       !p->pinned){
+      for(; va < p->sz; va += PGSIZE){
+        pte = walkpgdir(p->pgdir, (char*)va, 0);
+        if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+          continue;
+        if(*pte & PTE_A){
+          *pte &= ~PTE_A;
+          continue;
+        }
+        mem = P2V(PTE_ADDR(*pte));
+        if(krefcount(mem) != 1)
+          continue;
+        *pte = (slot << PTXSHIFT) | PTE_SWAP | (PTE_FLAGS(*pte) & (PTE_W|PTE_U));
+        if(p == myproc())
+          lcr3(V2P(p->pgdir));  // flush the TLB
+        va += PGSIZE;
+        release(&ptable.lock);
+        // Nothing maps mem any more, so it is ours to copy.
+        memmove(dst, mem, PGSIZE);
+        kfree(mem);
+        return 1;
+      }
+    }
+    if(++p == &ptable.proc[NPROC])
+      p = ptable.proc;
+    va = 0;
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
 void
 pinit(void)
 {
@@ -236,11 +290,15 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->pinned = 0;
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
+  memset(p->fdmap, 0, sizeof(p->fdmap));
 
   release(&ptable.lock);
 
   // Allocate kernel stack.
-  if((p->kstack = kalloc()) == 0){
+  if((p->kstack = kallocswap()) == 0){
     p->state = UNUSED;
     return 0;
   }
@@ -263,6 +321,44 @@ found:
   return p;
 }
 
+// A new kernel thread's first scheduling by scheduler()
+// will swtch here.
+static void
+kthreadstart(void)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  myproc()->kfn();
+  panic("kthread returned");
+}
+
+// Start a kernel thread called name running fn(), which must
+// not return.  It has no user memory, files, or parent.
+// Returns its pid, or -1.
+int
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return -1;
+  }
+  p->context->eip = (uint)kthreadstart;
+  p->kfn = fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+
+  return p->pid;
+}
+
 // Set up first user process.
 void
 userinit(void)
@@ -310,6 +406,9 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
+    // The heap must stay below the mmap regions.
+    if(sz + n > MMAPBASE || sz + n < sz)
+      return -1;
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   } else if(n < 0){
@@ -339,8 +438,25 @@ fork2(int pri)
     return -1;
   }
 
+  if(np->nofile < curproc->nofile && fdgrow(np) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+
   // Copy process state from proc.
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+    fdfreetab(np);
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  if(vmafork(np, curproc) < 0){
+    fdfreetab(np);
+    freevm(np->pgdir);
+    np->pgdir = 0;
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
@@ -353,9 +469,10 @@ fork2(int pri)
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
+  for(i = 0; i < curproc->nofile; i++)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
+  memmove(np->fdmap, curproc->fdmap, sizeof(np->fdmap));
   np->cwd = idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
@@ -390,13 +507,17 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
+  // Unmap mmap regions, writing back shared file pages.
+  vmaunmapall(curproc);
+
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < curproc->nofile; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  fdfreetab(curproc);
 
   begin_op();
   iput(curproc->cwd);
@@ -562,6 +683,9 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    bsuminit(ROOTDEV);  // after recovery may have changed the free map
+    flusherinit();
+    swapinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
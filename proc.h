@@ -33,6 +33,18 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A region of the address space set up by mmap() or shmat().
+// Pages are faulted in on first touch (see vmafault).
+struct vma {
+  uint start;                  // First address, page aligned; 0 if unused
+  uint end;                    // One past the last address
+  int prot;                    // PROT_READ, PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE, MAP_ANONYMOUS
+  struct file *f;              // Mapped file, or 0 if anonymous
+  uint off;                    // File offset of start
+  struct shm *shm;             // Shared-memory segment, or 0 (see shm.c)
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -45,8 +57,15 @@ struct proc {
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  int pinned;                  // Syscall holds user pointers; see swap.c
+  void (*kfn)(void);           // Body of a kernel thread (see kthread)
+  int logres;                  // Log blocks reserved by begin_op
+  struct file **ofile;         // Open files, nofile slots
+  int nofile;
+  uint fdmap[NOFILEMAX/32];     // Bit fd set if ofile[fd] is in use
+  struct file *ofile0[NOFILE]; // ofile until it grows (see fdgrow)
   struct inode *cwd;           // Current directory
+  struct vma vma[NVMA];        // mmap() regions
   char name[16];               // Process name (debugging)
   int priority;
   int qtail[4];
@@ -60,3 +79,4 @@ struct proc {
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+// followed, from MMAPBASE up, by any mmap() regions.
@@ -0,0 +1,191 @@
+//
+// Named shared-memory segments.
+//
+// shmat(name, npages) attaches the segment called name to the
+// calling process, creating it with npages zeroed pages if it
+// does not exist yet; npages may be 0 to attach only an
+// existing segment.  The segment is mapped as a MAP_SHARED
+// region (see mmap.c), so fork() shares it with the child and
+// exit(), exec() and munmap() detach it.
+//
+// The segment holds one kalloc reference to each of its pages
+// and every mapping holds another (see kref), so the memory is
+// freed when the last attachment goes away.
+//
+// mmap(MAP_SHARED|MAP_ANONYMOUS) is backed by a segment with no
+// name, which only fork() can share.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "mman.h"
+
+struct shm {
+  char name[SHMNAME];
+  int npages;
+  int nattach;                 // Regions that map this segment
+  char *pages[SHMMAXPG];
+};
+
+struct {
+  struct spinlock lock;
+  struct shm seg[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+  initlock(&shmtab.lock, "shm");
+}
+
+// Free the pages of an unused segment.
+// Caller holds shmtab.lock.
+static void
+shmfree(struct shm *s)
+{
+  int i;
+
+  for(i = 0; i < s->npages; i++)
+    kfree(s->pages[i]);
+  memset(s, 0, sizeof(*s));
+}
+
+// Find the segment called name, or create it with npages
+// zeroed pages.  An empty name always creates a new segment.
+// Returns it with an extra attachment, or 0.
+static struct shm*
+shmlookup(char *name, int npages)
+{
+  struct shm *s, *empty;
+  int i;
+
+  acquire(&shmtab.lock);
+  empty = 0;
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++){
+    if(s->nattach > 0 && name[0] && strncmp(s->name, name, SHMNAME) == 0){
+      if(npages > s->npages)
+        goto bad;
+      s->nattach++;
+      release(&shmtab.lock);
+      return s;
+    }
+    if(empty == 0 && s->nattach == 0)
+      empty = s;
+  }
+  if(empty == 0 || npages <= 0 || npages > SHMMAXPG)
+    goto bad;
+
+  s = empty;
+  for(i = 0; i < npages; i++){
+    if((s->pages[i] = kalloc()) == 0){
+      s->npages = i;
+      shmfree(s);
+      goto bad;
+    }
+    memset(s->pages[i], 0, PGSIZE);
+  }
+  safestrcpy(s->name, name, SHMNAME);
+  s->npages = npages;
+  s->nattach = 1;
+  release(&shmtab.lock);
+  return s;
+
+bad:
+  release(&shmtab.lock);
+  return 0;
+}
+
+// Map all of s into the current process as a MAP_SHARED
+// region, consuming the caller's attachment.
+// Returns its address, or -1.
+static int
+shmmap(struct shm *s, int prot)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  int i, perm;
+
+  if((v = vmaalloc(curproc, s->npages*PGSIZE, PGSIZE)) == 0){
+    shmclose(s);
+    return -1;
+  }
+  v->prot = prot;
+  v->flags = MAP_SHARED;
+  v->shm = s;
+  perm = PTE_U;
+  if(prot & PROT_WRITE)
+    perm |= PTE_W;
+  for(i = 0; i < s->npages; i++){
+    if(mappages(curproc->pgdir, (char*)v->start + i*PGSIZE, PGSIZE,
+                V2P(s->pages[i]), perm) < 0){
+      munmap(v->start, v->end - v->start);
+      return -1;
+    }
+    kref(s->pages[i]);
+  }
+  return v->start;
+}
+
+// Attach the segment called name to the current process,
+// creating it if needed.  Returns its address, or -1.
+int
+shmat(char *name, int npages)
+{
+  struct shm *s;
+
+  if(name[0] == 0 || (s = shmlookup(name, npages)) == 0)
+    return -1;
+  return shmmap(s, PROT_READ | PROT_WRITE);
+}
+
+// Map a new segment of npages zeroed pages that has no name,
+// for mmap(MAP_SHARED|MAP_ANONYMOUS).  Returns its address, or -1.
+int
+shmanon(int npages, int prot)
+{
+  struct shm *s;
+
+  if((s = shmlookup("", npages)) == 0)
+    return -1;
+  return shmmap(s, prot);
+}
+
+// Detach the segment attached at addr.
+int
+shmdt(uint addr)
+{
+  struct vma *v;
+
+  if((v = vmafind(myproc(), addr)) == 0 || v->shm == 0 || v->start != addr)
+    return -1;
+  return munmap(v->start, v->end - v->start);
+}
+
+// Add an attachment to s, for fork() and partial munmap().
+void
+shmdup(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->nattach < 1)
+    panic("shmdup");
+  s->nattach++;
+  release(&shmtab.lock);
+}
+
+// Drop an attachment to s; free it when it was the last.
+// The region's own mappings must already be gone.
+void
+shmclose(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->nattach < 1)
+    panic("shmclose");
+  if(--s->nattach == 0)
+    shmfree(s);
+  release(&shmtab.lock);
+}
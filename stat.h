@@ -8,4 +8,5 @@ struct stat {
   uint ino;    // Inode number
   short nlink; // Number of links to file
   uint size;   // Size of file in bytes
+  uint nextent; // Runs of consecutive disk blocks holding it
 };
@@ -0,0 +1,176 @@
+//
+// Swap space.
+//
+// When kallocswap() finds no free memory it pages out a cold
+// user page: swapvictim() in proc.c picks one with a clock
+// sweep over the page tables, copies it into swappage and
+// replaces its PTE with a PTE_SWAP entry naming the slot it
+// is written to.  The page is read back by uvmpagein() in
+// vm.c when the process touches it again.
+//
+// Only pages of process memory [0, sz) that are not shared
+// are paged out, and never those of a process that is
+// running on another CPU or is pinned: argptr() and argstr()
+// pin the process until its system call returns, so the
+// kernel can use user pointers it has checked without them
+// disappearing.
+//
+// The swap area follows the file system on the root disk
+// (see mkfs.c).  Pages are moved by the disk driver through a
+// private buffer, bypassing the buffer cache, and swapbuf's
+// lock serializes all swap I/O.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "vmstat.h"
+
+struct {
+  struct spinlock lock;
+  uint start;          // first swap block
+  uint nslot;          // number of slots, 0 if no swap
+  uchar used[NSWAP];
+  uint pagein;
+  uint pageout;
+} swap;
+
+static struct buf swapbuf;
+// Page aligned, like every buf's data, so that no block of it
+// crosses a page (see idestart's PRDs).
+static char swappage[PGSIZE] __attribute__((aligned(PGSIZE)));
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+
+  initlock(&swap.lock, "swap");
+  initsleeplock(&swapbuf.lock, "swapbuf");
+  readsb(dev, &sb);
+  swapbuf.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap / (PGSIZE/bsize);
+  if(swap.nslot > NSWAP)
+    swap.nslot = NSWAP;
+}
+
+static int
+slotalloc(void)
+{
+  int i;
+
+  acquire(&swap.lock);
+  for(i = 0; i < swap.nslot; i++){
+    if(!swap.used[i]){
+      swap.used[i] = 1;
+      release(&swap.lock);
+      return i;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Release a swap slot whose page is no longer needed.
+void
+swapfree(uint slot)
+{
+  acquire(&swap.lock);
+  if(slot >= swap.nslot || !swap.used[slot])
+    panic("swapfree");
+  swap.used[slot] = 0;
+  release(&swap.lock);
+}
+
+// Read or write the page in slot, a block at a time
+// straight to or from mem.  Caller must hold swapbuf.lock.
+static void
+swaprw(uint slot, char *mem, int write)
+{
+  int i;
+
+  for(i = 0; i < PGSIZE/bsize; i++){
+    swapbuf.blockno = swap.start + slot*(PGSIZE/bsize) + i;
+    swapbuf.data = (uchar*)mem + i*bsize;
+    swapbuf.flags = write ? B_DIRTY : 0;
+    bdevsw[swapbuf.dev].rw(&swapbuf);
+  }
+}
+
+// Page out one cold user page.
+// Returns 1 if a page was freed, 0 if not.
+int
+swapout(void)
+{
+  int slot;
+
+  if(swap.nslot == 0)
+    return 0;
+  acquiresleep(&swapbuf.lock);
+  if((slot = slotalloc()) < 0){
+    releasesleep(&swapbuf.lock);
+    return 0;
+  }
+  if(swapvictim(swappage, slot) == 0){
+    swapfree(slot);
+    releasesleep(&swapbuf.lock);
+    return 0;
+  }
+  swaprw(slot, swappage, 1);
+  acquire(&swap.lock);
+  swap.pageout++;
+  release(&swap.lock);
+  releasesleep(&swapbuf.lock);
+  return 1;
+}
+
+// Read the page in slot into mem.  The slot stays allocated.
+void
+swapread(uint slot, char *mem)
+{
+  acquiresleep(&swapbuf.lock);
+  swaprw(slot, mem, 0);
+  acquire(&swap.lock);
+  swap.pagein++;
+  release(&swap.lock);
+  releasesleep(&swapbuf.lock);
+}
+
+// Allocate a page of user memory, a page table or a kernel
+// stack.  If none is free, shrink the page cache, the buffer
+// cache or the inode cache, or page out a cold user page, to
+// make room.
+// Returns 0 if none of them helps.  May sleep, so the caller must
+// not hold a spinlock.
+char*
+kallocswap(void)
+{
+  char *mem;
+
+  while((mem = kalloc()) == 0)
+    if(!pcreclaim() && !breclaim() && !ireclaim() && !swapout())
+      return 0;
+  return mem;
+}
+
+void
+getvmstat(struct vmstat *st)
+{
+  int i;
+
+  st->freepages = kfreepages();
+  acquire(&swap.lock);
+  st->pagein = swap.pagein;
+  st->pageout = swap.pageout;
+  st->swapused = 0;
+  for(i = 0; i < swap.nslot; i++)
+    st->swapused += swap.used[i];
+  st->swapsize = swap.nslot;
+  release(&swap.lock);
+}
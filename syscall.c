@@ -13,20 +13,21 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
-// Fetch the int at addr from the current process.
+// Fetch the int at addr from the current process, pinning
+// its memory like argptr so the page stays put until it is read.
 int
 fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
-
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  myproc()->pinned = 1;
+  if(uvmcheck(addr, 4, 0) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
 }
 
 // Fetch the nul-terminated string at addr from the current process.
-// Doesn't actually copy the string - just sets *pp to point at it.
+// Doesn't actually copy the string - just sets *pp to point at it,
+// and pins the process's memory like argptr.
 // Returns length of string, not including nul.
 int
 fetchstr(uint addr, char **pp)
@@ -34,11 +35,16 @@ fetchstr(uint addr, char **pp)
   char *s, *ep;
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
+  if(addr < curproc->sz)
+    ep = (char*)curproc->sz;
+  else if((ep = (char*)vmaend(curproc, addr)) == 0)
     return -1;
+  curproc->pinned = 1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    // Fault in each mmap page before looking at it.
+    if((s == *pp || (uint)s % PGSIZE == 0) && uvmcheck((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -54,16 +60,34 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the process address space, and that the kernel
+// may write there.  The process's memory is pinned (kept out
+// of swap) until the system call returns.
 int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  myproc()->pinned = 1;
+  if(size < 0 || uvmcheck((uint)i, size, 1) < 0)
+    return -1;
+  *pp = (char*)i;
+  return 0;
+}
+
+// Like argptr, for a block of memory the kernel will only
+// read, which may be in a read-only mmap region.
+int
+argroptr(int n, char **pp, int size)
+{
+  int i;
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  myproc()->pinned = 1;
+  if(size < 0 || uvmcheck((uint)i, size, 0) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -71,8 +95,8 @@ argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (Another process could change a string in a MAP_SHARED page
+// after this check, as it could any other shared argument.)
 int
 argstr(int n, char **pp)
 {
@@ -107,6 +131,21 @@ extern int sys_setpri(void);
 extern int sys_getpri(void);
 extern int sys_fork2(void);
 extern int sys_getpinfo(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_getvmstat(void);
+extern int sys_getbstat(void);
+extern int sys_getdiskstat(void);
+extern int sys_fsync(void);
+extern int sys_getdcstat(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_sendfile(void);
+extern int sys_splice(void);
 
 
 static int (*syscalls[])(void) = {
@@ -135,6 +174,21 @@ static int (*syscalls[])(void) = {
 [SYS_getpri]  sys_getpri,
 [SYS_fork2]   sys_fork2,
 [SYS_getpinfo] sys_getpinfo,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_shmat]   sys_shmat,
+[SYS_shmdt]   sys_shmdt,
+[SYS_getvmstat] sys_getvmstat,
+[SYS_getbstat] sys_getbstat,
+[SYS_getdiskstat] sys_getdiskstat,
+[SYS_fsync]   sys_fsync,
+[SYS_getdcstat] sys_getdcstat,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_sendfile] sys_sendfile,
+[SYS_splice]  sys_splice,
 };
 
 void
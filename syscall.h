@@ -24,3 +24,18 @@
 #define SYS_getpri 23
 #define SYS_fork2  24
 #define SYS_getpinfo 25
+#define SYS_mmap   26
+#define SYS_munmap 27
+#define SYS_shmat  28
+#define SYS_shmdt  29
+#define SYS_getvmstat 30
+#define SYS_getbstat 31
+#define SYS_getdiskstat 32
+#define SYS_fsync  33
+#define SYS_getdcstat 34
+#define SYS_pread  35
+#define SYS_pwrite 36
+#define SYS_readv  37
+#define SYS_writev 38
+#define SYS_sendfile 39
+#define SYS_splice 40
@@ -9,12 +9,18 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "x86.h"
 #include "proc.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mman.h"
+#include "bstat.h"
+#include "diskstat.h"
+#include "dcstat.h"
+#include "uio.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -26,7 +32,7 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if(fd < 0 || fd >= myproc()->nofile || (f=myproc()->ofile[fd]) == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -35,21 +41,40 @@ argfd(int n, int *pfd, struct file **pf)
   return 0;
 }
 
-// Allocate a file descriptor for the given file.
+// Allocate the lowest free file descriptor for the given file.
 // Takes over file reference from caller on success.
+// Scans curproc->fdmap for the first word with a clear bit,
+// at most NOFILEMAX/32 words.
 static int
 fdalloc(struct file *f)
 {
-  int fd;
+  int w, fd;
   struct proc *curproc = myproc();
 
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
+  for(;;){
+    for(w = 0; w*32 < curproc->nofile; w++){
+      if(curproc->fdmap[w] == ~0U)
+        continue;
+      fd = w*32 + bsf(~curproc->fdmap[w]);
+      if(fd >= curproc->nofile)
+        break;
+      curproc->fdmap[w] |= 1U << (fd%32);
       curproc->ofile[fd] = f;
       return fd;
     }
+    if(fdgrow(curproc) < 0)
+      return -1;
   }
-  return -1;
+}
+
+// Free file descriptor fd, without closing its file.
+static void
+fdrelease(int fd)
+{
+  struct proc *curproc = myproc();
+
+  curproc->ofile[fd] = 0;
+  curproc->fdmap[fd/32] &= ~(1U << (fd%32));
 }
 
 int
@@ -85,11 +110,131 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argroptr(1, &p, n) < 0)
     return -1;
   return filewrite(f, p, n);
 }
 
+// pread(fd, buf, n, off) and pwrite(fd, buf, n, off) read or
+// write at off without using or moving the file's offset, so
+// processes sharing the file need not seek around each other.
+int
+sys_pread(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepread(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argroptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepwrite(f, p, n, off);
+}
+
+// Copy the array of iovcnt buffers that argument n points to,
+// with iovcnt in argument n+1, into iov and check each buffer.
+// Returns iovcnt, or -1.
+static int
+argiov(int n, struct iovec *iov, int write)
+{
+  char *p;
+  int i, cnt;
+  uint tot;
+
+  if(argint(n+1, &cnt) < 0 || cnt < 0 || cnt > IOV_MAX)
+    return -1;
+  if(argroptr(n, &p, cnt*sizeof(iov[0])) < 0)
+    return -1;
+  memmove(iov, p, cnt*sizeof(iov[0]));
+  tot = 0;
+  for(i = 0; i < cnt; i++){
+    tot += iov[i].len;
+    if(tot < iov[i].len || tot > 0x7fffffff)
+      return -1;
+    if(uvmcheck((uint)iov[i].base, iov[i].len, write) < 0)
+      return -1;
+  }
+  return cnt;
+}
+
+// readv(fd, iov, iovcnt) and writev(fd, iov, iovcnt) read or
+// write several buffers in one system call, and write them in
+// as few transactions as one long write would take.
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || (cnt = argiov(1, iov, 1)) < 0)
+    return -1;
+  return filereadv(f, iov, cnt);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || (cnt = argiov(1, iov, 0)) < 0)
+    return -1;
+  return filewritev(f, iov, cnt);
+}
+
+// sendfile(outfd, infd, off, n) copies up to n bytes of the
+// file infd to outfd, a file or pipe, without passing them
+// through user memory.  If off is not 0, it reads from *off
+// and advances that rather than infd's offset.
+int
+sys_sendfile(void)
+{
+  struct file *in, *out;
+  int n, addr;
+  uint *offp;
+
+  if(argfd(0, 0, &out) < 0 || argfd(1, 0, &in) < 0 ||
+     argint(2, &addr) < 0 || argint(3, &n) < 0)
+    return -1;
+  if(in->type != FD_INODE)
+    return -1;
+  if(addr == 0)
+    return filesplice(in, &in->off, out, n);
+  if(argptr(2, (void*)&offp, sizeof(*offp)) < 0 || (int)*offp < 0)
+    return -1;
+  return filesplice(in, offp, out, n);
+}
+
+// splice(infd, outfd, n) copies up to n bytes from file or
+// pipe infd to file or pipe outfd inside the kernel, advancing
+// the offsets of both.  From a pipe it copies only what one
+// read() would return.
+int
+sys_splice(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filesplice(in, &in->off, out, n);
+}
+
 int
 sys_close(void)
 {
@@ -98,7 +243,7 @@ sys_close(void)
 
   if(argfd(0, &fd, &f) < 0)
     return -1;
-  myproc()->ofile[fd] = 0;
+  fdrelease(fd);
   fileclose(f);
   return 0;
 }
@@ -184,7 +329,6 @@ int
 sys_unlink(void)
 {
   struct inode *ip, *dp;
-  struct dirent de;
   char name[DIRSIZ], *path;
   uint off;
 
@@ -214,9 +358,7 @@ sys_unlink(void)
     goto bad;
   }
 
-  memset(&de, 0, sizeof(de));
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("unlink: writei");
+  dirunlink(dp, name, off);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -274,8 +416,18 @@ create(char *path, short type, short major, short minor)
       panic("create dots");
   }
 
-  if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
+  if(dirlink(dp, name, ip->inum) < 0){
+    // dp is full (see dxsplit): free ip again.
+    if(type == T_DIR){
+      dp->nlink--;
+      iupdate(dp);
+    }
+    ip->nlink = 0;
+    iupdate(ip);
+    iunlockput(ip);
+    iunlockput(dp);
+    return 0;
+  }
 
   iunlockput(dp);
 
@@ -433,7 +585,7 @@ sys_pipe(void)
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+      fdrelease(fd0);
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -442,3 +594,78 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+int
+sys_mmap(void)
+{
+  int addr, len, prot, flags, off;
+  struct file *f;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0)
+    return -1;
+  f = 0;
+  if((flags & MAP_ANONYMOUS) == 0 && argfd(4, 0, &f) < 0)
+    return -1;
+  return mmap(len, prot, flags, f, off);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || len <= 0)
+    return -1;
+  return munmap(addr, len);
+}
+
+int
+sys_getbstat(void)
+{
+  struct bstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getbstat(st);
+  return 0;
+}
+
+int
+sys_getdiskstat(void)
+{
+  struct diskstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getdiskstat(st);
+  return 0;
+}
+
+// Wait until the changes made to the file system so far,
+// including those to fd's file, are on disk.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  if(f->type == FD_INODE)
+    fileflush(f->ip);
+  log_sync();
+  return 0;
+}
+
+int
+sys_getdcstat(void)
+{
+  struct dcstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getdcstat(st);
+  return 0;
+}
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "vmstat.h"
 
 
 int
@@ -99,6 +100,38 @@ sys_sbrk(void)
   return addr;
 }
 
+int
+sys_shmat(void)
+{
+  char *name;
+  int npages;
+
+  if(argstr(0, &name) < 0 || argint(1, &npages) < 0)
+    return -1;
+  return shmat(name, npages);
+}
+
+int
+sys_shmdt(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmdt(addr);
+}
+
+int
+sys_getvmstat(void)
+{
+  struct vmstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getvmstat(st);
+  return 0;
+}
+
 int
 sys_sleep(void)
 {
@@ -40,6 +40,7 @@ trap(struct trapframe *tf)
       exit();
     myproc()->tf = tf;
     syscall();
+    myproc()->pinned = 0;
     if(myproc()->killed)
       exit();
     return;
@@ -62,6 +63,12 @@ trap(struct trapframe *tf)
   case T_IRQ0 + IRQ_IDE+1:
     // Bochs generates spurious IDE1 interrupts.
     break;
+  case T_IRQ0 + IRQ_PCI0:
+  case T_IRQ0 + IRQ_PCI1:
+  case T_IRQ0 + IRQ_PCI2:
+    virtiointr();
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_KBD:
     kbdintr();
     lapiceoi();
@@ -77,6 +84,13 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Fault in mmap pages on first touch, and pages that
+    // were paged out to swap.
+    if(myproc() && (tf->cs&3) == DPL_USER && pagefault(rcr2(), tf->err) == 0)
+      break;
+    // Otherwise treat like any other bad trap.
+
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
@@ -32,6 +32,9 @@
 #define IRQ_TIMER        0
 #define IRQ_KBD          1
 #define IRQ_COM1         4
+#define IRQ_PCI0         9   // PCI interrupt lines the BIOS routes
+#define IRQ_PCI1        10   //   devices to (see virtio.c)
+#define IRQ_PCI2        11
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
 #define IRQ_SPURIOUS    31
@@ -1,4 +1,9 @@
 struct stat;
+struct vmstat;
+struct bstat;
+struct diskstat;
+struct dcstat;
+struct iovec;
 struct rtcdate;
 struct pstat;
 
@@ -28,6 +33,21 @@ int setpri(int PID, int pri);
 int getpri(int PID);
 int fork2(int pri);
 int getpinfo(struct pstat*);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+void* shmat(const char*, int);
+int shmdt(void*);
+int getvmstat(struct vmstat*);
+int getbstat(struct bstat*);
+int getdiskstat(struct diskstat*);
+int fsync(int);
+int getdcstat(struct dcstat*);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int readv(int, const struct iovec*, int);
+int writev(int, const struct iovec*, int);
+int sendfile(int, int, int*, int);
+int splice(int, int, int);
 // ulib.c
 int stat(const char*, struct stat*);
 char* strcpy(char*, const char*);
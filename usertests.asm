@@ -0,0 +1,12187 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+       6:	68 8a 6b 00 00       	push   $0x6b8a
+       b:	ff 35 a4 a0 00 00    	push   0xa0a4
+      11:	e8 3f 68 00 00       	call   6855 <printf>
+
+  if(mkdir("iputdir") < 0){
+      16:	c7 04 24 1d 6b 00 00 	movl   $0x6b1d,(%esp)
+      1d:	e8 be 66 00 00       	call   66e0 <mkdir>
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	78 54                	js     7d <iputtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+  if(chdir("iputdir") < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 1d 6b 00 00       	push   $0x6b1d
+      31:	e8 b2 66 00 00       	call   66e8 <chdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	78 58                	js     95 <iputtest+0x95>
+    printf(stdout, "chdir iputdir failed\n");
+    exit();
+  }
+  if(unlink("../iputdir") < 0){
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	68 1a 6b 00 00       	push   $0x6b1a
+      45:	e8 7e 66 00 00       	call   66c8 <unlink>
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	85 c0                	test   %eax,%eax
+      4f:	78 5c                	js     ad <iputtest+0xad>
+    printf(stdout, "unlink ../iputdir failed\n");
+    exit();
+  }
+  if(chdir("/") < 0){
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	68 3f 6b 00 00       	push   $0x6b3f
+      59:	e8 8a 66 00 00       	call   66e8 <chdir>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	78 60                	js     c5 <iputtest+0xc5>
+    printf(stdout, "chdir / failed\n");
+    exit();
+  }
+  printf(stdout, "iput test ok\n");
+      65:	83 ec 08             	sub    $0x8,%esp
+      68:	68 b3 6b 00 00       	push   $0x6bb3
+      6d:	ff 35 a4 a0 00 00    	push   0xa0a4
+      73:	e8 dd 67 00 00       	call   6855 <printf>
+}
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	c9                   	leave
+      7c:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 94 74 00 00       	push   $0x7494
+      85:	ff 35 a4 a0 00 00    	push   0xa0a4
+      8b:	e8 c5 67 00 00       	call   6855 <printf>
+    exit();
+      90:	e8 e3 65 00 00       	call   6678 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 04 6b 00 00       	push   $0x6b04
+      9d:	ff 35 a4 a0 00 00    	push   0xa0a4
+      a3:	e8 ad 67 00 00       	call   6855 <printf>
+    exit();
+      a8:	e8 cb 65 00 00       	call   6678 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 25 6b 00 00       	push   $0x6b25
+      b5:	ff 35 a4 a0 00 00    	push   0xa0a4
+      bb:	e8 95 67 00 00       	call   6855 <printf>
+    exit();
+      c0:	e8 b3 65 00 00       	call   6678 <exit>
+    printf(stdout, "chdir / failed\n");
+      c5:	83 ec 08             	sub    $0x8,%esp
+      c8:	68 41 6b 00 00       	push   $0x6b41
+      cd:	ff 35 a4 a0 00 00    	push   0xa0a4
+      d3:	e8 7d 67 00 00       	call   6855 <printf>
+    exit();
+      d8:	e8 9b 65 00 00       	call   6678 <exit>
+
+000000dd <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      dd:	55                   	push   %ebp
+      de:	89 e5                	mov    %esp,%ebp
+      e0:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      e3:	68 51 6b 00 00       	push   $0x6b51
+      e8:	ff 35 a4 a0 00 00    	push   0xa0a4
+      ee:	e8 62 67 00 00       	call   6855 <printf>
+
+  pid = fork();
+      f3:	e8 78 65 00 00       	call   6670 <fork>
+  if(pid < 0){
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	78 47                	js     146 <exitiputtest+0x69>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      ff:	0f 85 a1 00 00 00    	jne    1a6 <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 1d 6b 00 00       	push   $0x6b1d
+     10d:	e8 ce 65 00 00       	call   66e0 <mkdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	78 45                	js     15e <exitiputtest+0x81>
+      printf(stdout, "mkdir failed\n");
+      exit();
+    }
+    if(chdir("iputdir") < 0){
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	68 1d 6b 00 00       	push   $0x6b1d
+     121:	e8 c2 65 00 00       	call   66e8 <chdir>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	85 c0                	test   %eax,%eax
+     12b:	78 49                	js     176 <exitiputtest+0x99>
+      printf(stdout, "child chdir failed\n");
+      exit();
+    }
+    if(unlink("../iputdir") < 0){
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 1a 6b 00 00       	push   $0x6b1a
+     135:	e8 8e 65 00 00       	call   66c8 <unlink>
+     13a:	83 c4 10             	add    $0x10,%esp
+     13d:	85 c0                	test   %eax,%eax
+     13f:	78 4d                	js     18e <exitiputtest+0xb1>
+      printf(stdout, "unlink ../iputdir failed\n");
+      exit();
+    }
+    exit();
+     141:	e8 32 65 00 00       	call   6678 <exit>
+    printf(stdout, "fork failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 07 85 00 00       	push   $0x8507
+     14e:	ff 35 a4 a0 00 00    	push   0xa0a4
+     154:	e8 fc 66 00 00       	call   6855 <printf>
+    exit();
+     159:	e8 1a 65 00 00       	call   6678 <exit>
+      printf(stdout, "mkdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 94 74 00 00       	push   $0x7494
+     166:	ff 35 a4 a0 00 00    	push   0xa0a4
+     16c:	e8 e4 66 00 00       	call   6855 <printf>
+      exit();
+     171:	e8 02 65 00 00       	call   6678 <exit>
+      printf(stdout, "child chdir failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 60 6b 00 00       	push   $0x6b60
+     17e:	ff 35 a4 a0 00 00    	push   0xa0a4
+     184:	e8 cc 66 00 00       	call   6855 <printf>
+      exit();
+     189:	e8 ea 64 00 00       	call   6678 <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 25 6b 00 00       	push   $0x6b25
+     196:	ff 35 a4 a0 00 00    	push   0xa0a4
+     19c:	e8 b4 66 00 00       	call   6855 <printf>
+      exit();
+     1a1:	e8 d2 64 00 00       	call   6678 <exit>
+  }
+  wait();
+     1a6:	e8 d5 64 00 00       	call   6680 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1ab:	83 ec 08             	sub    $0x8,%esp
+     1ae:	68 74 6b 00 00       	push   $0x6b74
+     1b3:	ff 35 a4 a0 00 00    	push   0xa0a4
+     1b9:	e8 97 66 00 00       	call   6855 <printf>
+}
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	c9                   	leave
+     1c2:	c3                   	ret
+
+000001c3 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1c3:	55                   	push   %ebp
+     1c4:	89 e5                	mov    %esp,%ebp
+     1c6:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1c9:	68 86 6b 00 00       	push   $0x6b86
+     1ce:	ff 35 a4 a0 00 00    	push   0xa0a4
+     1d4:	e8 7c 66 00 00       	call   6855 <printf>
+  if(mkdir("oidir") < 0){
+     1d9:	c7 04 24 95 6b 00 00 	movl   $0x6b95,(%esp)
+     1e0:	e8 fb 64 00 00       	call   66e0 <mkdir>
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	85 c0                	test   %eax,%eax
+     1ea:	78 39                	js     225 <openiputtest+0x62>
+    printf(stdout, "mkdir oidir failed\n");
+    exit();
+  }
+  pid = fork();
+     1ec:	e8 7f 64 00 00       	call   6670 <fork>
+  if(pid < 0){
+     1f1:	85 c0                	test   %eax,%eax
+     1f3:	78 48                	js     23d <openiputtest+0x7a>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     1f5:	75 63                	jne    25a <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     1f7:	83 ec 08             	sub    $0x8,%esp
+     1fa:	6a 02                	push   $0x2
+     1fc:	68 95 6b 00 00       	push   $0x6b95
+     201:	e8 b2 64 00 00       	call   66b8 <open>
+    if(fd >= 0){
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	85 c0                	test   %eax,%eax
+     20b:	78 48                	js     255 <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     20d:	83 ec 08             	sub    $0x8,%esp
+     210:	68 d0 85 00 00       	push   $0x85d0
+     215:	ff 35 a4 a0 00 00    	push   0xa0a4
+     21b:	e8 35 66 00 00       	call   6855 <printf>
+      exit();
+     220:	e8 53 64 00 00       	call   6678 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 9b 6b 00 00       	push   $0x6b9b
+     22d:	ff 35 a4 a0 00 00    	push   0xa0a4
+     233:	e8 1d 66 00 00       	call   6855 <printf>
+    exit();
+     238:	e8 3b 64 00 00       	call   6678 <exit>
+    printf(stdout, "fork failed\n");
+     23d:	83 ec 08             	sub    $0x8,%esp
+     240:	68 07 85 00 00       	push   $0x8507
+     245:	ff 35 a4 a0 00 00    	push   0xa0a4
+     24b:	e8 05 66 00 00       	call   6855 <printf>
+    exit();
+     250:	e8 23 64 00 00       	call   6678 <exit>
+    }
+    exit();
+     255:	e8 1e 64 00 00       	call   6678 <exit>
+  }
+  sleep(1);
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	6a 01                	push   $0x1
+     25f:	e8 a4 64 00 00       	call   6708 <sleep>
+  if(unlink("oidir") != 0){
+     264:	c7 04 24 95 6b 00 00 	movl   $0x6b95,(%esp)
+     26b:	e8 58 64 00 00       	call   66c8 <unlink>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	85 c0                	test   %eax,%eax
+     275:	75 1d                	jne    294 <openiputtest+0xd1>
+    printf(stdout, "unlink failed\n");
+    exit();
+  }
+  wait();
+     277:	e8 04 64 00 00       	call   6680 <wait>
+  printf(stdout, "openiput test ok\n");
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	68 af 6b 00 00       	push   $0x6baf
+     284:	ff 35 a4 a0 00 00    	push   0xa0a4
+     28a:	e8 c6 65 00 00       	call   6855 <printf>
+}
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	c9                   	leave
+     293:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     294:	83 ec 08             	sub    $0x8,%esp
+     297:	68 4e 85 00 00       	push   $0x854e
+     29c:	ff 35 a4 a0 00 00    	push   0xa0a4
+     2a2:	e8 ae 65 00 00       	call   6855 <printf>
+    exit();
+     2a7:	e8 cc 63 00 00       	call   6678 <exit>
+
+000002ac <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ac:	55                   	push   %ebp
+     2ad:	89 e5                	mov    %esp,%ebp
+     2af:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     2b2:	68 c1 6b 00 00       	push   $0x6bc1
+     2b7:	ff 35 a4 a0 00 00    	push   0xa0a4
+     2bd:	e8 93 65 00 00       	call   6855 <printf>
+  fd = open("echo", 0);
+     2c2:	83 c4 08             	add    $0x8,%esp
+     2c5:	6a 00                	push   $0x0
+     2c7:	68 cc 6b 00 00       	push   $0x6bcc
+     2cc:	e8 e7 63 00 00       	call   66b8 <open>
+  if(fd < 0){
+     2d1:	83 c4 10             	add    $0x10,%esp
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	78 37                	js     30f <opentest+0x63>
+    printf(stdout, "open echo failed!\n");
+    exit();
+  }
+  close(fd);
+     2d8:	83 ec 0c             	sub    $0xc,%esp
+     2db:	50                   	push   %eax
+     2dc:	e8 bf 63 00 00       	call   66a0 <close>
+  fd = open("doesnotexist", 0);
+     2e1:	83 c4 08             	add    $0x8,%esp
+     2e4:	6a 00                	push   $0x0
+     2e6:	68 e4 6b 00 00       	push   $0x6be4
+     2eb:	e8 c8 63 00 00       	call   66b8 <open>
+  if(fd >= 0){
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	79 30                	jns    327 <opentest+0x7b>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    exit();
+  }
+  printf(stdout, "open test ok\n");
+     2f7:	83 ec 08             	sub    $0x8,%esp
+     2fa:	68 0f 6c 00 00       	push   $0x6c0f
+     2ff:	ff 35 a4 a0 00 00    	push   0xa0a4
+     305:	e8 4b 65 00 00       	call   6855 <printf>
+}
+     30a:	83 c4 10             	add    $0x10,%esp
+     30d:	c9                   	leave
+     30e:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     30f:	83 ec 08             	sub    $0x8,%esp
+     312:	68 d1 6b 00 00       	push   $0x6bd1
+     317:	ff 35 a4 a0 00 00    	push   0xa0a4
+     31d:	e8 33 65 00 00       	call   6855 <printf>
+    exit();
+     322:	e8 51 63 00 00       	call   6678 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     327:	83 ec 08             	sub    $0x8,%esp
+     32a:	68 f1 6b 00 00       	push   $0x6bf1
+     32f:	ff 35 a4 a0 00 00    	push   0xa0a4
+     335:	e8 1b 65 00 00       	call   6855 <printf>
+    exit();
+     33a:	e8 39 63 00 00       	call   6678 <exit>
+
+0000033f <writetest>:
+
+void
+writetest(void)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	56                   	push   %esi
+     343:	53                   	push   %ebx
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	68 1d 6c 00 00       	push   $0x6c1d
+     34c:	ff 35 a4 a0 00 00    	push   0xa0a4
+     352:	e8 fe 64 00 00       	call   6855 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     357:	83 c4 08             	add    $0x8,%esp
+     35a:	68 02 02 00 00       	push   $0x202
+     35f:	68 2e 6c 00 00       	push   $0x6c2e
+     364:	e8 4f 63 00 00       	call   66b8 <open>
+  if(fd >= 0){
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	85 c0                	test   %eax,%eax
+     36e:	78 57                	js     3c7 <writetest+0x88>
+     370:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     372:	83 ec 08             	sub    $0x8,%esp
+     375:	68 34 6c 00 00       	push   $0x6c34
+     37a:	ff 35 a4 a0 00 00    	push   0xa0a4
+     380:	e8 d0 64 00 00       	call   6855 <printf>
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     385:	83 c4 10             	add    $0x10,%esp
+     388:	bb 00 00 00 00       	mov    $0x0,%ebx
+     38d:	83 fb 63             	cmp    $0x63,%ebx
+     390:	7f 7f                	jg     411 <writetest+0xd2>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     392:	83 ec 04             	sub    $0x4,%esp
+     395:	6a 0a                	push   $0xa
+     397:	68 6b 6c 00 00       	push   $0x6c6b
+     39c:	56                   	push   %esi
+     39d:	e8 f6 62 00 00       	call   6698 <write>
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	83 f8 0a             	cmp    $0xa,%eax
+     3a8:	75 35                	jne    3df <writetest+0xa0>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+      exit();
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3aa:	83 ec 04             	sub    $0x4,%esp
+     3ad:	6a 0a                	push   $0xa
+     3af:	68 76 6c 00 00       	push   $0x6c76
+     3b4:	56                   	push   %esi
+     3b5:	e8 de 62 00 00       	call   6698 <write>
+     3ba:	83 c4 10             	add    $0x10,%esp
+     3bd:	83 f8 0a             	cmp    $0xa,%eax
+     3c0:	75 36                	jne    3f8 <writetest+0xb9>
+  for(i = 0; i < 100; i++){
+     3c2:	83 c3 01             	add    $0x1,%ebx
+     3c5:	eb c6                	jmp    38d <writetest+0x4e>
+    printf(stdout, "error: creat small failed!\n");
+     3c7:	83 ec 08             	sub    $0x8,%esp
+     3ca:	68 4f 6c 00 00       	push   $0x6c4f
+     3cf:	ff 35 a4 a0 00 00    	push   0xa0a4
+     3d5:	e8 7b 64 00 00       	call   6855 <printf>
+    exit();
+     3da:	e8 99 62 00 00       	call   6678 <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     3df:	83 ec 04             	sub    $0x4,%esp
+     3e2:	53                   	push   %ebx
+     3e3:	68 f4 85 00 00       	push   $0x85f4
+     3e8:	ff 35 a4 a0 00 00    	push   0xa0a4
+     3ee:	e8 62 64 00 00       	call   6855 <printf>
+      exit();
+     3f3:	e8 80 62 00 00       	call   6678 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     3f8:	83 ec 04             	sub    $0x4,%esp
+     3fb:	53                   	push   %ebx
+     3fc:	68 18 86 00 00       	push   $0x8618
+     401:	ff 35 a4 a0 00 00    	push   0xa0a4
+     407:	e8 49 64 00 00       	call   6855 <printf>
+      exit();
+     40c:	e8 67 62 00 00       	call   6678 <exit>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     411:	83 ec 08             	sub    $0x8,%esp
+     414:	68 81 6c 00 00       	push   $0x6c81
+     419:	ff 35 a4 a0 00 00    	push   0xa0a4
+     41f:	e8 31 64 00 00       	call   6855 <printf>
+  close(fd);
+     424:	89 34 24             	mov    %esi,(%esp)
+     427:	e8 74 62 00 00       	call   66a0 <close>
+  fd = open("small", O_RDONLY);
+     42c:	83 c4 08             	add    $0x8,%esp
+     42f:	6a 00                	push   $0x0
+     431:	68 2e 6c 00 00       	push   $0x6c2e
+     436:	e8 7d 62 00 00       	call   66b8 <open>
+     43b:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     43d:	83 c4 10             	add    $0x10,%esp
+     440:	85 c0                	test   %eax,%eax
+     442:	78 7b                	js     4bf <writetest+0x180>
+    printf(stdout, "open small succeeded ok\n");
+     444:	83 ec 08             	sub    $0x8,%esp
+     447:	68 8c 6c 00 00       	push   $0x6c8c
+     44c:	ff 35 a4 a0 00 00    	push   0xa0a4
+     452:	e8 fe 63 00 00       	call   6855 <printf>
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     457:	83 c4 0c             	add    $0xc,%esp
+     45a:	68 d0 07 00 00       	push   $0x7d0
+     45f:	68 e0 c7 00 00       	push   $0xc7e0
+     464:	53                   	push   %ebx
+     465:	e8 26 62 00 00       	call   6690 <read>
+  if(i == 2000){
+     46a:	83 c4 10             	add    $0x10,%esp
+     46d:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     472:	75 63                	jne    4d7 <writetest+0x198>
+    printf(stdout, "read succeeded ok\n");
+     474:	83 ec 08             	sub    $0x8,%esp
+     477:	68 c0 6c 00 00       	push   $0x6cc0
+     47c:	ff 35 a4 a0 00 00    	push   0xa0a4
+     482:	e8 ce 63 00 00       	call   6855 <printf>
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     487:	89 1c 24             	mov    %ebx,(%esp)
+     48a:	e8 11 62 00 00       	call   66a0 <close>
+
+  if(unlink("small") < 0){
+     48f:	c7 04 24 2e 6c 00 00 	movl   $0x6c2e,(%esp)
+     496:	e8 2d 62 00 00       	call   66c8 <unlink>
+     49b:	83 c4 10             	add    $0x10,%esp
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	78 4d                	js     4ef <writetest+0x1b0>
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file test ok\n");
+     4a2:	83 ec 08             	sub    $0x8,%esp
+     4a5:	68 e8 6c 00 00       	push   $0x6ce8
+     4aa:	ff 35 a4 a0 00 00    	push   0xa0a4
+     4b0:	e8 a0 63 00 00       	call   6855 <printf>
+}
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4bb:	5b                   	pop    %ebx
+     4bc:	5e                   	pop    %esi
+     4bd:	5d                   	pop    %ebp
+     4be:	c3                   	ret
+    printf(stdout, "error: open small failed!\n");
+     4bf:	83 ec 08             	sub    $0x8,%esp
+     4c2:	68 a5 6c 00 00       	push   $0x6ca5
+     4c7:	ff 35 a4 a0 00 00    	push   0xa0a4
+     4cd:	e8 83 63 00 00       	call   6855 <printf>
+    exit();
+     4d2:	e8 a1 61 00 00       	call   6678 <exit>
+    printf(stdout, "read failed\n");
+     4d7:	83 ec 08             	sub    $0x8,%esp
+     4da:	68 5f 71 00 00       	push   $0x715f
+     4df:	ff 35 a4 a0 00 00    	push   0xa0a4
+     4e5:	e8 6b 63 00 00       	call   6855 <printf>
+    exit();
+     4ea:	e8 89 61 00 00       	call   6678 <exit>
+    printf(stdout, "unlink small failed\n");
+     4ef:	83 ec 08             	sub    $0x8,%esp
+     4f2:	68 d3 6c 00 00       	push   $0x6cd3
+     4f7:	ff 35 a4 a0 00 00    	push   0xa0a4
+     4fd:	e8 53 63 00 00       	call   6855 <printf>
+    exit();
+     502:	e8 71 61 00 00       	call   6678 <exit>
+
+00000507 <writetest1>:
+// enough to need an extent block if the disk is fragmented.
+#define BIGBLOCKS 400
+
+void
+writetest1(void)
+{
+     507:	55                   	push   %ebp
+     508:	89 e5                	mov    %esp,%ebp
+     50a:	56                   	push   %esi
+     50b:	53                   	push   %ebx
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     50c:	83 ec 08             	sub    $0x8,%esp
+     50f:	68 fc 6c 00 00       	push   $0x6cfc
+     514:	ff 35 a4 a0 00 00    	push   0xa0a4
+     51a:	e8 36 63 00 00       	call   6855 <printf>
+
+  fd = open("big", O_CREATE|O_RDWR);
+     51f:	83 c4 08             	add    $0x8,%esp
+     522:	68 02 02 00 00       	push   $0x202
+     527:	68 76 6d 00 00       	push   $0x6d76
+     52c:	e8 87 61 00 00       	call   66b8 <open>
+  if(fd < 0){
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	78 37                	js     56f <writetest1+0x68>
+     538:	89 c6                	mov    %eax,%esi
+    printf(stdout, "error: creat big failed!\n");
+    exit();
+  }
+
+  for(i = 0; i < BIGBLOCKS; i++){
+     53a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     53f:	81 fb 8f 01 00 00    	cmp    $0x18f,%ebx
+     545:	7f 59                	jg     5a0 <writetest1+0x99>
+    ((int*)buf)[0] = i;
+     547:	89 1d e0 c7 00 00    	mov    %ebx,0xc7e0
+    if(write(fd, buf, 512) != 512){
+     54d:	83 ec 04             	sub    $0x4,%esp
+     550:	68 00 02 00 00       	push   $0x200
+     555:	68 e0 c7 00 00       	push   $0xc7e0
+     55a:	56                   	push   %esi
+     55b:	e8 38 61 00 00       	call   6698 <write>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	3d 00 02 00 00       	cmp    $0x200,%eax
+     568:	75 1d                	jne    587 <writetest1+0x80>
+  for(i = 0; i < BIGBLOCKS; i++){
+     56a:	83 c3 01             	add    $0x1,%ebx
+     56d:	eb d0                	jmp    53f <writetest1+0x38>
+    printf(stdout, "error: creat big failed!\n");
+     56f:	83 ec 08             	sub    $0x8,%esp
+     572:	68 0c 6d 00 00       	push   $0x6d0c
+     577:	ff 35 a4 a0 00 00    	push   0xa0a4
+     57d:	e8 d3 62 00 00       	call   6855 <printf>
+    exit();
+     582:	e8 f1 60 00 00       	call   6678 <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     587:	83 ec 04             	sub    $0x4,%esp
+     58a:	53                   	push   %ebx
+     58b:	68 26 6d 00 00       	push   $0x6d26
+     590:	ff 35 a4 a0 00 00    	push   0xa0a4
+     596:	e8 ba 62 00 00       	call   6855 <printf>
+      exit();
+     59b:	e8 d8 60 00 00       	call   6678 <exit>
+    }
+  }
+
+  close(fd);
+     5a0:	83 ec 0c             	sub    $0xc,%esp
+     5a3:	56                   	push   %esi
+     5a4:	e8 f7 60 00 00       	call   66a0 <close>
+
+  fd = open("big", O_RDONLY);
+     5a9:	83 c4 08             	add    $0x8,%esp
+     5ac:	6a 00                	push   $0x0
+     5ae:	68 76 6d 00 00       	push   $0x6d76
+     5b3:	e8 00 61 00 00       	call   66b8 <open>
+     5b8:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     5ba:	83 c4 10             	add    $0x10,%esp
+     5bd:	85 c0                	test   %eax,%eax
+     5bf:	78 3c                	js     5fd <writetest1+0xf6>
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+
+  n = 0;
+     5c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(;;){
+    i = read(fd, buf, 512);
+     5c6:	83 ec 04             	sub    $0x4,%esp
+     5c9:	68 00 02 00 00       	push   $0x200
+     5ce:	68 e0 c7 00 00       	push   $0xc7e0
+     5d3:	56                   	push   %esi
+     5d4:	e8 b7 60 00 00       	call   6690 <read>
+    if(i == 0){
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	85 c0                	test   %eax,%eax
+     5de:	74 35                	je     615 <writetest1+0x10e>
+      if(n != BIGBLOCKS){
+        printf(stdout, "read only %d blocks from big", n);
+        exit();
+      }
+      break;
+    } else if(i != 512){
+     5e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5e5:	0f 85 84 00 00 00    	jne    66f <writetest1+0x168>
+      printf(stdout, "read failed %d\n", i);
+      exit();
+    }
+    if(((int*)buf)[0] != n){
+     5eb:	a1 e0 c7 00 00       	mov    0xc7e0,%eax
+     5f0:	39 d8                	cmp    %ebx,%eax
+     5f2:	0f 85 90 00 00 00    	jne    688 <writetest1+0x181>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+    n++;
+     5f8:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     5fb:	eb c9                	jmp    5c6 <writetest1+0xbf>
+    printf(stdout, "error: open big failed!\n");
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 44 6d 00 00       	push   $0x6d44
+     605:	ff 35 a4 a0 00 00    	push   0xa0a4
+     60b:	e8 45 62 00 00       	call   6855 <printf>
+    exit();
+     610:	e8 63 60 00 00       	call   6678 <exit>
+      if(n != BIGBLOCKS){
+     615:	81 fb 90 01 00 00    	cmp    $0x190,%ebx
+     61b:	75 39                	jne    656 <writetest1+0x14f>
+  }
+  close(fd);
+     61d:	83 ec 0c             	sub    $0xc,%esp
+     620:	56                   	push   %esi
+     621:	e8 7a 60 00 00       	call   66a0 <close>
+  if(unlink("big") < 0){
+     626:	c7 04 24 76 6d 00 00 	movl   $0x6d76,(%esp)
+     62d:	e8 96 60 00 00       	call   66c8 <unlink>
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	78 66                	js     69f <writetest1+0x198>
+    printf(stdout, "unlink big failed\n");
+    exit();
+  }
+  printf(stdout, "big files ok\n");
+     639:	83 ec 08             	sub    $0x8,%esp
+     63c:	68 9d 6d 00 00       	push   $0x6d9d
+     641:	ff 35 a4 a0 00 00    	push   0xa0a4
+     647:	e8 09 62 00 00       	call   6855 <printf>
+}
+     64c:	83 c4 10             	add    $0x10,%esp
+     64f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     652:	5b                   	pop    %ebx
+     653:	5e                   	pop    %esi
+     654:	5d                   	pop    %ebp
+     655:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     656:	83 ec 04             	sub    $0x4,%esp
+     659:	53                   	push   %ebx
+     65a:	68 5d 6d 00 00       	push   $0x6d5d
+     65f:	ff 35 a4 a0 00 00    	push   0xa0a4
+     665:	e8 eb 61 00 00       	call   6855 <printf>
+        exit();
+     66a:	e8 09 60 00 00       	call   6678 <exit>
+      printf(stdout, "read failed %d\n", i);
+     66f:	83 ec 04             	sub    $0x4,%esp
+     672:	50                   	push   %eax
+     673:	68 7a 6d 00 00       	push   $0x6d7a
+     678:	ff 35 a4 a0 00 00    	push   0xa0a4
+     67e:	e8 d2 61 00 00       	call   6855 <printf>
+      exit();
+     683:	e8 f0 5f 00 00       	call   6678 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     688:	50                   	push   %eax
+     689:	53                   	push   %ebx
+     68a:	68 3c 86 00 00       	push   $0x863c
+     68f:	ff 35 a4 a0 00 00    	push   0xa0a4
+     695:	e8 bb 61 00 00       	call   6855 <printf>
+      exit();
+     69a:	e8 d9 5f 00 00       	call   6678 <exit>
+    printf(stdout, "unlink big failed\n");
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 8a 6d 00 00       	push   $0x6d8a
+     6a7:	ff 35 a4 a0 00 00    	push   0xa0a4
+     6ad:	e8 a3 61 00 00       	call   6855 <printf>
+    exit();
+     6b2:	e8 c1 5f 00 00       	call   6678 <exit>
+
+000006b7 <fragtest>:
+#define FRAGFILES 60
+#define FRAGBIG   300
+
+void
+fragtest(void)
+{
+     6b7:	55                   	push   %ebp
+     6b8:	89 e5                	mov    %esp,%ebp
+     6ba:	57                   	push   %edi
+     6bb:	56                   	push   %esi
+     6bc:	53                   	push   %ebx
+     6bd:	83 ec 24             	sub    $0x24,%esp
+  char name[8];
+  int i, fd, sfd, n;
+
+  printf(stdout, "fragmented file test\n");
+     6c0:	68 ab 6d 00 00       	push   $0x6dab
+     6c5:	ff 35 a4 a0 00 00    	push   0xa0a4
+     6cb:	e8 85 61 00 00       	call   6855 <printf>
+
+  // The first block of fragbig, so that its reservation sits
+  // in front of the small files.
+  unlink("fragbig");
+     6d0:	c7 04 24 c1 6d 00 00 	movl   $0x6dc1,(%esp)
+     6d7:	e8 ec 5f 00 00       	call   66c8 <unlink>
+  fd = open("fragbig", O_CREATE|O_RDWR);
+     6dc:	83 c4 08             	add    $0x8,%esp
+     6df:	68 02 02 00 00       	push   $0x202
+     6e4:	68 c1 6d 00 00       	push   $0x6dc1
+     6e9:	e8 ca 5f 00 00       	call   66b8 <open>
+  if(fd < 0){
+     6ee:	83 c4 10             	add    $0x10,%esp
+     6f1:	85 c0                	test   %eax,%eax
+     6f3:	0f 88 d6 00 00 00    	js     7cf <fragtest+0x118>
+     6f9:	89 c6                	mov    %eax,%esi
+    printf(stdout, "frag: create fragbig failed\n");
+    exit();
+  }
+  ((int*)buf)[0] = 0;
+     6fb:	c7 05 e0 c7 00 00 00 	movl   $0x0,0xc7e0
+     702:	00 00 00 
+  if(write(fd, buf, 512) != 512 || fsync(fd) != 0){
+     705:	83 ec 04             	sub    $0x4,%esp
+     708:	68 00 02 00 00       	push   $0x200
+     70d:	68 e0 c7 00 00       	push   $0xc7e0
+     712:	50                   	push   %eax
+     713:	e8 80 5f 00 00       	call   6698 <write>
+     718:	83 c4 10             	add    $0x10,%esp
+     71b:	3d 00 02 00 00       	cmp    $0x200,%eax
+     720:	0f 85 c1 00 00 00    	jne    7e7 <fragtest+0x130>
+     726:	83 ec 0c             	sub    $0xc,%esp
+     729:	56                   	push   %esi
+     72a:	e8 41 60 00 00       	call   6770 <fsync>
+     72f:	89 c3                	mov    %eax,%ebx
+     731:	83 c4 10             	add    $0x10,%esp
+     734:	85 c0                	test   %eax,%eax
+     736:	0f 85 ab 00 00 00    	jne    7e7 <fragtest+0x130>
+    printf(stdout, "frag: write fragbig failed\n");
+    exit();
+  }
+
+  // One-block files after it; every other one goes away.
+  name[0] = 'f';
+     73c:	c6 45 e0 66          	movb   $0x66,-0x20(%ebp)
+  name[1] = 'r';
+     740:	c6 45 e1 72          	movb   $0x72,-0x1f(%ebp)
+  name[4] = '\0';
+     744:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  for(i = 0; i < FRAGFILES; i++){
+     748:	83 fb 3b             	cmp    $0x3b,%ebx
+     74b:	0f 8f ca 00 00 00    	jg     81b <fragtest+0x164>
+    name[2] = '0' + i/10;
+     751:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     756:	89 d8                	mov    %ebx,%eax
+     758:	f7 ea                	imul   %edx
+     75a:	c1 fa 02             	sar    $0x2,%edx
+     75d:	89 d8                	mov    %ebx,%eax
+     75f:	c1 f8 1f             	sar    $0x1f,%eax
+     762:	29 c2                	sub    %eax,%edx
+     764:	8d 42 30             	lea    0x30(%edx),%eax
+     767:	88 45 e2             	mov    %al,-0x1e(%ebp)
+    name[3] = '0' + i%10;
+     76a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     76d:	01 d2                	add    %edx,%edx
+     76f:	89 d8                	mov    %ebx,%eax
+     771:	29 d0                	sub    %edx,%eax
+     773:	83 c0 30             	add    $0x30,%eax
+     776:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    sfd = open(name, O_CREATE|O_RDWR);
+     779:	83 ec 08             	sub    $0x8,%esp
+     77c:	68 02 02 00 00       	push   $0x202
+     781:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     784:	50                   	push   %eax
+     785:	e8 2e 5f 00 00       	call   66b8 <open>
+     78a:	89 c7                	mov    %eax,%edi
+    if(sfd < 0 || write(sfd, "x", 1) != 1 || fsync(sfd) != 0){
+     78c:	83 c4 10             	add    $0x10,%esp
+     78f:	85 c0                	test   %eax,%eax
+     791:	78 6c                	js     7ff <fragtest+0x148>
+     793:	83 ec 04             	sub    $0x4,%esp
+     796:	6a 01                	push   $0x1
+     798:	68 10 77 00 00       	push   $0x7710
+     79d:	50                   	push   %eax
+     79e:	e8 f5 5e 00 00       	call   6698 <write>
+     7a3:	83 c4 10             	add    $0x10,%esp
+     7a6:	83 f8 01             	cmp    $0x1,%eax
+     7a9:	75 54                	jne    7ff <fragtest+0x148>
+     7ab:	83 ec 0c             	sub    $0xc,%esp
+     7ae:	57                   	push   %edi
+     7af:	e8 bc 5f 00 00       	call   6770 <fsync>
+     7b4:	83 c4 10             	add    $0x10,%esp
+     7b7:	85 c0                	test   %eax,%eax
+     7b9:	75 44                	jne    7ff <fragtest+0x148>
+      printf(stdout, "frag: create %s failed\n", name);
+      exit();
+    }
+    close(sfd);
+     7bb:	83 ec 0c             	sub    $0xc,%esp
+     7be:	57                   	push   %edi
+     7bf:	e8 dc 5e 00 00       	call   66a0 <close>
+  for(i = 0; i < FRAGFILES; i++){
+     7c4:	83 c3 01             	add    $0x1,%ebx
+     7c7:	83 c4 10             	add    $0x10,%esp
+     7ca:	e9 79 ff ff ff       	jmp    748 <fragtest+0x91>
+    printf(stdout, "frag: create fragbig failed\n");
+     7cf:	83 ec 08             	sub    $0x8,%esp
+     7d2:	68 c9 6d 00 00       	push   $0x6dc9
+     7d7:	ff 35 a4 a0 00 00    	push   0xa0a4
+     7dd:	e8 73 60 00 00       	call   6855 <printf>
+    exit();
+     7e2:	e8 91 5e 00 00       	call   6678 <exit>
+    printf(stdout, "frag: write fragbig failed\n");
+     7e7:	83 ec 08             	sub    $0x8,%esp
+     7ea:	68 e6 6d 00 00       	push   $0x6de6
+     7ef:	ff 35 a4 a0 00 00    	push   0xa0a4
+     7f5:	e8 5b 60 00 00       	call   6855 <printf>
+    exit();
+     7fa:	e8 79 5e 00 00       	call   6678 <exit>
+      printf(stdout, "frag: create %s failed\n", name);
+     7ff:	83 ec 04             	sub    $0x4,%esp
+     802:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     805:	50                   	push   %eax
+     806:	68 02 6e 00 00       	push   $0x6e02
+     80b:	ff 35 a4 a0 00 00    	push   0xa0a4
+     811:	e8 3f 60 00 00       	call   6855 <printf>
+      exit();
+     816:	e8 5d 5e 00 00       	call   6678 <exit>
+  }
+  for(i = 1; i < FRAGFILES; i += 2){
+     81b:	bb 01 00 00 00       	mov    $0x1,%ebx
+     820:	83 fb 3b             	cmp    $0x3b,%ebx
+     823:	7f 5c                	jg     881 <fragtest+0x1ca>
+    name[2] = '0' + i/10;
+     825:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     82a:	89 d8                	mov    %ebx,%eax
+     82c:	f7 ea                	imul   %edx
+     82e:	c1 fa 02             	sar    $0x2,%edx
+     831:	89 d8                	mov    %ebx,%eax
+     833:	c1 f8 1f             	sar    $0x1f,%eax
+     836:	29 c2                	sub    %eax,%edx
+     838:	8d 42 30             	lea    0x30(%edx),%eax
+     83b:	88 45 e2             	mov    %al,-0x1e(%ebp)
+    name[3] = '0' + i%10;
+     83e:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     841:	01 d2                	add    %edx,%edx
+     843:	89 d8                	mov    %ebx,%eax
+     845:	29 d0                	sub    %edx,%eax
+     847:	83 c0 30             	add    $0x30,%eax
+     84a:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    if(unlink(name) < 0){
+     84d:	83 ec 0c             	sub    $0xc,%esp
+     850:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     853:	50                   	push   %eax
+     854:	e8 6f 5e 00 00       	call   66c8 <unlink>
+     859:	83 c4 10             	add    $0x10,%esp
+     85c:	85 c0                	test   %eax,%eax
+     85e:	78 05                	js     865 <fragtest+0x1ae>
+  for(i = 1; i < FRAGFILES; i += 2){
+     860:	83 c3 02             	add    $0x2,%ebx
+     863:	eb bb                	jmp    820 <fragtest+0x169>
+      printf(stdout, "frag: unlink %s failed\n", name);
+     865:	83 ec 04             	sub    $0x4,%esp
+     868:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     86b:	50                   	push   %eax
+     86c:	68 1a 6e 00 00       	push   $0x6e1a
+     871:	ff 35 a4 a0 00 00    	push   0xa0a4
+     877:	e8 d9 5f 00 00       	call   6855 <printf>
+      exit();
+     87c:	e8 f7 5d 00 00       	call   6678 <exit>
+    }
+  }
+
+  for(i = 1; i < FRAGBIG; i++){
+     881:	bb 01 00 00 00       	mov    $0x1,%ebx
+     886:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+     88c:	7f 40                	jg     8ce <fragtest+0x217>
+    ((int*)buf)[0] = i;
+     88e:	89 1d e0 c7 00 00    	mov    %ebx,0xc7e0
+    if(write(fd, buf, 512) != 512){
+     894:	83 ec 04             	sub    $0x4,%esp
+     897:	68 00 02 00 00       	push   $0x200
+     89c:	68 e0 c7 00 00       	push   $0xc7e0
+     8a1:	56                   	push   %esi
+     8a2:	e8 f1 5d 00 00       	call   6698 <write>
+     8a7:	83 c4 10             	add    $0x10,%esp
+     8aa:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8af:	75 05                	jne    8b6 <fragtest+0x1ff>
+  for(i = 1; i < FRAGBIG; i++){
+     8b1:	83 c3 01             	add    $0x1,%ebx
+     8b4:	eb d0                	jmp    886 <fragtest+0x1cf>
+      printf(stdout, "frag: write fragbig failed\n");
+     8b6:	83 ec 08             	sub    $0x8,%esp
+     8b9:	68 e6 6d 00 00       	push   $0x6de6
+     8be:	ff 35 a4 a0 00 00    	push   0xa0a4
+     8c4:	e8 8c 5f 00 00       	call   6855 <printf>
+      exit();
+     8c9:	e8 aa 5d 00 00       	call   6678 <exit>
+    }
+  }
+  if(fsync(fd) != 0){
+     8ce:	83 ec 0c             	sub    $0xc,%esp
+     8d1:	56                   	push   %esi
+     8d2:	e8 99 5e 00 00       	call   6770 <fsync>
+     8d7:	89 c3                	mov    %eax,%ebx
+     8d9:	83 c4 10             	add    $0x10,%esp
+     8dc:	85 c0                	test   %eax,%eax
+     8de:	75 4e                	jne    92e <fragtest+0x277>
+    printf(stdout, "frag: fsync fragbig failed\n");
+    exit();
+  }
+  close(fd);
+     8e0:	83 ec 0c             	sub    $0xc,%esp
+     8e3:	56                   	push   %esi
+     8e4:	e8 b7 5d 00 00       	call   66a0 <close>
+
+  fd = open("fragbig", O_RDONLY);
+     8e9:	83 c4 08             	add    $0x8,%esp
+     8ec:	6a 00                	push   $0x0
+     8ee:	68 c1 6d 00 00       	push   $0x6dc1
+     8f3:	e8 c0 5d 00 00       	call   66b8 <open>
+     8f8:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+     8fa:	83 c4 10             	add    $0x10,%esp
+     8fd:	85 c0                	test   %eax,%eax
+     8ff:	78 45                	js     946 <fragtest+0x28f>
+    printf(stdout, "frag: open fragbig failed\n");
+    exit();
+  }
+  for(n = 0; (i = read(fd, buf, 512)) == 512; n++){
+     901:	89 de                	mov    %ebx,%esi
+     903:	83 ec 04             	sub    $0x4,%esp
+     906:	68 00 02 00 00       	push   $0x200
+     90b:	68 e0 c7 00 00       	push   $0xc7e0
+     910:	57                   	push   %edi
+     911:	e8 7a 5d 00 00       	call   6690 <read>
+     916:	83 c4 10             	add    $0x10,%esp
+     919:	3d 00 02 00 00       	cmp    $0x200,%eax
+     91e:	75 55                	jne    975 <fragtest+0x2be>
+    if(((int*)buf)[0] != n){
+     920:	a1 e0 c7 00 00       	mov    0xc7e0,%eax
+     925:	39 f0                	cmp    %esi,%eax
+     927:	75 35                	jne    95e <fragtest+0x2a7>
+  for(n = 0; (i = read(fd, buf, 512)) == 512; n++){
+     929:	83 c6 01             	add    $0x1,%esi
+     92c:	eb d5                	jmp    903 <fragtest+0x24c>
+    printf(stdout, "frag: fsync fragbig failed\n");
+     92e:	83 ec 08             	sub    $0x8,%esp
+     931:	68 32 6e 00 00       	push   $0x6e32
+     936:	ff 35 a4 a0 00 00    	push   0xa0a4
+     93c:	e8 14 5f 00 00       	call   6855 <printf>
+    exit();
+     941:	e8 32 5d 00 00       	call   6678 <exit>
+    printf(stdout, "frag: open fragbig failed\n");
+     946:	83 ec 08             	sub    $0x8,%esp
+     949:	68 4e 6e 00 00       	push   $0x6e4e
+     94e:	ff 35 a4 a0 00 00    	push   0xa0a4
+     954:	e8 fc 5e 00 00       	call   6855 <printf>
+    exit();
+     959:	e8 1a 5d 00 00       	call   6678 <exit>
+      printf(stdout, "frag: block %d of fragbig reads as %d\n", n, ((int*)buf)[0]);
+     95e:	50                   	push   %eax
+     95f:	56                   	push   %esi
+     960:	68 5c 86 00 00       	push   $0x865c
+     965:	ff 35 a4 a0 00 00    	push   0xa0a4
+     96b:	e8 e5 5e 00 00       	call   6855 <printf>
+      exit();
+     970:	e8 03 5d 00 00       	call   6678 <exit>
+    }
+  }
+  if(i != 0 || n != FRAGBIG){
+     975:	85 c0                	test   %eax,%eax
+     977:	0f 95 c0             	setne  %al
+     97a:	81 fe 2c 01 00 00    	cmp    $0x12c,%esi
+     980:	0f 95 c2             	setne  %dl
+     983:	08 d0                	or     %dl,%al
+     985:	75 34                	jne    9bb <fragtest+0x304>
+    printf(stdout, "frag: read only %d blocks of fragbig\n", n);
+    exit();
+  }
+  close(fd);
+     987:	83 ec 0c             	sub    $0xc,%esp
+     98a:	57                   	push   %edi
+     98b:	e8 10 5d 00 00       	call   66a0 <close>
+
+  // Freeing the tree must not free anything twice.
+  if(unlink("fragbig") < 0){
+     990:	c7 04 24 c1 6d 00 00 	movl   $0x6dc1,(%esp)
+     997:	e8 2c 5d 00 00       	call   66c8 <unlink>
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	79 6b                	jns    a0e <fragtest+0x357>
+    printf(stdout, "frag: unlink fragbig failed\n");
+     9a3:	83 ec 08             	sub    $0x8,%esp
+     9a6:	68 69 6e 00 00       	push   $0x6e69
+     9ab:	ff 35 a4 a0 00 00    	push   0xa0a4
+     9b1:	e8 9f 5e 00 00       	call   6855 <printf>
+    exit();
+     9b6:	e8 bd 5c 00 00       	call   6678 <exit>
+    printf(stdout, "frag: read only %d blocks of fragbig\n", n);
+     9bb:	83 ec 04             	sub    $0x4,%esp
+     9be:	56                   	push   %esi
+     9bf:	68 84 86 00 00       	push   $0x8684
+     9c4:	ff 35 a4 a0 00 00    	push   0xa0a4
+     9ca:	e8 86 5e 00 00       	call   6855 <printf>
+    exit();
+     9cf:	e8 a4 5c 00 00       	call   6678 <exit>
+  }
+  for(i = 0; i < FRAGFILES; i += 2){
+    name[2] = '0' + i/10;
+     9d4:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     9d9:	89 d8                	mov    %ebx,%eax
+     9db:	f7 ea                	imul   %edx
+     9dd:	c1 fa 02             	sar    $0x2,%edx
+     9e0:	89 d8                	mov    %ebx,%eax
+     9e2:	c1 f8 1f             	sar    $0x1f,%eax
+     9e5:	29 c2                	sub    %eax,%edx
+     9e7:	8d 42 30             	lea    0x30(%edx),%eax
+     9ea:	88 45 e2             	mov    %al,-0x1e(%ebp)
+    name[3] = '0' + i%10;
+     9ed:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     9f0:	01 d2                	add    %edx,%edx
+     9f2:	89 d8                	mov    %ebx,%eax
+     9f4:	29 d0                	sub    %edx,%eax
+     9f6:	83 c0 30             	add    $0x30,%eax
+     9f9:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    unlink(name);
+     9fc:	83 ec 0c             	sub    $0xc,%esp
+     9ff:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a02:	50                   	push   %eax
+     a03:	e8 c0 5c 00 00       	call   66c8 <unlink>
+  for(i = 0; i < FRAGFILES; i += 2){
+     a08:	83 c3 02             	add    $0x2,%ebx
+     a0b:	83 c4 10             	add    $0x10,%esp
+     a0e:	83 fb 3b             	cmp    $0x3b,%ebx
+     a11:	7e c1                	jle    9d4 <fragtest+0x31d>
+  }
+  printf(stdout, "fragmented file ok\n");
+     a13:	83 ec 08             	sub    $0x8,%esp
+     a16:	68 86 6e 00 00       	push   $0x6e86
+     a1b:	ff 35 a4 a0 00 00    	push   0xa0a4
+     a21:	e8 2f 5e 00 00       	call   6855 <printf>
+}
+     a26:	83 c4 10             	add    $0x10,%esp
+     a29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a2c:	5b                   	pop    %ebx
+     a2d:	5e                   	pop    %esi
+     a2e:	5f                   	pop    %edi
+     a2f:	5d                   	pop    %ebp
+     a30:	c3                   	ret
+
+00000a31 <rsvtest>:
+// their last, so they do not end up interleaved on the disk.
+#define RSVROUNDS 32
+
+void
+rsvtest(void)
+{
+     a31:	55                   	push   %ebp
+     a32:	89 e5                	mov    %esp,%ebp
+     a34:	57                   	push   %edi
+     a35:	56                   	push   %esi
+     a36:	53                   	push   %ebx
+     a37:	83 ec 44             	sub    $0x44,%esp
+  struct stat sta, stb;
+  int fa, fb, i;
+
+  printf(stdout, "block reservation test\n");
+     a3a:	68 9a 6e 00 00       	push   $0x6e9a
+     a3f:	ff 35 a4 a0 00 00    	push   0xa0a4
+     a45:	e8 0b 5e 00 00       	call   6855 <printf>
+
+  unlink("rsva");
+     a4a:	c7 04 24 b2 6e 00 00 	movl   $0x6eb2,(%esp)
+     a51:	e8 72 5c 00 00       	call   66c8 <unlink>
+  unlink("rsvb");
+     a56:	c7 04 24 b7 6e 00 00 	movl   $0x6eb7,(%esp)
+     a5d:	e8 66 5c 00 00       	call   66c8 <unlink>
+  fa = open("rsva", O_CREATE|O_RDWR);
+     a62:	83 c4 08             	add    $0x8,%esp
+     a65:	68 02 02 00 00       	push   $0x202
+     a6a:	68 b2 6e 00 00       	push   $0x6eb2
+     a6f:	e8 44 5c 00 00       	call   66b8 <open>
+     a74:	89 c6                	mov    %eax,%esi
+  fb = open("rsvb", O_CREATE|O_RDWR);
+     a76:	83 c4 08             	add    $0x8,%esp
+     a79:	68 02 02 00 00       	push   $0x202
+     a7e:	68 b7 6e 00 00       	push   $0x6eb7
+     a83:	e8 30 5c 00 00       	call   66b8 <open>
+     a88:	89 c7                	mov    %eax,%edi
+  if(fa < 0 || fb < 0){
+     a8a:	89 f2                	mov    %esi,%edx
+     a8c:	c1 ea 1f             	shr    $0x1f,%edx
+     a8f:	c1 e8 1f             	shr    $0x1f,%eax
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	08 d0                	or     %dl,%al
+     a97:	75 6d                	jne    b06 <rsvtest+0xd5>
+    printf(stdout, "rsv: create failed\n");
+    exit();
+  }
+  // fsync allocates each piece's blocks before the other
+  // file's next piece.
+  for(i = 0; i < RSVROUNDS; i++){
+     a99:	bb 00 00 00 00       	mov    $0x0,%ebx
+     a9e:	83 fb 1f             	cmp    $0x1f,%ebx
+     aa1:	0f 8f 8f 00 00 00    	jg     b36 <rsvtest+0x105>
+    if(write(fa, buf, 4096) != 4096 || fsync(fa) != 0 ||
+     aa7:	83 ec 04             	sub    $0x4,%esp
+     aaa:	68 00 10 00 00       	push   $0x1000
+     aaf:	68 e0 c7 00 00       	push   $0xc7e0
+     ab4:	56                   	push   %esi
+     ab5:	e8 de 5b 00 00       	call   6698 <write>
+     aba:	83 c4 10             	add    $0x10,%esp
+     abd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     ac2:	75 5a                	jne    b1e <rsvtest+0xed>
+     ac4:	83 ec 0c             	sub    $0xc,%esp
+     ac7:	56                   	push   %esi
+     ac8:	e8 a3 5c 00 00       	call   6770 <fsync>
+     acd:	83 c4 10             	add    $0x10,%esp
+     ad0:	85 c0                	test   %eax,%eax
+     ad2:	75 4a                	jne    b1e <rsvtest+0xed>
+       write(fb, buf, 4096) != 4096 || fsync(fb) != 0){
+     ad4:	83 ec 04             	sub    $0x4,%esp
+     ad7:	68 00 10 00 00       	push   $0x1000
+     adc:	68 e0 c7 00 00       	push   $0xc7e0
+     ae1:	57                   	push   %edi
+     ae2:	e8 b1 5b 00 00       	call   6698 <write>
+    if(write(fa, buf, 4096) != 4096 || fsync(fa) != 0 ||
+     ae7:	83 c4 10             	add    $0x10,%esp
+     aea:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     aef:	75 2d                	jne    b1e <rsvtest+0xed>
+       write(fb, buf, 4096) != 4096 || fsync(fb) != 0){
+     af1:	83 ec 0c             	sub    $0xc,%esp
+     af4:	57                   	push   %edi
+     af5:	e8 76 5c 00 00       	call   6770 <fsync>
+     afa:	83 c4 10             	add    $0x10,%esp
+     afd:	85 c0                	test   %eax,%eax
+     aff:	75 1d                	jne    b1e <rsvtest+0xed>
+  for(i = 0; i < RSVROUNDS; i++){
+     b01:	83 c3 01             	add    $0x1,%ebx
+     b04:	eb 98                	jmp    a9e <rsvtest+0x6d>
+    printf(stdout, "rsv: create failed\n");
+     b06:	83 ec 08             	sub    $0x8,%esp
+     b09:	68 bc 6e 00 00       	push   $0x6ebc
+     b0e:	ff 35 a4 a0 00 00    	push   0xa0a4
+     b14:	e8 3c 5d 00 00       	call   6855 <printf>
+    exit();
+     b19:	e8 5a 5b 00 00       	call   6678 <exit>
+      printf(stdout, "rsv: write failed\n");
+     b1e:	83 ec 08             	sub    $0x8,%esp
+     b21:	68 d0 6e 00 00       	push   $0x6ed0
+     b26:	ff 35 a4 a0 00 00    	push   0xa0a4
+     b2c:	e8 24 5d 00 00       	call   6855 <printf>
+      exit();
+     b31:	e8 42 5b 00 00       	call   6678 <exit>
+    }
+  }
+  if(fstat(fa, &sta) < 0 || fstat(fb, &stb) < 0){
+     b36:	83 ec 08             	sub    $0x8,%esp
+     b39:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     b3c:	50                   	push   %eax
+     b3d:	56                   	push   %esi
+     b3e:	e8 8d 5b 00 00       	call   66d0 <fstat>
+     b43:	83 c4 10             	add    $0x10,%esp
+     b46:	85 c0                	test   %eax,%eax
+     b48:	0f 88 9f 00 00 00    	js     bed <rsvtest+0x1bc>
+     b4e:	83 ec 08             	sub    $0x8,%esp
+     b51:	8d 45 b8             	lea    -0x48(%ebp),%eax
+     b54:	50                   	push   %eax
+     b55:	57                   	push   %edi
+     b56:	e8 75 5b 00 00       	call   66d0 <fstat>
+     b5b:	83 c4 10             	add    $0x10,%esp
+     b5e:	85 c0                	test   %eax,%eax
+     b60:	0f 88 87 00 00 00    	js     bed <rsvtest+0x1bc>
+    printf(stdout, "rsv: fstat failed\n");
+    exit();
+  }
+  if(sta.size != RSVROUNDS*4096 || stb.size != RSVROUNDS*4096){
+     b66:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b69:	3d 00 00 02 00       	cmp    $0x20000,%eax
+     b6e:	0f 85 91 00 00 00    	jne    c05 <rsvtest+0x1d4>
+     b74:	81 7d c8 00 00 02 00 	cmpl   $0x20000,-0x38(%ebp)
+     b7b:	0f 85 84 00 00 00    	jne    c05 <rsvtest+0x1d4>
+    printf(stdout, "rsv: sizes %d %d\n", sta.size, stb.size);
+    exit();
+  }
+  // Interleaved, each file would have an extent per piece.
+  if(sta.nextent == 0 || stb.nextent == 0 ||
+     b81:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     b84:	85 d2                	test   %edx,%edx
+     b86:	0f 84 92 00 00 00    	je     c1e <rsvtest+0x1ed>
+     b8c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     b8f:	85 c0                	test   %eax,%eax
+     b91:	0f 84 87 00 00 00    	je     c1e <rsvtest+0x1ed>
+     2*sta.nextent > RSVROUNDS || 2*stb.nextent > RSVROUNDS){
+     b97:	8d 0c 12             	lea    (%edx,%edx,1),%ecx
+  if(sta.nextent == 0 || stb.nextent == 0 ||
+     b9a:	83 f9 20             	cmp    $0x20,%ecx
+     b9d:	77 7f                	ja     c1e <rsvtest+0x1ed>
+     2*sta.nextent > RSVROUNDS || 2*stb.nextent > RSVROUNDS){
+     b9f:	01 c0                	add    %eax,%eax
+     ba1:	83 f8 20             	cmp    $0x20,%eax
+     ba4:	77 78                	ja     c1e <rsvtest+0x1ed>
+    printf(stdout, "rsv: files interleaved, %d and %d extents\n",
+           sta.nextent, stb.nextent);
+    exit();
+  }
+  close(fa);
+     ba6:	83 ec 0c             	sub    $0xc,%esp
+     ba9:	56                   	push   %esi
+     baa:	e8 f1 5a 00 00       	call   66a0 <close>
+  close(fb);
+     baf:	89 3c 24             	mov    %edi,(%esp)
+     bb2:	e8 e9 5a 00 00       	call   66a0 <close>
+  unlink("rsva");
+     bb7:	c7 04 24 b2 6e 00 00 	movl   $0x6eb2,(%esp)
+     bbe:	e8 05 5b 00 00       	call   66c8 <unlink>
+  unlink("rsvb");
+     bc3:	c7 04 24 b7 6e 00 00 	movl   $0x6eb7,(%esp)
+     bca:	e8 f9 5a 00 00       	call   66c8 <unlink>
+  printf(stdout, "block reservation ok\n");
+     bcf:	83 c4 08             	add    $0x8,%esp
+     bd2:	68 08 6f 00 00       	push   $0x6f08
+     bd7:	ff 35 a4 a0 00 00    	push   0xa0a4
+     bdd:	e8 73 5c 00 00       	call   6855 <printf>
+}
+     be2:	83 c4 10             	add    $0x10,%esp
+     be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be8:	5b                   	pop    %ebx
+     be9:	5e                   	pop    %esi
+     bea:	5f                   	pop    %edi
+     beb:	5d                   	pop    %ebp
+     bec:	c3                   	ret
+    printf(stdout, "rsv: fstat failed\n");
+     bed:	83 ec 08             	sub    $0x8,%esp
+     bf0:	68 e3 6e 00 00       	push   $0x6ee3
+     bf5:	ff 35 a4 a0 00 00    	push   0xa0a4
+     bfb:	e8 55 5c 00 00       	call   6855 <printf>
+    exit();
+     c00:	e8 73 5a 00 00       	call   6678 <exit>
+    printf(stdout, "rsv: sizes %d %d\n", sta.size, stb.size);
+     c05:	ff 75 c8             	push   -0x38(%ebp)
+     c08:	50                   	push   %eax
+     c09:	68 f6 6e 00 00       	push   $0x6ef6
+     c0e:	ff 35 a4 a0 00 00    	push   0xa0a4
+     c14:	e8 3c 5c 00 00       	call   6855 <printf>
+    exit();
+     c19:	e8 5a 5a 00 00       	call   6678 <exit>
+    printf(stdout, "rsv: files interleaved, %d and %d extents\n",
+     c1e:	ff 75 cc             	push   -0x34(%ebp)
+     c21:	52                   	push   %edx
+     c22:	68 ac 86 00 00       	push   $0x86ac
+     c27:	ff 35 a4 a0 00 00    	push   0xa0a4
+     c2d:	e8 23 5c 00 00       	call   6855 <printf>
+    exit();
+     c32:	e8 41 5a 00 00       	call   6678 <exit>
+
+00000c37 <createtest>:
+
+void
+createtest(void)
+{
+     c37:	55                   	push   %ebp
+     c38:	89 e5                	mov    %esp,%ebp
+     c3a:	53                   	push   %ebx
+     c3b:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     c3e:	68 d8 86 00 00       	push   $0x86d8
+     c43:	ff 35 a4 a0 00 00    	push   0xa0a4
+     c49:	e8 07 5c 00 00       	call   6855 <printf>
+
+  name[0] = 'a';
+     c4e:	c6 05 d0 c7 00 00 61 	movb   $0x61,0xc7d0
+  name[2] = '\0';
+     c55:	c6 05 d2 c7 00 00 00 	movb   $0x0,0xc7d2
+  for(i = 0; i < 52; i++){
+     c5c:	83 c4 10             	add    $0x10,%esp
+     c5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c64:	eb 28                	jmp    c8e <createtest+0x57>
+    name[1] = '0' + i;
+     c66:	8d 43 30             	lea    0x30(%ebx),%eax
+     c69:	a2 d1 c7 00 00       	mov    %al,0xc7d1
+    fd = open(name, O_CREATE|O_RDWR);
+     c6e:	83 ec 08             	sub    $0x8,%esp
+     c71:	68 02 02 00 00       	push   $0x202
+     c76:	68 d0 c7 00 00       	push   $0xc7d0
+     c7b:	e8 38 5a 00 00       	call   66b8 <open>
+    close(fd);
+     c80:	89 04 24             	mov    %eax,(%esp)
+     c83:	e8 18 5a 00 00       	call   66a0 <close>
+  for(i = 0; i < 52; i++){
+     c88:	83 c3 01             	add    $0x1,%ebx
+     c8b:	83 c4 10             	add    $0x10,%esp
+     c8e:	83 fb 33             	cmp    $0x33,%ebx
+     c91:	7e d3                	jle    c66 <createtest+0x2f>
+  }
+  name[0] = 'a';
+     c93:	c6 05 d0 c7 00 00 61 	movb   $0x61,0xc7d0
+  name[2] = '\0';
+     c9a:	c6 05 d2 c7 00 00 00 	movb   $0x0,0xc7d2
+  for(i = 0; i < 52; i++){
+     ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ca6:	eb 1b                	jmp    cc3 <createtest+0x8c>
+    name[1] = '0' + i;
+     ca8:	8d 43 30             	lea    0x30(%ebx),%eax
+     cab:	a2 d1 c7 00 00       	mov    %al,0xc7d1
+    unlink(name);
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	68 d0 c7 00 00       	push   $0xc7d0
+     cb8:	e8 0b 5a 00 00       	call   66c8 <unlink>
+  for(i = 0; i < 52; i++){
+     cbd:	83 c3 01             	add    $0x1,%ebx
+     cc0:	83 c4 10             	add    $0x10,%esp
+     cc3:	83 fb 33             	cmp    $0x33,%ebx
+     cc6:	7e e0                	jle    ca8 <createtest+0x71>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     cc8:	83 ec 08             	sub    $0x8,%esp
+     ccb:	68 00 87 00 00       	push   $0x8700
+     cd0:	ff 35 a4 a0 00 00    	push   0xa0a4
+     cd6:	e8 7a 5b 00 00       	call   6855 <printf>
+}
+     cdb:	83 c4 10             	add    $0x10,%esp
+     cde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ce1:	c9                   	leave
+     ce2:	c3                   	ret
+
+00000ce3 <dirtest>:
+
+void dirtest(void)
+{
+     ce3:	55                   	push   %ebp
+     ce4:	89 e5                	mov    %esp,%ebp
+     ce6:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     ce9:	68 1e 6f 00 00       	push   $0x6f1e
+     cee:	ff 35 a4 a0 00 00    	push   0xa0a4
+     cf4:	e8 5c 5b 00 00       	call   6855 <printf>
+
+  if(mkdir("dir0") < 0){
+     cf9:	c7 04 24 2a 6f 00 00 	movl   $0x6f2a,(%esp)
+     d00:	e8 db 59 00 00       	call   66e0 <mkdir>
+     d05:	83 c4 10             	add    $0x10,%esp
+     d08:	85 c0                	test   %eax,%eax
+     d0a:	78 54                	js     d60 <dirtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+
+  if(chdir("dir0") < 0){
+     d0c:	83 ec 0c             	sub    $0xc,%esp
+     d0f:	68 2a 6f 00 00       	push   $0x6f2a
+     d14:	e8 cf 59 00 00       	call   66e8 <chdir>
+     d19:	83 c4 10             	add    $0x10,%esp
+     d1c:	85 c0                	test   %eax,%eax
+     d1e:	78 58                	js     d78 <dirtest+0x95>
+    printf(stdout, "chdir dir0 failed\n");
+    exit();
+  }
+
+  if(chdir("..") < 0){
+     d20:	83 ec 0c             	sub    $0xc,%esp
+     d23:	68 2c 76 00 00       	push   $0x762c
+     d28:	e8 bb 59 00 00       	call   66e8 <chdir>
+     d2d:	83 c4 10             	add    $0x10,%esp
+     d30:	85 c0                	test   %eax,%eax
+     d32:	78 5c                	js     d90 <dirtest+0xad>
+    printf(stdout, "chdir .. failed\n");
+    exit();
+  }
+
+  if(unlink("dir0") < 0){
+     d34:	83 ec 0c             	sub    $0xc,%esp
+     d37:	68 2a 6f 00 00       	push   $0x6f2a
+     d3c:	e8 87 59 00 00       	call   66c8 <unlink>
+     d41:	83 c4 10             	add    $0x10,%esp
+     d44:	85 c0                	test   %eax,%eax
+     d46:	78 60                	js     da8 <dirtest+0xc5>
+    printf(stdout, "unlink dir0 failed\n");
+    exit();
+  }
+  printf(stdout, "mkdir test ok\n");
+     d48:	83 ec 08             	sub    $0x8,%esp
+     d4b:	68 67 6f 00 00       	push   $0x6f67
+     d50:	ff 35 a4 a0 00 00    	push   0xa0a4
+     d56:	e8 fa 5a 00 00       	call   6855 <printf>
+}
+     d5b:	83 c4 10             	add    $0x10,%esp
+     d5e:	c9                   	leave
+     d5f:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     d60:	83 ec 08             	sub    $0x8,%esp
+     d63:	68 94 74 00 00       	push   $0x7494
+     d68:	ff 35 a4 a0 00 00    	push   0xa0a4
+     d6e:	e8 e2 5a 00 00       	call   6855 <printf>
+    exit();
+     d73:	e8 00 59 00 00       	call   6678 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     d78:	83 ec 08             	sub    $0x8,%esp
+     d7b:	68 2f 6f 00 00       	push   $0x6f2f
+     d80:	ff 35 a4 a0 00 00    	push   0xa0a4
+     d86:	e8 ca 5a 00 00       	call   6855 <printf>
+    exit();
+     d8b:	e8 e8 58 00 00       	call   6678 <exit>
+    printf(stdout, "chdir .. failed\n");
+     d90:	83 ec 08             	sub    $0x8,%esp
+     d93:	68 42 6f 00 00       	push   $0x6f42
+     d98:	ff 35 a4 a0 00 00    	push   0xa0a4
+     d9e:	e8 b2 5a 00 00       	call   6855 <printf>
+    exit();
+     da3:	e8 d0 58 00 00       	call   6678 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     da8:	83 ec 08             	sub    $0x8,%esp
+     dab:	68 53 6f 00 00       	push   $0x6f53
+     db0:	ff 35 a4 a0 00 00    	push   0xa0a4
+     db6:	e8 9a 5a 00 00       	call   6855 <printf>
+    exit();
+     dbb:	e8 b8 58 00 00       	call   6678 <exit>
+
+00000dc0 <exectest>:
+
+void
+exectest(void)
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     dc6:	68 76 6f 00 00       	push   $0x6f76
+     dcb:	ff 35 a4 a0 00 00    	push   0xa0a4
+     dd1:	e8 7f 5a 00 00       	call   6855 <printf>
+  if(exec("echo", echoargv) < 0){
+     dd6:	83 c4 08             	add    $0x8,%esp
+     dd9:	68 a8 a0 00 00       	push   $0xa0a8
+     dde:	68 cc 6b 00 00       	push   $0x6bcc
+     de3:	e8 c8 58 00 00       	call   66b0 <exec>
+     de8:	83 c4 10             	add    $0x10,%esp
+     deb:	85 c0                	test   %eax,%eax
+     ded:	78 02                	js     df1 <exectest+0x31>
+    printf(stdout, "exec echo failed\n");
+    exit();
+  }
+}
+     def:	c9                   	leave
+     df0:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     df1:	83 ec 08             	sub    $0x8,%esp
+     df4:	68 81 6f 00 00       	push   $0x6f81
+     df9:	ff 35 a4 a0 00 00    	push   0xa0a4
+     dff:	e8 51 5a 00 00       	call   6855 <printf>
+    exit();
+     e04:	e8 6f 58 00 00       	call   6678 <exit>
+
+00000e09 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     e09:	55                   	push   %ebp
+     e0a:	89 e5                	mov    %esp,%ebp
+     e0c:	57                   	push   %edi
+     e0d:	56                   	push   %esi
+     e0e:	53                   	push   %ebx
+     e0f:	83 ec 38             	sub    $0x38,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     e12:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     e15:	50                   	push   %eax
+     e16:	e8 6d 58 00 00       	call   6688 <pipe>
+     e1b:	83 c4 10             	add    $0x10,%esp
+     e1e:	85 c0                	test   %eax,%eax
+     e20:	75 74                	jne    e96 <pipe1+0x8d>
+     e22:	89 c6                	mov    %eax,%esi
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+     e24:	e8 47 58 00 00       	call   6670 <fork>
+     e29:	89 c7                	mov    %eax,%edi
+  seq = 0;
+  if(pid == 0){
+     e2b:	85 c0                	test   %eax,%eax
+     e2d:	74 7b                	je     eaa <pipe1+0xa1>
+        printf(1, "pipe1 oops 1\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+     e2f:	0f 8e 60 01 00 00    	jle    f95 <pipe1+0x18c>
+    close(fds[1]);
+     e35:	83 ec 0c             	sub    $0xc,%esp
+     e38:	ff 75 e4             	push   -0x1c(%ebp)
+     e3b:	e8 60 58 00 00       	call   66a0 <close>
+    total = 0;
+    cc = 1;
+    while((n = read(fds[0], buf, cc)) > 0){
+     e40:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     e43:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  seq = 0;
+     e46:	89 f3                	mov    %esi,%ebx
+    cc = 1;
+     e48:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     e4f:	83 ec 04             	sub    $0x4,%esp
+     e52:	ff 75 d4             	push   -0x2c(%ebp)
+     e55:	68 e0 c7 00 00       	push   $0xc7e0
+     e5a:	ff 75 e0             	push   -0x20(%ebp)
+     e5d:	e8 2e 58 00 00       	call   6690 <read>
+     e62:	89 c7                	mov    %eax,%edi
+     e64:	83 c4 10             	add    $0x10,%esp
+     e67:	85 c0                	test   %eax,%eax
+     e69:	0f 8e e2 00 00 00    	jle    f51 <pipe1+0x148>
+      for(i = 0; i < n; i++){
+     e6f:	89 f0                	mov    %esi,%eax
+     e71:	89 d9                	mov    %ebx,%ecx
+     e73:	39 f8                	cmp    %edi,%eax
+     e75:	0f 8d b4 00 00 00    	jge    f2f <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     e7b:	0f be 98 e0 c7 00 00 	movsbl 0xc7e0(%eax),%ebx
+     e82:	8d 51 01             	lea    0x1(%ecx),%edx
+     e85:	31 cb                	xor    %ecx,%ebx
+     e87:	84 db                	test   %bl,%bl
+     e89:	0f 85 86 00 00 00    	jne    f15 <pipe1+0x10c>
+      for(i = 0; i < n; i++){
+     e8f:	83 c0 01             	add    $0x1,%eax
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     e92:	89 d1                	mov    %edx,%ecx
+     e94:	eb dd                	jmp    e73 <pipe1+0x6a>
+    printf(1, "pipe() failed\n");
+     e96:	83 ec 08             	sub    $0x8,%esp
+     e99:	68 93 6f 00 00       	push   $0x6f93
+     e9e:	6a 01                	push   $0x1
+     ea0:	e8 b0 59 00 00       	call   6855 <printf>
+    exit();
+     ea5:	e8 ce 57 00 00       	call   6678 <exit>
+    close(fds[0]);
+     eaa:	83 ec 0c             	sub    $0xc,%esp
+     ead:	ff 75 e0             	push   -0x20(%ebp)
+     eb0:	e8 eb 57 00 00       	call   66a0 <close>
+    for(n = 0; n < 5; n++){
+     eb5:	83 c4 10             	add    $0x10,%esp
+     eb8:	89 fe                	mov    %edi,%esi
+  seq = 0;
+     eba:	89 fb                	mov    %edi,%ebx
+    for(n = 0; n < 5; n++){
+     ebc:	eb 35                	jmp    ef3 <pipe1+0xea>
+        buf[i] = seq++;
+     ebe:	88 98 e0 c7 00 00    	mov    %bl,0xc7e0(%eax)
+      for(i = 0; i < 1033; i++)
+     ec4:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     ec7:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      for(i = 0; i < 1033; i++)
+     eca:	3d 08 04 00 00       	cmp    $0x408,%eax
+     ecf:	7e ed                	jle    ebe <pipe1+0xb5>
+      if(write(fds[1], buf, 1033) != 1033){
+     ed1:	83 ec 04             	sub    $0x4,%esp
+     ed4:	68 09 04 00 00       	push   $0x409
+     ed9:	68 e0 c7 00 00       	push   $0xc7e0
+     ede:	ff 75 e4             	push   -0x1c(%ebp)
+     ee1:	e8 b2 57 00 00       	call   6698 <write>
+     ee6:	83 c4 10             	add    $0x10,%esp
+     ee9:	3d 09 04 00 00       	cmp    $0x409,%eax
+     eee:	75 0c                	jne    efc <pipe1+0xf3>
+    for(n = 0; n < 5; n++){
+     ef0:	83 c6 01             	add    $0x1,%esi
+     ef3:	83 fe 04             	cmp    $0x4,%esi
+     ef6:	7f 18                	jg     f10 <pipe1+0x107>
+      for(i = 0; i < 1033; i++)
+     ef8:	89 f8                	mov    %edi,%eax
+     efa:	eb ce                	jmp    eca <pipe1+0xc1>
+        printf(1, "pipe1 oops 1\n");
+     efc:	83 ec 08             	sub    $0x8,%esp
+     eff:	68 a2 6f 00 00       	push   $0x6fa2
+     f04:	6a 01                	push   $0x1
+     f06:	e8 4a 59 00 00       	call   6855 <printf>
+        exit();
+     f0b:	e8 68 57 00 00       	call   6678 <exit>
+    exit();
+     f10:	e8 63 57 00 00       	call   6678 <exit>
+          printf(1, "pipe1 oops 2\n");
+     f15:	83 ec 08             	sub    $0x8,%esp
+     f18:	68 b0 6f 00 00       	push   $0x6fb0
+     f1d:	6a 01                	push   $0x1
+     f1f:	e8 31 59 00 00       	call   6855 <printf>
+          return;
+     f24:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+}
+     f27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f2a:	5b                   	pop    %ebx
+     f2b:	5e                   	pop    %esi
+     f2c:	5f                   	pop    %edi
+     f2d:	5d                   	pop    %ebp
+     f2e:	c3                   	ret
+      total += n;
+     f2f:	89 cb                	mov    %ecx,%ebx
+     f31:	01 7d d0             	add    %edi,-0x30(%ebp)
+      cc = cc * 2;
+     f34:	d1 65 d4             	shll   -0x2c(%ebp)
+     f37:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      if(cc > sizeof(buf))
+     f3a:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f3f:	0f 86 0a ff ff ff    	jbe    e4f <pipe1+0x46>
+        cc = sizeof(buf);
+     f45:	c7 45 d4 00 20 00 00 	movl   $0x2000,-0x2c(%ebp)
+     f4c:	e9 fe fe ff ff       	jmp    e4f <pipe1+0x46>
+    if(total != 5 * 1033){
+     f51:	81 7d d0 2d 14 00 00 	cmpl   $0x142d,-0x30(%ebp)
+     f58:	75 24                	jne    f7e <pipe1+0x175>
+    close(fds[0]);
+     f5a:	83 ec 0c             	sub    $0xc,%esp
+     f5d:	ff 75 e0             	push   -0x20(%ebp)
+     f60:	e8 3b 57 00 00       	call   66a0 <close>
+    wait();
+     f65:	e8 16 57 00 00       	call   6680 <wait>
+  printf(1, "pipe1 ok\n");
+     f6a:	83 c4 08             	add    $0x8,%esp
+     f6d:	68 d5 6f 00 00       	push   $0x6fd5
+     f72:	6a 01                	push   $0x1
+     f74:	e8 dc 58 00 00       	call   6855 <printf>
+     f79:	83 c4 10             	add    $0x10,%esp
+     f7c:	eb a9                	jmp    f27 <pipe1+0x11e>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     f7e:	83 ec 04             	sub    $0x4,%esp
+     f81:	ff 75 d0             	push   -0x30(%ebp)
+     f84:	68 be 6f 00 00       	push   $0x6fbe
+     f89:	6a 01                	push   $0x1
+     f8b:	e8 c5 58 00 00       	call   6855 <printf>
+      exit();
+     f90:	e8 e3 56 00 00       	call   6678 <exit>
+    printf(1, "fork() failed\n");
+     f95:	83 ec 08             	sub    $0x8,%esp
+     f98:	68 df 6f 00 00       	push   $0x6fdf
+     f9d:	6a 01                	push   $0x1
+     f9f:	e8 b1 58 00 00       	call   6855 <printf>
+    exit();
+     fa4:	e8 cf 56 00 00       	call   6678 <exit>
+
+00000fa9 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     fa9:	55                   	push   %ebp
+     faa:	89 e5                	mov    %esp,%ebp
+     fac:	57                   	push   %edi
+     fad:	56                   	push   %esi
+     fae:	53                   	push   %ebx
+     faf:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     fb2:	68 ee 6f 00 00       	push   $0x6fee
+     fb7:	6a 01                	push   $0x1
+     fb9:	e8 97 58 00 00       	call   6855 <printf>
+  pid1 = fork();
+     fbe:	e8 ad 56 00 00       	call   6670 <fork>
+  if(pid1 == 0)
+     fc3:	83 c4 10             	add    $0x10,%esp
+     fc6:	85 c0                	test   %eax,%eax
+     fc8:	75 02                	jne    fcc <preempt+0x23>
+    for(;;)
+     fca:	eb fe                	jmp    fca <preempt+0x21>
+     fcc:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     fce:	e8 9d 56 00 00       	call   6670 <fork>
+     fd3:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     fd5:	85 c0                	test   %eax,%eax
+     fd7:	75 02                	jne    fdb <preempt+0x32>
+    for(;;)
+     fd9:	eb fe                	jmp    fd9 <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     fdb:	83 ec 0c             	sub    $0xc,%esp
+     fde:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     fe1:	50                   	push   %eax
+     fe2:	e8 a1 56 00 00       	call   6688 <pipe>
+  pid3 = fork();
+     fe7:	e8 84 56 00 00       	call   6670 <fork>
+     fec:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     fee:	83 c4 10             	add    $0x10,%esp
+     ff1:	85 c0                	test   %eax,%eax
+     ff3:	75 49                	jne    103e <preempt+0x95>
+    close(pfds[0]);
+     ff5:	83 ec 0c             	sub    $0xc,%esp
+     ff8:	ff 75 e0             	push   -0x20(%ebp)
+     ffb:	e8 a0 56 00 00       	call   66a0 <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1000:	83 c4 0c             	add    $0xc,%esp
+    1003:	6a 01                	push   $0x1
+    1005:	68 10 77 00 00       	push   $0x7710
+    100a:	ff 75 e4             	push   -0x1c(%ebp)
+    100d:	e8 86 56 00 00       	call   6698 <write>
+    1012:	83 c4 10             	add    $0x10,%esp
+    1015:	83 f8 01             	cmp    $0x1,%eax
+    1018:	75 10                	jne    102a <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+    101a:	83 ec 0c             	sub    $0xc,%esp
+    101d:	ff 75 e4             	push   -0x1c(%ebp)
+    1020:	e8 7b 56 00 00       	call   66a0 <close>
+    1025:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    1028:	eb fe                	jmp    1028 <preempt+0x7f>
+      printf(1, "preempt write error");
+    102a:	83 ec 08             	sub    $0x8,%esp
+    102d:	68 f8 6f 00 00       	push   $0x6ff8
+    1032:	6a 01                	push   $0x1
+    1034:	e8 1c 58 00 00       	call   6855 <printf>
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	eb dc                	jmp    101a <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+    103e:	83 ec 0c             	sub    $0xc,%esp
+    1041:	ff 75 e4             	push   -0x1c(%ebp)
+    1044:	e8 57 56 00 00       	call   66a0 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    1049:	83 c4 0c             	add    $0xc,%esp
+    104c:	68 00 20 00 00       	push   $0x2000
+    1051:	68 e0 c7 00 00       	push   $0xc7e0
+    1056:	ff 75 e0             	push   -0x20(%ebp)
+    1059:	e8 32 56 00 00       	call   6690 <read>
+    105e:	83 c4 10             	add    $0x10,%esp
+    1061:	83 f8 01             	cmp    $0x1,%eax
+    1064:	74 1a                	je     1080 <preempt+0xd7>
+    printf(1, "preempt read error");
+    1066:	83 ec 08             	sub    $0x8,%esp
+    1069:	68 0c 70 00 00       	push   $0x700c
+    106e:	6a 01                	push   $0x1
+    1070:	e8 e0 57 00 00       	call   6855 <printf>
+    return;
+    1075:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait();
+  wait();
+  wait();
+  printf(1, "preempt ok\n");
+}
+    1078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    107b:	5b                   	pop    %ebx
+    107c:	5e                   	pop    %esi
+    107d:	5f                   	pop    %edi
+    107e:	5d                   	pop    %ebp
+    107f:	c3                   	ret
+  close(pfds[0]);
+    1080:	83 ec 0c             	sub    $0xc,%esp
+    1083:	ff 75 e0             	push   -0x20(%ebp)
+    1086:	e8 15 56 00 00       	call   66a0 <close>
+  printf(1, "kill... ");
+    108b:	83 c4 08             	add    $0x8,%esp
+    108e:	68 1f 70 00 00       	push   $0x701f
+    1093:	6a 01                	push   $0x1
+    1095:	e8 bb 57 00 00       	call   6855 <printf>
+  kill(pid1);
+    109a:	89 1c 24             	mov    %ebx,(%esp)
+    109d:	e8 06 56 00 00       	call   66a8 <kill>
+  kill(pid2);
+    10a2:	89 34 24             	mov    %esi,(%esp)
+    10a5:	e8 fe 55 00 00       	call   66a8 <kill>
+  kill(pid3);
+    10aa:	89 3c 24             	mov    %edi,(%esp)
+    10ad:	e8 f6 55 00 00       	call   66a8 <kill>
+  printf(1, "wait... ");
+    10b2:	83 c4 08             	add    $0x8,%esp
+    10b5:	68 28 70 00 00       	push   $0x7028
+    10ba:	6a 01                	push   $0x1
+    10bc:	e8 94 57 00 00       	call   6855 <printf>
+  wait();
+    10c1:	e8 ba 55 00 00       	call   6680 <wait>
+  wait();
+    10c6:	e8 b5 55 00 00       	call   6680 <wait>
+  wait();
+    10cb:	e8 b0 55 00 00       	call   6680 <wait>
+  printf(1, "preempt ok\n");
+    10d0:	83 c4 08             	add    $0x8,%esp
+    10d3:	68 31 70 00 00       	push   $0x7031
+    10d8:	6a 01                	push   $0x1
+    10da:	e8 76 57 00 00       	call   6855 <printf>
+    10df:	83 c4 10             	add    $0x10,%esp
+    10e2:	eb 94                	jmp    1078 <preempt+0xcf>
+
+000010e4 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+    10e4:	55                   	push   %ebp
+    10e5:	89 e5                	mov    %esp,%ebp
+    10e7:	56                   	push   %esi
+    10e8:	53                   	push   %ebx
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    10e9:	be 00 00 00 00       	mov    $0x0,%esi
+    10ee:	83 fe 63             	cmp    $0x63,%esi
+    10f1:	7f 4d                	jg     1140 <exitwait+0x5c>
+    pid = fork();
+    10f3:	e8 78 55 00 00       	call   6670 <fork>
+    10f8:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    10fa:	85 c0                	test   %eax,%eax
+    10fc:	78 10                	js     110e <exitwait+0x2a>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+    10fe:	74 3b                	je     113b <exitwait+0x57>
+      if(wait() != pid){
+    1100:	e8 7b 55 00 00       	call   6680 <wait>
+    1105:	39 d8                	cmp    %ebx,%eax
+    1107:	75 1e                	jne    1127 <exitwait+0x43>
+  for(i = 0; i < 100; i++){
+    1109:	83 c6 01             	add    $0x1,%esi
+    110c:	eb e0                	jmp    10ee <exitwait+0xa>
+      printf(1, "fork failed\n");
+    110e:	83 ec 08             	sub    $0x8,%esp
+    1111:	68 07 85 00 00       	push   $0x8507
+    1116:	6a 01                	push   $0x1
+    1118:	e8 38 57 00 00       	call   6855 <printf>
+      return;
+    111d:	83 c4 10             	add    $0x10,%esp
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+}
+    1120:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1123:	5b                   	pop    %ebx
+    1124:	5e                   	pop    %esi
+    1125:	5d                   	pop    %ebp
+    1126:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+    1127:	83 ec 08             	sub    $0x8,%esp
+    112a:	68 3d 70 00 00       	push   $0x703d
+    112f:	6a 01                	push   $0x1
+    1131:	e8 1f 57 00 00       	call   6855 <printf>
+        return;
+    1136:	83 c4 10             	add    $0x10,%esp
+    1139:	eb e5                	jmp    1120 <exitwait+0x3c>
+      exit();
+    113b:	e8 38 55 00 00       	call   6678 <exit>
+  printf(1, "exitwait ok\n");
+    1140:	83 ec 08             	sub    $0x8,%esp
+    1143:	68 4d 70 00 00       	push   $0x704d
+    1148:	6a 01                	push   $0x1
+    114a:	e8 06 57 00 00       	call   6855 <printf>
+    114f:	83 c4 10             	add    $0x10,%esp
+    1152:	eb cc                	jmp    1120 <exitwait+0x3c>
+
+00001154 <mem>:
+
+void
+mem(void)
+{
+    1154:	55                   	push   %ebp
+    1155:	89 e5                	mov    %esp,%ebp
+    1157:	57                   	push   %edi
+    1158:	56                   	push   %esi
+    1159:	53                   	push   %ebx
+    115a:	83 ec 14             	sub    $0x14,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    115d:	68 5a 70 00 00       	push   $0x705a
+    1162:	6a 01                	push   $0x1
+    1164:	e8 ec 56 00 00       	call   6855 <printf>
+  ppid = getpid();
+    1169:	e8 8a 55 00 00       	call   66f8 <getpid>
+    116e:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+    1170:	e8 fb 54 00 00       	call   6670 <fork>
+    1175:	83 c4 10             	add    $0x10,%esp
+    1178:	85 c0                	test   %eax,%eax
+    117a:	0f 85 82 00 00 00    	jne    1202 <mem+0xae>
+    m1 = 0;
+    1180:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1185:	eb 04                	jmp    118b <mem+0x37>
+    while((m2 = malloc(10001)) != 0){
+      *(char**)m2 = m1;
+    1187:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+    1189:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+    118b:	83 ec 0c             	sub    $0xc,%esp
+    118e:	68 11 27 00 00       	push   $0x2711
+    1193:	e8 e3 58 00 00       	call   6a7b <malloc>
+    1198:	83 c4 10             	add    $0x10,%esp
+    119b:	85 c0                	test   %eax,%eax
+    119d:	75 e8                	jne    1187 <mem+0x33>
+    119f:	eb 10                	jmp    11b1 <mem+0x5d>
+    }
+    while(m1){
+      m2 = *(char**)m1;
+    11a1:	8b 3b                	mov    (%ebx),%edi
+      free(m1);
+    11a3:	83 ec 0c             	sub    $0xc,%esp
+    11a6:	53                   	push   %ebx
+    11a7:	e8 0f 58 00 00       	call   69bb <free>
+    11ac:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    11af:	89 fb                	mov    %edi,%ebx
+    while(m1){
+    11b1:	85 db                	test   %ebx,%ebx
+    11b3:	75 ec                	jne    11a1 <mem+0x4d>
+    }
+    m1 = malloc(1024*20);
+    11b5:	83 ec 0c             	sub    $0xc,%esp
+    11b8:	68 00 50 00 00       	push   $0x5000
+    11bd:	e8 b9 58 00 00       	call   6a7b <malloc>
+    if(m1 == 0){
+    11c2:	83 c4 10             	add    $0x10,%esp
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	74 1d                	je     11e6 <mem+0x92>
+      printf(1, "couldn't allocate mem?!!\n");
+      kill(ppid);
+      exit();
+    }
+    free(m1);
+    11c9:	83 ec 0c             	sub    $0xc,%esp
+    11cc:	50                   	push   %eax
+    11cd:	e8 e9 57 00 00       	call   69bb <free>
+    printf(1, "mem ok\n");
+    11d2:	83 c4 08             	add    $0x8,%esp
+    11d5:	68 7e 70 00 00       	push   $0x707e
+    11da:	6a 01                	push   $0x1
+    11dc:	e8 74 56 00 00       	call   6855 <printf>
+    exit();
+    11e1:	e8 92 54 00 00       	call   6678 <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+    11e6:	83 ec 08             	sub    $0x8,%esp
+    11e9:	68 64 70 00 00       	push   $0x7064
+    11ee:	6a 01                	push   $0x1
+    11f0:	e8 60 56 00 00       	call   6855 <printf>
+      kill(ppid);
+    11f5:	89 34 24             	mov    %esi,(%esp)
+    11f8:	e8 ab 54 00 00       	call   66a8 <kill>
+      exit();
+    11fd:	e8 76 54 00 00       	call   6678 <exit>
+  } else {
+    wait();
+    1202:	e8 79 54 00 00       	call   6680 <wait>
+  }
+}
+    1207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    120a:	5b                   	pop    %ebx
+    120b:	5e                   	pop    %esi
+    120c:	5f                   	pop    %edi
+    120d:	5d                   	pop    %ebp
+    120e:	c3                   	ret
+
+0000120f <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    120f:	55                   	push   %ebp
+    1210:	89 e5                	mov    %esp,%ebp
+    1212:	57                   	push   %edi
+    1213:	56                   	push   %esi
+    1214:	53                   	push   %ebx
+    1215:	83 ec 24             	sub    $0x24,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    1218:	68 86 70 00 00       	push   $0x7086
+    121d:	6a 01                	push   $0x1
+    121f:	e8 31 56 00 00       	call   6855 <printf>
+
+  unlink("sharedfd");
+    1224:	c7 04 24 95 70 00 00 	movl   $0x7095,(%esp)
+    122b:	e8 98 54 00 00       	call   66c8 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1230:	83 c4 08             	add    $0x8,%esp
+    1233:	68 02 02 00 00       	push   $0x202
+    1238:	68 95 70 00 00       	push   $0x7095
+    123d:	e8 76 54 00 00       	call   66b8 <open>
+  if(fd < 0){
+    1242:	83 c4 10             	add    $0x10,%esp
+    1245:	85 c0                	test   %eax,%eax
+    1247:	78 4d                	js     1296 <sharedfd+0x87>
+    1249:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+    124b:	e8 20 54 00 00       	call   6670 <fork>
+    1250:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1252:	85 c0                	test   %eax,%eax
+    1254:	75 57                	jne    12ad <sharedfd+0x9e>
+    1256:	b8 63 00 00 00       	mov    $0x63,%eax
+    125b:	83 ec 04             	sub    $0x4,%esp
+    125e:	6a 0a                	push   $0xa
+    1260:	50                   	push   %eax
+    1261:	8d 45 de             	lea    -0x22(%ebp),%eax
+    1264:	50                   	push   %eax
+    1265:	e8 d3 52 00 00       	call   653d <memset>
+  for(i = 0; i < 1000; i++){
+    126a:	83 c4 10             	add    $0x10,%esp
+    126d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1272:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    1278:	7f 4c                	jg     12c6 <sharedfd+0xb7>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    127a:	83 ec 04             	sub    $0x4,%esp
+    127d:	6a 0a                	push   $0xa
+    127f:	8d 45 de             	lea    -0x22(%ebp),%eax
+    1282:	50                   	push   %eax
+    1283:	56                   	push   %esi
+    1284:	e8 0f 54 00 00       	call   6698 <write>
+    1289:	83 c4 10             	add    $0x10,%esp
+    128c:	83 f8 0a             	cmp    $0xa,%eax
+    128f:	75 23                	jne    12b4 <sharedfd+0xa5>
+  for(i = 0; i < 1000; i++){
+    1291:	83 c3 01             	add    $0x1,%ebx
+    1294:	eb dc                	jmp    1272 <sharedfd+0x63>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1296:	83 ec 08             	sub    $0x8,%esp
+    1299:	68 28 87 00 00       	push   $0x8728
+    129e:	6a 01                	push   $0x1
+    12a0:	e8 b0 55 00 00       	call   6855 <printf>
+    return;
+    12a5:	83 c4 10             	add    $0x10,%esp
+    12a8:	e9 e4 00 00 00       	jmp    1391 <sharedfd+0x182>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    12ad:	b8 70 00 00 00       	mov    $0x70,%eax
+    12b2:	eb a7                	jmp    125b <sharedfd+0x4c>
+      printf(1, "fstests: write sharedfd failed\n");
+    12b4:	83 ec 08             	sub    $0x8,%esp
+    12b7:	68 54 87 00 00       	push   $0x8754
+    12bc:	6a 01                	push   $0x1
+    12be:	e8 92 55 00 00       	call   6855 <printf>
+      break;
+    12c3:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+    12c6:	85 ff                	test   %edi,%edi
+    12c8:	74 4d                	je     1317 <sharedfd+0x108>
+    exit();
+  else
+    wait();
+    12ca:	e8 b1 53 00 00       	call   6680 <wait>
+  close(fd);
+    12cf:	83 ec 0c             	sub    $0xc,%esp
+    12d2:	56                   	push   %esi
+    12d3:	e8 c8 53 00 00       	call   66a0 <close>
+  fd = open("sharedfd", 0);
+    12d8:	83 c4 08             	add    $0x8,%esp
+    12db:	6a 00                	push   $0x0
+    12dd:	68 95 70 00 00       	push   $0x7095
+    12e2:	e8 d1 53 00 00       	call   66b8 <open>
+    12e7:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    12e9:	83 c4 10             	add    $0x10,%esp
+    12ec:	85 c0                	test   %eax,%eax
+    12ee:	78 2c                	js     131c <sharedfd+0x10d>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+    12f0:	be 00 00 00 00       	mov    $0x0,%esi
+    12f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    12fa:	83 ec 04             	sub    $0x4,%esp
+    12fd:	6a 0a                	push   $0xa
+    12ff:	8d 45 de             	lea    -0x22(%ebp),%eax
+    1302:	50                   	push   %eax
+    1303:	57                   	push   %edi
+    1304:	e8 87 53 00 00       	call   6690 <read>
+    1309:	83 c4 10             	add    $0x10,%esp
+    130c:	85 c0                	test   %eax,%eax
+    130e:	7e 41                	jle    1351 <sharedfd+0x142>
+    for(i = 0; i < sizeof(buf); i++){
+    1310:	b8 00 00 00 00       	mov    $0x0,%eax
+    1315:	eb 21                	jmp    1338 <sharedfd+0x129>
+    exit();
+    1317:	e8 5c 53 00 00       	call   6678 <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    131c:	83 ec 08             	sub    $0x8,%esp
+    131f:	68 74 87 00 00       	push   $0x8774
+    1324:	6a 01                	push   $0x1
+    1326:	e8 2a 55 00 00       	call   6855 <printf>
+    return;
+    132b:	83 c4 10             	add    $0x10,%esp
+    132e:	eb 61                	jmp    1391 <sharedfd+0x182>
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+    1330:	80 fa 70             	cmp    $0x70,%dl
+    1333:	74 17                	je     134c <sharedfd+0x13d>
+    for(i = 0; i < sizeof(buf); i++){
+    1335:	83 c0 01             	add    $0x1,%eax
+    1338:	83 f8 09             	cmp    $0x9,%eax
+    133b:	77 bd                	ja     12fa <sharedfd+0xeb>
+      if(buf[i] == 'c')
+    133d:	0f b6 54 05 de       	movzbl -0x22(%ebp,%eax,1),%edx
+    1342:	80 fa 63             	cmp    $0x63,%dl
+    1345:	75 e9                	jne    1330 <sharedfd+0x121>
+        nc++;
+    1347:	83 c3 01             	add    $0x1,%ebx
+    134a:	eb e4                	jmp    1330 <sharedfd+0x121>
+        np++;
+    134c:	83 c6 01             	add    $0x1,%esi
+    134f:	eb e4                	jmp    1335 <sharedfd+0x126>
+    }
+  }
+  close(fd);
+    1351:	83 ec 0c             	sub    $0xc,%esp
+    1354:	57                   	push   %edi
+    1355:	e8 46 53 00 00       	call   66a0 <close>
+  unlink("sharedfd");
+    135a:	c7 04 24 95 70 00 00 	movl   $0x7095,(%esp)
+    1361:	e8 62 53 00 00       	call   66c8 <unlink>
+  if(nc == 10000 && np == 10000){
+    1366:	83 c4 10             	add    $0x10,%esp
+    1369:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    136f:	0f 94 c2             	sete   %dl
+    1372:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+    1378:	0f 94 c0             	sete   %al
+    137b:	84 c2                	test   %al,%dl
+    137d:	74 1a                	je     1399 <sharedfd+0x18a>
+    printf(1, "sharedfd ok\n");
+    137f:	83 ec 08             	sub    $0x8,%esp
+    1382:	68 9e 70 00 00       	push   $0x709e
+    1387:	6a 01                	push   $0x1
+    1389:	e8 c7 54 00 00       	call   6855 <printf>
+    138e:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+    1391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1394:	5b                   	pop    %ebx
+    1395:	5e                   	pop    %esi
+    1396:	5f                   	pop    %edi
+    1397:	5d                   	pop    %ebp
+    1398:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1399:	56                   	push   %esi
+    139a:	53                   	push   %ebx
+    139b:	68 ab 70 00 00       	push   $0x70ab
+    13a0:	6a 01                	push   $0x1
+    13a2:	e8 ae 54 00 00       	call   6855 <printf>
+    exit();
+    13a7:	e8 cc 52 00 00       	call   6678 <exit>
+
+000013ac <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    13ac:	55                   	push   %ebp
+    13ad:	89 e5                	mov    %esp,%ebp
+    13af:	57                   	push   %edi
+    13b0:	56                   	push   %esi
+    13b1:	53                   	push   %ebx
+    13b2:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    13b5:	c7 45 d8 c0 70 00 00 	movl   $0x70c0,-0x28(%ebp)
+    13bc:	c7 45 dc 09 72 00 00 	movl   $0x7209,-0x24(%ebp)
+    13c3:	c7 45 e0 0d 72 00 00 	movl   $0x720d,-0x20(%ebp)
+    13ca:	c7 45 e4 c3 70 00 00 	movl   $0x70c3,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    13d1:	68 c6 70 00 00       	push   $0x70c6
+    13d6:	6a 01                	push   $0x1
+    13d8:	e8 78 54 00 00       	call   6855 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    13dd:	83 c4 10             	add    $0x10,%esp
+    13e0:	be 00 00 00 00       	mov    $0x0,%esi
+    13e5:	eb 45                	jmp    142c <fourfiles+0x80>
+    fname = names[pi];
+    unlink(fname);
+
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    13e7:	83 ec 08             	sub    $0x8,%esp
+    13ea:	68 07 85 00 00       	push   $0x8507
+    13ef:	6a 01                	push   $0x1
+    13f1:	e8 5f 54 00 00       	call   6855 <printf>
+      exit();
+    13f6:	e8 7d 52 00 00       	call   6678 <exit>
+    }
+
+    if(pid == 0){
+      fd = open(fname, O_CREATE | O_RDWR);
+      if(fd < 0){
+        printf(1, "create failed\n");
+    13fb:	83 ec 08             	sub    $0x8,%esp
+    13fe:	68 1b 85 00 00       	push   $0x851b
+    1403:	6a 01                	push   $0x1
+    1405:	e8 4b 54 00 00       	call   6855 <printf>
+        exit();
+    140a:	e8 69 52 00 00       	call   6678 <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+      for(i = 0; i < 12; i++){
+        if((n = write(fd, buf, 500)) != 500){
+          printf(1, "write failed %d\n", n);
+    140f:	83 ec 04             	sub    $0x4,%esp
+    1412:	50                   	push   %eax
+    1413:	68 d6 70 00 00       	push   $0x70d6
+    1418:	6a 01                	push   $0x1
+    141a:	e8 36 54 00 00       	call   6855 <printf>
+          exit();
+    141f:	e8 54 52 00 00       	call   6678 <exit>
+        }
+      }
+      exit();
+    1424:	e8 4f 52 00 00       	call   6678 <exit>
+  for(pi = 0; pi < 4; pi++){
+    1429:	83 c6 01             	add    $0x1,%esi
+    142c:	83 fe 03             	cmp    $0x3,%esi
+    142f:	7f 78                	jg     14a9 <fourfiles+0xfd>
+    fname = names[pi];
+    1431:	8b 7c b5 d8          	mov    -0x28(%ebp,%esi,4),%edi
+    unlink(fname);
+    1435:	83 ec 0c             	sub    $0xc,%esp
+    1438:	57                   	push   %edi
+    1439:	e8 8a 52 00 00       	call   66c8 <unlink>
+    pid = fork();
+    143e:	e8 2d 52 00 00       	call   6670 <fork>
+    if(pid < 0){
+    1443:	83 c4 10             	add    $0x10,%esp
+    1446:	85 c0                	test   %eax,%eax
+    1448:	78 9d                	js     13e7 <fourfiles+0x3b>
+    if(pid == 0){
+    144a:	75 dd                	jne    1429 <fourfiles+0x7d>
+      fd = open(fname, O_CREATE | O_RDWR);
+    144c:	89 c3                	mov    %eax,%ebx
+    144e:	83 ec 08             	sub    $0x8,%esp
+    1451:	68 02 02 00 00       	push   $0x202
+    1456:	57                   	push   %edi
+    1457:	e8 5c 52 00 00       	call   66b8 <open>
+    145c:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+    145e:	83 c4 10             	add    $0x10,%esp
+    1461:	85 c0                	test   %eax,%eax
+    1463:	78 96                	js     13fb <fourfiles+0x4f>
+      memset(buf, '0'+pi, 512);
+    1465:	83 ec 04             	sub    $0x4,%esp
+    1468:	68 00 02 00 00       	push   $0x200
+    146d:	83 c6 30             	add    $0x30,%esi
+    1470:	56                   	push   %esi
+    1471:	68 e0 c7 00 00       	push   $0xc7e0
+    1476:	e8 c2 50 00 00       	call   653d <memset>
+      for(i = 0; i < 12; i++){
+    147b:	83 c4 10             	add    $0x10,%esp
+    147e:	83 fb 0b             	cmp    $0xb,%ebx
+    1481:	7f a1                	jg     1424 <fourfiles+0x78>
+        if((n = write(fd, buf, 500)) != 500){
+    1483:	83 ec 04             	sub    $0x4,%esp
+    1486:	68 f4 01 00 00       	push   $0x1f4
+    148b:	68 e0 c7 00 00       	push   $0xc7e0
+    1490:	57                   	push   %edi
+    1491:	e8 02 52 00 00       	call   6698 <write>
+    1496:	83 c4 10             	add    $0x10,%esp
+    1499:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    149e:	0f 85 6b ff ff ff    	jne    140f <fourfiles+0x63>
+      for(i = 0; i < 12; i++){
+    14a4:	83 c3 01             	add    $0x1,%ebx
+    14a7:	eb d5                	jmp    147e <fourfiles+0xd2>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    14a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    14ae:	eb 08                	jmp    14b8 <fourfiles+0x10c>
+    wait();
+    14b0:	e8 cb 51 00 00       	call   6680 <wait>
+  for(pi = 0; pi < 4; pi++){
+    14b5:	83 c3 01             	add    $0x1,%ebx
+    14b8:	83 fb 03             	cmp    $0x3,%ebx
+    14bb:	7e f3                	jle    14b0 <fourfiles+0x104>
+  }
+
+  for(i = 0; i < 2; i++){
+    14bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    14c2:	eb 78                	jmp    153c <fourfiles+0x190>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+    14c4:	83 ec 08             	sub    $0x8,%esp
+    14c7:	68 e7 70 00 00       	push   $0x70e7
+    14cc:	6a 01                	push   $0x1
+    14ce:	e8 82 53 00 00       	call   6855 <printf>
+          exit();
+    14d3:	e8 a0 51 00 00       	call   6678 <exit>
+        }
+      }
+      total += n;
+    14d8:	01 fe                	add    %edi,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    14da:	83 ec 04             	sub    $0x4,%esp
+    14dd:	68 00 20 00 00       	push   $0x2000
+    14e2:	68 e0 c7 00 00       	push   $0xc7e0
+    14e7:	ff 75 d4             	push   -0x2c(%ebp)
+    14ea:	e8 a1 51 00 00       	call   6690 <read>
+    14ef:	89 c7                	mov    %eax,%edi
+    14f1:	83 c4 10             	add    $0x10,%esp
+    14f4:	85 c0                	test   %eax,%eax
+    14f6:	7e 1c                	jle    1514 <fourfiles+0x168>
+      for(j = 0; j < n; j++){
+    14f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    14fd:	39 f8                	cmp    %edi,%eax
+    14ff:	7d d7                	jge    14d8 <fourfiles+0x12c>
+        if(buf[j] != '0'+i){
+    1501:	0f be 88 e0 c7 00 00 	movsbl 0xc7e0(%eax),%ecx
+    1508:	8d 53 30             	lea    0x30(%ebx),%edx
+    150b:	39 d1                	cmp    %edx,%ecx
+    150d:	75 b5                	jne    14c4 <fourfiles+0x118>
+      for(j = 0; j < n; j++){
+    150f:	83 c0 01             	add    $0x1,%eax
+    1512:	eb e9                	jmp    14fd <fourfiles+0x151>
+    }
+    close(fd);
+    1514:	8b 7d d0             	mov    -0x30(%ebp),%edi
+    1517:	83 ec 0c             	sub    $0xc,%esp
+    151a:	ff 75 d4             	push   -0x2c(%ebp)
+    151d:	e8 7e 51 00 00       	call   66a0 <close>
+    if(total != 12*500){
+    1522:	83 c4 10             	add    $0x10,%esp
+    1525:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+    152b:	75 36                	jne    1563 <fourfiles+0x1b7>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+    152d:	83 ec 0c             	sub    $0xc,%esp
+    1530:	57                   	push   %edi
+    1531:	e8 92 51 00 00       	call   66c8 <unlink>
+  for(i = 0; i < 2; i++){
+    1536:	83 c3 01             	add    $0x1,%ebx
+    1539:	83 c4 10             	add    $0x10,%esp
+    153c:	83 fb 01             	cmp    $0x1,%ebx
+    153f:	7f 37                	jg     1578 <fourfiles+0x1cc>
+    fname = names[i];
+    1541:	8b 7c 9d d8          	mov    -0x28(%ebp,%ebx,4),%edi
+    fd = open(fname, 0);
+    1545:	83 ec 08             	sub    $0x8,%esp
+    1548:	6a 00                	push   $0x0
+    154a:	57                   	push   %edi
+    154b:	e8 68 51 00 00       	call   66b8 <open>
+    1550:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1553:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+    1556:	be 00 00 00 00       	mov    $0x0,%esi
+    155b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    155e:	e9 77 ff ff ff       	jmp    14da <fourfiles+0x12e>
+      printf(1, "wrong length %d\n", total);
+    1563:	83 ec 04             	sub    $0x4,%esp
+    1566:	56                   	push   %esi
+    1567:	68 f3 70 00 00       	push   $0x70f3
+    156c:	6a 01                	push   $0x1
+    156e:	e8 e2 52 00 00       	call   6855 <printf>
+      exit();
+    1573:	e8 00 51 00 00       	call   6678 <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+    1578:	83 ec 08             	sub    $0x8,%esp
+    157b:	68 04 71 00 00       	push   $0x7104
+    1580:	6a 01                	push   $0x1
+    1582:	e8 ce 52 00 00       	call   6855 <printf>
+}
+    1587:	83 c4 10             	add    $0x10,%esp
+    158a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    158d:	5b                   	pop    %ebx
+    158e:	5e                   	pop    %esi
+    158f:	5f                   	pop    %edi
+    1590:	5d                   	pop    %ebp
+    1591:	c3                   	ret
+
+00001592 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1592:	55                   	push   %ebp
+    1593:	89 e5                	mov    %esp,%ebp
+    1595:	56                   	push   %esi
+    1596:	53                   	push   %ebx
+    1597:	83 ec 28             	sub    $0x28,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    159a:	68 12 71 00 00       	push   $0x7112
+    159f:	6a 01                	push   $0x1
+    15a1:	e8 af 52 00 00       	call   6855 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    15a6:	83 c4 10             	add    $0x10,%esp
+    15a9:	be 00 00 00 00       	mov    $0x0,%esi
+    15ae:	83 fe 03             	cmp    $0x3,%esi
+    15b1:	0f 8f bc 00 00 00    	jg     1673 <createdelete+0xe1>
+    pid = fork();
+    15b7:	e8 b4 50 00 00       	call   6670 <fork>
+    15bc:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    15be:	85 c0                	test   %eax,%eax
+    15c0:	78 07                	js     15c9 <createdelete+0x37>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    15c2:	74 19                	je     15dd <createdelete+0x4b>
+  for(pi = 0; pi < 4; pi++){
+    15c4:	83 c6 01             	add    $0x1,%esi
+    15c7:	eb e5                	jmp    15ae <createdelete+0x1c>
+      printf(1, "fork failed\n");
+    15c9:	83 ec 08             	sub    $0x8,%esp
+    15cc:	68 07 85 00 00       	push   $0x8507
+    15d1:	6a 01                	push   $0x1
+    15d3:	e8 7d 52 00 00       	call   6855 <printf>
+      exit();
+    15d8:	e8 9b 50 00 00       	call   6678 <exit>
+      name[0] = 'p' + pi;
+    15dd:	8d 46 70             	lea    0x70(%esi),%eax
+    15e0:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[2] = '\0';
+    15e3:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+      for(i = 0; i < N; i++){
+    15e7:	eb 17                	jmp    1600 <createdelete+0x6e>
+        name[1] = '0' + i;
+        fd = open(name, O_CREATE | O_RDWR);
+        if(fd < 0){
+          printf(1, "create failed\n");
+    15e9:	83 ec 08             	sub    $0x8,%esp
+    15ec:	68 1b 85 00 00       	push   $0x851b
+    15f1:	6a 01                	push   $0x1
+    15f3:	e8 5d 52 00 00       	call   6855 <printf>
+          exit();
+    15f8:	e8 7b 50 00 00       	call   6678 <exit>
+      for(i = 0; i < N; i++){
+    15fd:	83 c3 01             	add    $0x1,%ebx
+    1600:	83 fb 13             	cmp    $0x13,%ebx
+    1603:	7f 69                	jg     166e <createdelete+0xdc>
+        name[1] = '0' + i;
+    1605:	8d 43 30             	lea    0x30(%ebx),%eax
+    1608:	88 45 d9             	mov    %al,-0x27(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    160b:	83 ec 08             	sub    $0x8,%esp
+    160e:	68 02 02 00 00       	push   $0x202
+    1613:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1616:	50                   	push   %eax
+    1617:	e8 9c 50 00 00       	call   66b8 <open>
+        if(fd < 0){
+    161c:	83 c4 10             	add    $0x10,%esp
+    161f:	85 c0                	test   %eax,%eax
+    1621:	78 c6                	js     15e9 <createdelete+0x57>
+        }
+        close(fd);
+    1623:	83 ec 0c             	sub    $0xc,%esp
+    1626:	50                   	push   %eax
+    1627:	e8 74 50 00 00       	call   66a0 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	85 db                	test   %ebx,%ebx
+    1631:	7e ca                	jle    15fd <createdelete+0x6b>
+    1633:	f6 c3 01             	test   $0x1,%bl
+    1636:	75 c5                	jne    15fd <createdelete+0x6b>
+          name[1] = '0' + (i / 2);
+    1638:	89 d8                	mov    %ebx,%eax
+    163a:	c1 e8 1f             	shr    $0x1f,%eax
+    163d:	01 d8                	add    %ebx,%eax
+    163f:	d1 f8                	sar    %eax
+    1641:	83 c0 30             	add    $0x30,%eax
+    1644:	88 45 d9             	mov    %al,-0x27(%ebp)
+          if(unlink(name) < 0){
+    1647:	83 ec 0c             	sub    $0xc,%esp
+    164a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    164d:	50                   	push   %eax
+    164e:	e8 75 50 00 00       	call   66c8 <unlink>
+    1653:	83 c4 10             	add    $0x10,%esp
+    1656:	85 c0                	test   %eax,%eax
+    1658:	79 a3                	jns    15fd <createdelete+0x6b>
+            printf(1, "unlink failed\n");
+    165a:	83 ec 08             	sub    $0x8,%esp
+    165d:	68 4e 85 00 00       	push   $0x854e
+    1662:	6a 01                	push   $0x1
+    1664:	e8 ec 51 00 00       	call   6855 <printf>
+            exit();
+    1669:	e8 0a 50 00 00       	call   6678 <exit>
+          }
+        }
+      }
+      exit();
+    166e:	e8 05 50 00 00       	call   6678 <exit>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    1673:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1678:	eb 08                	jmp    1682 <createdelete+0xf0>
+    wait();
+    167a:	e8 01 50 00 00       	call   6680 <wait>
+  for(pi = 0; pi < 4; pi++){
+    167f:	83 c3 01             	add    $0x1,%ebx
+    1682:	83 fb 03             	cmp    $0x3,%ebx
+    1685:	7e f3                	jle    167a <createdelete+0xe8>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    1687:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+    168b:	c6 45 d9 00          	movb   $0x0,-0x27(%ebp)
+    168f:	c6 45 d8 00          	movb   $0x0,-0x28(%ebp)
+  for(i = 0; i < N; i++){
+    1693:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1698:	e9 89 00 00 00       	jmp    1726 <createdelete+0x194>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    169d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    16a0:	83 fa 08             	cmp    $0x8,%edx
+    16a3:	76 54                	jbe    16f9 <createdelete+0x167>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    16a5:	85 c0                	test   %eax,%eax
+    16a7:	79 6c                	jns    1715 <createdelete+0x183>
+    for(pi = 0; pi < 4; pi++){
+    16a9:	83 c6 01             	add    $0x1,%esi
+    16ac:	83 fe 03             	cmp    $0x3,%esi
+    16af:	7f 72                	jg     1723 <createdelete+0x191>
+      name[0] = 'p' + pi;
+    16b1:	8d 46 70             	lea    0x70(%esi),%eax
+    16b4:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    16b7:	8d 43 30             	lea    0x30(%ebx),%eax
+    16ba:	88 45 d9             	mov    %al,-0x27(%ebp)
+      fd = open(name, 0);
+    16bd:	83 ec 08             	sub    $0x8,%esp
+    16c0:	6a 00                	push   $0x0
+    16c2:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    16c5:	50                   	push   %eax
+    16c6:	e8 ed 4f 00 00       	call   66b8 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    16cb:	83 c4 10             	add    $0x10,%esp
+    16ce:	85 db                	test   %ebx,%ebx
+    16d0:	0f 94 c2             	sete   %dl
+    16d3:	83 fb 09             	cmp    $0x9,%ebx
+    16d6:	0f 9f c1             	setg   %cl
+    16d9:	08 ca                	or     %cl,%dl
+    16db:	74 c0                	je     169d <createdelete+0x10b>
+    16dd:	85 c0                	test   %eax,%eax
+    16df:	79 bc                	jns    169d <createdelete+0x10b>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    16e1:	83 ec 04             	sub    $0x4,%esp
+    16e4:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    16e7:	50                   	push   %eax
+    16e8:	68 a0 87 00 00       	push   $0x87a0
+    16ed:	6a 01                	push   $0x1
+    16ef:	e8 61 51 00 00       	call   6855 <printf>
+        exit();
+    16f4:	e8 7f 4f 00 00       	call   6678 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    16f9:	85 c0                	test   %eax,%eax
+    16fb:	78 ac                	js     16a9 <createdelete+0x117>
+        printf(1, "oops createdelete %s did exist\n", name);
+    16fd:	83 ec 04             	sub    $0x4,%esp
+    1700:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1703:	50                   	push   %eax
+    1704:	68 c4 87 00 00       	push   $0x87c4
+    1709:	6a 01                	push   $0x1
+    170b:	e8 45 51 00 00       	call   6855 <printf>
+        exit();
+    1710:	e8 63 4f 00 00       	call   6678 <exit>
+        close(fd);
+    1715:	83 ec 0c             	sub    $0xc,%esp
+    1718:	50                   	push   %eax
+    1719:	e8 82 4f 00 00       	call   66a0 <close>
+    171e:	83 c4 10             	add    $0x10,%esp
+    1721:	eb 86                	jmp    16a9 <createdelete+0x117>
+  for(i = 0; i < N; i++){
+    1723:	83 c3 01             	add    $0x1,%ebx
+    1726:	83 fb 13             	cmp    $0x13,%ebx
+    1729:	7f 0a                	jg     1735 <createdelete+0x1a3>
+    for(pi = 0; pi < 4; pi++){
+    172b:	be 00 00 00 00       	mov    $0x0,%esi
+    1730:	e9 77 ff ff ff       	jmp    16ac <createdelete+0x11a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    1735:	be 00 00 00 00       	mov    $0x0,%esi
+    173a:	eb 26                	jmp    1762 <createdelete+0x1d0>
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    173c:	8d 46 70             	lea    0x70(%esi),%eax
+    173f:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    1742:	8d 46 30             	lea    0x30(%esi),%eax
+    1745:	88 45 d9             	mov    %al,-0x27(%ebp)
+      unlink(name);
+    1748:	83 ec 0c             	sub    $0xc,%esp
+    174b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    174e:	50                   	push   %eax
+    174f:	e8 74 4f 00 00       	call   66c8 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1754:	83 c3 01             	add    $0x1,%ebx
+    1757:	83 c4 10             	add    $0x10,%esp
+    175a:	83 fb 03             	cmp    $0x3,%ebx
+    175d:	7e dd                	jle    173c <createdelete+0x1aa>
+  for(i = 0; i < N; i++){
+    175f:	83 c6 01             	add    $0x1,%esi
+    1762:	83 fe 13             	cmp    $0x13,%esi
+    1765:	7f 07                	jg     176e <createdelete+0x1dc>
+    for(pi = 0; pi < 4; pi++){
+    1767:	bb 00 00 00 00       	mov    $0x0,%ebx
+    176c:	eb ec                	jmp    175a <createdelete+0x1c8>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    176e:	83 ec 08             	sub    $0x8,%esp
+    1771:	68 25 71 00 00       	push   $0x7125
+    1776:	6a 01                	push   $0x1
+    1778:	e8 d8 50 00 00       	call   6855 <printf>
+}
+    177d:	83 c4 10             	add    $0x10,%esp
+    1780:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1783:	5b                   	pop    %ebx
+    1784:	5e                   	pop    %esi
+    1785:	5d                   	pop    %ebp
+    1786:	c3                   	ret
+
+00001787 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1787:	55                   	push   %ebp
+    1788:	89 e5                	mov    %esp,%ebp
+    178a:	56                   	push   %esi
+    178b:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    178c:	83 ec 08             	sub    $0x8,%esp
+    178f:	68 36 71 00 00       	push   $0x7136
+    1794:	6a 01                	push   $0x1
+    1796:	e8 ba 50 00 00       	call   6855 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    179b:	83 c4 08             	add    $0x8,%esp
+    179e:	68 02 02 00 00       	push   $0x202
+    17a3:	68 47 71 00 00       	push   $0x7147
+    17a8:	e8 0b 4f 00 00       	call   66b8 <open>
+  if(fd < 0){
+    17ad:	83 c4 10             	add    $0x10,%esp
+    17b0:	85 c0                	test   %eax,%eax
+    17b2:	0f 88 f0 00 00 00    	js     18a8 <unlinkread+0x121>
+    17b8:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    17ba:	83 ec 04             	sub    $0x4,%esp
+    17bd:	6a 05                	push   $0x5
+    17bf:	68 6c 71 00 00       	push   $0x716c
+    17c4:	50                   	push   %eax
+    17c5:	e8 ce 4e 00 00       	call   6698 <write>
+  close(fd);
+    17ca:	89 1c 24             	mov    %ebx,(%esp)
+    17cd:	e8 ce 4e 00 00       	call   66a0 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    17d2:	83 c4 08             	add    $0x8,%esp
+    17d5:	6a 02                	push   $0x2
+    17d7:	68 47 71 00 00       	push   $0x7147
+    17dc:	e8 d7 4e 00 00       	call   66b8 <open>
+    17e1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    17e3:	83 c4 10             	add    $0x10,%esp
+    17e6:	85 c0                	test   %eax,%eax
+    17e8:	0f 88 ce 00 00 00    	js     18bc <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    17ee:	83 ec 0c             	sub    $0xc,%esp
+    17f1:	68 47 71 00 00       	push   $0x7147
+    17f6:	e8 cd 4e 00 00       	call   66c8 <unlink>
+    17fb:	83 c4 10             	add    $0x10,%esp
+    17fe:	85 c0                	test   %eax,%eax
+    1800:	0f 85 ca 00 00 00    	jne    18d0 <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1806:	83 ec 08             	sub    $0x8,%esp
+    1809:	68 02 02 00 00       	push   $0x202
+    180e:	68 47 71 00 00       	push   $0x7147
+    1813:	e8 a0 4e 00 00       	call   66b8 <open>
+    1818:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    181a:	83 c4 0c             	add    $0xc,%esp
+    181d:	6a 03                	push   $0x3
+    181f:	68 a4 71 00 00       	push   $0x71a4
+    1824:	50                   	push   %eax
+    1825:	e8 6e 4e 00 00       	call   6698 <write>
+  close(fd1);
+    182a:	89 34 24             	mov    %esi,(%esp)
+    182d:	e8 6e 4e 00 00       	call   66a0 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1832:	83 c4 0c             	add    $0xc,%esp
+    1835:	68 00 20 00 00       	push   $0x2000
+    183a:	68 e0 c7 00 00       	push   $0xc7e0
+    183f:	53                   	push   %ebx
+    1840:	e8 4b 4e 00 00       	call   6690 <read>
+    1845:	83 c4 10             	add    $0x10,%esp
+    1848:	83 f8 05             	cmp    $0x5,%eax
+    184b:	0f 85 93 00 00 00    	jne    18e4 <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    1851:	80 3d e0 c7 00 00 68 	cmpb   $0x68,0xc7e0
+    1858:	0f 85 9a 00 00 00    	jne    18f8 <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    185e:	83 ec 04             	sub    $0x4,%esp
+    1861:	6a 0a                	push   $0xa
+    1863:	68 e0 c7 00 00       	push   $0xc7e0
+    1868:	53                   	push   %ebx
+    1869:	e8 2a 4e 00 00       	call   6698 <write>
+    186e:	83 c4 10             	add    $0x10,%esp
+    1871:	83 f8 0a             	cmp    $0xa,%eax
+    1874:	0f 85 92 00 00 00    	jne    190c <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    187a:	83 ec 0c             	sub    $0xc,%esp
+    187d:	53                   	push   %ebx
+    187e:	e8 1d 4e 00 00       	call   66a0 <close>
+  unlink("unlinkread");
+    1883:	c7 04 24 47 71 00 00 	movl   $0x7147,(%esp)
+    188a:	e8 39 4e 00 00       	call   66c8 <unlink>
+  printf(1, "unlinkread ok\n");
+    188f:	83 c4 08             	add    $0x8,%esp
+    1892:	68 ef 71 00 00       	push   $0x71ef
+    1897:	6a 01                	push   $0x1
+    1899:	e8 b7 4f 00 00       	call   6855 <printf>
+}
+    189e:	83 c4 10             	add    $0x10,%esp
+    18a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    18a4:	5b                   	pop    %ebx
+    18a5:	5e                   	pop    %esi
+    18a6:	5d                   	pop    %ebp
+    18a7:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    18a8:	83 ec 08             	sub    $0x8,%esp
+    18ab:	68 52 71 00 00       	push   $0x7152
+    18b0:	6a 01                	push   $0x1
+    18b2:	e8 9e 4f 00 00       	call   6855 <printf>
+    exit();
+    18b7:	e8 bc 4d 00 00       	call   6678 <exit>
+    printf(1, "open unlinkread failed\n");
+    18bc:	83 ec 08             	sub    $0x8,%esp
+    18bf:	68 72 71 00 00       	push   $0x7172
+    18c4:	6a 01                	push   $0x1
+    18c6:	e8 8a 4f 00 00       	call   6855 <printf>
+    exit();
+    18cb:	e8 a8 4d 00 00       	call   6678 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    18d0:	83 ec 08             	sub    $0x8,%esp
+    18d3:	68 8a 71 00 00       	push   $0x718a
+    18d8:	6a 01                	push   $0x1
+    18da:	e8 76 4f 00 00       	call   6855 <printf>
+    exit();
+    18df:	e8 94 4d 00 00       	call   6678 <exit>
+    printf(1, "unlinkread read failed");
+    18e4:	83 ec 08             	sub    $0x8,%esp
+    18e7:	68 a8 71 00 00       	push   $0x71a8
+    18ec:	6a 01                	push   $0x1
+    18ee:	e8 62 4f 00 00       	call   6855 <printf>
+    exit();
+    18f3:	e8 80 4d 00 00       	call   6678 <exit>
+    printf(1, "unlinkread wrong data\n");
+    18f8:	83 ec 08             	sub    $0x8,%esp
+    18fb:	68 bf 71 00 00       	push   $0x71bf
+    1900:	6a 01                	push   $0x1
+    1902:	e8 4e 4f 00 00       	call   6855 <printf>
+    exit();
+    1907:	e8 6c 4d 00 00       	call   6678 <exit>
+    printf(1, "unlinkread write failed\n");
+    190c:	83 ec 08             	sub    $0x8,%esp
+    190f:	68 d6 71 00 00       	push   $0x71d6
+    1914:	6a 01                	push   $0x1
+    1916:	e8 3a 4f 00 00       	call   6855 <printf>
+    exit();
+    191b:	e8 58 4d 00 00       	call   6678 <exit>
+
+00001920 <linktest>:
+
+void
+linktest(void)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	53                   	push   %ebx
+    1924:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    1927:	68 fe 71 00 00       	push   $0x71fe
+    192c:	6a 01                	push   $0x1
+    192e:	e8 22 4f 00 00       	call   6855 <printf>
+
+  unlink("lf1");
+    1933:	c7 04 24 08 72 00 00 	movl   $0x7208,(%esp)
+    193a:	e8 89 4d 00 00       	call   66c8 <unlink>
+  unlink("lf2");
+    193f:	c7 04 24 0c 72 00 00 	movl   $0x720c,(%esp)
+    1946:	e8 7d 4d 00 00       	call   66c8 <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    194b:	83 c4 08             	add    $0x8,%esp
+    194e:	68 02 02 00 00       	push   $0x202
+    1953:	68 08 72 00 00       	push   $0x7208
+    1958:	e8 5b 4d 00 00       	call   66b8 <open>
+  if(fd < 0){
+    195d:	83 c4 10             	add    $0x10,%esp
+    1960:	85 c0                	test   %eax,%eax
+    1962:	0f 88 2a 01 00 00    	js     1a92 <linktest+0x172>
+    1968:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    196a:	83 ec 04             	sub    $0x4,%esp
+    196d:	6a 05                	push   $0x5
+    196f:	68 6c 71 00 00       	push   $0x716c
+    1974:	50                   	push   %eax
+    1975:	e8 1e 4d 00 00       	call   6698 <write>
+    197a:	83 c4 10             	add    $0x10,%esp
+    197d:	83 f8 05             	cmp    $0x5,%eax
+    1980:	0f 85 20 01 00 00    	jne    1aa6 <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    1986:	83 ec 0c             	sub    $0xc,%esp
+    1989:	53                   	push   %ebx
+    198a:	e8 11 4d 00 00       	call   66a0 <close>
+
+  if(link("lf1", "lf2") < 0){
+    198f:	83 c4 08             	add    $0x8,%esp
+    1992:	68 0c 72 00 00       	push   $0x720c
+    1997:	68 08 72 00 00       	push   $0x7208
+    199c:	e8 37 4d 00 00       	call   66d8 <link>
+    19a1:	83 c4 10             	add    $0x10,%esp
+    19a4:	85 c0                	test   %eax,%eax
+    19a6:	0f 88 0e 01 00 00    	js     1aba <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    19ac:	83 ec 0c             	sub    $0xc,%esp
+    19af:	68 08 72 00 00       	push   $0x7208
+    19b4:	e8 0f 4d 00 00       	call   66c8 <unlink>
+
+  if(open("lf1", 0) >= 0){
+    19b9:	83 c4 08             	add    $0x8,%esp
+    19bc:	6a 00                	push   $0x0
+    19be:	68 08 72 00 00       	push   $0x7208
+    19c3:	e8 f0 4c 00 00       	call   66b8 <open>
+    19c8:	83 c4 10             	add    $0x10,%esp
+    19cb:	85 c0                	test   %eax,%eax
+    19cd:	0f 89 fb 00 00 00    	jns    1ace <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    19d3:	83 ec 08             	sub    $0x8,%esp
+    19d6:	6a 00                	push   $0x0
+    19d8:	68 0c 72 00 00       	push   $0x720c
+    19dd:	e8 d6 4c 00 00       	call   66b8 <open>
+    19e2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    19e4:	83 c4 10             	add    $0x10,%esp
+    19e7:	85 c0                	test   %eax,%eax
+    19e9:	0f 88 f3 00 00 00    	js     1ae2 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    19ef:	83 ec 04             	sub    $0x4,%esp
+    19f2:	68 00 20 00 00       	push   $0x2000
+    19f7:	68 e0 c7 00 00       	push   $0xc7e0
+    19fc:	50                   	push   %eax
+    19fd:	e8 8e 4c 00 00       	call   6690 <read>
+    1a02:	83 c4 10             	add    $0x10,%esp
+    1a05:	83 f8 05             	cmp    $0x5,%eax
+    1a08:	0f 85 e8 00 00 00    	jne    1af6 <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    1a0e:	83 ec 0c             	sub    $0xc,%esp
+    1a11:	53                   	push   %ebx
+    1a12:	e8 89 4c 00 00       	call   66a0 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    1a17:	83 c4 08             	add    $0x8,%esp
+    1a1a:	68 0c 72 00 00       	push   $0x720c
+    1a1f:	68 0c 72 00 00       	push   $0x720c
+    1a24:	e8 af 4c 00 00       	call   66d8 <link>
+    1a29:	83 c4 10             	add    $0x10,%esp
+    1a2c:	85 c0                	test   %eax,%eax
+    1a2e:	0f 89 d6 00 00 00    	jns    1b0a <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    1a34:	83 ec 0c             	sub    $0xc,%esp
+    1a37:	68 0c 72 00 00       	push   $0x720c
+    1a3c:	e8 87 4c 00 00       	call   66c8 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1a41:	83 c4 08             	add    $0x8,%esp
+    1a44:	68 08 72 00 00       	push   $0x7208
+    1a49:	68 0c 72 00 00       	push   $0x720c
+    1a4e:	e8 85 4c 00 00       	call   66d8 <link>
+    1a53:	83 c4 10             	add    $0x10,%esp
+    1a56:	85 c0                	test   %eax,%eax
+    1a58:	0f 89 c0 00 00 00    	jns    1b1e <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    1a5e:	83 ec 08             	sub    $0x8,%esp
+    1a61:	68 08 72 00 00       	push   $0x7208
+    1a66:	68 2d 76 00 00       	push   $0x762d
+    1a6b:	e8 68 4c 00 00       	call   66d8 <link>
+    1a70:	83 c4 10             	add    $0x10,%esp
+    1a73:	85 c0                	test   %eax,%eax
+    1a75:	0f 89 b7 00 00 00    	jns    1b32 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    1a7b:	83 ec 08             	sub    $0x8,%esp
+    1a7e:	68 a6 72 00 00       	push   $0x72a6
+    1a83:	6a 01                	push   $0x1
+    1a85:	e8 cb 4d 00 00       	call   6855 <printf>
+}
+    1a8a:	83 c4 10             	add    $0x10,%esp
+    1a8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a90:	c9                   	leave
+    1a91:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1a92:	83 ec 08             	sub    $0x8,%esp
+    1a95:	68 10 72 00 00       	push   $0x7210
+    1a9a:	6a 01                	push   $0x1
+    1a9c:	e8 b4 4d 00 00       	call   6855 <printf>
+    exit();
+    1aa1:	e8 d2 4b 00 00       	call   6678 <exit>
+    printf(1, "write lf1 failed\n");
+    1aa6:	83 ec 08             	sub    $0x8,%esp
+    1aa9:	68 23 72 00 00       	push   $0x7223
+    1aae:	6a 01                	push   $0x1
+    1ab0:	e8 a0 4d 00 00       	call   6855 <printf>
+    exit();
+    1ab5:	e8 be 4b 00 00       	call   6678 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1aba:	83 ec 08             	sub    $0x8,%esp
+    1abd:	68 35 72 00 00       	push   $0x7235
+    1ac2:	6a 01                	push   $0x1
+    1ac4:	e8 8c 4d 00 00       	call   6855 <printf>
+    exit();
+    1ac9:	e8 aa 4b 00 00       	call   6678 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1ace:	83 ec 08             	sub    $0x8,%esp
+    1ad1:	68 e4 87 00 00       	push   $0x87e4
+    1ad6:	6a 01                	push   $0x1
+    1ad8:	e8 78 4d 00 00       	call   6855 <printf>
+    exit();
+    1add:	e8 96 4b 00 00       	call   6678 <exit>
+    printf(1, "open lf2 failed\n");
+    1ae2:	83 ec 08             	sub    $0x8,%esp
+    1ae5:	68 4a 72 00 00       	push   $0x724a
+    1aea:	6a 01                	push   $0x1
+    1aec:	e8 64 4d 00 00       	call   6855 <printf>
+    exit();
+    1af1:	e8 82 4b 00 00       	call   6678 <exit>
+    printf(1, "read lf2 failed\n");
+    1af6:	83 ec 08             	sub    $0x8,%esp
+    1af9:	68 5b 72 00 00       	push   $0x725b
+    1afe:	6a 01                	push   $0x1
+    1b00:	e8 50 4d 00 00       	call   6855 <printf>
+    exit();
+    1b05:	e8 6e 4b 00 00       	call   6678 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1b0a:	83 ec 08             	sub    $0x8,%esp
+    1b0d:	68 6c 72 00 00       	push   $0x726c
+    1b12:	6a 01                	push   $0x1
+    1b14:	e8 3c 4d 00 00       	call   6855 <printf>
+    exit();
+    1b19:	e8 5a 4b 00 00       	call   6678 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1b1e:	83 ec 08             	sub    $0x8,%esp
+    1b21:	68 0c 88 00 00       	push   $0x880c
+    1b26:	6a 01                	push   $0x1
+    1b28:	e8 28 4d 00 00       	call   6855 <printf>
+    exit();
+    1b2d:	e8 46 4b 00 00       	call   6678 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1b32:	83 ec 08             	sub    $0x8,%esp
+    1b35:	68 8a 72 00 00       	push   $0x728a
+    1b3a:	6a 01                	push   $0x1
+    1b3c:	e8 14 4d 00 00       	call   6855 <printf>
+    exit();
+    1b41:	e8 32 4b 00 00       	call   6678 <exit>
+
+00001b46 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    1b46:	55                   	push   %ebp
+    1b47:	89 e5                	mov    %esp,%ebp
+    1b49:	57                   	push   %edi
+    1b4a:	56                   	push   %esi
+    1b4b:	53                   	push   %ebx
+    1b4c:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    1b4f:	68 b3 72 00 00       	push   $0x72b3
+    1b54:	6a 01                	push   $0x1
+    1b56:	e8 fa 4c 00 00       	call   6855 <printf>
+  file[0] = 'C';
+    1b5b:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    1b5f:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    1b63:	83 c4 10             	add    $0x10,%esp
+    1b66:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1b6b:	eb 5a                	jmp    1bc7 <concreate+0x81>
+    file[1] = '0' + i;
+    unlink(file);
+    pid = fork();
+    if(pid && (i % 3) == 1){
+      link("C0", file);
+    } else if(pid == 0 && (i % 5) == 1){
+    1b6d:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1b72:	89 d8                	mov    %ebx,%eax
+    1b74:	f7 ea                	imul   %edx
+    1b76:	d1 fa                	sar    %edx
+    1b78:	89 d8                	mov    %ebx,%eax
+    1b7a:	c1 f8 1f             	sar    $0x1f,%eax
+    1b7d:	29 c2                	sub    %eax,%edx
+    1b7f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1b82:	89 da                	mov    %ebx,%edx
+    1b84:	29 c2                	sub    %eax,%edx
+    1b86:	83 fa 01             	cmp    $0x1,%edx
+    1b89:	0f 84 9b 00 00 00    	je     1c2a <concreate+0xe4>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1b8f:	83 ec 08             	sub    $0x8,%esp
+    1b92:	68 02 02 00 00       	push   $0x202
+    1b97:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1b9a:	50                   	push   %eax
+    1b9b:	e8 18 4b 00 00       	call   66b8 <open>
+      if(fd < 0){
+    1ba0:	83 c4 10             	add    $0x10,%esp
+    1ba3:	85 c0                	test   %eax,%eax
+    1ba5:	0f 88 98 00 00 00    	js     1c43 <concreate+0xfd>
+        printf(1, "concreate create %s failed\n", file);
+        exit();
+      }
+      close(fd);
+    1bab:	83 ec 0c             	sub    $0xc,%esp
+    1bae:	50                   	push   %eax
+    1baf:	e8 ec 4a 00 00       	call   66a0 <close>
+    1bb4:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1bb7:	85 f6                	test   %esi,%esi
+    1bb9:	0f 84 9c 00 00 00    	je     1c5b <concreate+0x115>
+      exit();
+    else
+      wait();
+    1bbf:	e8 bc 4a 00 00       	call   6680 <wait>
+  for(i = 0; i < 40; i++){
+    1bc4:	83 c3 01             	add    $0x1,%ebx
+    1bc7:	83 fb 27             	cmp    $0x27,%ebx
+    1bca:	0f 8f 90 00 00 00    	jg     1c60 <concreate+0x11a>
+    file[1] = '0' + i;
+    1bd0:	8d 43 30             	lea    0x30(%ebx),%eax
+    1bd3:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1bd6:	83 ec 0c             	sub    $0xc,%esp
+    1bd9:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1bdc:	50                   	push   %eax
+    1bdd:	e8 e6 4a 00 00       	call   66c8 <unlink>
+    pid = fork();
+    1be2:	e8 89 4a 00 00       	call   6670 <fork>
+    1be7:	89 c6                	mov    %eax,%esi
+    if(pid && (i % 3) == 1){
+    1be9:	83 c4 10             	add    $0x10,%esp
+    1bec:	85 c0                	test   %eax,%eax
+    1bee:	0f 84 79 ff ff ff    	je     1b6d <concreate+0x27>
+    1bf4:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1bf9:	89 d8                	mov    %ebx,%eax
+    1bfb:	f7 ea                	imul   %edx
+    1bfd:	89 d8                	mov    %ebx,%eax
+    1bff:	c1 f8 1f             	sar    $0x1f,%eax
+    1c02:	29 c2                	sub    %eax,%edx
+    1c04:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1c07:	89 da                	mov    %ebx,%edx
+    1c09:	29 c2                	sub    %eax,%edx
+    1c0b:	83 fa 01             	cmp    $0x1,%edx
+    1c0e:	0f 85 7b ff ff ff    	jne    1b8f <concreate+0x49>
+      link("C0", file);
+    1c14:	83 ec 08             	sub    $0x8,%esp
+    1c17:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c1a:	50                   	push   %eax
+    1c1b:	68 c3 72 00 00       	push   $0x72c3
+    1c20:	e8 b3 4a 00 00       	call   66d8 <link>
+    1c25:	83 c4 10             	add    $0x10,%esp
+    1c28:	eb 8d                	jmp    1bb7 <concreate+0x71>
+      link("C0", file);
+    1c2a:	83 ec 08             	sub    $0x8,%esp
+    1c2d:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c30:	50                   	push   %eax
+    1c31:	68 c3 72 00 00       	push   $0x72c3
+    1c36:	e8 9d 4a 00 00       	call   66d8 <link>
+    1c3b:	83 c4 10             	add    $0x10,%esp
+    1c3e:	e9 74 ff ff ff       	jmp    1bb7 <concreate+0x71>
+        printf(1, "concreate create %s failed\n", file);
+    1c43:	83 ec 04             	sub    $0x4,%esp
+    1c46:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c49:	50                   	push   %eax
+    1c4a:	68 c6 72 00 00       	push   $0x72c6
+    1c4f:	6a 01                	push   $0x1
+    1c51:	e8 ff 4b 00 00       	call   6855 <printf>
+        exit();
+    1c56:	e8 1d 4a 00 00       	call   6678 <exit>
+      exit();
+    1c5b:	e8 18 4a 00 00       	call   6678 <exit>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    1c60:	83 ec 04             	sub    $0x4,%esp
+    1c63:	6a 28                	push   $0x28
+    1c65:	6a 00                	push   $0x0
+    1c67:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1c6a:	50                   	push   %eax
+    1c6b:	e8 cd 48 00 00       	call   653d <memset>
+  fd = open(".", 0);
+    1c70:	83 c4 08             	add    $0x8,%esp
+    1c73:	6a 00                	push   $0x0
+    1c75:	68 2d 76 00 00       	push   $0x762d
+    1c7a:	e8 39 4a 00 00       	call   66b8 <open>
+    1c7f:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    1c81:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1c84:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1c89:	83 ec 04             	sub    $0x4,%esp
+    1c8c:	6a 10                	push   $0x10
+    1c8e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1c91:	50                   	push   %eax
+    1c92:	53                   	push   %ebx
+    1c93:	e8 f8 49 00 00       	call   6690 <read>
+    1c98:	83 c4 10             	add    $0x10,%esp
+    1c9b:	85 c0                	test   %eax,%eax
+    1c9d:	7e 60                	jle    1cff <concreate+0x1b9>
+    if(de.inum == 0)
+    1c9f:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    1ca4:	74 e3                	je     1c89 <concreate+0x143>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1ca6:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    1caa:	75 dd                	jne    1c89 <concreate+0x143>
+    1cac:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    1cb0:	75 d7                	jne    1c89 <concreate+0x143>
+      i = de.name[1] - '0';
+    1cb2:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    1cb6:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1cb9:	83 f8 27             	cmp    $0x27,%eax
+    1cbc:	77 11                	ja     1ccf <concreate+0x189>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    1cbe:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    1cc3:	75 22                	jne    1ce7 <concreate+0x1a1>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    1cc5:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    1cca:	83 c6 01             	add    $0x1,%esi
+    1ccd:	eb ba                	jmp    1c89 <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    1ccf:	83 ec 04             	sub    $0x4,%esp
+    1cd2:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1cd5:	50                   	push   %eax
+    1cd6:	68 e2 72 00 00       	push   $0x72e2
+    1cdb:	6a 01                	push   $0x1
+    1cdd:	e8 73 4b 00 00       	call   6855 <printf>
+        exit();
+    1ce2:	e8 91 49 00 00       	call   6678 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1ce7:	83 ec 04             	sub    $0x4,%esp
+    1cea:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1ced:	50                   	push   %eax
+    1cee:	68 fb 72 00 00       	push   $0x72fb
+    1cf3:	6a 01                	push   $0x1
+    1cf5:	e8 5b 4b 00 00       	call   6855 <printf>
+        exit();
+    1cfa:	e8 79 49 00 00       	call   6678 <exit>
+    }
+  }
+  close(fd);
+    1cff:	83 ec 0c             	sub    $0xc,%esp
+    1d02:	53                   	push   %ebx
+    1d03:	e8 98 49 00 00       	call   66a0 <close>
+
+  if(n != 40){
+    1d08:	83 c4 10             	add    $0x10,%esp
+    1d0b:	83 fe 28             	cmp    $0x28,%esi
+    1d0e:	75 0a                	jne    1d1a <concreate+0x1d4>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    1d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1d15:	e9 86 00 00 00       	jmp    1da0 <concreate+0x25a>
+    printf(1, "concreate not enough files in directory listing\n");
+    1d1a:	83 ec 08             	sub    $0x8,%esp
+    1d1d:	68 30 88 00 00       	push   $0x8830
+    1d22:	6a 01                	push   $0x1
+    1d24:	e8 2c 4b 00 00       	call   6855 <printf>
+    exit();
+    1d29:	e8 4a 49 00 00       	call   6678 <exit>
+    file[1] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    1d2e:	83 ec 08             	sub    $0x8,%esp
+    1d31:	68 07 85 00 00       	push   $0x8507
+    1d36:	6a 01                	push   $0x1
+    1d38:	e8 18 4b 00 00       	call   6855 <printf>
+      exit();
+    1d3d:	e8 36 49 00 00       	call   6678 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    1d42:	83 ec 08             	sub    $0x8,%esp
+    1d45:	6a 00                	push   $0x0
+    1d47:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    1d4a:	57                   	push   %edi
+    1d4b:	e8 68 49 00 00       	call   66b8 <open>
+    1d50:	89 04 24             	mov    %eax,(%esp)
+    1d53:	e8 48 49 00 00       	call   66a0 <close>
+      close(open(file, 0));
+    1d58:	83 c4 08             	add    $0x8,%esp
+    1d5b:	6a 00                	push   $0x0
+    1d5d:	57                   	push   %edi
+    1d5e:	e8 55 49 00 00       	call   66b8 <open>
+    1d63:	89 04 24             	mov    %eax,(%esp)
+    1d66:	e8 35 49 00 00       	call   66a0 <close>
+      close(open(file, 0));
+    1d6b:	83 c4 08             	add    $0x8,%esp
+    1d6e:	6a 00                	push   $0x0
+    1d70:	57                   	push   %edi
+    1d71:	e8 42 49 00 00       	call   66b8 <open>
+    1d76:	89 04 24             	mov    %eax,(%esp)
+    1d79:	e8 22 49 00 00       	call   66a0 <close>
+      close(open(file, 0));
+    1d7e:	83 c4 08             	add    $0x8,%esp
+    1d81:	6a 00                	push   $0x0
+    1d83:	57                   	push   %edi
+    1d84:	e8 2f 49 00 00       	call   66b8 <open>
+    1d89:	89 04 24             	mov    %eax,(%esp)
+    1d8c:	e8 0f 49 00 00       	call   66a0 <close>
+    1d91:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1d94:	85 f6                	test   %esi,%esi
+    1d96:	74 79                	je     1e11 <concreate+0x2cb>
+      exit();
+    else
+      wait();
+    1d98:	e8 e3 48 00 00       	call   6680 <wait>
+  for(i = 0; i < 40; i++){
+    1d9d:	83 c3 01             	add    $0x1,%ebx
+    1da0:	83 fb 27             	cmp    $0x27,%ebx
+    1da3:	7f 71                	jg     1e16 <concreate+0x2d0>
+    file[1] = '0' + i;
+    1da5:	8d 43 30             	lea    0x30(%ebx),%eax
+    1da8:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1dab:	e8 c0 48 00 00       	call   6670 <fork>
+    1db0:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    1db2:	85 c0                	test   %eax,%eax
+    1db4:	0f 88 74 ff ff ff    	js     1d2e <concreate+0x1e8>
+    if(((i % 3) == 0 && pid == 0) ||
+    1dba:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1dbf:	89 d8                	mov    %ebx,%eax
+    1dc1:	f7 ea                	imul   %edx
+    1dc3:	89 d8                	mov    %ebx,%eax
+    1dc5:	c1 f8 1f             	sar    $0x1f,%eax
+    1dc8:	29 c2                	sub    %eax,%edx
+    1dca:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1dcd:	89 da                	mov    %ebx,%edx
+    1dcf:	29 c2                	sub    %eax,%edx
+    1dd1:	89 d0                	mov    %edx,%eax
+    1dd3:	09 f0                	or     %esi,%eax
+    1dd5:	0f 84 67 ff ff ff    	je     1d42 <concreate+0x1fc>
+    1ddb:	83 fa 01             	cmp    $0x1,%edx
+    1dde:	75 08                	jne    1de8 <concreate+0x2a2>
+       ((i % 3) == 1 && pid != 0)){
+    1de0:	85 f6                	test   %esi,%esi
+    1de2:	0f 85 5a ff ff ff    	jne    1d42 <concreate+0x1fc>
+      unlink(file);
+    1de8:	83 ec 0c             	sub    $0xc,%esp
+    1deb:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    1dee:	57                   	push   %edi
+    1def:	e8 d4 48 00 00       	call   66c8 <unlink>
+      unlink(file);
+    1df4:	89 3c 24             	mov    %edi,(%esp)
+    1df7:	e8 cc 48 00 00       	call   66c8 <unlink>
+      unlink(file);
+    1dfc:	89 3c 24             	mov    %edi,(%esp)
+    1dff:	e8 c4 48 00 00       	call   66c8 <unlink>
+      unlink(file);
+    1e04:	89 3c 24             	mov    %edi,(%esp)
+    1e07:	e8 bc 48 00 00       	call   66c8 <unlink>
+    1e0c:	83 c4 10             	add    $0x10,%esp
+    1e0f:	eb 83                	jmp    1d94 <concreate+0x24e>
+      exit();
+    1e11:	e8 62 48 00 00       	call   6678 <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    1e16:	83 ec 08             	sub    $0x8,%esp
+    1e19:	68 18 73 00 00       	push   $0x7318
+    1e1e:	6a 01                	push   $0x1
+    1e20:	e8 30 4a 00 00       	call   6855 <printf>
+}
+    1e25:	83 c4 10             	add    $0x10,%esp
+    1e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e2b:	5b                   	pop    %ebx
+    1e2c:	5e                   	pop    %esi
+    1e2d:	5f                   	pop    %edi
+    1e2e:	5d                   	pop    %ebp
+    1e2f:	c3                   	ret
+
+00001e30 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    1e30:	55                   	push   %ebp
+    1e31:	89 e5                	mov    %esp,%ebp
+    1e33:	57                   	push   %edi
+    1e34:	56                   	push   %esi
+    1e35:	53                   	push   %ebx
+    1e36:	83 ec 14             	sub    $0x14,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    1e39:	68 26 73 00 00       	push   $0x7326
+    1e3e:	6a 01                	push   $0x1
+    1e40:	e8 10 4a 00 00       	call   6855 <printf>
+
+  unlink("x");
+    1e45:	c7 04 24 10 77 00 00 	movl   $0x7710,(%esp)
+    1e4c:	e8 77 48 00 00       	call   66c8 <unlink>
+  pid = fork();
+    1e51:	e8 1a 48 00 00       	call   6670 <fork>
+  if(pid < 0){
+    1e56:	83 c4 10             	add    $0x10,%esp
+    1e59:	85 c0                	test   %eax,%eax
+    1e5b:	78 10                	js     1e6d <linkunlink+0x3d>
+    1e5d:	89 c7                	mov    %eax,%edi
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    1e5f:	74 20                	je     1e81 <linkunlink+0x51>
+    1e61:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1e66:	be 00 00 00 00       	mov    $0x0,%esi
+    1e6b:	eb 3b                	jmp    1ea8 <linkunlink+0x78>
+    printf(1, "fork failed\n");
+    1e6d:	83 ec 08             	sub    $0x8,%esp
+    1e70:	68 07 85 00 00       	push   $0x8507
+    1e75:	6a 01                	push   $0x1
+    1e77:	e8 d9 49 00 00       	call   6855 <printf>
+    exit();
+    1e7c:	e8 f7 47 00 00       	call   6678 <exit>
+  unsigned int x = (pid ? 1 : 97);
+    1e81:	bb 61 00 00 00       	mov    $0x61,%ebx
+    1e86:	eb de                	jmp    1e66 <linkunlink+0x36>
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+      close(open("x", O_RDWR | O_CREATE));
+    1e88:	83 ec 08             	sub    $0x8,%esp
+    1e8b:	68 02 02 00 00       	push   $0x202
+    1e90:	68 10 77 00 00       	push   $0x7710
+    1e95:	e8 1e 48 00 00       	call   66b8 <open>
+    1e9a:	89 04 24             	mov    %eax,(%esp)
+    1e9d:	e8 fe 47 00 00       	call   66a0 <close>
+    1ea2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1ea5:	83 c6 01             	add    $0x1,%esi
+    1ea8:	83 fe 63             	cmp    $0x63,%esi
+    1eab:	7f 52                	jg     1eff <linkunlink+0xcf>
+    x = x * 1103515245 + 12345;
+    1ead:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    1eb3:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    1eb9:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    1ebe:	89 d8                	mov    %ebx,%eax
+    1ec0:	f7 e2                	mul    %edx
+    1ec2:	89 d0                	mov    %edx,%eax
+    1ec4:	d1 e8                	shr    %eax
+    1ec6:	83 e2 fe             	and    $0xfffffffe,%edx
+    1ec9:	01 c2                	add    %eax,%edx
+    1ecb:	89 d8                	mov    %ebx,%eax
+    1ecd:	29 d0                	sub    %edx,%eax
+    1ecf:	74 b7                	je     1e88 <linkunlink+0x58>
+    } else if((x % 3) == 1){
+    1ed1:	83 f8 01             	cmp    $0x1,%eax
+    1ed4:	74 12                	je     1ee8 <linkunlink+0xb8>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    1ed6:	83 ec 0c             	sub    $0xc,%esp
+    1ed9:	68 10 77 00 00       	push   $0x7710
+    1ede:	e8 e5 47 00 00       	call   66c8 <unlink>
+    1ee3:	83 c4 10             	add    $0x10,%esp
+    1ee6:	eb bd                	jmp    1ea5 <linkunlink+0x75>
+      link("cat", "x");
+    1ee8:	83 ec 08             	sub    $0x8,%esp
+    1eeb:	68 10 77 00 00       	push   $0x7710
+    1ef0:	68 37 73 00 00       	push   $0x7337
+    1ef5:	e8 de 47 00 00       	call   66d8 <link>
+    1efa:	83 c4 10             	add    $0x10,%esp
+    1efd:	eb a6                	jmp    1ea5 <linkunlink+0x75>
+    }
+  }
+
+  if(pid)
+    1eff:	85 ff                	test   %edi,%edi
+    1f01:	74 1c                	je     1f1f <linkunlink+0xef>
+    wait();
+    1f03:	e8 78 47 00 00       	call   6680 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    1f08:	83 ec 08             	sub    $0x8,%esp
+    1f0b:	68 3b 73 00 00       	push   $0x733b
+    1f10:	6a 01                	push   $0x1
+    1f12:	e8 3e 49 00 00       	call   6855 <printf>
+}
+    1f17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f1a:	5b                   	pop    %ebx
+    1f1b:	5e                   	pop    %esi
+    1f1c:	5f                   	pop    %edi
+    1f1d:	5d                   	pop    %ebp
+    1f1e:	c3                   	ret
+    exit();
+    1f1f:	e8 54 47 00 00       	call   6678 <exit>
+
+00001f24 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    1f24:	55                   	push   %ebp
+    1f25:	89 e5                	mov    %esp,%ebp
+    1f27:	53                   	push   %ebx
+    1f28:	83 ec 1c             	sub    $0x1c,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    1f2b:	68 4a 73 00 00       	push   $0x734a
+    1f30:	6a 01                	push   $0x1
+    1f32:	e8 1e 49 00 00       	call   6855 <printf>
+  unlink("bd");
+    1f37:	c7 04 24 57 73 00 00 	movl   $0x7357,(%esp)
+    1f3e:	e8 85 47 00 00       	call   66c8 <unlink>
+
+  fd = open("bd", O_CREATE);
+    1f43:	83 c4 08             	add    $0x8,%esp
+    1f46:	68 00 02 00 00       	push   $0x200
+    1f4b:	68 57 73 00 00       	push   $0x7357
+    1f50:	e8 63 47 00 00       	call   66b8 <open>
+  if(fd < 0){
+    1f55:	83 c4 10             	add    $0x10,%esp
+    1f58:	85 c0                	test   %eax,%eax
+    1f5a:	78 65                	js     1fc1 <bigdir+0x9d>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    1f5c:	83 ec 0c             	sub    $0xc,%esp
+    1f5f:	50                   	push   %eax
+    1f60:	e8 3b 47 00 00       	call   66a0 <close>
+
+  for(i = 0; i < 500; i++){
+    1f65:	83 c4 10             	add    $0x10,%esp
+    1f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1f6d:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    1f73:	7f 74                	jg     1fe9 <bigdir+0xc5>
+    name[0] = 'x';
+    1f75:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    1f79:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1f7c:	85 db                	test   %ebx,%ebx
+    1f7e:	0f 49 c3             	cmovns %ebx,%eax
+    1f81:	c1 f8 06             	sar    $0x6,%eax
+    1f84:	83 c0 30             	add    $0x30,%eax
+    1f87:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1f8a:	89 da                	mov    %ebx,%edx
+    1f8c:	c1 fa 1f             	sar    $0x1f,%edx
+    1f8f:	c1 ea 1a             	shr    $0x1a,%edx
+    1f92:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1f95:	83 e0 3f             	and    $0x3f,%eax
+    1f98:	29 d0                	sub    %edx,%eax
+    1f9a:	83 c0 30             	add    $0x30,%eax
+    1f9d:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1fa0:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(link("bd", name) != 0){
+    1fa4:	83 ec 08             	sub    $0x8,%esp
+    1fa7:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1faa:	50                   	push   %eax
+    1fab:	68 57 73 00 00       	push   $0x7357
+    1fb0:	e8 23 47 00 00       	call   66d8 <link>
+    1fb5:	83 c4 10             	add    $0x10,%esp
+    1fb8:	85 c0                	test   %eax,%eax
+    1fba:	75 19                	jne    1fd5 <bigdir+0xb1>
+  for(i = 0; i < 500; i++){
+    1fbc:	83 c3 01             	add    $0x1,%ebx
+    1fbf:	eb ac                	jmp    1f6d <bigdir+0x49>
+    printf(1, "bigdir create failed\n");
+    1fc1:	83 ec 08             	sub    $0x8,%esp
+    1fc4:	68 5a 73 00 00       	push   $0x735a
+    1fc9:	6a 01                	push   $0x1
+    1fcb:	e8 85 48 00 00       	call   6855 <printf>
+    exit();
+    1fd0:	e8 a3 46 00 00       	call   6678 <exit>
+      printf(1, "bigdir link failed\n");
+    1fd5:	83 ec 08             	sub    $0x8,%esp
+    1fd8:	68 70 73 00 00       	push   $0x7370
+    1fdd:	6a 01                	push   $0x1
+    1fdf:	e8 71 48 00 00       	call   6855 <printf>
+      exit();
+    1fe4:	e8 8f 46 00 00       	call   6678 <exit>
+    }
+  }
+
+  unlink("bd");
+    1fe9:	83 ec 0c             	sub    $0xc,%esp
+    1fec:	68 57 73 00 00       	push   $0x7357
+    1ff1:	e8 d2 46 00 00       	call   66c8 <unlink>
+  for(i = 0; i < 500; i++){
+    1ff6:	83 c4 10             	add    $0x10,%esp
+    1ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1ffe:	eb 03                	jmp    2003 <bigdir+0xdf>
+    2000:	83 c3 01             	add    $0x1,%ebx
+    2003:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    2009:	7f 56                	jg     2061 <bigdir+0x13d>
+    name[0] = 'x';
+    200b:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    200f:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    2012:	85 db                	test   %ebx,%ebx
+    2014:	0f 49 c3             	cmovns %ebx,%eax
+    2017:	c1 f8 06             	sar    $0x6,%eax
+    201a:	83 c0 30             	add    $0x30,%eax
+    201d:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    2020:	89 da                	mov    %ebx,%edx
+    2022:	c1 fa 1f             	sar    $0x1f,%edx
+    2025:	c1 ea 1a             	shr    $0x1a,%edx
+    2028:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    202b:	83 e0 3f             	and    $0x3f,%eax
+    202e:	29 d0                	sub    %edx,%eax
+    2030:	83 c0 30             	add    $0x30,%eax
+    2033:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    2036:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(unlink(name) != 0){
+    203a:	83 ec 0c             	sub    $0xc,%esp
+    203d:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    2040:	50                   	push   %eax
+    2041:	e8 82 46 00 00       	call   66c8 <unlink>
+    2046:	83 c4 10             	add    $0x10,%esp
+    2049:	85 c0                	test   %eax,%eax
+    204b:	74 b3                	je     2000 <bigdir+0xdc>
+      printf(1, "bigdir unlink failed");
+    204d:	83 ec 08             	sub    $0x8,%esp
+    2050:	68 84 73 00 00       	push   $0x7384
+    2055:	6a 01                	push   $0x1
+    2057:	e8 f9 47 00 00       	call   6855 <printf>
+      exit();
+    205c:	e8 17 46 00 00       	call   6678 <exit>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    2061:	83 ec 08             	sub    $0x8,%esp
+    2064:	68 99 73 00 00       	push   $0x7399
+    2069:	6a 01                	push   $0x1
+    206b:	e8 e5 47 00 00       	call   6855 <printf>
+}
+    2070:	83 c4 10             	add    $0x10,%esp
+    2073:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2076:	c9                   	leave
+    2077:	c3                   	ret
+
+00002078 <hashdir>:
+// a directory with hundreds of entries is hashed; every name
+// must still be found, read back by a linear reader like ls,
+// and the directory must count as empty once they are gone
+void
+hashdir(void)
+{
+    2078:	55                   	push   %ebp
+    2079:	89 e5                	mov    %esp,%ebp
+    207b:	57                   	push   %edi
+    207c:	56                   	push   %esi
+    207d:	53                   	push   %ebx
+    207e:	83 ec 34             	sub    $0x34,%esp
+  int i, fd, n;
+  char name[16];
+  struct dirent de;
+
+  printf(1, "hashdir test\n");
+    2081:	68 a4 73 00 00       	push   $0x73a4
+    2086:	6a 01                	push   $0x1
+    2088:	e8 c8 47 00 00       	call   6855 <printf>
+  if(mkdir("hd") != 0){
+    208d:	c7 04 24 b2 73 00 00 	movl   $0x73b2,(%esp)
+    2094:	e8 47 46 00 00       	call   66e0 <mkdir>
+    2099:	83 c4 10             	add    $0x10,%esp
+    209c:	85 c0                	test   %eax,%eax
+    209e:	0f 85 bd 00 00 00    	jne    2161 <hashdir+0xe9>
+    20a4:	89 c6                	mov    %eax,%esi
+    printf(1, "hashdir mkdir failed\n");
+    exit();
+  }
+  fd = open("hd/f", O_CREATE|O_RDWR);
+    20a6:	83 ec 08             	sub    $0x8,%esp
+    20a9:	68 02 02 00 00       	push   $0x202
+    20ae:	68 cb 73 00 00       	push   $0x73cb
+    20b3:	e8 00 46 00 00       	call   66b8 <open>
+  if(fd < 0){
+    20b8:	83 c4 10             	add    $0x10,%esp
+    20bb:	85 c0                	test   %eax,%eax
+    20bd:	0f 88 b2 00 00 00    	js     2175 <hashdir+0xfd>
+    printf(1, "hashdir create failed\n");
+    exit();
+  }
+  close(fd);
+    20c3:	83 ec 0c             	sub    $0xc,%esp
+    20c6:	50                   	push   %eax
+    20c7:	e8 d4 45 00 00       	call   66a0 <close>
+
+  strcpy(name, "hd/n");
+    20cc:	83 c4 08             	add    $0x8,%esp
+    20cf:	68 e7 73 00 00       	push   $0x73e7
+    20d4:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    20d7:	50                   	push   %eax
+    20d8:	e8 fc 43 00 00       	call   64d9 <strcpy>
+  for(i = 0; i < 300; i++){
+    20dd:	83 c4 10             	add    $0x10,%esp
+    20e0:	89 f3                	mov    %esi,%ebx
+    20e2:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+    20e8:	0f 8f b3 00 00 00    	jg     21a1 <hashdir+0x129>
+    name[4] = 'a' + i/26/26;
+    20ee:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+    20f3:	89 d8                	mov    %ebx,%eax
+    20f5:	f7 ea                	imul   %edx
+    20f7:	c1 fa 08             	sar    $0x8,%edx
+    20fa:	89 df                	mov    %ebx,%edi
+    20fc:	c1 ff 1f             	sar    $0x1f,%edi
+    20ff:	29 fa                	sub    %edi,%edx
+    2101:	83 c2 61             	add    $0x61,%edx
+    2104:	88 55 dc             	mov    %dl,-0x24(%ebp)
+    name[5] = 'a' + i/26%26;
+    2107:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    210c:	f7 eb                	imul   %ebx
+    210e:	89 d1                	mov    %edx,%ecx
+    2110:	c1 f9 03             	sar    $0x3,%ecx
+    2113:	29 f9                	sub    %edi,%ecx
+    2115:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    211a:	f7 e9                	imul   %ecx
+    211c:	c1 fa 03             	sar    $0x3,%edx
+    211f:	89 c8                	mov    %ecx,%eax
+    2121:	c1 f8 1f             	sar    $0x1f,%eax
+    2124:	29 c2                	sub    %eax,%edx
+    2126:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    2129:	89 ca                	mov    %ecx,%edx
+    212b:	29 c2                	sub    %eax,%edx
+    212d:	83 c2 61             	add    $0x61,%edx
+    2130:	88 55 dd             	mov    %dl,-0x23(%ebp)
+    name[6] = 'a' + i%26;
+    2133:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    2136:	89 d8                	mov    %ebx,%eax
+    2138:	29 c8                	sub    %ecx,%eax
+    213a:	83 c0 61             	add    $0x61,%eax
+    213d:	88 45 de             	mov    %al,-0x22(%ebp)
+    name[7] = '\0';
+    2140:	c6 45 df 00          	movb   $0x0,-0x21(%ebp)
+    if(link("hd/f", name) != 0){
+    2144:	83 ec 08             	sub    $0x8,%esp
+    2147:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    214a:	50                   	push   %eax
+    214b:	68 cb 73 00 00       	push   $0x73cb
+    2150:	e8 83 45 00 00       	call   66d8 <link>
+    2155:	83 c4 10             	add    $0x10,%esp
+    2158:	85 c0                	test   %eax,%eax
+    215a:	75 2d                	jne    2189 <hashdir+0x111>
+  for(i = 0; i < 300; i++){
+    215c:	83 c3 01             	add    $0x1,%ebx
+    215f:	eb 81                	jmp    20e2 <hashdir+0x6a>
+    printf(1, "hashdir mkdir failed\n");
+    2161:	83 ec 08             	sub    $0x8,%esp
+    2164:	68 b5 73 00 00       	push   $0x73b5
+    2169:	6a 01                	push   $0x1
+    216b:	e8 e5 46 00 00       	call   6855 <printf>
+    exit();
+    2170:	e8 03 45 00 00       	call   6678 <exit>
+    printf(1, "hashdir create failed\n");
+    2175:	83 ec 08             	sub    $0x8,%esp
+    2178:	68 d0 73 00 00       	push   $0x73d0
+    217d:	6a 01                	push   $0x1
+    217f:	e8 d1 46 00 00       	call   6855 <printf>
+    exit();
+    2184:	e8 ef 44 00 00       	call   6678 <exit>
+      printf(1, "hashdir link %s failed\n", name);
+    2189:	83 ec 04             	sub    $0x4,%esp
+    218c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    218f:	50                   	push   %eax
+    2190:	68 ec 73 00 00       	push   $0x73ec
+    2195:	6a 01                	push   $0x1
+    2197:	e8 b9 46 00 00       	call   6855 <printf>
+      exit();
+    219c:	e8 d7 44 00 00       	call   6678 <exit>
+    }
+  }
+  for(i = 0; i < 300; i++){
+    21a1:	89 f3                	mov    %esi,%ebx
+    21a3:	eb 0f                	jmp    21b4 <hashdir+0x13c>
+    name[6] = 'a' + i%26;
+    if((fd = open(name, 0)) < 0){
+      printf(1, "hashdir open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+    21a5:	83 ec 0c             	sub    $0xc,%esp
+    21a8:	50                   	push   %eax
+    21a9:	e8 f2 44 00 00       	call   66a0 <close>
+  for(i = 0; i < 300; i++){
+    21ae:	83 c3 01             	add    $0x1,%ebx
+    21b1:	83 c4 10             	add    $0x10,%esp
+    21b4:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+    21ba:	7f 7f                	jg     223b <hashdir+0x1c3>
+    name[4] = 'a' + i/26/26;
+    21bc:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+    21c1:	89 d8                	mov    %ebx,%eax
+    21c3:	f7 ea                	imul   %edx
+    21c5:	c1 fa 08             	sar    $0x8,%edx
+    21c8:	89 df                	mov    %ebx,%edi
+    21ca:	c1 ff 1f             	sar    $0x1f,%edi
+    21cd:	29 fa                	sub    %edi,%edx
+    21cf:	83 c2 61             	add    $0x61,%edx
+    21d2:	88 55 dc             	mov    %dl,-0x24(%ebp)
+    name[5] = 'a' + i/26%26;
+    21d5:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    21da:	f7 eb                	imul   %ebx
+    21dc:	89 d1                	mov    %edx,%ecx
+    21de:	c1 f9 03             	sar    $0x3,%ecx
+    21e1:	29 f9                	sub    %edi,%ecx
+    21e3:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    21e8:	f7 e9                	imul   %ecx
+    21ea:	c1 fa 03             	sar    $0x3,%edx
+    21ed:	89 c8                	mov    %ecx,%eax
+    21ef:	c1 f8 1f             	sar    $0x1f,%eax
+    21f2:	29 c2                	sub    %eax,%edx
+    21f4:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    21f7:	89 ca                	mov    %ecx,%edx
+    21f9:	29 c2                	sub    %eax,%edx
+    21fb:	83 c2 61             	add    $0x61,%edx
+    21fe:	88 55 dd             	mov    %dl,-0x23(%ebp)
+    name[6] = 'a' + i%26;
+    2201:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    2204:	89 d8                	mov    %ebx,%eax
+    2206:	29 c8                	sub    %ecx,%eax
+    2208:	83 c0 61             	add    $0x61,%eax
+    220b:	88 45 de             	mov    %al,-0x22(%ebp)
+    if((fd = open(name, 0)) < 0){
+    220e:	83 ec 08             	sub    $0x8,%esp
+    2211:	6a 00                	push   $0x0
+    2213:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2216:	50                   	push   %eax
+    2217:	e8 9c 44 00 00       	call   66b8 <open>
+    221c:	83 c4 10             	add    $0x10,%esp
+    221f:	85 c0                	test   %eax,%eax
+    2221:	79 82                	jns    21a5 <hashdir+0x12d>
+      printf(1, "hashdir open %s failed\n", name);
+    2223:	83 ec 04             	sub    $0x4,%esp
+    2226:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2229:	50                   	push   %eax
+    222a:	68 04 74 00 00       	push   $0x7404
+    222f:	6a 01                	push   $0x1
+    2231:	e8 1f 46 00 00       	call   6855 <printf>
+      exit();
+    2236:	e8 3d 44 00 00       	call   6678 <exit>
+  }
+  if(link("hd/f", "hd/naaa") == 0){
+    223b:	83 ec 08             	sub    $0x8,%esp
+    223e:	68 1c 74 00 00       	push   $0x741c
+    2243:	68 cb 73 00 00       	push   $0x73cb
+    2248:	e8 8b 44 00 00       	call   66d8 <link>
+    224d:	83 c4 10             	add    $0x10,%esp
+    2250:	85 c0                	test   %eax,%eax
+    2252:	74 39                	je     228d <hashdir+0x215>
+    printf(1, "hashdir duplicate link succeeded\n");
+    exit();
+  }
+
+  fd = open("hd", 0);
+    2254:	83 ec 08             	sub    $0x8,%esp
+    2257:	6a 00                	push   $0x0
+    2259:	68 b2 73 00 00       	push   $0x73b2
+    225e:	e8 55 44 00 00       	call   66b8 <open>
+    2263:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    2265:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    2268:	89 f7                	mov    %esi,%edi
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    226a:	83 ec 04             	sub    $0x4,%esp
+    226d:	6a 10                	push   $0x10
+    226f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2272:	50                   	push   %eax
+    2273:	53                   	push   %ebx
+    2274:	e8 17 44 00 00       	call   6690 <read>
+    2279:	83 c4 10             	add    $0x10,%esp
+    227c:	83 f8 10             	cmp    $0x10,%eax
+    227f:	75 20                	jne    22a1 <hashdir+0x229>
+    if(de.inum != 0)
+    2281:	66 83 7d c8 00       	cmpw   $0x0,-0x38(%ebp)
+    2286:	74 e2                	je     226a <hashdir+0x1f2>
+      n++;
+    2288:	83 c7 01             	add    $0x1,%edi
+    228b:	eb dd                	jmp    226a <hashdir+0x1f2>
+    printf(1, "hashdir duplicate link succeeded\n");
+    228d:	83 ec 08             	sub    $0x8,%esp
+    2290:	68 64 88 00 00       	push   $0x8864
+    2295:	6a 01                	push   $0x1
+    2297:	e8 b9 45 00 00       	call   6855 <printf>
+    exit();
+    229c:	e8 d7 43 00 00       	call   6678 <exit>
+  close(fd);
+    22a1:	83 ec 0c             	sub    $0xc,%esp
+    22a4:	53                   	push   %ebx
+    22a5:	e8 f6 43 00 00       	call   66a0 <close>
+  if(n != 300 + 3){
+    22aa:	83 c4 10             	add    $0x10,%esp
+    22ad:	81 ff 2f 01 00 00    	cmp    $0x12f,%edi
+    22b3:	75 75                	jne    232a <hashdir+0x2b2>
+    printf(1, "hashdir read %d entries\n", n);
+    exit();
+  }
+
+  for(i = 0; i < 300; i++){
+    22b5:	81 fe 2b 01 00 00    	cmp    $0x12b,%esi
+    22bb:	0f 8f 96 00 00 00    	jg     2357 <hashdir+0x2df>
+    name[4] = 'a' + i/26/26;
+    22c1:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+    22c6:	89 f0                	mov    %esi,%eax
+    22c8:	f7 ea                	imul   %edx
+    22ca:	c1 fa 08             	sar    $0x8,%edx
+    22cd:	89 f7                	mov    %esi,%edi
+    22cf:	c1 ff 1f             	sar    $0x1f,%edi
+    22d2:	29 fa                	sub    %edi,%edx
+    22d4:	83 c2 61             	add    $0x61,%edx
+    22d7:	88 55 dc             	mov    %dl,-0x24(%ebp)
+    name[5] = 'a' + i/26%26;
+    22da:	b9 4f ec c4 4e       	mov    $0x4ec4ec4f,%ecx
+    22df:	89 f0                	mov    %esi,%eax
+    22e1:	f7 e9                	imul   %ecx
+    22e3:	c1 fa 03             	sar    $0x3,%edx
+    22e6:	89 d3                	mov    %edx,%ebx
+    22e8:	29 fb                	sub    %edi,%ebx
+    22ea:	89 d8                	mov    %ebx,%eax
+    22ec:	f7 e9                	imul   %ecx
+    22ee:	c1 fa 03             	sar    $0x3,%edx
+    22f1:	89 d8                	mov    %ebx,%eax
+    22f3:	c1 f8 1f             	sar    $0x1f,%eax
+    22f6:	29 c2                	sub    %eax,%edx
+    22f8:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    22fb:	89 da                	mov    %ebx,%edx
+    22fd:	29 c2                	sub    %eax,%edx
+    22ff:	83 c2 61             	add    $0x61,%edx
+    2302:	88 55 dd             	mov    %dl,-0x23(%ebp)
+    name[6] = 'a' + i%26;
+    2305:	6b db 1a             	imul   $0x1a,%ebx,%ebx
+    2308:	89 f0                	mov    %esi,%eax
+    230a:	29 d8                	sub    %ebx,%eax
+    230c:	83 c0 61             	add    $0x61,%eax
+    230f:	88 45 de             	mov    %al,-0x22(%ebp)
+    if(unlink(name) != 0){
+    2312:	83 ec 0c             	sub    $0xc,%esp
+    2315:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2318:	50                   	push   %eax
+    2319:	e8 aa 43 00 00       	call   66c8 <unlink>
+    231e:	83 c4 10             	add    $0x10,%esp
+    2321:	85 c0                	test   %eax,%eax
+    2323:	75 1a                	jne    233f <hashdir+0x2c7>
+  for(i = 0; i < 300; i++){
+    2325:	83 c6 01             	add    $0x1,%esi
+    2328:	eb 8b                	jmp    22b5 <hashdir+0x23d>
+    printf(1, "hashdir read %d entries\n", n);
+    232a:	83 ec 04             	sub    $0x4,%esp
+    232d:	57                   	push   %edi
+    232e:	68 24 74 00 00       	push   $0x7424
+    2333:	6a 01                	push   $0x1
+    2335:	e8 1b 45 00 00       	call   6855 <printf>
+    exit();
+    233a:	e8 39 43 00 00       	call   6678 <exit>
+      printf(1, "hashdir unlink %s failed\n", name);
+    233f:	83 ec 04             	sub    $0x4,%esp
+    2342:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2345:	50                   	push   %eax
+    2346:	68 3d 74 00 00       	push   $0x743d
+    234b:	6a 01                	push   $0x1
+    234d:	e8 03 45 00 00       	call   6855 <printf>
+      exit();
+    2352:	e8 21 43 00 00       	call   6678 <exit>
+    }
+  }
+  if(unlink("hd") == 0){
+    2357:	83 ec 0c             	sub    $0xc,%esp
+    235a:	68 b2 73 00 00       	push   $0x73b2
+    235f:	e8 64 43 00 00       	call   66c8 <unlink>
+    2364:	83 c4 10             	add    $0x10,%esp
+    2367:	85 c0                	test   %eax,%eax
+    2369:	74 42                	je     23ad <hashdir+0x335>
+    printf(1, "hashdir unlinked non-empty dir\n");
+    exit();
+  }
+  if(unlink("hd/f") != 0 || unlink("hd") != 0){
+    236b:	83 ec 0c             	sub    $0xc,%esp
+    236e:	68 cb 73 00 00       	push   $0x73cb
+    2373:	e8 50 43 00 00       	call   66c8 <unlink>
+    2378:	83 c4 10             	add    $0x10,%esp
+    237b:	85 c0                	test   %eax,%eax
+    237d:	75 42                	jne    23c1 <hashdir+0x349>
+    237f:	83 ec 0c             	sub    $0xc,%esp
+    2382:	68 b2 73 00 00       	push   $0x73b2
+    2387:	e8 3c 43 00 00       	call   66c8 <unlink>
+    238c:	83 c4 10             	add    $0x10,%esp
+    238f:	85 c0                	test   %eax,%eax
+    2391:	75 2e                	jne    23c1 <hashdir+0x349>
+    printf(1, "hashdir cleanup failed\n");
+    exit();
+  }
+  printf(1, "hashdir ok\n");
+    2393:	83 ec 08             	sub    $0x8,%esp
+    2396:	68 6f 74 00 00       	push   $0x746f
+    239b:	6a 01                	push   $0x1
+    239d:	e8 b3 44 00 00       	call   6855 <printf>
+}
+    23a2:	83 c4 10             	add    $0x10,%esp
+    23a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23a8:	5b                   	pop    %ebx
+    23a9:	5e                   	pop    %esi
+    23aa:	5f                   	pop    %edi
+    23ab:	5d                   	pop    %ebp
+    23ac:	c3                   	ret
+    printf(1, "hashdir unlinked non-empty dir\n");
+    23ad:	83 ec 08             	sub    $0x8,%esp
+    23b0:	68 88 88 00 00       	push   $0x8888
+    23b5:	6a 01                	push   $0x1
+    23b7:	e8 99 44 00 00       	call   6855 <printf>
+    exit();
+    23bc:	e8 b7 42 00 00       	call   6678 <exit>
+    printf(1, "hashdir cleanup failed\n");
+    23c1:	83 ec 08             	sub    $0x8,%esp
+    23c4:	68 57 74 00 00       	push   $0x7457
+    23c9:	6a 01                	push   $0x1
+    23cb:	e8 85 44 00 00       	call   6855 <printf>
+    exit();
+    23d0:	e8 a3 42 00 00       	call   6678 <exit>
+
+000023d5 <dirfull>:
+
+// a hashed directory has a limited index; once it is full,
+// creating an entry in a full leaf fails instead of panicking
+void
+dirfull(void)
+{
+    23d5:	55                   	push   %ebp
+    23d6:	89 e5                	mov    %esp,%ebp
+    23d8:	57                   	push   %edi
+    23d9:	56                   	push   %esi
+    23da:	53                   	push   %ebx
+    23db:	83 ec 24             	sub    $0x24,%esp
+  int i, n, fd;
+  char name[16];
+
+  printf(1, "dirfull test\n");
+    23de:	68 7b 74 00 00       	push   $0x747b
+    23e3:	6a 01                	push   $0x1
+    23e5:	e8 6b 44 00 00       	call   6855 <printf>
+  if(mkdir("df") != 0){
+    23ea:	c7 04 24 89 74 00 00 	movl   $0x7489,(%esp)
+    23f1:	e8 ea 42 00 00       	call   66e0 <mkdir>
+    23f6:	83 c4 10             	add    $0x10,%esp
+    23f9:	85 c0                	test   %eax,%eax
+    23fb:	0f 85 bd 00 00 00    	jne    24be <dirfull+0xe9>
+    2401:	89 c6                	mov    %eax,%esi
+    printf(1, "dirfull mkdir failed\n");
+    exit();
+  }
+  fd = open("df/f", O_CREATE|O_RDWR);
+    2403:	83 ec 08             	sub    $0x8,%esp
+    2406:	68 02 02 00 00       	push   $0x202
+    240b:	68 a2 74 00 00       	push   $0x74a2
+    2410:	e8 a3 42 00 00       	call   66b8 <open>
+  if(fd < 0){
+    2415:	83 c4 10             	add    $0x10,%esp
+    2418:	85 c0                	test   %eax,%eax
+    241a:	0f 88 b2 00 00 00    	js     24d2 <dirfull+0xfd>
+    printf(1, "dirfull create failed\n");
+    exit();
+  }
+  close(fd);
+    2420:	83 ec 0c             	sub    $0xc,%esp
+    2423:	50                   	push   %eax
+    2424:	e8 77 42 00 00       	call   66a0 <close>
+
+  strcpy(name, "df/n");
+    2429:	83 c4 08             	add    $0x8,%esp
+    242c:	68 be 74 00 00       	push   $0x74be
+    2431:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2434:	50                   	push   %eax
+    2435:	e8 9f 40 00 00       	call   64d9 <strcpy>
+  name[7] = '\0';
+    243a:	c6 45 df 00          	movb   $0x0,-0x21(%ebp)
+  for(n = 0; n < 26*26*26; n++){
+    243e:	83 c4 10             	add    $0x10,%esp
+    2441:	89 f3                	mov    %esi,%ebx
+    2443:	81 fb a7 44 00 00    	cmp    $0x44a7,%ebx
+    2449:	0f 8f 97 00 00 00    	jg     24e6 <dirfull+0x111>
+    name[4] = 'a' + n/26/26;
+    244f:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+    2454:	89 d8                	mov    %ebx,%eax
+    2456:	f7 ea                	imul   %edx
+    2458:	c1 fa 08             	sar    $0x8,%edx
+    245b:	89 df                	mov    %ebx,%edi
+    245d:	c1 ff 1f             	sar    $0x1f,%edi
+    2460:	29 fa                	sub    %edi,%edx
+    2462:	83 c2 61             	add    $0x61,%edx
+    2465:	88 55 dc             	mov    %dl,-0x24(%ebp)
+    name[5] = 'a' + n/26%26;
+    2468:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    246d:	f7 eb                	imul   %ebx
+    246f:	89 d1                	mov    %edx,%ecx
+    2471:	c1 f9 03             	sar    $0x3,%ecx
+    2474:	29 f9                	sub    %edi,%ecx
+    2476:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    247b:	f7 e9                	imul   %ecx
+    247d:	c1 fa 03             	sar    $0x3,%edx
+    2480:	89 c8                	mov    %ecx,%eax
+    2482:	c1 f8 1f             	sar    $0x1f,%eax
+    2485:	29 c2                	sub    %eax,%edx
+    2487:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    248a:	89 ca                	mov    %ecx,%edx
+    248c:	29 c2                	sub    %eax,%edx
+    248e:	83 c2 61             	add    $0x61,%edx
+    2491:	88 55 dd             	mov    %dl,-0x23(%ebp)
+    name[6] = 'a' + n%26;
+    2494:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    2497:	89 d8                	mov    %ebx,%eax
+    2499:	29 c8                	sub    %ecx,%eax
+    249b:	83 c0 61             	add    $0x61,%eax
+    249e:	88 45 de             	mov    %al,-0x22(%ebp)
+    if(link("df/f", name) != 0)
+    24a1:	83 ec 08             	sub    $0x8,%esp
+    24a4:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    24a7:	50                   	push   %eax
+    24a8:	68 a2 74 00 00       	push   $0x74a2
+    24ad:	e8 26 42 00 00       	call   66d8 <link>
+    24b2:	83 c4 10             	add    $0x10,%esp
+    24b5:	85 c0                	test   %eax,%eax
+    24b7:	75 2d                	jne    24e6 <dirfull+0x111>
+  for(n = 0; n < 26*26*26; n++){
+    24b9:	83 c3 01             	add    $0x1,%ebx
+    24bc:	eb 85                	jmp    2443 <dirfull+0x6e>
+    printf(1, "dirfull mkdir failed\n");
+    24be:	83 ec 08             	sub    $0x8,%esp
+    24c1:	68 8c 74 00 00       	push   $0x748c
+    24c6:	6a 01                	push   $0x1
+    24c8:	e8 88 43 00 00       	call   6855 <printf>
+    exit();
+    24cd:	e8 a6 41 00 00       	call   6678 <exit>
+    printf(1, "dirfull create failed\n");
+    24d2:	83 ec 08             	sub    $0x8,%esp
+    24d5:	68 a7 74 00 00       	push   $0x74a7
+    24da:	6a 01                	push   $0x1
+    24dc:	e8 74 43 00 00       	call   6855 <printf>
+    exit();
+    24e1:	e8 92 41 00 00       	call   6678 <exit>
+      break;
+  }
+  if(n == 26*26*26){
+    24e6:	81 fb a8 44 00 00    	cmp    $0x44a8,%ebx
+    24ec:	74 43                	je     2531 <dirfull+0x15c>
+    printf(1, "dirfull: directory never filled\n");
+    exit();
+  }
+  // name's leaf is full and cannot be split
+  if(open(name, O_CREATE|O_RDWR) >= 0 || mkdir(name) == 0){
+    24ee:	83 ec 08             	sub    $0x8,%esp
+    24f1:	68 02 02 00 00       	push   $0x202
+    24f6:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    24f9:	50                   	push   %eax
+    24fa:	e8 b9 41 00 00       	call   66b8 <open>
+    24ff:	83 c4 10             	add    $0x10,%esp
+    2502:	85 c0                	test   %eax,%eax
+    2504:	79 13                	jns    2519 <dirfull+0x144>
+    2506:	83 ec 0c             	sub    $0xc,%esp
+    2509:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    250c:	50                   	push   %eax
+    250d:	e8 ce 41 00 00       	call   66e0 <mkdir>
+    2512:	83 c4 10             	add    $0x10,%esp
+    2515:	85 c0                	test   %eax,%eax
+    2517:	75 2f                	jne    2548 <dirfull+0x173>
+    printf(1, "dirfull: created %s in a full directory\n", name);
+    2519:	83 ec 04             	sub    $0x4,%esp
+    251c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    251f:	50                   	push   %eax
+    2520:	68 cc 88 00 00       	push   $0x88cc
+    2525:	6a 01                	push   $0x1
+    2527:	e8 29 43 00 00       	call   6855 <printf>
+    exit();
+    252c:	e8 47 41 00 00       	call   6678 <exit>
+    printf(1, "dirfull: directory never filled\n");
+    2531:	83 ec 08             	sub    $0x8,%esp
+    2534:	68 a8 88 00 00       	push   $0x88a8
+    2539:	6a 01                	push   $0x1
+    253b:	e8 15 43 00 00       	call   6855 <printf>
+    exit();
+    2540:	e8 33 41 00 00       	call   6678 <exit>
+  }
+
+  for(i = 0; i < n; i++){
+    2545:	83 c6 01             	add    $0x1,%esi
+    2548:	39 de                	cmp    %ebx,%esi
+    254a:	7d 7d                	jge    25c9 <dirfull+0x1f4>
+    name[4] = 'a' + i/26/26;
+    254c:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+    2551:	89 f0                	mov    %esi,%eax
+    2553:	f7 ea                	imul   %edx
+    2555:	c1 fa 08             	sar    $0x8,%edx
+    2558:	89 f7                	mov    %esi,%edi
+    255a:	c1 ff 1f             	sar    $0x1f,%edi
+    255d:	29 fa                	sub    %edi,%edx
+    255f:	83 c2 61             	add    $0x61,%edx
+    2562:	88 55 dc             	mov    %dl,-0x24(%ebp)
+    name[5] = 'a' + i/26%26;
+    2565:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    256a:	f7 ee                	imul   %esi
+    256c:	89 d1                	mov    %edx,%ecx
+    256e:	c1 f9 03             	sar    $0x3,%ecx
+    2571:	29 f9                	sub    %edi,%ecx
+    2573:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    2578:	f7 e9                	imul   %ecx
+    257a:	c1 fa 03             	sar    $0x3,%edx
+    257d:	89 c8                	mov    %ecx,%eax
+    257f:	c1 f8 1f             	sar    $0x1f,%eax
+    2582:	29 c2                	sub    %eax,%edx
+    2584:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    2587:	89 ca                	mov    %ecx,%edx
+    2589:	29 c2                	sub    %eax,%edx
+    258b:	83 c2 61             	add    $0x61,%edx
+    258e:	88 55 dd             	mov    %dl,-0x23(%ebp)
+    name[6] = 'a' + i%26;
+    2591:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    2594:	89 f0                	mov    %esi,%eax
+    2596:	29 c8                	sub    %ecx,%eax
+    2598:	83 c0 61             	add    $0x61,%eax
+    259b:	88 45 de             	mov    %al,-0x22(%ebp)
+    if(unlink(name) != 0){
+    259e:	83 ec 0c             	sub    $0xc,%esp
+    25a1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    25a4:	50                   	push   %eax
+    25a5:	e8 1e 41 00 00       	call   66c8 <unlink>
+    25aa:	83 c4 10             	add    $0x10,%esp
+    25ad:	85 c0                	test   %eax,%eax
+    25af:	74 94                	je     2545 <dirfull+0x170>
+      printf(1, "dirfull unlink %s failed\n", name);
+    25b1:	83 ec 04             	sub    $0x4,%esp
+    25b4:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    25b7:	50                   	push   %eax
+    25b8:	68 c3 74 00 00       	push   $0x74c3
+    25bd:	6a 01                	push   $0x1
+    25bf:	e8 91 42 00 00       	call   6855 <printf>
+      exit();
+    25c4:	e8 af 40 00 00       	call   6678 <exit>
+    }
+  }
+  if(unlink("df/f") != 0 || unlink("df") != 0){
+    25c9:	83 ec 0c             	sub    $0xc,%esp
+    25cc:	68 a2 74 00 00       	push   $0x74a2
+    25d1:	e8 f2 40 00 00       	call   66c8 <unlink>
+    25d6:	83 c4 10             	add    $0x10,%esp
+    25d9:	85 c0                	test   %eax,%eax
+    25db:	75 2e                	jne    260b <dirfull+0x236>
+    25dd:	83 ec 0c             	sub    $0xc,%esp
+    25e0:	68 89 74 00 00       	push   $0x7489
+    25e5:	e8 de 40 00 00       	call   66c8 <unlink>
+    25ea:	83 c4 10             	add    $0x10,%esp
+    25ed:	85 c0                	test   %eax,%eax
+    25ef:	75 1a                	jne    260b <dirfull+0x236>
+    printf(1, "dirfull cleanup failed\n");
+    exit();
+  }
+  printf(1, "dirfull ok\n");
+    25f1:	83 ec 08             	sub    $0x8,%esp
+    25f4:	68 f5 74 00 00       	push   $0x74f5
+    25f9:	6a 01                	push   $0x1
+    25fb:	e8 55 42 00 00       	call   6855 <printf>
+}
+    2600:	83 c4 10             	add    $0x10,%esp
+    2603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2606:	5b                   	pop    %ebx
+    2607:	5e                   	pop    %esi
+    2608:	5f                   	pop    %edi
+    2609:	5d                   	pop    %ebp
+    260a:	c3                   	ret
+    printf(1, "dirfull cleanup failed\n");
+    260b:	83 ec 08             	sub    $0x8,%esp
+    260e:	68 dd 74 00 00       	push   $0x74dd
+    2613:	6a 01                	push   $0x1
+    2615:	e8 3b 42 00 00       	call   6855 <printf>
+    exit();
+    261a:	e8 59 40 00 00       	call   6678 <exit>
+
+0000261f <subdir>:
+
+void
+subdir(void)
+{
+    261f:	55                   	push   %ebp
+    2620:	89 e5                	mov    %esp,%ebp
+    2622:	53                   	push   %ebx
+    2623:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    2626:	68 01 75 00 00       	push   $0x7501
+    262b:	6a 01                	push   $0x1
+    262d:	e8 23 42 00 00       	call   6855 <printf>
+
+  unlink("ff");
+    2632:	c7 04 24 8a 75 00 00 	movl   $0x758a,(%esp)
+    2639:	e8 8a 40 00 00       	call   66c8 <unlink>
+  if(mkdir("dd") != 0){
+    263e:	c7 04 24 27 76 00 00 	movl   $0x7627,(%esp)
+    2645:	e8 96 40 00 00       	call   66e0 <mkdir>
+    264a:	83 c4 10             	add    $0x10,%esp
+    264d:	85 c0                	test   %eax,%eax
+    264f:	0f 85 14 04 00 00    	jne    2a69 <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2655:	83 ec 08             	sub    $0x8,%esp
+    2658:	68 02 02 00 00       	push   $0x202
+    265d:	68 60 75 00 00       	push   $0x7560
+    2662:	e8 51 40 00 00       	call   66b8 <open>
+    2667:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2669:	83 c4 10             	add    $0x10,%esp
+    266c:	85 c0                	test   %eax,%eax
+    266e:	0f 88 09 04 00 00    	js     2a7d <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    2674:	83 ec 04             	sub    $0x4,%esp
+    2677:	6a 02                	push   $0x2
+    2679:	68 8a 75 00 00       	push   $0x758a
+    267e:	50                   	push   %eax
+    267f:	e8 14 40 00 00       	call   6698 <write>
+  close(fd);
+    2684:	89 1c 24             	mov    %ebx,(%esp)
+    2687:	e8 14 40 00 00       	call   66a0 <close>
+
+  if(unlink("dd") >= 0){
+    268c:	c7 04 24 27 76 00 00 	movl   $0x7627,(%esp)
+    2693:	e8 30 40 00 00       	call   66c8 <unlink>
+    2698:	83 c4 10             	add    $0x10,%esp
+    269b:	85 c0                	test   %eax,%eax
+    269d:	0f 89 ee 03 00 00    	jns    2a91 <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    26a3:	83 ec 0c             	sub    $0xc,%esp
+    26a6:	68 3b 75 00 00       	push   $0x753b
+    26ab:	e8 30 40 00 00       	call   66e0 <mkdir>
+    26b0:	83 c4 10             	add    $0x10,%esp
+    26b3:	85 c0                	test   %eax,%eax
+    26b5:	0f 85 ea 03 00 00    	jne    2aa5 <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    26bb:	83 ec 08             	sub    $0x8,%esp
+    26be:	68 02 02 00 00       	push   $0x202
+    26c3:	68 5d 75 00 00       	push   $0x755d
+    26c8:	e8 eb 3f 00 00       	call   66b8 <open>
+    26cd:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    26cf:	83 c4 10             	add    $0x10,%esp
+    26d2:	85 c0                	test   %eax,%eax
+    26d4:	0f 88 df 03 00 00    	js     2ab9 <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    26da:	83 ec 04             	sub    $0x4,%esp
+    26dd:	6a 02                	push   $0x2
+    26df:	68 7e 75 00 00       	push   $0x757e
+    26e4:	50                   	push   %eax
+    26e5:	e8 ae 3f 00 00       	call   6698 <write>
+  close(fd);
+    26ea:	89 1c 24             	mov    %ebx,(%esp)
+    26ed:	e8 ae 3f 00 00       	call   66a0 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    26f2:	83 c4 08             	add    $0x8,%esp
+    26f5:	6a 00                	push   $0x0
+    26f7:	68 81 75 00 00       	push   $0x7581
+    26fc:	e8 b7 3f 00 00       	call   66b8 <open>
+    2701:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2703:	83 c4 10             	add    $0x10,%esp
+    2706:	85 c0                	test   %eax,%eax
+    2708:	0f 88 bf 03 00 00    	js     2acd <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    270e:	83 ec 04             	sub    $0x4,%esp
+    2711:	68 00 20 00 00       	push   $0x2000
+    2716:	68 e0 c7 00 00       	push   $0xc7e0
+    271b:	50                   	push   %eax
+    271c:	e8 6f 3f 00 00       	call   6690 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2721:	83 c4 10             	add    $0x10,%esp
+    2724:	83 f8 02             	cmp    $0x2,%eax
+    2727:	0f 85 b4 03 00 00    	jne    2ae1 <subdir+0x4c2>
+    272d:	80 3d e0 c7 00 00 66 	cmpb   $0x66,0xc7e0
+    2734:	0f 85 a7 03 00 00    	jne    2ae1 <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    273a:	83 ec 0c             	sub    $0xc,%esp
+    273d:	53                   	push   %ebx
+    273e:	e8 5d 3f 00 00       	call   66a0 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2743:	83 c4 08             	add    $0x8,%esp
+    2746:	68 c1 75 00 00       	push   $0x75c1
+    274b:	68 5d 75 00 00       	push   $0x755d
+    2750:	e8 83 3f 00 00       	call   66d8 <link>
+    2755:	83 c4 10             	add    $0x10,%esp
+    2758:	85 c0                	test   %eax,%eax
+    275a:	0f 85 95 03 00 00    	jne    2af5 <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    2760:	83 ec 0c             	sub    $0xc,%esp
+    2763:	68 5d 75 00 00       	push   $0x755d
+    2768:	e8 5b 3f 00 00       	call   66c8 <unlink>
+    276d:	83 c4 10             	add    $0x10,%esp
+    2770:	85 c0                	test   %eax,%eax
+    2772:	0f 85 91 03 00 00    	jne    2b09 <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2778:	83 ec 08             	sub    $0x8,%esp
+    277b:	6a 00                	push   $0x0
+    277d:	68 5d 75 00 00       	push   $0x755d
+    2782:	e8 31 3f 00 00       	call   66b8 <open>
+    2787:	83 c4 10             	add    $0x10,%esp
+    278a:	85 c0                	test   %eax,%eax
+    278c:	0f 89 8b 03 00 00    	jns    2b1d <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    2792:	83 ec 0c             	sub    $0xc,%esp
+    2795:	68 27 76 00 00       	push   $0x7627
+    279a:	e8 49 3f 00 00       	call   66e8 <chdir>
+    279f:	83 c4 10             	add    $0x10,%esp
+    27a2:	85 c0                	test   %eax,%eax
+    27a4:	0f 85 87 03 00 00    	jne    2b31 <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    27aa:	83 ec 0c             	sub    $0xc,%esp
+    27ad:	68 f5 75 00 00       	push   $0x75f5
+    27b2:	e8 31 3f 00 00       	call   66e8 <chdir>
+    27b7:	83 c4 10             	add    $0x10,%esp
+    27ba:	85 c0                	test   %eax,%eax
+    27bc:	0f 85 83 03 00 00    	jne    2b45 <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    27c2:	83 ec 0c             	sub    $0xc,%esp
+    27c5:	68 1b 76 00 00       	push   $0x761b
+    27ca:	e8 19 3f 00 00       	call   66e8 <chdir>
+    27cf:	83 c4 10             	add    $0x10,%esp
+    27d2:	85 c0                	test   %eax,%eax
+    27d4:	0f 85 7f 03 00 00    	jne    2b59 <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    27da:	83 ec 0c             	sub    $0xc,%esp
+    27dd:	68 2a 76 00 00       	push   $0x762a
+    27e2:	e8 01 3f 00 00       	call   66e8 <chdir>
+    27e7:	83 c4 10             	add    $0x10,%esp
+    27ea:	85 c0                	test   %eax,%eax
+    27ec:	0f 85 7b 03 00 00    	jne    2b6d <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    27f2:	83 ec 08             	sub    $0x8,%esp
+    27f5:	6a 00                	push   $0x0
+    27f7:	68 c1 75 00 00       	push   $0x75c1
+    27fc:	e8 b7 3e 00 00       	call   66b8 <open>
+    2801:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2803:	83 c4 10             	add    $0x10,%esp
+    2806:	85 c0                	test   %eax,%eax
+    2808:	0f 88 73 03 00 00    	js     2b81 <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    280e:	83 ec 04             	sub    $0x4,%esp
+    2811:	68 00 20 00 00       	push   $0x2000
+    2816:	68 e0 c7 00 00       	push   $0xc7e0
+    281b:	50                   	push   %eax
+    281c:	e8 6f 3e 00 00       	call   6690 <read>
+    2821:	83 c4 10             	add    $0x10,%esp
+    2824:	83 f8 02             	cmp    $0x2,%eax
+    2827:	0f 85 68 03 00 00    	jne    2b95 <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    282d:	83 ec 0c             	sub    $0xc,%esp
+    2830:	53                   	push   %ebx
+    2831:	e8 6a 3e 00 00       	call   66a0 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2836:	83 c4 08             	add    $0x8,%esp
+    2839:	6a 00                	push   $0x0
+    283b:	68 5d 75 00 00       	push   $0x755d
+    2840:	e8 73 3e 00 00       	call   66b8 <open>
+    2845:	83 c4 10             	add    $0x10,%esp
+    2848:	85 c0                	test   %eax,%eax
+    284a:	0f 89 59 03 00 00    	jns    2ba9 <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2850:	83 ec 08             	sub    $0x8,%esp
+    2853:	68 02 02 00 00       	push   $0x202
+    2858:	68 75 76 00 00       	push   $0x7675
+    285d:	e8 56 3e 00 00       	call   66b8 <open>
+    2862:	83 c4 10             	add    $0x10,%esp
+    2865:	85 c0                	test   %eax,%eax
+    2867:	0f 89 50 03 00 00    	jns    2bbd <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    286d:	83 ec 08             	sub    $0x8,%esp
+    2870:	68 02 02 00 00       	push   $0x202
+    2875:	68 9a 76 00 00       	push   $0x769a
+    287a:	e8 39 3e 00 00       	call   66b8 <open>
+    287f:	83 c4 10             	add    $0x10,%esp
+    2882:	85 c0                	test   %eax,%eax
+    2884:	0f 89 47 03 00 00    	jns    2bd1 <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    288a:	83 ec 08             	sub    $0x8,%esp
+    288d:	68 00 02 00 00       	push   $0x200
+    2892:	68 27 76 00 00       	push   $0x7627
+    2897:	e8 1c 3e 00 00       	call   66b8 <open>
+    289c:	83 c4 10             	add    $0x10,%esp
+    289f:	85 c0                	test   %eax,%eax
+    28a1:	0f 89 3e 03 00 00    	jns    2be5 <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    28a7:	83 ec 08             	sub    $0x8,%esp
+    28aa:	6a 02                	push   $0x2
+    28ac:	68 27 76 00 00       	push   $0x7627
+    28b1:	e8 02 3e 00 00       	call   66b8 <open>
+    28b6:	83 c4 10             	add    $0x10,%esp
+    28b9:	85 c0                	test   %eax,%eax
+    28bb:	0f 89 38 03 00 00    	jns    2bf9 <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    28c1:	83 ec 08             	sub    $0x8,%esp
+    28c4:	6a 01                	push   $0x1
+    28c6:	68 27 76 00 00       	push   $0x7627
+    28cb:	e8 e8 3d 00 00       	call   66b8 <open>
+    28d0:	83 c4 10             	add    $0x10,%esp
+    28d3:	85 c0                	test   %eax,%eax
+    28d5:	0f 89 32 03 00 00    	jns    2c0d <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    28db:	83 ec 08             	sub    $0x8,%esp
+    28de:	68 09 77 00 00       	push   $0x7709
+    28e3:	68 75 76 00 00       	push   $0x7675
+    28e8:	e8 eb 3d 00 00       	call   66d8 <link>
+    28ed:	83 c4 10             	add    $0x10,%esp
+    28f0:	85 c0                	test   %eax,%eax
+    28f2:	0f 84 29 03 00 00    	je     2c21 <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    28f8:	83 ec 08             	sub    $0x8,%esp
+    28fb:	68 09 77 00 00       	push   $0x7709
+    2900:	68 9a 76 00 00       	push   $0x769a
+    2905:	e8 ce 3d 00 00       	call   66d8 <link>
+    290a:	83 c4 10             	add    $0x10,%esp
+    290d:	85 c0                	test   %eax,%eax
+    290f:	0f 84 20 03 00 00    	je     2c35 <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2915:	83 ec 08             	sub    $0x8,%esp
+    2918:	68 c1 75 00 00       	push   $0x75c1
+    291d:	68 60 75 00 00       	push   $0x7560
+    2922:	e8 b1 3d 00 00       	call   66d8 <link>
+    2927:	83 c4 10             	add    $0x10,%esp
+    292a:	85 c0                	test   %eax,%eax
+    292c:	0f 84 17 03 00 00    	je     2c49 <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    2932:	83 ec 0c             	sub    $0xc,%esp
+    2935:	68 75 76 00 00       	push   $0x7675
+    293a:	e8 a1 3d 00 00       	call   66e0 <mkdir>
+    293f:	83 c4 10             	add    $0x10,%esp
+    2942:	85 c0                	test   %eax,%eax
+    2944:	0f 84 13 03 00 00    	je     2c5d <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    294a:	83 ec 0c             	sub    $0xc,%esp
+    294d:	68 9a 76 00 00       	push   $0x769a
+    2952:	e8 89 3d 00 00       	call   66e0 <mkdir>
+    2957:	83 c4 10             	add    $0x10,%esp
+    295a:	85 c0                	test   %eax,%eax
+    295c:	0f 84 0f 03 00 00    	je     2c71 <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    2962:	83 ec 0c             	sub    $0xc,%esp
+    2965:	68 c1 75 00 00       	push   $0x75c1
+    296a:	e8 71 3d 00 00       	call   66e0 <mkdir>
+    296f:	83 c4 10             	add    $0x10,%esp
+    2972:	85 c0                	test   %eax,%eax
+    2974:	0f 84 0b 03 00 00    	je     2c85 <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    297a:	83 ec 0c             	sub    $0xc,%esp
+    297d:	68 9a 76 00 00       	push   $0x769a
+    2982:	e8 41 3d 00 00       	call   66c8 <unlink>
+    2987:	83 c4 10             	add    $0x10,%esp
+    298a:	85 c0                	test   %eax,%eax
+    298c:	0f 84 07 03 00 00    	je     2c99 <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    2992:	83 ec 0c             	sub    $0xc,%esp
+    2995:	68 75 76 00 00       	push   $0x7675
+    299a:	e8 29 3d 00 00       	call   66c8 <unlink>
+    299f:	83 c4 10             	add    $0x10,%esp
+    29a2:	85 c0                	test   %eax,%eax
+    29a4:	0f 84 03 03 00 00    	je     2cad <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    29aa:	83 ec 0c             	sub    $0xc,%esp
+    29ad:	68 60 75 00 00       	push   $0x7560
+    29b2:	e8 31 3d 00 00       	call   66e8 <chdir>
+    29b7:	83 c4 10             	add    $0x10,%esp
+    29ba:	85 c0                	test   %eax,%eax
+    29bc:	0f 84 ff 02 00 00    	je     2cc1 <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    29c2:	83 ec 0c             	sub    $0xc,%esp
+    29c5:	68 0c 77 00 00       	push   $0x770c
+    29ca:	e8 19 3d 00 00       	call   66e8 <chdir>
+    29cf:	83 c4 10             	add    $0x10,%esp
+    29d2:	85 c0                	test   %eax,%eax
+    29d4:	0f 84 fb 02 00 00    	je     2cd5 <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    29da:	83 ec 0c             	sub    $0xc,%esp
+    29dd:	68 c1 75 00 00       	push   $0x75c1
+    29e2:	e8 e1 3c 00 00       	call   66c8 <unlink>
+    29e7:	83 c4 10             	add    $0x10,%esp
+    29ea:	85 c0                	test   %eax,%eax
+    29ec:	0f 85 f7 02 00 00    	jne    2ce9 <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    29f2:	83 ec 0c             	sub    $0xc,%esp
+    29f5:	68 60 75 00 00       	push   $0x7560
+    29fa:	e8 c9 3c 00 00       	call   66c8 <unlink>
+    29ff:	83 c4 10             	add    $0x10,%esp
+    2a02:	85 c0                	test   %eax,%eax
+    2a04:	0f 85 f3 02 00 00    	jne    2cfd <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    2a0a:	83 ec 0c             	sub    $0xc,%esp
+    2a0d:	68 27 76 00 00       	push   $0x7627
+    2a12:	e8 b1 3c 00 00       	call   66c8 <unlink>
+    2a17:	83 c4 10             	add    $0x10,%esp
+    2a1a:	85 c0                	test   %eax,%eax
+    2a1c:	0f 84 ef 02 00 00    	je     2d11 <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    2a22:	83 ec 0c             	sub    $0xc,%esp
+    2a25:	68 3c 75 00 00       	push   $0x753c
+    2a2a:	e8 99 3c 00 00       	call   66c8 <unlink>
+    2a2f:	83 c4 10             	add    $0x10,%esp
+    2a32:	85 c0                	test   %eax,%eax
+    2a34:	0f 88 eb 02 00 00    	js     2d25 <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    2a3a:	83 ec 0c             	sub    $0xc,%esp
+    2a3d:	68 27 76 00 00       	push   $0x7627
+    2a42:	e8 81 3c 00 00       	call   66c8 <unlink>
+    2a47:	83 c4 10             	add    $0x10,%esp
+    2a4a:	85 c0                	test   %eax,%eax
+    2a4c:	0f 88 e7 02 00 00    	js     2d39 <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    2a52:	83 ec 08             	sub    $0x8,%esp
+    2a55:	68 09 78 00 00       	push   $0x7809
+    2a5a:	6a 01                	push   $0x1
+    2a5c:	e8 f4 3d 00 00       	call   6855 <printf>
+}
+    2a61:	83 c4 10             	add    $0x10,%esp
+    2a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2a67:	c9                   	leave
+    2a68:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    2a69:	83 ec 08             	sub    $0x8,%esp
+    2a6c:	68 0e 75 00 00       	push   $0x750e
+    2a71:	6a 01                	push   $0x1
+    2a73:	e8 dd 3d 00 00       	call   6855 <printf>
+    exit();
+    2a78:	e8 fb 3b 00 00       	call   6678 <exit>
+    printf(1, "create dd/ff failed\n");
+    2a7d:	83 ec 08             	sub    $0x8,%esp
+    2a80:	68 26 75 00 00       	push   $0x7526
+    2a85:	6a 01                	push   $0x1
+    2a87:	e8 c9 3d 00 00       	call   6855 <printf>
+    exit();
+    2a8c:	e8 e7 3b 00 00       	call   6678 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2a91:	83 ec 08             	sub    $0x8,%esp
+    2a94:	68 f8 88 00 00       	push   $0x88f8
+    2a99:	6a 01                	push   $0x1
+    2a9b:	e8 b5 3d 00 00       	call   6855 <printf>
+    exit();
+    2aa0:	e8 d3 3b 00 00       	call   6678 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2aa5:	83 ec 08             	sub    $0x8,%esp
+    2aa8:	68 42 75 00 00       	push   $0x7542
+    2aad:	6a 01                	push   $0x1
+    2aaf:	e8 a1 3d 00 00       	call   6855 <printf>
+    exit();
+    2ab4:	e8 bf 3b 00 00       	call   6678 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    2ab9:	83 ec 08             	sub    $0x8,%esp
+    2abc:	68 66 75 00 00       	push   $0x7566
+    2ac1:	6a 01                	push   $0x1
+    2ac3:	e8 8d 3d 00 00       	call   6855 <printf>
+    exit();
+    2ac8:	e8 ab 3b 00 00       	call   6678 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    2acd:	83 ec 08             	sub    $0x8,%esp
+    2ad0:	68 8d 75 00 00       	push   $0x758d
+    2ad5:	6a 01                	push   $0x1
+    2ad7:	e8 79 3d 00 00       	call   6855 <printf>
+    exit();
+    2adc:	e8 97 3b 00 00       	call   6678 <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    2ae1:	83 ec 08             	sub    $0x8,%esp
+    2ae4:	68 a6 75 00 00       	push   $0x75a6
+    2ae9:	6a 01                	push   $0x1
+    2aeb:	e8 65 3d 00 00       	call   6855 <printf>
+    exit();
+    2af0:	e8 83 3b 00 00       	call   6678 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2af5:	83 ec 08             	sub    $0x8,%esp
+    2af8:	68 20 89 00 00       	push   $0x8920
+    2afd:	6a 01                	push   $0x1
+    2aff:	e8 51 3d 00 00       	call   6855 <printf>
+    exit();
+    2b04:	e8 6f 3b 00 00       	call   6678 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2b09:	83 ec 08             	sub    $0x8,%esp
+    2b0c:	68 cc 75 00 00       	push   $0x75cc
+    2b11:	6a 01                	push   $0x1
+    2b13:	e8 3d 3d 00 00       	call   6855 <printf>
+    exit();
+    2b18:	e8 5b 3b 00 00       	call   6678 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2b1d:	83 ec 08             	sub    $0x8,%esp
+    2b20:	68 44 89 00 00       	push   $0x8944
+    2b25:	6a 01                	push   $0x1
+    2b27:	e8 29 3d 00 00       	call   6855 <printf>
+    exit();
+    2b2c:	e8 47 3b 00 00       	call   6678 <exit>
+    printf(1, "chdir dd failed\n");
+    2b31:	83 ec 08             	sub    $0x8,%esp
+    2b34:	68 e4 75 00 00       	push   $0x75e4
+    2b39:	6a 01                	push   $0x1
+    2b3b:	e8 15 3d 00 00       	call   6855 <printf>
+    exit();
+    2b40:	e8 33 3b 00 00       	call   6678 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2b45:	83 ec 08             	sub    $0x8,%esp
+    2b48:	68 01 76 00 00       	push   $0x7601
+    2b4d:	6a 01                	push   $0x1
+    2b4f:	e8 01 3d 00 00       	call   6855 <printf>
+    exit();
+    2b54:	e8 1f 3b 00 00       	call   6678 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2b59:	83 ec 08             	sub    $0x8,%esp
+    2b5c:	68 01 76 00 00       	push   $0x7601
+    2b61:	6a 01                	push   $0x1
+    2b63:	e8 ed 3c 00 00       	call   6855 <printf>
+    exit();
+    2b68:	e8 0b 3b 00 00       	call   6678 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2b6d:	83 ec 08             	sub    $0x8,%esp
+    2b70:	68 2f 76 00 00       	push   $0x762f
+    2b75:	6a 01                	push   $0x1
+    2b77:	e8 d9 3c 00 00       	call   6855 <printf>
+    exit();
+    2b7c:	e8 f7 3a 00 00       	call   6678 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    2b81:	83 ec 08             	sub    $0x8,%esp
+    2b84:	68 42 76 00 00       	push   $0x7642
+    2b89:	6a 01                	push   $0x1
+    2b8b:	e8 c5 3c 00 00       	call   6855 <printf>
+    exit();
+    2b90:	e8 e3 3a 00 00       	call   6678 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    2b95:	83 ec 08             	sub    $0x8,%esp
+    2b98:	68 5a 76 00 00       	push   $0x765a
+    2b9d:	6a 01                	push   $0x1
+    2b9f:	e8 b1 3c 00 00       	call   6855 <printf>
+    exit();
+    2ba4:	e8 cf 3a 00 00       	call   6678 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2ba9:	83 ec 08             	sub    $0x8,%esp
+    2bac:	68 68 89 00 00       	push   $0x8968
+    2bb1:	6a 01                	push   $0x1
+    2bb3:	e8 9d 3c 00 00       	call   6855 <printf>
+    exit();
+    2bb8:	e8 bb 3a 00 00       	call   6678 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2bbd:	83 ec 08             	sub    $0x8,%esp
+    2bc0:	68 7e 76 00 00       	push   $0x767e
+    2bc5:	6a 01                	push   $0x1
+    2bc7:	e8 89 3c 00 00       	call   6855 <printf>
+    exit();
+    2bcc:	e8 a7 3a 00 00       	call   6678 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2bd1:	83 ec 08             	sub    $0x8,%esp
+    2bd4:	68 a3 76 00 00       	push   $0x76a3
+    2bd9:	6a 01                	push   $0x1
+    2bdb:	e8 75 3c 00 00       	call   6855 <printf>
+    exit();
+    2be0:	e8 93 3a 00 00       	call   6678 <exit>
+    printf(1, "create dd succeeded!\n");
+    2be5:	83 ec 08             	sub    $0x8,%esp
+    2be8:	68 bf 76 00 00       	push   $0x76bf
+    2bed:	6a 01                	push   $0x1
+    2bef:	e8 61 3c 00 00       	call   6855 <printf>
+    exit();
+    2bf4:	e8 7f 3a 00 00       	call   6678 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2bf9:	83 ec 08             	sub    $0x8,%esp
+    2bfc:	68 d5 76 00 00       	push   $0x76d5
+    2c01:	6a 01                	push   $0x1
+    2c03:	e8 4d 3c 00 00       	call   6855 <printf>
+    exit();
+    2c08:	e8 6b 3a 00 00       	call   6678 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    2c0d:	83 ec 08             	sub    $0x8,%esp
+    2c10:	68 ee 76 00 00       	push   $0x76ee
+    2c15:	6a 01                	push   $0x1
+    2c17:	e8 39 3c 00 00       	call   6855 <printf>
+    exit();
+    2c1c:	e8 57 3a 00 00       	call   6678 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    2c21:	83 ec 08             	sub    $0x8,%esp
+    2c24:	68 90 89 00 00       	push   $0x8990
+    2c29:	6a 01                	push   $0x1
+    2c2b:	e8 25 3c 00 00       	call   6855 <printf>
+    exit();
+    2c30:	e8 43 3a 00 00       	call   6678 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2c35:	83 ec 08             	sub    $0x8,%esp
+    2c38:	68 b4 89 00 00       	push   $0x89b4
+    2c3d:	6a 01                	push   $0x1
+    2c3f:	e8 11 3c 00 00       	call   6855 <printf>
+    exit();
+    2c44:	e8 2f 3a 00 00       	call   6678 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2c49:	83 ec 08             	sub    $0x8,%esp
+    2c4c:	68 d8 89 00 00       	push   $0x89d8
+    2c51:	6a 01                	push   $0x1
+    2c53:	e8 fd 3b 00 00       	call   6855 <printf>
+    exit();
+    2c58:	e8 1b 3a 00 00       	call   6678 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2c5d:	83 ec 08             	sub    $0x8,%esp
+    2c60:	68 12 77 00 00       	push   $0x7712
+    2c65:	6a 01                	push   $0x1
+    2c67:	e8 e9 3b 00 00       	call   6855 <printf>
+    exit();
+    2c6c:	e8 07 3a 00 00       	call   6678 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2c71:	83 ec 08             	sub    $0x8,%esp
+    2c74:	68 2d 77 00 00       	push   $0x772d
+    2c79:	6a 01                	push   $0x1
+    2c7b:	e8 d5 3b 00 00       	call   6855 <printf>
+    exit();
+    2c80:	e8 f3 39 00 00       	call   6678 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2c85:	83 ec 08             	sub    $0x8,%esp
+    2c88:	68 48 77 00 00       	push   $0x7748
+    2c8d:	6a 01                	push   $0x1
+    2c8f:	e8 c1 3b 00 00       	call   6855 <printf>
+    exit();
+    2c94:	e8 df 39 00 00       	call   6678 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2c99:	83 ec 08             	sub    $0x8,%esp
+    2c9c:	68 65 77 00 00       	push   $0x7765
+    2ca1:	6a 01                	push   $0x1
+    2ca3:	e8 ad 3b 00 00       	call   6855 <printf>
+    exit();
+    2ca8:	e8 cb 39 00 00       	call   6678 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2cad:	83 ec 08             	sub    $0x8,%esp
+    2cb0:	68 81 77 00 00       	push   $0x7781
+    2cb5:	6a 01                	push   $0x1
+    2cb7:	e8 99 3b 00 00       	call   6855 <printf>
+    exit();
+    2cbc:	e8 b7 39 00 00       	call   6678 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2cc1:	83 ec 08             	sub    $0x8,%esp
+    2cc4:	68 9d 77 00 00       	push   $0x779d
+    2cc9:	6a 01                	push   $0x1
+    2ccb:	e8 85 3b 00 00       	call   6855 <printf>
+    exit();
+    2cd0:	e8 a3 39 00 00       	call   6678 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2cd5:	83 ec 08             	sub    $0x8,%esp
+    2cd8:	68 b5 77 00 00       	push   $0x77b5
+    2cdd:	6a 01                	push   $0x1
+    2cdf:	e8 71 3b 00 00       	call   6855 <printf>
+    exit();
+    2ce4:	e8 8f 39 00 00       	call   6678 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2ce9:	83 ec 08             	sub    $0x8,%esp
+    2cec:	68 cc 75 00 00       	push   $0x75cc
+    2cf1:	6a 01                	push   $0x1
+    2cf3:	e8 5d 3b 00 00       	call   6855 <printf>
+    exit();
+    2cf8:	e8 7b 39 00 00       	call   6678 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2cfd:	83 ec 08             	sub    $0x8,%esp
+    2d00:	68 cd 77 00 00       	push   $0x77cd
+    2d05:	6a 01                	push   $0x1
+    2d07:	e8 49 3b 00 00       	call   6855 <printf>
+    exit();
+    2d0c:	e8 67 39 00 00       	call   6678 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2d11:	83 ec 08             	sub    $0x8,%esp
+    2d14:	68 fc 89 00 00       	push   $0x89fc
+    2d19:	6a 01                	push   $0x1
+    2d1b:	e8 35 3b 00 00       	call   6855 <printf>
+    exit();
+    2d20:	e8 53 39 00 00       	call   6678 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    2d25:	83 ec 08             	sub    $0x8,%esp
+    2d28:	68 e2 77 00 00       	push   $0x77e2
+    2d2d:	6a 01                	push   $0x1
+    2d2f:	e8 21 3b 00 00       	call   6855 <printf>
+    exit();
+    2d34:	e8 3f 39 00 00       	call   6678 <exit>
+    printf(1, "unlink dd failed\n");
+    2d39:	83 ec 08             	sub    $0x8,%esp
+    2d3c:	68 f7 77 00 00       	push   $0x77f7
+    2d41:	6a 01                	push   $0x1
+    2d43:	e8 0d 3b 00 00       	call   6855 <printf>
+    exit();
+    2d48:	e8 2b 39 00 00       	call   6678 <exit>
+
+00002d4d <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2d4d:	55                   	push   %ebp
+    2d4e:	89 e5                	mov    %esp,%ebp
+    2d50:	57                   	push   %edi
+    2d51:	56                   	push   %esi
+    2d52:	53                   	push   %ebx
+    2d53:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    2d56:	68 14 78 00 00       	push   $0x7814
+    2d5b:	6a 01                	push   $0x1
+    2d5d:	e8 f3 3a 00 00       	call   6855 <printf>
+
+  unlink("bigwrite");
+    2d62:	c7 04 24 23 78 00 00 	movl   $0x7823,(%esp)
+    2d69:	e8 5a 39 00 00       	call   66c8 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2d6e:	83 c4 10             	add    $0x10,%esp
+    2d71:	be f3 01 00 00       	mov    $0x1f3,%esi
+    2d76:	eb 45                	jmp    2dbd <bigwrite+0x70>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "cannot create bigwrite\n");
+    2d78:	83 ec 08             	sub    $0x8,%esp
+    2d7b:	68 2c 78 00 00       	push   $0x782c
+    2d80:	6a 01                	push   $0x1
+    2d82:	e8 ce 3a 00 00       	call   6855 <printf>
+      exit();
+    2d87:	e8 ec 38 00 00       	call   6678 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+      if(cc != sz){
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2d8c:	50                   	push   %eax
+    2d8d:	56                   	push   %esi
+    2d8e:	68 44 78 00 00       	push   $0x7844
+    2d93:	6a 01                	push   $0x1
+    2d95:	e8 bb 3a 00 00       	call   6855 <printf>
+        exit();
+    2d9a:	e8 d9 38 00 00       	call   6678 <exit>
+      }
+    }
+    close(fd);
+    2d9f:	83 ec 0c             	sub    $0xc,%esp
+    2da2:	57                   	push   %edi
+    2da3:	e8 f8 38 00 00       	call   66a0 <close>
+    unlink("bigwrite");
+    2da8:	c7 04 24 23 78 00 00 	movl   $0x7823,(%esp)
+    2daf:	e8 14 39 00 00       	call   66c8 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2db4:	81 c6 d7 01 00 00    	add    $0x1d7,%esi
+    2dba:	83 c4 10             	add    $0x10,%esp
+    2dbd:	81 fe ff 17 00 00    	cmp    $0x17ff,%esi
+    2dc3:	7f 40                	jg     2e05 <bigwrite+0xb8>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2dc5:	83 ec 08             	sub    $0x8,%esp
+    2dc8:	68 02 02 00 00       	push   $0x202
+    2dcd:	68 23 78 00 00       	push   $0x7823
+    2dd2:	e8 e1 38 00 00       	call   66b8 <open>
+    2dd7:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    2dd9:	83 c4 10             	add    $0x10,%esp
+    2ddc:	85 c0                	test   %eax,%eax
+    2dde:	78 98                	js     2d78 <bigwrite+0x2b>
+    for(i = 0; i < 2; i++){
+    2de0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2de5:	83 fb 01             	cmp    $0x1,%ebx
+    2de8:	7f b5                	jg     2d9f <bigwrite+0x52>
+      int cc = write(fd, buf, sz);
+    2dea:	83 ec 04             	sub    $0x4,%esp
+    2ded:	56                   	push   %esi
+    2dee:	68 e0 c7 00 00       	push   $0xc7e0
+    2df3:	57                   	push   %edi
+    2df4:	e8 9f 38 00 00       	call   6698 <write>
+      if(cc != sz){
+    2df9:	83 c4 10             	add    $0x10,%esp
+    2dfc:	39 c6                	cmp    %eax,%esi
+    2dfe:	75 8c                	jne    2d8c <bigwrite+0x3f>
+    for(i = 0; i < 2; i++){
+    2e00:	83 c3 01             	add    $0x1,%ebx
+    2e03:	eb e0                	jmp    2de5 <bigwrite+0x98>
+  }
+
+  printf(1, "bigwrite ok\n");
+    2e05:	83 ec 08             	sub    $0x8,%esp
+    2e08:	68 56 78 00 00       	push   $0x7856
+    2e0d:	6a 01                	push   $0x1
+    2e0f:	e8 41 3a 00 00       	call   6855 <printf>
+}
+    2e14:	83 c4 10             	add    $0x10,%esp
+    2e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2e1a:	5b                   	pop    %ebx
+    2e1b:	5e                   	pop    %esi
+    2e1c:	5f                   	pop    %edi
+    2e1d:	5d                   	pop    %ebp
+    2e1e:	c3                   	ret
+
+00002e1f <bigfile>:
+
+void
+bigfile(void)
+{
+    2e1f:	55                   	push   %ebp
+    2e20:	89 e5                	mov    %esp,%ebp
+    2e22:	57                   	push   %edi
+    2e23:	56                   	push   %esi
+    2e24:	53                   	push   %ebx
+    2e25:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2e28:	68 63 78 00 00       	push   $0x7863
+    2e2d:	6a 01                	push   $0x1
+    2e2f:	e8 21 3a 00 00       	call   6855 <printf>
+
+  unlink("bigfile");
+    2e34:	c7 04 24 7f 78 00 00 	movl   $0x787f,(%esp)
+    2e3b:	e8 88 38 00 00       	call   66c8 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2e40:	83 c4 08             	add    $0x8,%esp
+    2e43:	68 02 02 00 00       	push   $0x202
+    2e48:	68 7f 78 00 00       	push   $0x787f
+    2e4d:	e8 66 38 00 00       	call   66b8 <open>
+  if(fd < 0){
+    2e52:	83 c4 10             	add    $0x10,%esp
+    2e55:	85 c0                	test   %eax,%eax
+    2e57:	78 41                	js     2e9a <bigfile+0x7b>
+    2e59:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    2e5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2e60:	83 fb 13             	cmp    $0x13,%ebx
+    2e63:	7f 5d                	jg     2ec2 <bigfile+0xa3>
+    memset(buf, i, 600);
+    2e65:	83 ec 04             	sub    $0x4,%esp
+    2e68:	68 58 02 00 00       	push   $0x258
+    2e6d:	53                   	push   %ebx
+    2e6e:	68 e0 c7 00 00       	push   $0xc7e0
+    2e73:	e8 c5 36 00 00       	call   653d <memset>
+    if(write(fd, buf, 600) != 600){
+    2e78:	83 c4 0c             	add    $0xc,%esp
+    2e7b:	68 58 02 00 00       	push   $0x258
+    2e80:	68 e0 c7 00 00       	push   $0xc7e0
+    2e85:	56                   	push   %esi
+    2e86:	e8 0d 38 00 00       	call   6698 <write>
+    2e8b:	83 c4 10             	add    $0x10,%esp
+    2e8e:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2e93:	75 19                	jne    2eae <bigfile+0x8f>
+  for(i = 0; i < 20; i++){
+    2e95:	83 c3 01             	add    $0x1,%ebx
+    2e98:	eb c6                	jmp    2e60 <bigfile+0x41>
+    printf(1, "cannot create bigfile");
+    2e9a:	83 ec 08             	sub    $0x8,%esp
+    2e9d:	68 71 78 00 00       	push   $0x7871
+    2ea2:	6a 01                	push   $0x1
+    2ea4:	e8 ac 39 00 00       	call   6855 <printf>
+    exit();
+    2ea9:	e8 ca 37 00 00       	call   6678 <exit>
+      printf(1, "write bigfile failed\n");
+    2eae:	83 ec 08             	sub    $0x8,%esp
+    2eb1:	68 87 78 00 00       	push   $0x7887
+    2eb6:	6a 01                	push   $0x1
+    2eb8:	e8 98 39 00 00       	call   6855 <printf>
+      exit();
+    2ebd:	e8 b6 37 00 00       	call   6678 <exit>
+    }
+  }
+  close(fd);
+    2ec2:	83 ec 0c             	sub    $0xc,%esp
+    2ec5:	56                   	push   %esi
+    2ec6:	e8 d5 37 00 00       	call   66a0 <close>
+
+  fd = open("bigfile", 0);
+    2ecb:	83 c4 08             	add    $0x8,%esp
+    2ece:	6a 00                	push   $0x0
+    2ed0:	68 7f 78 00 00       	push   $0x787f
+    2ed5:	e8 de 37 00 00       	call   66b8 <open>
+    2eda:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    2edc:	83 c4 10             	add    $0x10,%esp
+    2edf:	85 c0                	test   %eax,%eax
+    2ee1:	78 53                	js     2f36 <bigfile+0x117>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    2ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    2ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    2eed:	83 ec 04             	sub    $0x4,%esp
+    2ef0:	68 2c 01 00 00       	push   $0x12c
+    2ef5:	68 e0 c7 00 00       	push   $0xc7e0
+    2efa:	57                   	push   %edi
+    2efb:	e8 90 37 00 00       	call   6690 <read>
+    if(cc < 0){
+    2f00:	83 c4 10             	add    $0x10,%esp
+    2f03:	85 c0                	test   %eax,%eax
+    2f05:	78 43                	js     2f4a <bigfile+0x12b>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    2f07:	74 7d                	je     2f86 <bigfile+0x167>
+      break;
+    if(cc != 300){
+    2f09:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2f0e:	75 4e                	jne    2f5e <bigfile+0x13f>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2f10:	0f be 0d e0 c7 00 00 	movsbl 0xc7e0,%ecx
+    2f17:	89 da                	mov    %ebx,%edx
+    2f19:	c1 ea 1f             	shr    $0x1f,%edx
+    2f1c:	01 da                	add    %ebx,%edx
+    2f1e:	d1 fa                	sar    %edx
+    2f20:	39 d1                	cmp    %edx,%ecx
+    2f22:	75 4e                	jne    2f72 <bigfile+0x153>
+    2f24:	0f be 0d 0b c9 00 00 	movsbl 0xc90b,%ecx
+    2f2b:	39 ca                	cmp    %ecx,%edx
+    2f2d:	75 43                	jne    2f72 <bigfile+0x153>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    2f2f:	01 c6                	add    %eax,%esi
+  for(i = 0; ; i++){
+    2f31:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    2f34:	eb b7                	jmp    2eed <bigfile+0xce>
+    printf(1, "cannot open bigfile\n");
+    2f36:	83 ec 08             	sub    $0x8,%esp
+    2f39:	68 9d 78 00 00       	push   $0x789d
+    2f3e:	6a 01                	push   $0x1
+    2f40:	e8 10 39 00 00       	call   6855 <printf>
+    exit();
+    2f45:	e8 2e 37 00 00       	call   6678 <exit>
+      printf(1, "read bigfile failed\n");
+    2f4a:	83 ec 08             	sub    $0x8,%esp
+    2f4d:	68 b2 78 00 00       	push   $0x78b2
+    2f52:	6a 01                	push   $0x1
+    2f54:	e8 fc 38 00 00       	call   6855 <printf>
+      exit();
+    2f59:	e8 1a 37 00 00       	call   6678 <exit>
+      printf(1, "short read bigfile\n");
+    2f5e:	83 ec 08             	sub    $0x8,%esp
+    2f61:	68 c7 78 00 00       	push   $0x78c7
+    2f66:	6a 01                	push   $0x1
+    2f68:	e8 e8 38 00 00       	call   6855 <printf>
+      exit();
+    2f6d:	e8 06 37 00 00       	call   6678 <exit>
+      printf(1, "read bigfile wrong data\n");
+    2f72:	83 ec 08             	sub    $0x8,%esp
+    2f75:	68 db 78 00 00       	push   $0x78db
+    2f7a:	6a 01                	push   $0x1
+    2f7c:	e8 d4 38 00 00       	call   6855 <printf>
+      exit();
+    2f81:	e8 f2 36 00 00       	call   6678 <exit>
+  }
+  close(fd);
+    2f86:	83 ec 0c             	sub    $0xc,%esp
+    2f89:	57                   	push   %edi
+    2f8a:	e8 11 37 00 00       	call   66a0 <close>
+  if(total != 20*600){
+    2f8f:	83 c4 10             	add    $0x10,%esp
+    2f92:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2f98:	75 27                	jne    2fc1 <bigfile+0x1a2>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    2f9a:	83 ec 0c             	sub    $0xc,%esp
+    2f9d:	68 7f 78 00 00       	push   $0x787f
+    2fa2:	e8 21 37 00 00       	call   66c8 <unlink>
+
+  printf(1, "bigfile test ok\n");
+    2fa7:	83 c4 08             	add    $0x8,%esp
+    2faa:	68 0e 79 00 00       	push   $0x790e
+    2faf:	6a 01                	push   $0x1
+    2fb1:	e8 9f 38 00 00       	call   6855 <printf>
+}
+    2fb6:	83 c4 10             	add    $0x10,%esp
+    2fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2fbc:	5b                   	pop    %ebx
+    2fbd:	5e                   	pop    %esi
+    2fbe:	5f                   	pop    %edi
+    2fbf:	5d                   	pop    %ebp
+    2fc0:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    2fc1:	83 ec 08             	sub    $0x8,%esp
+    2fc4:	68 f4 78 00 00       	push   $0x78f4
+    2fc9:	6a 01                	push   $0x1
+    2fcb:	e8 85 38 00 00       	call   6855 <printf>
+    exit();
+    2fd0:	e8 a3 36 00 00       	call   6678 <exit>
+
+00002fd5 <fourteen>:
+
+void
+fourteen(void)
+{
+    2fd5:	55                   	push   %ebp
+    2fd6:	89 e5                	mov    %esp,%ebp
+    2fd8:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    2fdb:	68 1f 79 00 00       	push   $0x791f
+    2fe0:	6a 01                	push   $0x1
+    2fe2:	e8 6e 38 00 00       	call   6855 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    2fe7:	c7 04 24 5a 79 00 00 	movl   $0x795a,(%esp)
+    2fee:	e8 ed 36 00 00       	call   66e0 <mkdir>
+    2ff3:	83 c4 10             	add    $0x10,%esp
+    2ff6:	85 c0                	test   %eax,%eax
+    2ff8:	0f 85 9c 00 00 00    	jne    309a <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2ffe:	83 ec 0c             	sub    $0xc,%esp
+    3001:	68 1c 8a 00 00       	push   $0x8a1c
+    3006:	e8 d5 36 00 00       	call   66e0 <mkdir>
+    300b:	83 c4 10             	add    $0x10,%esp
+    300e:	85 c0                	test   %eax,%eax
+    3010:	0f 85 98 00 00 00    	jne    30ae <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3016:	83 ec 08             	sub    $0x8,%esp
+    3019:	68 00 02 00 00       	push   $0x200
+    301e:	68 6c 8a 00 00       	push   $0x8a6c
+    3023:	e8 90 36 00 00       	call   66b8 <open>
+  if(fd < 0){
+    3028:	83 c4 10             	add    $0x10,%esp
+    302b:	85 c0                	test   %eax,%eax
+    302d:	0f 88 8f 00 00 00    	js     30c2 <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    3033:	83 ec 0c             	sub    $0xc,%esp
+    3036:	50                   	push   %eax
+    3037:	e8 64 36 00 00       	call   66a0 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    303c:	83 c4 08             	add    $0x8,%esp
+    303f:	6a 00                	push   $0x0
+    3041:	68 dc 8a 00 00       	push   $0x8adc
+    3046:	e8 6d 36 00 00       	call   66b8 <open>
+  if(fd < 0){
+    304b:	83 c4 10             	add    $0x10,%esp
+    304e:	85 c0                	test   %eax,%eax
+    3050:	0f 88 80 00 00 00    	js     30d6 <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    3056:	83 ec 0c             	sub    $0xc,%esp
+    3059:	50                   	push   %eax
+    305a:	e8 41 36 00 00       	call   66a0 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    305f:	c7 04 24 4b 79 00 00 	movl   $0x794b,(%esp)
+    3066:	e8 75 36 00 00       	call   66e0 <mkdir>
+    306b:	83 c4 10             	add    $0x10,%esp
+    306e:	85 c0                	test   %eax,%eax
+    3070:	74 78                	je     30ea <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3072:	83 ec 0c             	sub    $0xc,%esp
+    3075:	68 78 8b 00 00       	push   $0x8b78
+    307a:	e8 61 36 00 00       	call   66e0 <mkdir>
+    307f:	83 c4 10             	add    $0x10,%esp
+    3082:	85 c0                	test   %eax,%eax
+    3084:	74 78                	je     30fe <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    3086:	83 ec 08             	sub    $0x8,%esp
+    3089:	68 69 79 00 00       	push   $0x7969
+    308e:	6a 01                	push   $0x1
+    3090:	e8 c0 37 00 00       	call   6855 <printf>
+}
+    3095:	83 c4 10             	add    $0x10,%esp
+    3098:	c9                   	leave
+    3099:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    309a:	83 ec 08             	sub    $0x8,%esp
+    309d:	68 2e 79 00 00       	push   $0x792e
+    30a2:	6a 01                	push   $0x1
+    30a4:	e8 ac 37 00 00       	call   6855 <printf>
+    exit();
+    30a9:	e8 ca 35 00 00       	call   6678 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    30ae:	83 ec 08             	sub    $0x8,%esp
+    30b1:	68 3c 8a 00 00       	push   $0x8a3c
+    30b6:	6a 01                	push   $0x1
+    30b8:	e8 98 37 00 00       	call   6855 <printf>
+    exit();
+    30bd:	e8 b6 35 00 00       	call   6678 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    30c2:	83 ec 08             	sub    $0x8,%esp
+    30c5:	68 9c 8a 00 00       	push   $0x8a9c
+    30ca:	6a 01                	push   $0x1
+    30cc:	e8 84 37 00 00       	call   6855 <printf>
+    exit();
+    30d1:	e8 a2 35 00 00       	call   6678 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    30d6:	83 ec 08             	sub    $0x8,%esp
+    30d9:	68 0c 8b 00 00       	push   $0x8b0c
+    30de:	6a 01                	push   $0x1
+    30e0:	e8 70 37 00 00       	call   6855 <printf>
+    exit();
+    30e5:	e8 8e 35 00 00       	call   6678 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    30ea:	83 ec 08             	sub    $0x8,%esp
+    30ed:	68 48 8b 00 00       	push   $0x8b48
+    30f2:	6a 01                	push   $0x1
+    30f4:	e8 5c 37 00 00       	call   6855 <printf>
+    exit();
+    30f9:	e8 7a 35 00 00       	call   6678 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    30fe:	83 ec 08             	sub    $0x8,%esp
+    3101:	68 98 8b 00 00       	push   $0x8b98
+    3106:	6a 01                	push   $0x1
+    3108:	e8 48 37 00 00       	call   6855 <printf>
+    exit();
+    310d:	e8 66 35 00 00       	call   6678 <exit>
+
+00003112 <rmdot>:
+
+void
+rmdot(void)
+{
+    3112:	55                   	push   %ebp
+    3113:	89 e5                	mov    %esp,%ebp
+    3115:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3118:	68 76 79 00 00       	push   $0x7976
+    311d:	6a 01                	push   $0x1
+    311f:	e8 31 37 00 00       	call   6855 <printf>
+  if(mkdir("dots") != 0){
+    3124:	c7 04 24 82 79 00 00 	movl   $0x7982,(%esp)
+    312b:	e8 b0 35 00 00       	call   66e0 <mkdir>
+    3130:	83 c4 10             	add    $0x10,%esp
+    3133:	85 c0                	test   %eax,%eax
+    3135:	0f 85 bc 00 00 00    	jne    31f7 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    313b:	83 ec 0c             	sub    $0xc,%esp
+    313e:	68 82 79 00 00       	push   $0x7982
+    3143:	e8 a0 35 00 00       	call   66e8 <chdir>
+    3148:	83 c4 10             	add    $0x10,%esp
+    314b:	85 c0                	test   %eax,%eax
+    314d:	0f 85 b8 00 00 00    	jne    320b <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    3153:	83 ec 0c             	sub    $0xc,%esp
+    3156:	68 2d 76 00 00       	push   $0x762d
+    315b:	e8 68 35 00 00       	call   66c8 <unlink>
+    3160:	83 c4 10             	add    $0x10,%esp
+    3163:	85 c0                	test   %eax,%eax
+    3165:	0f 84 b4 00 00 00    	je     321f <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    316b:	83 ec 0c             	sub    $0xc,%esp
+    316e:	68 2c 76 00 00       	push   $0x762c
+    3173:	e8 50 35 00 00       	call   66c8 <unlink>
+    3178:	83 c4 10             	add    $0x10,%esp
+    317b:	85 c0                	test   %eax,%eax
+    317d:	0f 84 b0 00 00 00    	je     3233 <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    3183:	83 ec 0c             	sub    $0xc,%esp
+    3186:	68 3f 6b 00 00       	push   $0x6b3f
+    318b:	e8 58 35 00 00       	call   66e8 <chdir>
+    3190:	83 c4 10             	add    $0x10,%esp
+    3193:	85 c0                	test   %eax,%eax
+    3195:	0f 85 ac 00 00 00    	jne    3247 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    319b:	83 ec 0c             	sub    $0xc,%esp
+    319e:	68 ca 79 00 00       	push   $0x79ca
+    31a3:	e8 20 35 00 00       	call   66c8 <unlink>
+    31a8:	83 c4 10             	add    $0x10,%esp
+    31ab:	85 c0                	test   %eax,%eax
+    31ad:	0f 84 a8 00 00 00    	je     325b <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    31b3:	83 ec 0c             	sub    $0xc,%esp
+    31b6:	68 e8 79 00 00       	push   $0x79e8
+    31bb:	e8 08 35 00 00       	call   66c8 <unlink>
+    31c0:	83 c4 10             	add    $0x10,%esp
+    31c3:	85 c0                	test   %eax,%eax
+    31c5:	0f 84 a4 00 00 00    	je     326f <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    31cb:	83 ec 0c             	sub    $0xc,%esp
+    31ce:	68 82 79 00 00       	push   $0x7982
+    31d3:	e8 f0 34 00 00       	call   66c8 <unlink>
+    31d8:	83 c4 10             	add    $0x10,%esp
+    31db:	85 c0                	test   %eax,%eax
+    31dd:	0f 85 a0 00 00 00    	jne    3283 <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    31e3:	83 ec 08             	sub    $0x8,%esp
+    31e6:	68 1d 7a 00 00       	push   $0x7a1d
+    31eb:	6a 01                	push   $0x1
+    31ed:	e8 63 36 00 00       	call   6855 <printf>
+}
+    31f2:	83 c4 10             	add    $0x10,%esp
+    31f5:	c9                   	leave
+    31f6:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    31f7:	83 ec 08             	sub    $0x8,%esp
+    31fa:	68 87 79 00 00       	push   $0x7987
+    31ff:	6a 01                	push   $0x1
+    3201:	e8 4f 36 00 00       	call   6855 <printf>
+    exit();
+    3206:	e8 6d 34 00 00       	call   6678 <exit>
+    printf(1, "chdir dots failed\n");
+    320b:	83 ec 08             	sub    $0x8,%esp
+    320e:	68 9a 79 00 00       	push   $0x799a
+    3213:	6a 01                	push   $0x1
+    3215:	e8 3b 36 00 00       	call   6855 <printf>
+    exit();
+    321a:	e8 59 34 00 00       	call   6678 <exit>
+    printf(1, "rm . worked!\n");
+    321f:	83 ec 08             	sub    $0x8,%esp
+    3222:	68 ad 79 00 00       	push   $0x79ad
+    3227:	6a 01                	push   $0x1
+    3229:	e8 27 36 00 00       	call   6855 <printf>
+    exit();
+    322e:	e8 45 34 00 00       	call   6678 <exit>
+    printf(1, "rm .. worked!\n");
+    3233:	83 ec 08             	sub    $0x8,%esp
+    3236:	68 bb 79 00 00       	push   $0x79bb
+    323b:	6a 01                	push   $0x1
+    323d:	e8 13 36 00 00       	call   6855 <printf>
+    exit();
+    3242:	e8 31 34 00 00       	call   6678 <exit>
+    printf(1, "chdir / failed\n");
+    3247:	83 ec 08             	sub    $0x8,%esp
+    324a:	68 41 6b 00 00       	push   $0x6b41
+    324f:	6a 01                	push   $0x1
+    3251:	e8 ff 35 00 00       	call   6855 <printf>
+    exit();
+    3256:	e8 1d 34 00 00       	call   6678 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    325b:	83 ec 08             	sub    $0x8,%esp
+    325e:	68 d1 79 00 00       	push   $0x79d1
+    3263:	6a 01                	push   $0x1
+    3265:	e8 eb 35 00 00       	call   6855 <printf>
+    exit();
+    326a:	e8 09 34 00 00       	call   6678 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    326f:	83 ec 08             	sub    $0x8,%esp
+    3272:	68 f0 79 00 00       	push   $0x79f0
+    3277:	6a 01                	push   $0x1
+    3279:	e8 d7 35 00 00       	call   6855 <printf>
+    exit();
+    327e:	e8 f5 33 00 00       	call   6678 <exit>
+    printf(1, "unlink dots failed!\n");
+    3283:	83 ec 08             	sub    $0x8,%esp
+    3286:	68 08 7a 00 00       	push   $0x7a08
+    328b:	6a 01                	push   $0x1
+    328d:	e8 c3 35 00 00       	call   6855 <printf>
+    exit();
+    3292:	e8 e1 33 00 00       	call   6678 <exit>
+
+00003297 <dirfile>:
+
+void
+dirfile(void)
+{
+    3297:	55                   	push   %ebp
+    3298:	89 e5                	mov    %esp,%ebp
+    329a:	53                   	push   %ebx
+    329b:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    329e:	68 27 7a 00 00       	push   $0x7a27
+    32a3:	6a 01                	push   $0x1
+    32a5:	e8 ab 35 00 00       	call   6855 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    32aa:	83 c4 08             	add    $0x8,%esp
+    32ad:	68 00 02 00 00       	push   $0x200
+    32b2:	68 34 7a 00 00       	push   $0x7a34
+    32b7:	e8 fc 33 00 00       	call   66b8 <open>
+  if(fd < 0){
+    32bc:	83 c4 10             	add    $0x10,%esp
+    32bf:	85 c0                	test   %eax,%eax
+    32c1:	0f 88 22 01 00 00    	js     33e9 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    32c7:	83 ec 0c             	sub    $0xc,%esp
+    32ca:	50                   	push   %eax
+    32cb:	e8 d0 33 00 00       	call   66a0 <close>
+  if(chdir("dirfile") == 0){
+    32d0:	c7 04 24 34 7a 00 00 	movl   $0x7a34,(%esp)
+    32d7:	e8 0c 34 00 00       	call   66e8 <chdir>
+    32dc:	83 c4 10             	add    $0x10,%esp
+    32df:	85 c0                	test   %eax,%eax
+    32e1:	0f 84 16 01 00 00    	je     33fd <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    32e7:	83 ec 08             	sub    $0x8,%esp
+    32ea:	6a 00                	push   $0x0
+    32ec:	68 6d 7a 00 00       	push   $0x7a6d
+    32f1:	e8 c2 33 00 00       	call   66b8 <open>
+  if(fd >= 0){
+    32f6:	83 c4 10             	add    $0x10,%esp
+    32f9:	85 c0                	test   %eax,%eax
+    32fb:	0f 89 10 01 00 00    	jns    3411 <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    3301:	83 ec 08             	sub    $0x8,%esp
+    3304:	68 00 02 00 00       	push   $0x200
+    3309:	68 6d 7a 00 00       	push   $0x7a6d
+    330e:	e8 a5 33 00 00       	call   66b8 <open>
+  if(fd >= 0){
+    3313:	83 c4 10             	add    $0x10,%esp
+    3316:	85 c0                	test   %eax,%eax
+    3318:	0f 89 07 01 00 00    	jns    3425 <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    331e:	83 ec 0c             	sub    $0xc,%esp
+    3321:	68 6d 7a 00 00       	push   $0x7a6d
+    3326:	e8 b5 33 00 00       	call   66e0 <mkdir>
+    332b:	83 c4 10             	add    $0x10,%esp
+    332e:	85 c0                	test   %eax,%eax
+    3330:	0f 84 03 01 00 00    	je     3439 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    3336:	83 ec 0c             	sub    $0xc,%esp
+    3339:	68 6d 7a 00 00       	push   $0x7a6d
+    333e:	e8 85 33 00 00       	call   66c8 <unlink>
+    3343:	83 c4 10             	add    $0x10,%esp
+    3346:	85 c0                	test   %eax,%eax
+    3348:	0f 84 ff 00 00 00    	je     344d <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    334e:	83 ec 08             	sub    $0x8,%esp
+    3351:	68 6d 7a 00 00       	push   $0x7a6d
+    3356:	68 d1 7a 00 00       	push   $0x7ad1
+    335b:	e8 78 33 00 00       	call   66d8 <link>
+    3360:	83 c4 10             	add    $0x10,%esp
+    3363:	85 c0                	test   %eax,%eax
+    3365:	0f 84 f6 00 00 00    	je     3461 <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    336b:	83 ec 0c             	sub    $0xc,%esp
+    336e:	68 34 7a 00 00       	push   $0x7a34
+    3373:	e8 50 33 00 00       	call   66c8 <unlink>
+    3378:	83 c4 10             	add    $0x10,%esp
+    337b:	85 c0                	test   %eax,%eax
+    337d:	0f 85 f2 00 00 00    	jne    3475 <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    3383:	83 ec 08             	sub    $0x8,%esp
+    3386:	6a 02                	push   $0x2
+    3388:	68 2d 76 00 00       	push   $0x762d
+    338d:	e8 26 33 00 00       	call   66b8 <open>
+  if(fd >= 0){
+    3392:	83 c4 10             	add    $0x10,%esp
+    3395:	85 c0                	test   %eax,%eax
+    3397:	0f 89 ec 00 00 00    	jns    3489 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    339d:	83 ec 08             	sub    $0x8,%esp
+    33a0:	6a 00                	push   $0x0
+    33a2:	68 2d 76 00 00       	push   $0x762d
+    33a7:	e8 0c 33 00 00       	call   66b8 <open>
+    33ac:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    33ae:	83 c4 0c             	add    $0xc,%esp
+    33b1:	6a 01                	push   $0x1
+    33b3:	68 10 77 00 00       	push   $0x7710
+    33b8:	50                   	push   %eax
+    33b9:	e8 da 32 00 00       	call   6698 <write>
+    33be:	83 c4 10             	add    $0x10,%esp
+    33c1:	85 c0                	test   %eax,%eax
+    33c3:	0f 8f d4 00 00 00    	jg     349d <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    33c9:	83 ec 0c             	sub    $0xc,%esp
+    33cc:	53                   	push   %ebx
+    33cd:	e8 ce 32 00 00       	call   66a0 <close>
+
+  printf(1, "dir vs file OK\n");
+    33d2:	83 c4 08             	add    $0x8,%esp
+    33d5:	68 04 7b 00 00       	push   $0x7b04
+    33da:	6a 01                	push   $0x1
+    33dc:	e8 74 34 00 00       	call   6855 <printf>
+}
+    33e1:	83 c4 10             	add    $0x10,%esp
+    33e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    33e7:	c9                   	leave
+    33e8:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    33e9:	83 ec 08             	sub    $0x8,%esp
+    33ec:	68 3c 7a 00 00       	push   $0x7a3c
+    33f1:	6a 01                	push   $0x1
+    33f3:	e8 5d 34 00 00       	call   6855 <printf>
+    exit();
+    33f8:	e8 7b 32 00 00       	call   6678 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    33fd:	83 ec 08             	sub    $0x8,%esp
+    3400:	68 53 7a 00 00       	push   $0x7a53
+    3405:	6a 01                	push   $0x1
+    3407:	e8 49 34 00 00       	call   6855 <printf>
+    exit();
+    340c:	e8 67 32 00 00       	call   6678 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    3411:	83 ec 08             	sub    $0x8,%esp
+    3414:	68 78 7a 00 00       	push   $0x7a78
+    3419:	6a 01                	push   $0x1
+    341b:	e8 35 34 00 00       	call   6855 <printf>
+    exit();
+    3420:	e8 53 32 00 00       	call   6678 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    3425:	83 ec 08             	sub    $0x8,%esp
+    3428:	68 78 7a 00 00       	push   $0x7a78
+    342d:	6a 01                	push   $0x1
+    342f:	e8 21 34 00 00       	call   6855 <printf>
+    exit();
+    3434:	e8 3f 32 00 00       	call   6678 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3439:	83 ec 08             	sub    $0x8,%esp
+    343c:	68 96 7a 00 00       	push   $0x7a96
+    3441:	6a 01                	push   $0x1
+    3443:	e8 0d 34 00 00       	call   6855 <printf>
+    exit();
+    3448:	e8 2b 32 00 00       	call   6678 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    344d:	83 ec 08             	sub    $0x8,%esp
+    3450:	68 b3 7a 00 00       	push   $0x7ab3
+    3455:	6a 01                	push   $0x1
+    3457:	e8 f9 33 00 00       	call   6855 <printf>
+    exit();
+    345c:	e8 17 32 00 00       	call   6678 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    3461:	83 ec 08             	sub    $0x8,%esp
+    3464:	68 cc 8b 00 00       	push   $0x8bcc
+    3469:	6a 01                	push   $0x1
+    346b:	e8 e5 33 00 00       	call   6855 <printf>
+    exit();
+    3470:	e8 03 32 00 00       	call   6678 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    3475:	83 ec 08             	sub    $0x8,%esp
+    3478:	68 d8 7a 00 00       	push   $0x7ad8
+    347d:	6a 01                	push   $0x1
+    347f:	e8 d1 33 00 00       	call   6855 <printf>
+    exit();
+    3484:	e8 ef 31 00 00       	call   6678 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3489:	83 ec 08             	sub    $0x8,%esp
+    348c:	68 ec 8b 00 00       	push   $0x8bec
+    3491:	6a 01                	push   $0x1
+    3493:	e8 bd 33 00 00       	call   6855 <printf>
+    exit();
+    3498:	e8 db 31 00 00       	call   6678 <exit>
+    printf(1, "write . succeeded!\n");
+    349d:	83 ec 08             	sub    $0x8,%esp
+    34a0:	68 f0 7a 00 00       	push   $0x7af0
+    34a5:	6a 01                	push   $0x1
+    34a7:	e8 a9 33 00 00       	call   6855 <printf>
+    exit();
+    34ac:	e8 c7 31 00 00       	call   6678 <exit>
+
+000034b1 <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    34b1:	55                   	push   %ebp
+    34b2:	89 e5                	mov    %esp,%ebp
+    34b4:	53                   	push   %ebx
+    34b5:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    34b8:	68 14 7b 00 00       	push   $0x7b14
+    34bd:	6a 01                	push   $0x1
+    34bf:	e8 91 33 00 00       	call   6855 <printf>
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    34c4:	83 c4 10             	add    $0x10,%esp
+    34c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    34cc:	eb 4c                	jmp    351a <iref+0x69>
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    34ce:	83 ec 08             	sub    $0x8,%esp
+    34d1:	68 2b 7b 00 00       	push   $0x7b2b
+    34d6:	6a 01                	push   $0x1
+    34d8:	e8 78 33 00 00       	call   6855 <printf>
+      exit();
+    34dd:	e8 96 31 00 00       	call   6678 <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    34e2:	83 ec 08             	sub    $0x8,%esp
+    34e5:	68 3f 7b 00 00       	push   $0x7b3f
+    34ea:	6a 01                	push   $0x1
+    34ec:	e8 64 33 00 00       	call   6855 <printf>
+      exit();
+    34f1:	e8 82 31 00 00       	call   6678 <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    34f6:	83 ec 0c             	sub    $0xc,%esp
+    34f9:	50                   	push   %eax
+    34fa:	e8 a1 31 00 00       	call   66a0 <close>
+    34ff:	83 c4 10             	add    $0x10,%esp
+    3502:	e9 80 00 00 00       	jmp    3587 <iref+0xd6>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    3507:	83 ec 0c             	sub    $0xc,%esp
+    350a:	68 0f 77 00 00       	push   $0x770f
+    350f:	e8 b4 31 00 00       	call   66c8 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3514:	83 c3 01             	add    $0x1,%ebx
+    3517:	83 c4 10             	add    $0x10,%esp
+    351a:	83 fb 32             	cmp    $0x32,%ebx
+    351d:	0f 8f 92 00 00 00    	jg     35b5 <iref+0x104>
+    if(mkdir("irefd") != 0){
+    3523:	83 ec 0c             	sub    $0xc,%esp
+    3526:	68 25 7b 00 00       	push   $0x7b25
+    352b:	e8 b0 31 00 00       	call   66e0 <mkdir>
+    3530:	83 c4 10             	add    $0x10,%esp
+    3533:	85 c0                	test   %eax,%eax
+    3535:	75 97                	jne    34ce <iref+0x1d>
+    if(chdir("irefd") != 0){
+    3537:	83 ec 0c             	sub    $0xc,%esp
+    353a:	68 25 7b 00 00       	push   $0x7b25
+    353f:	e8 a4 31 00 00       	call   66e8 <chdir>
+    3544:	83 c4 10             	add    $0x10,%esp
+    3547:	85 c0                	test   %eax,%eax
+    3549:	75 97                	jne    34e2 <iref+0x31>
+    mkdir("");
+    354b:	83 ec 0c             	sub    $0xc,%esp
+    354e:	68 7d 70 00 00       	push   $0x707d
+    3553:	e8 88 31 00 00       	call   66e0 <mkdir>
+    link("README", "");
+    3558:	83 c4 08             	add    $0x8,%esp
+    355b:	68 7d 70 00 00       	push   $0x707d
+    3560:	68 d1 7a 00 00       	push   $0x7ad1
+    3565:	e8 6e 31 00 00       	call   66d8 <link>
+    fd = open("", O_CREATE);
+    356a:	83 c4 08             	add    $0x8,%esp
+    356d:	68 00 02 00 00       	push   $0x200
+    3572:	68 7d 70 00 00       	push   $0x707d
+    3577:	e8 3c 31 00 00       	call   66b8 <open>
+    if(fd >= 0)
+    357c:	83 c4 10             	add    $0x10,%esp
+    357f:	85 c0                	test   %eax,%eax
+    3581:	0f 89 6f ff ff ff    	jns    34f6 <iref+0x45>
+    fd = open("xx", O_CREATE);
+    3587:	83 ec 08             	sub    $0x8,%esp
+    358a:	68 00 02 00 00       	push   $0x200
+    358f:	68 0f 77 00 00       	push   $0x770f
+    3594:	e8 1f 31 00 00       	call   66b8 <open>
+    if(fd >= 0)
+    3599:	83 c4 10             	add    $0x10,%esp
+    359c:	85 c0                	test   %eax,%eax
+    359e:	0f 88 63 ff ff ff    	js     3507 <iref+0x56>
+      close(fd);
+    35a4:	83 ec 0c             	sub    $0xc,%esp
+    35a7:	50                   	push   %eax
+    35a8:	e8 f3 30 00 00       	call   66a0 <close>
+    35ad:	83 c4 10             	add    $0x10,%esp
+    35b0:	e9 52 ff ff ff       	jmp    3507 <iref+0x56>
+  }
+
+  chdir("/");
+    35b5:	83 ec 0c             	sub    $0xc,%esp
+    35b8:	68 3f 6b 00 00       	push   $0x6b3f
+    35bd:	e8 26 31 00 00       	call   66e8 <chdir>
+  printf(1, "empty file name OK\n");
+    35c2:	83 c4 08             	add    $0x8,%esp
+    35c5:	68 53 7b 00 00       	push   $0x7b53
+    35ca:	6a 01                	push   $0x1
+    35cc:	e8 84 32 00 00       	call   6855 <printf>
+}
+    35d1:	83 c4 10             	add    $0x10,%esp
+    35d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    35d7:	c9                   	leave
+    35d8:	c3                   	ret
+
+000035d9 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    35d9:	55                   	push   %ebp
+    35da:	89 e5                	mov    %esp,%ebp
+    35dc:	53                   	push   %ebx
+    35dd:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    35e0:	68 67 7b 00 00       	push   $0x7b67
+    35e5:	6a 01                	push   $0x1
+    35e7:	e8 69 32 00 00       	call   6855 <printf>
+
+  for(n=0; n<1000; n++){
+    35ec:	83 c4 10             	add    $0x10,%esp
+    35ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    35f4:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    35fa:	7f 15                	jg     3611 <forktest+0x38>
+    pid = fork();
+    35fc:	e8 6f 30 00 00       	call   6670 <fork>
+    if(pid < 0)
+    3601:	85 c0                	test   %eax,%eax
+    3603:	78 0c                	js     3611 <forktest+0x38>
+      break;
+    if(pid == 0)
+    3605:	74 05                	je     360c <forktest+0x33>
+  for(n=0; n<1000; n++){
+    3607:	83 c3 01             	add    $0x1,%ebx
+    360a:	eb e8                	jmp    35f4 <forktest+0x1b>
+      exit();
+    360c:	e8 67 30 00 00       	call   6678 <exit>
+  }
+
+  if(n == 1000){
+    3611:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    3617:	74 12                	je     362b <forktest+0x52>
+    printf(1, "fork claimed to work 1000 times!\n");
+    exit();
+  }
+
+  for(; n > 0; n--){
+    3619:	85 db                	test   %ebx,%ebx
+    361b:	7e 36                	jle    3653 <forktest+0x7a>
+    if(wait() < 0){
+    361d:	e8 5e 30 00 00       	call   6680 <wait>
+    3622:	85 c0                	test   %eax,%eax
+    3624:	78 19                	js     363f <forktest+0x66>
+  for(; n > 0; n--){
+    3626:	83 eb 01             	sub    $0x1,%ebx
+    3629:	eb ee                	jmp    3619 <forktest+0x40>
+    printf(1, "fork claimed to work 1000 times!\n");
+    362b:	83 ec 08             	sub    $0x8,%esp
+    362e:	68 0c 8c 00 00       	push   $0x8c0c
+    3633:	6a 01                	push   $0x1
+    3635:	e8 1b 32 00 00       	call   6855 <printf>
+    exit();
+    363a:	e8 39 30 00 00       	call   6678 <exit>
+      printf(1, "wait stopped early\n");
+    363f:	83 ec 08             	sub    $0x8,%esp
+    3642:	68 72 7b 00 00       	push   $0x7b72
+    3647:	6a 01                	push   $0x1
+    3649:	e8 07 32 00 00       	call   6855 <printf>
+      exit();
+    364e:	e8 25 30 00 00       	call   6678 <exit>
+    }
+  }
+
+  if(wait() != -1){
+    3653:	e8 28 30 00 00       	call   6680 <wait>
+    3658:	83 f8 ff             	cmp    $0xffffffff,%eax
+    365b:	75 17                	jne    3674 <forktest+0x9b>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    365d:	83 ec 08             	sub    $0x8,%esp
+    3660:	68 99 7b 00 00       	push   $0x7b99
+    3665:	6a 01                	push   $0x1
+    3667:	e8 e9 31 00 00       	call   6855 <printf>
+}
+    366c:	83 c4 10             	add    $0x10,%esp
+    366f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3672:	c9                   	leave
+    3673:	c3                   	ret
+    printf(1, "wait got too many\n");
+    3674:	83 ec 08             	sub    $0x8,%esp
+    3677:	68 86 7b 00 00       	push   $0x7b86
+    367c:	6a 01                	push   $0x1
+    367e:	e8 d2 31 00 00       	call   6855 <printf>
+    exit();
+    3683:	e8 f0 2f 00 00       	call   6678 <exit>
+
+00003688 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    3688:	55                   	push   %ebp
+    3689:	89 e5                	mov    %esp,%ebp
+    368b:	57                   	push   %edi
+    368c:	56                   	push   %esi
+    368d:	53                   	push   %ebx
+    368e:	83 ec 54             	sub    $0x54,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    3691:	68 a7 7b 00 00       	push   $0x7ba7
+    3696:	ff 35 a4 a0 00 00    	push   0xa0a4
+    369c:	e8 b4 31 00 00       	call   6855 <printf>
+  oldbrk = sbrk(0);
+    36a1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    36a8:	e8 53 30 00 00       	call   6700 <sbrk>
+    36ad:	89 c7                	mov    %eax,%edi
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    36af:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    36b6:	e8 45 30 00 00       	call   6700 <sbrk>
+    36bb:	89 c6                	mov    %eax,%esi
+  int i;
+  for(i = 0; i < 5000; i++){
+    36bd:	83 c4 10             	add    $0x10,%esp
+    36c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    36c5:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+    36cb:	7f 3a                	jg     3707 <sbrktest+0x7f>
+    b = sbrk(1);
+    36cd:	83 ec 0c             	sub    $0xc,%esp
+    36d0:	6a 01                	push   $0x1
+    36d2:	e8 29 30 00 00       	call   6700 <sbrk>
+    if(b != a){
+    36d7:	83 c4 10             	add    $0x10,%esp
+    36da:	39 c6                	cmp    %eax,%esi
+    36dc:	75 0b                	jne    36e9 <sbrktest+0x61>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    36de:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    36e1:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5000; i++){
+    36e4:	83 c3 01             	add    $0x1,%ebx
+    36e7:	eb dc                	jmp    36c5 <sbrktest+0x3d>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    36e9:	83 ec 0c             	sub    $0xc,%esp
+    36ec:	50                   	push   %eax
+    36ed:	56                   	push   %esi
+    36ee:	53                   	push   %ebx
+    36ef:	68 b2 7b 00 00       	push   $0x7bb2
+    36f4:	ff 35 a4 a0 00 00    	push   0xa0a4
+    36fa:	e8 56 31 00 00       	call   6855 <printf>
+      exit();
+    36ff:	83 c4 20             	add    $0x20,%esp
+    3702:	e8 71 2f 00 00       	call   6678 <exit>
+  }
+  pid = fork();
+    3707:	e8 64 2f 00 00       	call   6670 <fork>
+    370c:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    370e:	85 c0                	test   %eax,%eax
+    3710:	0f 88 53 01 00 00    	js     3869 <sbrktest+0x1e1>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    3716:	83 ec 0c             	sub    $0xc,%esp
+    3719:	6a 01                	push   $0x1
+    371b:	e8 e0 2f 00 00       	call   6700 <sbrk>
+  c = sbrk(1);
+    3720:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3727:	e8 d4 2f 00 00       	call   6700 <sbrk>
+  if(c != a + 1){
+    372c:	83 c6 01             	add    $0x1,%esi
+    372f:	83 c4 10             	add    $0x10,%esp
+    3732:	39 c6                	cmp    %eax,%esi
+    3734:	0f 85 47 01 00 00    	jne    3881 <sbrktest+0x1f9>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    373a:	85 db                	test   %ebx,%ebx
+    373c:	0f 84 57 01 00 00    	je     3899 <sbrktest+0x211>
+    exit();
+  wait();
+    3742:	e8 39 2f 00 00       	call   6680 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    3747:	83 ec 0c             	sub    $0xc,%esp
+    374a:	6a 00                	push   $0x0
+    374c:	e8 af 2f 00 00       	call   6700 <sbrk>
+    3751:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3753:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3758:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    375a:	89 04 24             	mov    %eax,(%esp)
+    375d:	e8 9e 2f 00 00       	call   6700 <sbrk>
+  if (p != a) {
+    3762:	83 c4 10             	add    $0x10,%esp
+    3765:	39 c3                	cmp    %eax,%ebx
+    3767:	0f 85 31 01 00 00    	jne    389e <sbrktest+0x216>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    376d:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+
+  // can one de-allocate?
+  a = sbrk(0);
+    3774:	83 ec 0c             	sub    $0xc,%esp
+    3777:	6a 00                	push   $0x0
+    3779:	e8 82 2f 00 00       	call   6700 <sbrk>
+    377e:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3780:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    3787:	e8 74 2f 00 00       	call   6700 <sbrk>
+  if(c == (char*)0xffffffff){
+    378c:	83 c4 10             	add    $0x10,%esp
+    378f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3792:	0f 84 1e 01 00 00    	je     38b6 <sbrktest+0x22e>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    3798:	83 ec 0c             	sub    $0xc,%esp
+    379b:	6a 00                	push   $0x0
+    379d:	e8 5e 2f 00 00       	call   6700 <sbrk>
+  if(c != a - 4096){
+    37a2:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    37a8:	83 c4 10             	add    $0x10,%esp
+    37ab:	39 c2                	cmp    %eax,%edx
+    37ad:	0f 85 1b 01 00 00    	jne    38ce <sbrktest+0x246>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    37b3:	83 ec 0c             	sub    $0xc,%esp
+    37b6:	6a 00                	push   $0x0
+    37b8:	e8 43 2f 00 00       	call   6700 <sbrk>
+    37bd:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    37bf:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    37c6:	e8 35 2f 00 00       	call   6700 <sbrk>
+    37cb:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    37cd:	83 c4 10             	add    $0x10,%esp
+    37d0:	39 c3                	cmp    %eax,%ebx
+    37d2:	0f 85 0d 01 00 00    	jne    38e5 <sbrktest+0x25d>
+    37d8:	83 ec 0c             	sub    $0xc,%esp
+    37db:	6a 00                	push   $0x0
+    37dd:	e8 1e 2f 00 00       	call   6700 <sbrk>
+    37e2:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    37e8:	83 c4 10             	add    $0x10,%esp
+    37eb:	39 c2                	cmp    %eax,%edx
+    37ed:	0f 85 f2 00 00 00    	jne    38e5 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    37f3:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    37fa:	0f 84 fc 00 00 00    	je     38fc <sbrktest+0x274>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    3800:	83 ec 0c             	sub    $0xc,%esp
+    3803:	6a 00                	push   $0x0
+    3805:	e8 f6 2e 00 00       	call   6700 <sbrk>
+    380a:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    380c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3813:	e8 e8 2e 00 00       	call   6700 <sbrk>
+    3818:	89 c2                	mov    %eax,%edx
+    381a:	89 f8                	mov    %edi,%eax
+    381c:	29 d0                	sub    %edx,%eax
+    381e:	89 04 24             	mov    %eax,(%esp)
+    3821:	e8 da 2e 00 00       	call   6700 <sbrk>
+  if(c != a){
+    3826:	83 c4 10             	add    $0x10,%esp
+    3829:	39 c3                	cmp    %eax,%ebx
+    382b:	0f 85 e3 00 00 00    	jne    3914 <sbrktest+0x28c>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3831:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3836:	81 fb 7f 84 1e 80    	cmp    $0x801e847f,%ebx
+    383c:	0f 87 23 01 00 00    	ja     3965 <sbrktest+0x2dd>
+    ppid = getpid();
+    3842:	e8 b1 2e 00 00       	call   66f8 <getpid>
+    3847:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3849:	e8 22 2e 00 00       	call   6670 <fork>
+    if(pid < 0){
+    384e:	85 c0                	test   %eax,%eax
+    3850:	0f 88 d5 00 00 00    	js     392b <sbrktest+0x2a3>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    3856:	0f 84 e7 00 00 00    	je     3943 <sbrktest+0x2bb>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    385c:	e8 1f 2e 00 00       	call   6680 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3861:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3867:	eb cd                	jmp    3836 <sbrktest+0x1ae>
+    printf(stdout, "sbrk test fork failed\n");
+    3869:	83 ec 08             	sub    $0x8,%esp
+    386c:	68 cd 7b 00 00       	push   $0x7bcd
+    3871:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3877:	e8 d9 2f 00 00       	call   6855 <printf>
+    exit();
+    387c:	e8 f7 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3881:	83 ec 08             	sub    $0x8,%esp
+    3884:	68 e4 7b 00 00       	push   $0x7be4
+    3889:	ff 35 a4 a0 00 00    	push   0xa0a4
+    388f:	e8 c1 2f 00 00       	call   6855 <printf>
+    exit();
+    3894:	e8 df 2d 00 00       	call   6678 <exit>
+    exit();
+    3899:	e8 da 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    389e:	83 ec 08             	sub    $0x8,%esp
+    38a1:	68 30 8c 00 00       	push   $0x8c30
+    38a6:	ff 35 a4 a0 00 00    	push   0xa0a4
+    38ac:	e8 a4 2f 00 00       	call   6855 <printf>
+    exit();
+    38b1:	e8 c2 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    38b6:	83 ec 08             	sub    $0x8,%esp
+    38b9:	68 00 7c 00 00       	push   $0x7c00
+    38be:	ff 35 a4 a0 00 00    	push   0xa0a4
+    38c4:	e8 8c 2f 00 00       	call   6855 <printf>
+    exit();
+    38c9:	e8 aa 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    38ce:	50                   	push   %eax
+    38cf:	53                   	push   %ebx
+    38d0:	68 70 8c 00 00       	push   $0x8c70
+    38d5:	ff 35 a4 a0 00 00    	push   0xa0a4
+    38db:	e8 75 2f 00 00       	call   6855 <printf>
+    exit();
+    38e0:	e8 93 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    38e5:	56                   	push   %esi
+    38e6:	53                   	push   %ebx
+    38e7:	68 a8 8c 00 00       	push   $0x8ca8
+    38ec:	ff 35 a4 a0 00 00    	push   0xa0a4
+    38f2:	e8 5e 2f 00 00       	call   6855 <printf>
+    exit();
+    38f7:	e8 7c 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    38fc:	83 ec 08             	sub    $0x8,%esp
+    38ff:	68 d0 8c 00 00       	push   $0x8cd0
+    3904:	ff 35 a4 a0 00 00    	push   0xa0a4
+    390a:	e8 46 2f 00 00       	call   6855 <printf>
+    exit();
+    390f:	e8 64 2d 00 00       	call   6678 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3914:	50                   	push   %eax
+    3915:	53                   	push   %ebx
+    3916:	68 00 8d 00 00       	push   $0x8d00
+    391b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3921:	e8 2f 2f 00 00       	call   6855 <printf>
+    exit();
+    3926:	e8 4d 2d 00 00       	call   6678 <exit>
+      printf(stdout, "fork failed\n");
+    392b:	83 ec 08             	sub    $0x8,%esp
+    392e:	68 07 85 00 00       	push   $0x8507
+    3933:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3939:	e8 17 2f 00 00       	call   6855 <printf>
+      exit();
+    393e:	e8 35 2d 00 00       	call   6678 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3943:	0f be 03             	movsbl (%ebx),%eax
+    3946:	50                   	push   %eax
+    3947:	53                   	push   %ebx
+    3948:	68 1b 7c 00 00       	push   $0x7c1b
+    394d:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3953:	e8 fd 2e 00 00       	call   6855 <printf>
+      kill(ppid);
+    3958:	89 34 24             	mov    %esi,(%esp)
+    395b:	e8 48 2d 00 00       	call   66a8 <kill>
+      exit();
+    3960:	e8 13 2d 00 00       	call   6678 <exit>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    3965:	83 ec 0c             	sub    $0xc,%esp
+    3968:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    396b:	50                   	push   %eax
+    396c:	e8 17 2d 00 00       	call   6688 <pipe>
+    3971:	89 c3                	mov    %eax,%ebx
+    3973:	83 c4 10             	add    $0x10,%esp
+    3976:	85 c0                	test   %eax,%eax
+    3978:	75 04                	jne    397e <sbrktest+0x2f6>
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    397a:	89 c6                	mov    %eax,%esi
+    397c:	eb 59                	jmp    39d7 <sbrktest+0x34f>
+    printf(1, "pipe() failed\n");
+    397e:	83 ec 08             	sub    $0x8,%esp
+    3981:	68 93 6f 00 00       	push   $0x6f93
+    3986:	6a 01                	push   $0x1
+    3988:	e8 c8 2e 00 00       	call   6855 <printf>
+    exit();
+    398d:	e8 e6 2c 00 00       	call   6678 <exit>
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    3992:	83 ec 0c             	sub    $0xc,%esp
+    3995:	6a 00                	push   $0x0
+    3997:	e8 64 2d 00 00       	call   6700 <sbrk>
+    399c:	89 c2                	mov    %eax,%edx
+    399e:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    39a3:	29 d0                	sub    %edx,%eax
+    39a5:	89 04 24             	mov    %eax,(%esp)
+    39a8:	e8 53 2d 00 00       	call   6700 <sbrk>
+      write(fds[1], "x", 1);
+    39ad:	83 c4 0c             	add    $0xc,%esp
+    39b0:	6a 01                	push   $0x1
+    39b2:	68 10 77 00 00       	push   $0x7710
+    39b7:	ff 75 e4             	push   -0x1c(%ebp)
+    39ba:	e8 d9 2c 00 00       	call   6698 <write>
+    39bf:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    39c2:	83 ec 0c             	sub    $0xc,%esp
+    39c5:	68 e8 03 00 00       	push   $0x3e8
+    39ca:	e8 39 2d 00 00       	call   6708 <sleep>
+    39cf:	83 c4 10             	add    $0x10,%esp
+    39d2:	eb ee                	jmp    39c2 <sbrktest+0x33a>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    39d4:	83 c6 01             	add    $0x1,%esi
+    39d7:	83 fe 09             	cmp    $0x9,%esi
+    39da:	77 28                	ja     3a04 <sbrktest+0x37c>
+    if((pids[i] = fork()) == 0){
+    39dc:	e8 8f 2c 00 00       	call   6670 <fork>
+    39e1:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    39e5:	85 c0                	test   %eax,%eax
+    39e7:	74 a9                	je     3992 <sbrktest+0x30a>
+    }
+    if(pids[i] != -1)
+    39e9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    39ec:	74 e6                	je     39d4 <sbrktest+0x34c>
+      read(fds[0], &scratch, 1);
+    39ee:	83 ec 04             	sub    $0x4,%esp
+    39f1:	6a 01                	push   $0x1
+    39f3:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    39f6:	50                   	push   %eax
+    39f7:	ff 75 e0             	push   -0x20(%ebp)
+    39fa:	e8 91 2c 00 00       	call   6690 <read>
+    39ff:	83 c4 10             	add    $0x10,%esp
+    3a02:	eb d0                	jmp    39d4 <sbrktest+0x34c>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    3a04:	83 ec 0c             	sub    $0xc,%esp
+    3a07:	68 00 10 00 00       	push   $0x1000
+    3a0c:	e8 ef 2c 00 00       	call   6700 <sbrk>
+    3a11:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3a13:	83 c4 10             	add    $0x10,%esp
+    3a16:	eb 03                	jmp    3a1b <sbrktest+0x393>
+    3a18:	83 c3 01             	add    $0x1,%ebx
+    3a1b:	83 fb 09             	cmp    $0x9,%ebx
+    3a1e:	77 1c                	ja     3a3c <sbrktest+0x3b4>
+    if(pids[i] == -1)
+    3a20:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+    3a24:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a27:	74 ef                	je     3a18 <sbrktest+0x390>
+      continue;
+    kill(pids[i]);
+    3a29:	83 ec 0c             	sub    $0xc,%esp
+    3a2c:	50                   	push   %eax
+    3a2d:	e8 76 2c 00 00       	call   66a8 <kill>
+    wait();
+    3a32:	e8 49 2c 00 00       	call   6680 <wait>
+    3a37:	83 c4 10             	add    $0x10,%esp
+    3a3a:	eb dc                	jmp    3a18 <sbrktest+0x390>
+  }
+  if(c == (char*)0xffffffff){
+    3a3c:	83 fe ff             	cmp    $0xffffffff,%esi
+    3a3f:	74 2f                	je     3a70 <sbrktest+0x3e8>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    3a41:	83 ec 0c             	sub    $0xc,%esp
+    3a44:	6a 00                	push   $0x0
+    3a46:	e8 b5 2c 00 00       	call   6700 <sbrk>
+    3a4b:	83 c4 10             	add    $0x10,%esp
+    3a4e:	39 c7                	cmp    %eax,%edi
+    3a50:	72 36                	jb     3a88 <sbrktest+0x400>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    3a52:	83 ec 08             	sub    $0x8,%esp
+    3a55:	68 4f 7c 00 00       	push   $0x7c4f
+    3a5a:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3a60:	e8 f0 2d 00 00       	call   6855 <printf>
+}
+    3a65:	83 c4 10             	add    $0x10,%esp
+    3a68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a6b:	5b                   	pop    %ebx
+    3a6c:	5e                   	pop    %esi
+    3a6d:	5f                   	pop    %edi
+    3a6e:	5d                   	pop    %ebp
+    3a6f:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    3a70:	83 ec 08             	sub    $0x8,%esp
+    3a73:	68 34 7c 00 00       	push   $0x7c34
+    3a78:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3a7e:	e8 d2 2d 00 00       	call   6855 <printf>
+    exit();
+    3a83:	e8 f0 2b 00 00       	call   6678 <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    3a88:	83 ec 0c             	sub    $0xc,%esp
+    3a8b:	6a 00                	push   $0x0
+    3a8d:	e8 6e 2c 00 00       	call   6700 <sbrk>
+    3a92:	29 c7                	sub    %eax,%edi
+    3a94:	89 3c 24             	mov    %edi,(%esp)
+    3a97:	e8 64 2c 00 00       	call   6700 <sbrk>
+    3a9c:	83 c4 10             	add    $0x10,%esp
+    3a9f:	eb b1                	jmp    3a52 <sbrktest+0x3ca>
+
+00003aa1 <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    3aa1:	c3                   	ret
+
+00003aa2 <validatetest>:
+
+void
+validatetest(void)
+{
+    3aa2:	55                   	push   %ebp
+    3aa3:	89 e5                	mov    %esp,%ebp
+    3aa5:	56                   	push   %esi
+    3aa6:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    3aa7:	83 ec 08             	sub    $0x8,%esp
+    3aaa:	68 5d 7c 00 00       	push   $0x7c5d
+    3aaf:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3ab5:	e8 9b 2d 00 00       	call   6855 <printf>
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3aba:	83 c4 10             	add    $0x10,%esp
+    3abd:	be 00 00 00 00       	mov    $0x0,%esi
+    3ac2:	81 fe 00 30 11 00    	cmp    $0x113000,%esi
+    3ac8:	77 69                	ja     3b33 <validatetest+0x91>
+    if((pid = fork()) == 0){
+    3aca:	e8 a1 2b 00 00       	call   6670 <fork>
+    3acf:	89 c3                	mov    %eax,%ebx
+    3ad1:	85 c0                	test   %eax,%eax
+    3ad3:	74 41                	je     3b16 <validatetest+0x74>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    3ad5:	83 ec 0c             	sub    $0xc,%esp
+    3ad8:	6a 00                	push   $0x0
+    3ada:	e8 29 2c 00 00       	call   6708 <sleep>
+    sleep(0);
+    3adf:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3ae6:	e8 1d 2c 00 00       	call   6708 <sleep>
+    kill(pid);
+    3aeb:	89 1c 24             	mov    %ebx,(%esp)
+    3aee:	e8 b5 2b 00 00       	call   66a8 <kill>
+    wait();
+    3af3:	e8 88 2b 00 00       	call   6680 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    3af8:	83 c4 08             	add    $0x8,%esp
+    3afb:	56                   	push   %esi
+    3afc:	68 6c 7c 00 00       	push   $0x7c6c
+    3b01:	e8 d2 2b 00 00       	call   66d8 <link>
+    3b06:	83 c4 10             	add    $0x10,%esp
+    3b09:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b0c:	75 0d                	jne    3b1b <validatetest+0x79>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3b0e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3b14:	eb ac                	jmp    3ac2 <validatetest+0x20>
+      exit();
+    3b16:	e8 5d 2b 00 00       	call   6678 <exit>
+      printf(stdout, "link should not succeed\n");
+    3b1b:	83 ec 08             	sub    $0x8,%esp
+    3b1e:	68 77 7c 00 00       	push   $0x7c77
+    3b23:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3b29:	e8 27 2d 00 00       	call   6855 <printf>
+      exit();
+    3b2e:	e8 45 2b 00 00       	call   6678 <exit>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3b33:	83 ec 08             	sub    $0x8,%esp
+    3b36:	68 90 7c 00 00       	push   $0x7c90
+    3b3b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3b41:	e8 0f 2d 00 00       	call   6855 <printf>
+}
+    3b46:	83 c4 10             	add    $0x10,%esp
+    3b49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3b4c:	5b                   	pop    %ebx
+    3b4d:	5e                   	pop    %esi
+    3b4e:	5d                   	pop    %ebp
+    3b4f:	c3                   	ret
+
+00003b50 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3b50:	55                   	push   %ebp
+    3b51:	89 e5                	mov    %esp,%ebp
+    3b53:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3b56:	68 9d 7c 00 00       	push   $0x7c9d
+    3b5b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3b61:	e8 ef 2c 00 00       	call   6855 <printf>
+  for(i = 0; i < sizeof(uninit); i++){
+    3b66:	83 c4 10             	add    $0x10,%esp
+    3b69:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b6e:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    3b73:	77 26                	ja     3b9b <bsstest+0x4b>
+    if(uninit[i] != '\0'){
+    3b75:	80 b8 c0 a0 00 00 00 	cmpb   $0x0,0xa0c0(%eax)
+    3b7c:	75 05                	jne    3b83 <bsstest+0x33>
+  for(i = 0; i < sizeof(uninit); i++){
+    3b7e:	83 c0 01             	add    $0x1,%eax
+    3b81:	eb eb                	jmp    3b6e <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+    3b83:	83 ec 08             	sub    $0x8,%esp
+    3b86:	68 a7 7c 00 00       	push   $0x7ca7
+    3b8b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3b91:	e8 bf 2c 00 00       	call   6855 <printf>
+      exit();
+    3b96:	e8 dd 2a 00 00       	call   6678 <exit>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3b9b:	83 ec 08             	sub    $0x8,%esp
+    3b9e:	68 b8 7c 00 00       	push   $0x7cb8
+    3ba3:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3ba9:	e8 a7 2c 00 00       	call   6855 <printf>
+}
+    3bae:	83 c4 10             	add    $0x10,%esp
+    3bb1:	c9                   	leave
+    3bb2:	c3                   	ret
+
+00003bb3 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    3bb3:	55                   	push   %ebp
+    3bb4:	89 e5                	mov    %esp,%ebp
+    3bb6:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3bb9:	68 c5 7c 00 00       	push   $0x7cc5
+    3bbe:	e8 05 2b 00 00       	call   66c8 <unlink>
+  pid = fork();
+    3bc3:	e8 a8 2a 00 00       	call   6670 <fork>
+  if(pid == 0){
+    3bc8:	83 c4 10             	add    $0x10,%esp
+    3bcb:	85 c0                	test   %eax,%eax
+    3bcd:	74 4d                	je     3c1c <bigargtest+0x69>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    3bcf:	0f 88 ad 00 00 00    	js     3c82 <bigargtest+0xcf>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    3bd5:	e8 a6 2a 00 00       	call   6680 <wait>
+  fd = open("bigarg-ok", 0);
+    3bda:	83 ec 08             	sub    $0x8,%esp
+    3bdd:	6a 00                	push   $0x0
+    3bdf:	68 c5 7c 00 00       	push   $0x7cc5
+    3be4:	e8 cf 2a 00 00       	call   66b8 <open>
+  if(fd < 0){
+    3be9:	83 c4 10             	add    $0x10,%esp
+    3bec:	85 c0                	test   %eax,%eax
+    3bee:	0f 88 a6 00 00 00    	js     3c9a <bigargtest+0xe7>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    3bf4:	83 ec 0c             	sub    $0xc,%esp
+    3bf7:	50                   	push   %eax
+    3bf8:	e8 a3 2a 00 00       	call   66a0 <close>
+  unlink("bigarg-ok");
+    3bfd:	c7 04 24 c5 7c 00 00 	movl   $0x7cc5,(%esp)
+    3c04:	e8 bf 2a 00 00       	call   66c8 <unlink>
+}
+    3c09:	83 c4 10             	add    $0x10,%esp
+    3c0c:	c9                   	leave
+    3c0d:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3c0e:	c7 04 85 20 0f 01 00 	movl   $0x8d24,0x10f20(,%eax,4)
+    3c15:	24 8d 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3c19:	83 c0 01             	add    $0x1,%eax
+    3c1c:	83 f8 1e             	cmp    $0x1e,%eax
+    3c1f:	7e ed                	jle    3c0e <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    3c21:	c7 05 9c 0f 01 00 00 	movl   $0x0,0x10f9c
+    3c28:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3c2b:	83 ec 08             	sub    $0x8,%esp
+    3c2e:	68 cf 7c 00 00       	push   $0x7ccf
+    3c33:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3c39:	e8 17 2c 00 00       	call   6855 <printf>
+    exec("echo", args);
+    3c3e:	83 c4 08             	add    $0x8,%esp
+    3c41:	68 20 0f 01 00       	push   $0x10f20
+    3c46:	68 cc 6b 00 00       	push   $0x6bcc
+    3c4b:	e8 60 2a 00 00       	call   66b0 <exec>
+    printf(stdout, "bigarg test ok\n");
+    3c50:	83 c4 08             	add    $0x8,%esp
+    3c53:	68 dc 7c 00 00       	push   $0x7cdc
+    3c58:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3c5e:	e8 f2 2b 00 00       	call   6855 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3c63:	83 c4 08             	add    $0x8,%esp
+    3c66:	68 00 02 00 00       	push   $0x200
+    3c6b:	68 c5 7c 00 00       	push   $0x7cc5
+    3c70:	e8 43 2a 00 00       	call   66b8 <open>
+    close(fd);
+    3c75:	89 04 24             	mov    %eax,(%esp)
+    3c78:	e8 23 2a 00 00       	call   66a0 <close>
+    exit();
+    3c7d:	e8 f6 29 00 00       	call   6678 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3c82:	83 ec 08             	sub    $0x8,%esp
+    3c85:	68 ec 7c 00 00       	push   $0x7cec
+    3c8a:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3c90:	e8 c0 2b 00 00       	call   6855 <printf>
+    exit();
+    3c95:	e8 de 29 00 00       	call   6678 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3c9a:	83 ec 08             	sub    $0x8,%esp
+    3c9d:	68 05 7d 00 00       	push   $0x7d05
+    3ca2:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3ca8:	e8 a8 2b 00 00       	call   6855 <printf>
+    exit();
+    3cad:	e8 c6 29 00 00       	call   6678 <exit>
+
+00003cb2 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    3cb2:	55                   	push   %ebp
+    3cb3:	89 e5                	mov    %esp,%ebp
+    3cb5:	57                   	push   %edi
+    3cb6:	56                   	push   %esi
+    3cb7:	53                   	push   %ebx
+    3cb8:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    3cbb:	68 1a 7d 00 00       	push   $0x7d1a
+    3cc0:	6a 01                	push   $0x1
+    3cc2:	e8 8e 2b 00 00       	call   6855 <printf>
+    3cc7:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    3cca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    3ccf:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3cd3:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3cd8:	89 d8                	mov    %ebx,%eax
+    3cda:	f7 ea                	imul   %edx
+    3cdc:	c1 fa 06             	sar    $0x6,%edx
+    3cdf:	89 de                	mov    %ebx,%esi
+    3ce1:	c1 fe 1f             	sar    $0x1f,%esi
+    3ce4:	29 f2                	sub    %esi,%edx
+    3ce6:	8d 42 30             	lea    0x30(%edx),%eax
+    3ce9:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3cec:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    3cf2:	89 d9                	mov    %ebx,%ecx
+    3cf4:	29 d1                	sub    %edx,%ecx
+    3cf6:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    3cfb:	89 c8                	mov    %ecx,%eax
+    3cfd:	f7 ef                	imul   %edi
+    3cff:	c1 fa 05             	sar    $0x5,%edx
+    3d02:	c1 f9 1f             	sar    $0x1f,%ecx
+    3d05:	29 ca                	sub    %ecx,%edx
+    3d07:	83 c2 30             	add    $0x30,%edx
+    3d0a:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d0d:	89 d8                	mov    %ebx,%eax
+    3d0f:	f7 ef                	imul   %edi
+    3d11:	89 d7                	mov    %edx,%edi
+    3d13:	c1 ff 05             	sar    $0x5,%edi
+    3d16:	29 f7                	sub    %esi,%edi
+    3d18:	6b c7 64             	imul   $0x64,%edi,%eax
+    3d1b:	89 df                	mov    %ebx,%edi
+    3d1d:	29 c7                	sub    %eax,%edi
+    3d1f:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3d24:	89 f8                	mov    %edi,%eax
+    3d26:	f7 e9                	imul   %ecx
+    3d28:	c1 fa 02             	sar    $0x2,%edx
+    3d2b:	c1 ff 1f             	sar    $0x1f,%edi
+    3d2e:	29 fa                	sub    %edi,%edx
+    3d30:	83 c2 30             	add    $0x30,%edx
+    3d33:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3d36:	89 d8                	mov    %ebx,%eax
+    3d38:	f7 e9                	imul   %ecx
+    3d3a:	c1 fa 02             	sar    $0x2,%edx
+    3d3d:	29 f2                	sub    %esi,%edx
+    3d3f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3d42:	01 c0                	add    %eax,%eax
+    3d44:	89 da                	mov    %ebx,%edx
+    3d46:	29 c2                	sub    %eax,%edx
+    3d48:	83 c2 30             	add    $0x30,%edx
+    3d4b:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    3d4e:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    3d52:	83 ec 04             	sub    $0x4,%esp
+    3d55:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    3d58:	56                   	push   %esi
+    3d59:	68 27 7d 00 00       	push   $0x7d27
+    3d5e:	6a 01                	push   $0x1
+    3d60:	e8 f0 2a 00 00       	call   6855 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3d65:	83 c4 08             	add    $0x8,%esp
+    3d68:	68 02 02 00 00       	push   $0x202
+    3d6d:	56                   	push   %esi
+    3d6e:	e8 45 29 00 00       	call   66b8 <open>
+    3d73:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3d75:	83 c4 10             	add    $0x10,%esp
+    3d78:	85 c0                	test   %eax,%eax
+    3d7a:	79 1b                	jns    3d97 <fsfull+0xe5>
+      printf(1, "open %s failed\n", name);
+    3d7c:	83 ec 04             	sub    $0x4,%esp
+    3d7f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3d82:	50                   	push   %eax
+    3d83:	68 0c 74 00 00       	push   $0x740c
+    3d88:	6a 01                	push   $0x1
+    3d8a:	e8 c6 2a 00 00       	call   6855 <printf>
+      break;
+    3d8f:	83 c4 10             	add    $0x10,%esp
+    3d92:	e9 e6 00 00 00       	jmp    3e7d <fsfull+0x1cb>
+    }
+    int total = 0;
+    3d97:	bf 00 00 00 00       	mov    $0x0,%edi
+    while(1){
+      int cc = write(fd, buf, 512);
+    3d9c:	83 ec 04             	sub    $0x4,%esp
+    3d9f:	68 00 02 00 00       	push   $0x200
+    3da4:	68 e0 c7 00 00       	push   $0xc7e0
+    3da9:	56                   	push   %esi
+    3daa:	e8 e9 28 00 00       	call   6698 <write>
+      if(cc < 512)
+    3daf:	83 c4 10             	add    $0x10,%esp
+    3db2:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3db7:	7e 04                	jle    3dbd <fsfull+0x10b>
+        break;
+      total += cc;
+    3db9:	01 c7                	add    %eax,%edi
+    while(1){
+    3dbb:	eb df                	jmp    3d9c <fsfull+0xea>
+      fsblocks++;
+    }
+    printf(1, "wrote %d bytes\n", total);
+    3dbd:	83 ec 04             	sub    $0x4,%esp
+    3dc0:	57                   	push   %edi
+    3dc1:	68 33 7d 00 00       	push   $0x7d33
+    3dc6:	6a 01                	push   $0x1
+    3dc8:	e8 88 2a 00 00       	call   6855 <printf>
+    close(fd);
+    3dcd:	89 34 24             	mov    %esi,(%esp)
+    3dd0:	e8 cb 28 00 00       	call   66a0 <close>
+    if(total == 0)
+    3dd5:	83 c4 10             	add    $0x10,%esp
+    3dd8:	85 ff                	test   %edi,%edi
+    3dda:	0f 84 9d 00 00 00    	je     3e7d <fsfull+0x1cb>
+  for(nfiles = 0; ; nfiles++){
+    3de0:	83 c3 01             	add    $0x1,%ebx
+    3de3:	e9 e7 fe ff ff       	jmp    3ccf <fsfull+0x1d>
+      break;
+  }
+
+  while(nfiles >= 0){
+    char name[64];
+    name[0] = 'f';
+    3de8:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3dec:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3df1:	89 d8                	mov    %ebx,%eax
+    3df3:	f7 ea                	imul   %edx
+    3df5:	c1 fa 06             	sar    $0x6,%edx
+    3df8:	89 de                	mov    %ebx,%esi
+    3dfa:	c1 fe 1f             	sar    $0x1f,%esi
+    3dfd:	29 f2                	sub    %esi,%edx
+    3dff:	8d 42 30             	lea    0x30(%edx),%eax
+    3e02:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3e05:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    3e0b:	89 d9                	mov    %ebx,%ecx
+    3e0d:	29 d1                	sub    %edx,%ecx
+    3e0f:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    3e14:	89 c8                	mov    %ecx,%eax
+    3e16:	f7 ef                	imul   %edi
+    3e18:	c1 fa 05             	sar    $0x5,%edx
+    3e1b:	c1 f9 1f             	sar    $0x1f,%ecx
+    3e1e:	29 ca                	sub    %ecx,%edx
+    3e20:	83 c2 30             	add    $0x30,%edx
+    3e23:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3e26:	89 d8                	mov    %ebx,%eax
+    3e28:	f7 ef                	imul   %edi
+    3e2a:	89 d7                	mov    %edx,%edi
+    3e2c:	c1 ff 05             	sar    $0x5,%edi
+    3e2f:	29 f7                	sub    %esi,%edi
+    3e31:	6b c7 64             	imul   $0x64,%edi,%eax
+    3e34:	89 df                	mov    %ebx,%edi
+    3e36:	29 c7                	sub    %eax,%edi
+    3e38:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3e3d:	89 f8                	mov    %edi,%eax
+    3e3f:	f7 e9                	imul   %ecx
+    3e41:	c1 fa 02             	sar    $0x2,%edx
+    3e44:	c1 ff 1f             	sar    $0x1f,%edi
+    3e47:	29 fa                	sub    %edi,%edx
+    3e49:	83 c2 30             	add    $0x30,%edx
+    3e4c:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3e4f:	89 d8                	mov    %ebx,%eax
+    3e51:	f7 e9                	imul   %ecx
+    3e53:	c1 fa 02             	sar    $0x2,%edx
+    3e56:	29 f2                	sub    %esi,%edx
+    3e58:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3e5b:	01 c0                	add    %eax,%eax
+    3e5d:	89 da                	mov    %ebx,%edx
+    3e5f:	29 c2                	sub    %eax,%edx
+    3e61:	83 c2 30             	add    $0x30,%edx
+    3e64:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    3e67:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    3e6b:	83 ec 0c             	sub    $0xc,%esp
+    3e6e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3e71:	50                   	push   %eax
+    3e72:	e8 51 28 00 00       	call   66c8 <unlink>
+    nfiles--;
+    3e77:	83 eb 01             	sub    $0x1,%ebx
+    3e7a:	83 c4 10             	add    $0x10,%esp
+  while(nfiles >= 0){
+    3e7d:	85 db                	test   %ebx,%ebx
+    3e7f:	0f 89 63 ff ff ff    	jns    3de8 <fsfull+0x136>
+  }
+
+  printf(1, "fsfull test finished\n");
+    3e85:	83 ec 08             	sub    $0x8,%esp
+    3e88:	68 43 7d 00 00       	push   $0x7d43
+    3e8d:	6a 01                	push   $0x1
+    3e8f:	e8 c1 29 00 00       	call   6855 <printf>
+}
+    3e94:	83 c4 10             	add    $0x10,%esp
+    3e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3e9a:	5b                   	pop    %ebx
+    3e9b:	5e                   	pop    %esi
+    3e9c:	5f                   	pop    %edi
+    3e9d:	5d                   	pop    %ebp
+    3e9e:	c3                   	ret
+
+00003e9f <mmaptest>:
+
+// mmap() of a file, privately and shared, and of anonymous memory.
+void
+mmaptest(void)
+{
+    3e9f:	55                   	push   %ebp
+    3ea0:	89 e5                	mov    %esp,%ebp
+    3ea2:	57                   	push   %edi
+    3ea3:	56                   	push   %esi
+    3ea4:	53                   	push   %ebx
+    3ea5:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, pid;
+  char *p, *q;
+
+  printf(stdout, "mmap test\n");
+    3ea8:	68 59 7d 00 00       	push   $0x7d59
+    3ead:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3eb3:	e8 9d 29 00 00       	call   6855 <printf>
+
+  unlink("mmapfile");
+    3eb8:	c7 04 24 64 7d 00 00 	movl   $0x7d64,(%esp)
+    3ebf:	e8 04 28 00 00       	call   66c8 <unlink>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    3ec4:	83 c4 08             	add    $0x8,%esp
+    3ec7:	68 02 02 00 00       	push   $0x202
+    3ecc:	68 64 7d 00 00       	push   $0x7d64
+    3ed1:	e8 e2 27 00 00       	call   66b8 <open>
+  if(fd < 0){
+    3ed6:	83 c4 10             	add    $0x10,%esp
+    3ed9:	85 c0                	test   %eax,%eax
+    3edb:	78 09                	js     3ee6 <mmaptest+0x47>
+    3edd:	89 c3                	mov    %eax,%ebx
+    printf(stdout, "mmap: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 6000; i++)
+    3edf:	b9 00 00 00 00       	mov    $0x0,%ecx
+    3ee4:	eb 3e                	jmp    3f24 <mmaptest+0x85>
+    printf(stdout, "mmap: create failed\n");
+    3ee6:	83 ec 08             	sub    $0x8,%esp
+    3ee9:	68 6d 7d 00 00       	push   $0x7d6d
+    3eee:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3ef4:	e8 5c 29 00 00       	call   6855 <printf>
+    exit();
+    3ef9:	e8 7a 27 00 00       	call   6678 <exit>
+    buf[i] = 'a' + i % 26;
+    3efe:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    3f03:	89 c8                	mov    %ecx,%eax
+    3f05:	f7 ea                	imul   %edx
+    3f07:	c1 fa 03             	sar    $0x3,%edx
+    3f0a:	89 c8                	mov    %ecx,%eax
+    3f0c:	c1 f8 1f             	sar    $0x1f,%eax
+    3f0f:	29 c2                	sub    %eax,%edx
+    3f11:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    3f14:	89 ca                	mov    %ecx,%edx
+    3f16:	29 c2                	sub    %eax,%edx
+    3f18:	83 c2 61             	add    $0x61,%edx
+    3f1b:	88 91 e0 c7 00 00    	mov    %dl,0xc7e0(%ecx)
+  for(i = 0; i < 6000; i++)
+    3f21:	83 c1 01             	add    $0x1,%ecx
+    3f24:	81 f9 6f 17 00 00    	cmp    $0x176f,%ecx
+    3f2a:	7e d2                	jle    3efe <mmaptest+0x5f>
+  if(write(fd, buf, 6000) != 6000){
+    3f2c:	83 ec 04             	sub    $0x4,%esp
+    3f2f:	68 70 17 00 00       	push   $0x1770
+    3f34:	68 e0 c7 00 00       	push   $0xc7e0
+    3f39:	53                   	push   %ebx
+    3f3a:	e8 59 27 00 00       	call   6698 <write>
+    3f3f:	83 c4 10             	add    $0x10,%esp
+    3f42:	3d 70 17 00 00       	cmp    $0x1770,%eax
+    3f47:	75 57                	jne    3fa0 <mmaptest+0x101>
+    printf(stdout, "mmap: write failed\n");
+    exit();
+  }
+
+  // private: contents match, writes stay private
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    3f49:	83 ec 08             	sub    $0x8,%esp
+    3f4c:	6a 00                	push   $0x0
+    3f4e:	53                   	push   %ebx
+    3f4f:	6a 02                	push   $0x2
+    3f51:	6a 03                	push   $0x3
+    3f53:	68 70 17 00 00       	push   $0x1770
+    3f58:	6a 00                	push   $0x0
+    3f5a:	e8 d9 27 00 00       	call   6738 <mmap>
+    3f5f:	89 c7                	mov    %eax,%edi
+  if(p == MAP_FAILED){
+    3f61:	83 c4 20             	add    $0x20,%esp
+    3f64:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3f67:	74 4f                	je     3fb8 <mmaptest+0x119>
+    printf(stdout, "mmap: private mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < 6000; i++){
+    3f69:	b9 00 00 00 00       	mov    $0x0,%ecx
+    3f6e:	81 f9 6f 17 00 00    	cmp    $0x176f,%ecx
+    3f74:	7f 73                	jg     3fe9 <mmaptest+0x14a>
+    if(p[i] != 'a' + i % 26){
+    3f76:	0f be 34 0f          	movsbl (%edi,%ecx,1),%esi
+    3f7a:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    3f7f:	89 c8                	mov    %ecx,%eax
+    3f81:	f7 ea                	imul   %edx
+    3f83:	c1 fa 03             	sar    $0x3,%edx
+    3f86:	89 c8                	mov    %ecx,%eax
+    3f88:	c1 f8 1f             	sar    $0x1f,%eax
+    3f8b:	29 c2                	sub    %eax,%edx
+    3f8d:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    3f90:	89 ca                	mov    %ecx,%edx
+    3f92:	29 c2                	sub    %eax,%edx
+    3f94:	83 c2 61             	add    $0x61,%edx
+    3f97:	39 d6                	cmp    %edx,%esi
+    3f99:	75 35                	jne    3fd0 <mmaptest+0x131>
+  for(i = 0; i < 6000; i++){
+    3f9b:	83 c1 01             	add    $0x1,%ecx
+    3f9e:	eb ce                	jmp    3f6e <mmaptest+0xcf>
+    printf(stdout, "mmap: write failed\n");
+    3fa0:	83 ec 08             	sub    $0x8,%esp
+    3fa3:	68 82 7d 00 00       	push   $0x7d82
+    3fa8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3fae:	e8 a2 28 00 00       	call   6855 <printf>
+    exit();
+    3fb3:	e8 c0 26 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: private mmap failed\n");
+    3fb8:	83 ec 08             	sub    $0x8,%esp
+    3fbb:	68 96 7d 00 00       	push   $0x7d96
+    3fc0:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3fc6:	e8 8a 28 00 00       	call   6855 <printf>
+    exit();
+    3fcb:	e8 a8 26 00 00       	call   6678 <exit>
+      printf(stdout, "mmap: private content wrong at %d\n", i);
+    3fd0:	83 ec 04             	sub    $0x4,%esp
+    3fd3:	51                   	push   %ecx
+    3fd4:	68 04 8e 00 00       	push   $0x8e04
+    3fd9:	ff 35 a4 a0 00 00    	push   0xa0a4
+    3fdf:	e8 71 28 00 00       	call   6855 <printf>
+      exit();
+    3fe4:	e8 8f 26 00 00       	call   6678 <exit>
+    }
+  }
+  if(p[6000] != 0 || p[8191] != 0){
+    3fe9:	80 bf 70 17 00 00 00 	cmpb   $0x0,0x1770(%edi)
+    3ff0:	0f 85 78 01 00 00    	jne    416e <mmaptest+0x2cf>
+    3ff6:	80 bf ff 1f 00 00 00 	cmpb   $0x0,0x1fff(%edi)
+    3ffd:	0f 85 6b 01 00 00    	jne    416e <mmaptest+0x2cf>
+    printf(stdout, "mmap: tail of last page not zero\n");
+    exit();
+  }
+  p[0] = 'Z';
+    4003:	c6 07 5a             	movb   $0x5a,(%edi)
+  if(munmap(p, 6000) < 0){
+    4006:	83 ec 08             	sub    $0x8,%esp
+    4009:	68 70 17 00 00       	push   $0x1770
+    400e:	57                   	push   %edi
+    400f:	e8 2c 27 00 00       	call   6740 <munmap>
+    4014:	83 c4 10             	add    $0x10,%esp
+    4017:	85 c0                	test   %eax,%eax
+    4019:	0f 88 67 01 00 00    	js     4186 <mmaptest+0x2e7>
+    printf(stdout, "mmap: munmap failed\n");
+    exit();
+  }
+
+  // shared: a store is seen by read() and by a child
+  q = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    401f:	83 ec 08             	sub    $0x8,%esp
+    4022:	6a 00                	push   $0x0
+    4024:	53                   	push   %ebx
+    4025:	6a 01                	push   $0x1
+    4027:	6a 03                	push   $0x3
+    4029:	68 70 17 00 00       	push   $0x1770
+    402e:	6a 00                	push   $0x0
+    4030:	e8 03 27 00 00       	call   6738 <mmap>
+    4035:	89 c6                	mov    %eax,%esi
+  if(q == MAP_FAILED){
+    4037:	83 c4 20             	add    $0x20,%esp
+    403a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    403d:	0f 84 5b 01 00 00    	je     419e <mmaptest+0x2ff>
+    printf(stdout, "mmap: shared mmap failed\n");
+    exit();
+  }
+  if(q[0] != 'a'){
+    4043:	80 38 61             	cmpb   $0x61,(%eax)
+    4046:	0f 85 6a 01 00 00    	jne    41b6 <mmaptest+0x317>
+    printf(stdout, "mmap: private store leaked into file\n");
+    exit();
+  }
+  q[1] = 'X';
+    404c:	c6 40 01 58          	movb   $0x58,0x1(%eax)
+  pid = fork();
+    4050:	e8 1b 26 00 00       	call   6670 <fork>
+  if(pid < 0){
+    4055:	85 c0                	test   %eax,%eax
+    4057:	0f 88 71 01 00 00    	js     41ce <mmaptest+0x32f>
+    printf(stdout, "mmap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    405d:	0f 84 83 01 00 00    	je     41e6 <mmaptest+0x347>
+    if(q[1] != 'X')
+      printf(stdout, "mmap: child does not see store\n");
+    q[4097] = 'Y';
+    exit();
+  }
+  wait();
+    4063:	e8 18 26 00 00       	call   6680 <wait>
+  if(q[4097] != 'Y'){
+    4068:	80 be 01 10 00 00 59 	cmpb   $0x59,0x1001(%esi)
+    406f:	0f 85 9b 01 00 00    	jne    4210 <mmaptest+0x371>
+    printf(stdout, "mmap: parent does not see child store\n");
+    exit();
+  }
+  // write() from a mapped buffer
+  if(write(fd, q, 10) != 10){
+    4075:	83 ec 04             	sub    $0x4,%esp
+    4078:	6a 0a                	push   $0xa
+    407a:	56                   	push   %esi
+    407b:	53                   	push   %ebx
+    407c:	e8 17 26 00 00       	call   6698 <write>
+    4081:	83 c4 10             	add    $0x10,%esp
+    4084:	83 f8 0a             	cmp    $0xa,%eax
+    4087:	0f 85 9b 01 00 00    	jne    4228 <mmaptest+0x389>
+    printf(stdout, "mmap: write from mapping failed\n");
+    exit();
+  }
+  munmap(q, 6000);
+    408d:	83 ec 08             	sub    $0x8,%esp
+    4090:	68 70 17 00 00       	push   $0x1770
+    4095:	56                   	push   %esi
+    4096:	e8 a5 26 00 00       	call   6740 <munmap>
+  close(fd);
+    409b:	89 1c 24             	mov    %ebx,(%esp)
+    409e:	e8 fd 25 00 00       	call   66a0 <close>
+
+  fd = open("mmapfile", O_RDONLY);
+    40a3:	83 c4 08             	add    $0x8,%esp
+    40a6:	6a 00                	push   $0x0
+    40a8:	68 64 7d 00 00       	push   $0x7d64
+    40ad:	e8 06 26 00 00       	call   66b8 <open>
+    40b2:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, 6000) != 6000 || buf[1] != 'X' || buf[4097] != 'Y'){
+    40b4:	83 c4 0c             	add    $0xc,%esp
+    40b7:	68 70 17 00 00       	push   $0x1770
+    40bc:	68 e0 c7 00 00       	push   $0xc7e0
+    40c1:	50                   	push   %eax
+    40c2:	e8 c9 25 00 00       	call   6690 <read>
+    40c7:	83 c4 10             	add    $0x10,%esp
+    40ca:	3d 70 17 00 00       	cmp    $0x1770,%eax
+    40cf:	0f 85 6b 01 00 00    	jne    4240 <mmaptest+0x3a1>
+    40d5:	80 3d e1 c7 00 00 58 	cmpb   $0x58,0xc7e1
+    40dc:	0f 85 5e 01 00 00    	jne    4240 <mmaptest+0x3a1>
+    40e2:	80 3d e1 d7 00 00 59 	cmpb   $0x59,0xd7e1
+    40e9:	0f 85 51 01 00 00    	jne    4240 <mmaptest+0x3a1>
+    printf(stdout, "mmap: shared stores not written back\n");
+    exit();
+  }
+  // shared writable mapping needs a writable descriptor
+  if(mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED){
+    40ef:	83 ec 08             	sub    $0x8,%esp
+    40f2:	6a 00                	push   $0x0
+    40f4:	53                   	push   %ebx
+    40f5:	6a 01                	push   $0x1
+    40f7:	6a 03                	push   $0x3
+    40f9:	68 00 10 00 00       	push   $0x1000
+    40fe:	6a 00                	push   $0x0
+    4100:	e8 33 26 00 00       	call   6738 <mmap>
+    4105:	83 c4 20             	add    $0x20,%esp
+    4108:	83 f8 ff             	cmp    $0xffffffff,%eax
+    410b:	0f 85 47 01 00 00    	jne    4258 <mmaptest+0x3b9>
+    printf(stdout, "mmap: shared writable mapping of read-only file\n");
+    exit();
+  }
+  close(fd);
+    4111:	83 ec 0c             	sub    $0xc,%esp
+    4114:	53                   	push   %ebx
+    4115:	e8 86 25 00 00       	call   66a0 <close>
+  unlink("mmapfile");
+    411a:	c7 04 24 64 7d 00 00 	movl   $0x7d64,(%esp)
+    4121:	e8 a2 25 00 00       	call   66c8 <unlink>
+
+  // anonymous: zeroed, and gone after munmap
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    4126:	83 c4 08             	add    $0x8,%esp
+    4129:	6a 00                	push   $0x0
+    412b:	6a ff                	push   $0xffffffff
+    412d:	6a 22                	push   $0x22
+    412f:	6a 03                	push   $0x3
+    4131:	68 00 30 00 00       	push   $0x3000
+    4136:	6a 00                	push   $0x0
+    4138:	e8 fb 25 00 00       	call   6738 <mmap>
+    413d:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED){
+    413f:	83 c4 20             	add    $0x20,%esp
+    4142:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4145:	0f 84 25 01 00 00    	je     4270 <mmaptest+0x3d1>
+    printf(stdout, "mmap: anonymous mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < 3*4096; i++){
+    414b:	b8 00 00 00 00       	mov    $0x0,%eax
+    4150:	3d ff 2f 00 00       	cmp    $0x2fff,%eax
+    4155:	0f 8f 45 01 00 00    	jg     42a0 <mmaptest+0x401>
+    if(p[i] != 0){
+    415b:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+    415e:	80 3a 00             	cmpb   $0x0,(%edx)
+    4161:	0f 85 21 01 00 00    	jne    4288 <mmaptest+0x3e9>
+      printf(stdout, "mmap: anonymous page not zero\n");
+      exit();
+    }
+    p[i] = i;
+    4167:	88 02                	mov    %al,(%edx)
+  for(i = 0; i < 3*4096; i++){
+    4169:	83 c0 01             	add    $0x1,%eax
+    416c:	eb e2                	jmp    4150 <mmaptest+0x2b1>
+    printf(stdout, "mmap: tail of last page not zero\n");
+    416e:	83 ec 08             	sub    $0x8,%esp
+    4171:	68 28 8e 00 00       	push   $0x8e28
+    4176:	ff 35 a4 a0 00 00    	push   0xa0a4
+    417c:	e8 d4 26 00 00       	call   6855 <printf>
+    exit();
+    4181:	e8 f2 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: munmap failed\n");
+    4186:	83 ec 08             	sub    $0x8,%esp
+    4189:	68 b1 7d 00 00       	push   $0x7db1
+    418e:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4194:	e8 bc 26 00 00       	call   6855 <printf>
+    exit();
+    4199:	e8 da 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: shared mmap failed\n");
+    419e:	83 ec 08             	sub    $0x8,%esp
+    41a1:	68 c6 7d 00 00       	push   $0x7dc6
+    41a6:	ff 35 a4 a0 00 00    	push   0xa0a4
+    41ac:	e8 a4 26 00 00       	call   6855 <printf>
+    exit();
+    41b1:	e8 c2 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: private store leaked into file\n");
+    41b6:	83 ec 08             	sub    $0x8,%esp
+    41b9:	68 4c 8e 00 00       	push   $0x8e4c
+    41be:	ff 35 a4 a0 00 00    	push   0xa0a4
+    41c4:	e8 8c 26 00 00       	call   6855 <printf>
+    exit();
+    41c9:	e8 aa 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: fork failed\n");
+    41ce:	83 ec 08             	sub    $0x8,%esp
+    41d1:	68 e0 7d 00 00       	push   $0x7de0
+    41d6:	ff 35 a4 a0 00 00    	push   0xa0a4
+    41dc:	e8 74 26 00 00       	call   6855 <printf>
+    exit();
+    41e1:	e8 92 24 00 00       	call   6678 <exit>
+    if(q[1] != 'X')
+    41e6:	80 7e 01 58          	cmpb   $0x58,0x1(%esi)
+    41ea:	75 0c                	jne    41f8 <mmaptest+0x359>
+    q[4097] = 'Y';
+    41ec:	c6 86 01 10 00 00 59 	movb   $0x59,0x1001(%esi)
+    exit();
+    41f3:	e8 80 24 00 00       	call   6678 <exit>
+      printf(stdout, "mmap: child does not see store\n");
+    41f8:	83 ec 08             	sub    $0x8,%esp
+    41fb:	68 74 8e 00 00       	push   $0x8e74
+    4200:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4206:	e8 4a 26 00 00       	call   6855 <printf>
+    420b:	83 c4 10             	add    $0x10,%esp
+    420e:	eb dc                	jmp    41ec <mmaptest+0x34d>
+    printf(stdout, "mmap: parent does not see child store\n");
+    4210:	83 ec 08             	sub    $0x8,%esp
+    4213:	68 94 8e 00 00       	push   $0x8e94
+    4218:	ff 35 a4 a0 00 00    	push   0xa0a4
+    421e:	e8 32 26 00 00       	call   6855 <printf>
+    exit();
+    4223:	e8 50 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: write from mapping failed\n");
+    4228:	83 ec 08             	sub    $0x8,%esp
+    422b:	68 bc 8e 00 00       	push   $0x8ebc
+    4230:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4236:	e8 1a 26 00 00       	call   6855 <printf>
+    exit();
+    423b:	e8 38 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: shared stores not written back\n");
+    4240:	83 ec 08             	sub    $0x8,%esp
+    4243:	68 e0 8e 00 00       	push   $0x8ee0
+    4248:	ff 35 a4 a0 00 00    	push   0xa0a4
+    424e:	e8 02 26 00 00       	call   6855 <printf>
+    exit();
+    4253:	e8 20 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: shared writable mapping of read-only file\n");
+    4258:	83 ec 08             	sub    $0x8,%esp
+    425b:	68 08 8f 00 00       	push   $0x8f08
+    4260:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4266:	e8 ea 25 00 00       	call   6855 <printf>
+    exit();
+    426b:	e8 08 24 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: anonymous mmap failed\n");
+    4270:	83 ec 08             	sub    $0x8,%esp
+    4273:	68 f3 7d 00 00       	push   $0x7df3
+    4278:	ff 35 a4 a0 00 00    	push   0xa0a4
+    427e:	e8 d2 25 00 00       	call   6855 <printf>
+    exit();
+    4283:	e8 f0 23 00 00       	call   6678 <exit>
+      printf(stdout, "mmap: anonymous page not zero\n");
+    4288:	83 ec 08             	sub    $0x8,%esp
+    428b:	68 3c 8f 00 00       	push   $0x8f3c
+    4290:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4296:	e8 ba 25 00 00       	call   6855 <printf>
+      exit();
+    429b:	e8 d8 23 00 00       	call   6678 <exit>
+  }
+  munmap(p + 4096, 4096);
+    42a0:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    42a6:	83 ec 08             	sub    $0x8,%esp
+    42a9:	68 00 10 00 00       	push   $0x1000
+    42ae:	50                   	push   %eax
+    42af:	e8 8c 24 00 00       	call   6740 <munmap>
+  if(p[0] != 0 || p[2*4096+1] != 1){
+    42b4:	83 c4 10             	add    $0x10,%esp
+    42b7:	80 3b 00             	cmpb   $0x0,(%ebx)
+    42ba:	0f 85 ac 00 00 00    	jne    436c <mmaptest+0x4cd>
+    42c0:	80 bb 01 20 00 00 01 	cmpb   $0x1,0x2001(%ebx)
+    42c7:	0f 85 9f 00 00 00    	jne    436c <mmaptest+0x4cd>
+    printf(stdout, "mmap: munmap of middle page clobbered neighbours\n");
+    exit();
+  }
+  pid = fork();
+    42cd:	e8 9e 23 00 00       	call   6670 <fork>
+  if(pid == 0){
+    42d2:	85 c0                	test   %eax,%eax
+    42d4:	0f 84 aa 00 00 00    	je     4384 <mmaptest+0x4e5>
+    p[4096] = 1;
+    printf(stdout, "mmap: store to unmapped page succeeded\n");
+    exit();
+  }
+  wait();
+    42da:	e8 a1 23 00 00       	call   6680 <wait>
+  munmap(p, 3*4096);
+    42df:	83 ec 08             	sub    $0x8,%esp
+    42e2:	68 00 30 00 00       	push   $0x3000
+    42e7:	53                   	push   %ebx
+    42e8:	e8 53 24 00 00       	call   6740 <munmap>
+
+  // shared anonymous: shared with a child forked before any
+  // page was touched
+  p = mmap(0, 2*4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    42ed:	83 c4 08             	add    $0x8,%esp
+    42f0:	6a 00                	push   $0x0
+    42f2:	6a ff                	push   $0xffffffff
+    42f4:	6a 21                	push   $0x21
+    42f6:	6a 03                	push   $0x3
+    42f8:	68 00 20 00 00       	push   $0x2000
+    42fd:	6a 00                	push   $0x0
+    42ff:	e8 34 24 00 00       	call   6738 <mmap>
+    4304:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED){
+    4306:	83 c4 20             	add    $0x20,%esp
+    4309:	83 f8 ff             	cmp    $0xffffffff,%eax
+    430c:	0f 84 91 00 00 00    	je     43a3 <mmaptest+0x504>
+    printf(stdout, "mmap: shared anonymous mmap failed\n");
+    exit();
+  }
+  pid = fork();
+    4312:	e8 59 23 00 00       	call   6670 <fork>
+  if(pid < 0){
+    4317:	85 c0                	test   %eax,%eax
+    4319:	0f 88 9c 00 00 00    	js     43bb <mmaptest+0x51c>
+    printf(stdout, "mmap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    431f:	0f 84 ae 00 00 00    	je     43d3 <mmaptest+0x534>
+    p[0] = 'C';
+    p[4096+7] = 'D';
+    exit();
+  }
+  wait();
+    4325:	e8 56 23 00 00       	call   6680 <wait>
+  if(p[0] != 'C' || p[4096+7] != 'D'){
+    432a:	80 3b 43             	cmpb   $0x43,(%ebx)
+    432d:	0f 85 af 00 00 00    	jne    43e2 <mmaptest+0x543>
+    4333:	80 bb 07 10 00 00 44 	cmpb   $0x44,0x1007(%ebx)
+    433a:	0f 85 a2 00 00 00    	jne    43e2 <mmaptest+0x543>
+    printf(stdout, "mmap: parent does not see child store to shared anonymous page\n");
+    exit();
+  }
+  munmap(p, 2*4096);
+    4340:	83 ec 08             	sub    $0x8,%esp
+    4343:	68 00 20 00 00       	push   $0x2000
+    4348:	53                   	push   %ebx
+    4349:	e8 f2 23 00 00       	call   6740 <munmap>
+
+  printf(stdout, "mmap test ok\n");
+    434e:	83 c4 08             	add    $0x8,%esp
+    4351:	68 10 7e 00 00       	push   $0x7e10
+    4356:	ff 35 a4 a0 00 00    	push   0xa0a4
+    435c:	e8 f4 24 00 00       	call   6855 <printf>
+}
+    4361:	83 c4 10             	add    $0x10,%esp
+    4364:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4367:	5b                   	pop    %ebx
+    4368:	5e                   	pop    %esi
+    4369:	5f                   	pop    %edi
+    436a:	5d                   	pop    %ebp
+    436b:	c3                   	ret
+    printf(stdout, "mmap: munmap of middle page clobbered neighbours\n");
+    436c:	83 ec 08             	sub    $0x8,%esp
+    436f:	68 5c 8f 00 00       	push   $0x8f5c
+    4374:	ff 35 a4 a0 00 00    	push   0xa0a4
+    437a:	e8 d6 24 00 00       	call   6855 <printf>
+    exit();
+    437f:	e8 f4 22 00 00       	call   6678 <exit>
+    p[4096] = 1;
+    4384:	c6 83 00 10 00 00 01 	movb   $0x1,0x1000(%ebx)
+    printf(stdout, "mmap: store to unmapped page succeeded\n");
+    438b:	83 ec 08             	sub    $0x8,%esp
+    438e:	68 90 8f 00 00       	push   $0x8f90
+    4393:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4399:	e8 b7 24 00 00       	call   6855 <printf>
+    exit();
+    439e:	e8 d5 22 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: shared anonymous mmap failed\n");
+    43a3:	83 ec 08             	sub    $0x8,%esp
+    43a6:	68 b8 8f 00 00       	push   $0x8fb8
+    43ab:	ff 35 a4 a0 00 00    	push   0xa0a4
+    43b1:	e8 9f 24 00 00       	call   6855 <printf>
+    exit();
+    43b6:	e8 bd 22 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: fork failed\n");
+    43bb:	83 ec 08             	sub    $0x8,%esp
+    43be:	68 e0 7d 00 00       	push   $0x7de0
+    43c3:	ff 35 a4 a0 00 00    	push   0xa0a4
+    43c9:	e8 87 24 00 00       	call   6855 <printf>
+    exit();
+    43ce:	e8 a5 22 00 00       	call   6678 <exit>
+    p[0] = 'C';
+    43d3:	c6 03 43             	movb   $0x43,(%ebx)
+    p[4096+7] = 'D';
+    43d6:	c6 83 07 10 00 00 44 	movb   $0x44,0x1007(%ebx)
+    exit();
+    43dd:	e8 96 22 00 00       	call   6678 <exit>
+    printf(stdout, "mmap: parent does not see child store to shared anonymous page\n");
+    43e2:	83 ec 08             	sub    $0x8,%esp
+    43e5:	68 dc 8f 00 00       	push   $0x8fdc
+    43ea:	ff 35 a4 a0 00 00    	push   0xa0a4
+    43f0:	e8 60 24 00 00       	call   6855 <printf>
+    exit();
+    43f5:	e8 7e 22 00 00       	call   6678 <exit>
+
+000043fa <shmtest>:
+
+// named shared memory between unrelated attachments
+void
+shmtest(void)
+{
+    43fa:	55                   	push   %ebp
+    43fb:	89 e5                	mov    %esp,%ebp
+    43fd:	53                   	push   %ebx
+    43fe:	83 ec 0c             	sub    $0xc,%esp
+  char *p, *q;
+  int pid, i;
+
+  printf(stdout, "shm test\n");
+    4401:	68 1e 7e 00 00       	push   $0x7e1e
+    4406:	ff 35 a4 a0 00 00    	push   0xa0a4
+    440c:	e8 44 24 00 00       	call   6855 <printf>
+
+  p = shmat("shmtest", 2);
+    4411:	83 c4 08             	add    $0x8,%esp
+    4414:	6a 02                	push   $0x2
+    4416:	68 28 7e 00 00       	push   $0x7e28
+    441b:	e8 28 23 00 00       	call   6748 <shmat>
+  if(p == (char*)-1){
+    4420:	83 c4 10             	add    $0x10,%esp
+    4423:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4426:	74 19                	je     4441 <shmtest+0x47>
+    4428:	89 c3                	mov    %eax,%ebx
+    printf(stdout, "shm: shmat failed\n");
+    exit();
+  }
+  for(i = 0; i < 2*4096; i++){
+    442a:	b8 00 00 00 00       	mov    $0x0,%eax
+    442f:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+    4434:	7f 3b                	jg     4471 <shmtest+0x77>
+    if(p[i] != 0){
+    4436:	80 3c 03 00          	cmpb   $0x0,(%ebx,%eax,1)
+    443a:	75 1d                	jne    4459 <shmtest+0x5f>
+  for(i = 0; i < 2*4096; i++){
+    443c:	83 c0 01             	add    $0x1,%eax
+    443f:	eb ee                	jmp    442f <shmtest+0x35>
+    printf(stdout, "shm: shmat failed\n");
+    4441:	83 ec 08             	sub    $0x8,%esp
+    4444:	68 30 7e 00 00       	push   $0x7e30
+    4449:	ff 35 a4 a0 00 00    	push   0xa0a4
+    444f:	e8 01 24 00 00       	call   6855 <printf>
+    exit();
+    4454:	e8 1f 22 00 00       	call   6678 <exit>
+      printf(stdout, "shm: new segment not zero\n");
+    4459:	83 ec 08             	sub    $0x8,%esp
+    445c:	68 43 7e 00 00       	push   $0x7e43
+    4461:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4467:	e8 e9 23 00 00       	call   6855 <printf>
+      exit();
+    446c:	e8 07 22 00 00       	call   6678 <exit>
+    }
+  }
+  p[0] = 'P';
+    4471:	c6 03 50             	movb   $0x50,(%ebx)
+
+  pid = fork();
+    4474:	e8 f7 21 00 00       	call   6670 <fork>
+  if(pid < 0){
+    4479:	85 c0                	test   %eax,%eax
+    447b:	78 3f                	js     44bc <shmtest+0xc2>
+    printf(stdout, "shm: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    447d:	75 6a                	jne    44e9 <shmtest+0xef>
+    // drop the inherited attachment and attach by name
+    shmdt(p);
+    447f:	83 ec 0c             	sub    $0xc,%esp
+    4482:	53                   	push   %ebx
+    4483:	e8 c8 22 00 00       	call   6750 <shmdt>
+    q = shmat("shmtest", 0);
+    4488:	83 c4 08             	add    $0x8,%esp
+    448b:	6a 00                	push   $0x0
+    448d:	68 28 7e 00 00       	push   $0x7e28
+    4492:	e8 b1 22 00 00       	call   6748 <shmat>
+    if(q == (char*)-1 || q[0] != 'P'){
+    4497:	83 c4 10             	add    $0x10,%esp
+    449a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    449d:	74 05                	je     44a4 <shmtest+0xaa>
+    449f:	80 38 50             	cmpb   $0x50,(%eax)
+    44a2:	74 30                	je     44d4 <shmtest+0xda>
+      printf(stdout, "shm: child cannot see segment\n");
+    44a4:	83 ec 08             	sub    $0x8,%esp
+    44a7:	68 1c 90 00 00       	push   $0x901c
+    44ac:	ff 35 a4 a0 00 00    	push   0xa0a4
+    44b2:	e8 9e 23 00 00       	call   6855 <printf>
+      exit();
+    44b7:	e8 bc 21 00 00       	call   6678 <exit>
+    printf(stdout, "shm: fork failed\n");
+    44bc:	83 ec 08             	sub    $0x8,%esp
+    44bf:	68 5e 7e 00 00       	push   $0x7e5e
+    44c4:	ff 35 a4 a0 00 00    	push   0xa0a4
+    44ca:	e8 86 23 00 00       	call   6855 <printf>
+    exit();
+    44cf:	e8 a4 21 00 00       	call   6678 <exit>
+    }
+    q[4096+5] = 'C';
+    44d4:	c6 80 05 10 00 00 43 	movb   $0x43,0x1005(%eax)
+    shmdt(q);
+    44db:	83 ec 0c             	sub    $0xc,%esp
+    44de:	50                   	push   %eax
+    44df:	e8 6c 22 00 00       	call   6750 <shmdt>
+    exit();
+    44e4:	e8 8f 21 00 00       	call   6678 <exit>
+  }
+  wait();
+    44e9:	e8 92 21 00 00       	call   6680 <wait>
+  if(p[4096+5] != 'C'){
+    44ee:	80 bb 05 10 00 00 43 	cmpb   $0x43,0x1005(%ebx)
+    44f5:	0f 85 92 00 00 00    	jne    458d <shmtest+0x193>
+    printf(stdout, "shm: parent does not see child store\n");
+    exit();
+  }
+  if(shmat("shmtest", 3) != (char*)-1){
+    44fb:	83 ec 08             	sub    $0x8,%esp
+    44fe:	6a 03                	push   $0x3
+    4500:	68 28 7e 00 00       	push   $0x7e28
+    4505:	e8 3e 22 00 00       	call   6748 <shmat>
+    450a:	83 c4 10             	add    $0x10,%esp
+    450d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4510:	0f 85 8f 00 00 00    	jne    45a5 <shmtest+0x1ab>
+    printf(stdout, "shm: attached more pages than the segment has\n");
+    exit();
+  }
+  if(shmdt(p) < 0){
+    4516:	83 ec 0c             	sub    $0xc,%esp
+    4519:	53                   	push   %ebx
+    451a:	e8 31 22 00 00       	call   6750 <shmdt>
+    451f:	83 c4 10             	add    $0x10,%esp
+    4522:	85 c0                	test   %eax,%eax
+    4524:	0f 88 93 00 00 00    	js     45bd <shmtest+0x1c3>
+    printf(stdout, "shm: shmdt failed\n");
+    exit();
+  }
+
+  // the last detach freed it
+  if(shmat("shmtest", 0) != (char*)-1){
+    452a:	83 ec 08             	sub    $0x8,%esp
+    452d:	6a 00                	push   $0x0
+    452f:	68 28 7e 00 00       	push   $0x7e28
+    4534:	e8 0f 22 00 00       	call   6748 <shmat>
+    4539:	83 c4 10             	add    $0x10,%esp
+    453c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    453f:	0f 85 90 00 00 00    	jne    45d5 <shmtest+0x1db>
+    printf(stdout, "shm: segment outlived its last detach\n");
+    exit();
+  }
+  p = shmat("shmtest", 1);
+    4545:	83 ec 08             	sub    $0x8,%esp
+    4548:	6a 01                	push   $0x1
+    454a:	68 28 7e 00 00       	push   $0x7e28
+    454f:	e8 f4 21 00 00       	call   6748 <shmat>
+  if(p == (char*)-1 || p[0] != 0){
+    4554:	83 c4 10             	add    $0x10,%esp
+    4557:	83 f8 ff             	cmp    $0xffffffff,%eax
+    455a:	0f 84 8d 00 00 00    	je     45ed <shmtest+0x1f3>
+    4560:	80 38 00             	cmpb   $0x0,(%eax)
+    4563:	0f 85 84 00 00 00    	jne    45ed <shmtest+0x1f3>
+    printf(stdout, "shm: recreated segment not zero\n");
+    exit();
+  }
+  shmdt(p);
+    4569:	83 ec 0c             	sub    $0xc,%esp
+    456c:	50                   	push   %eax
+    456d:	e8 de 21 00 00       	call   6750 <shmdt>
+
+  printf(stdout, "shm test ok\n");
+    4572:	83 c4 08             	add    $0x8,%esp
+    4575:	68 83 7e 00 00       	push   $0x7e83
+    457a:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4580:	e8 d0 22 00 00       	call   6855 <printf>
+}
+    4585:	83 c4 10             	add    $0x10,%esp
+    4588:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    458b:	c9                   	leave
+    458c:	c3                   	ret
+    printf(stdout, "shm: parent does not see child store\n");
+    458d:	83 ec 08             	sub    $0x8,%esp
+    4590:	68 3c 90 00 00       	push   $0x903c
+    4595:	ff 35 a4 a0 00 00    	push   0xa0a4
+    459b:	e8 b5 22 00 00       	call   6855 <printf>
+    exit();
+    45a0:	e8 d3 20 00 00       	call   6678 <exit>
+    printf(stdout, "shm: attached more pages than the segment has\n");
+    45a5:	83 ec 08             	sub    $0x8,%esp
+    45a8:	68 64 90 00 00       	push   $0x9064
+    45ad:	ff 35 a4 a0 00 00    	push   0xa0a4
+    45b3:	e8 9d 22 00 00       	call   6855 <printf>
+    exit();
+    45b8:	e8 bb 20 00 00       	call   6678 <exit>
+    printf(stdout, "shm: shmdt failed\n");
+    45bd:	83 ec 08             	sub    $0x8,%esp
+    45c0:	68 70 7e 00 00       	push   $0x7e70
+    45c5:	ff 35 a4 a0 00 00    	push   0xa0a4
+    45cb:	e8 85 22 00 00       	call   6855 <printf>
+    exit();
+    45d0:	e8 a3 20 00 00       	call   6678 <exit>
+    printf(stdout, "shm: segment outlived its last detach\n");
+    45d5:	83 ec 08             	sub    $0x8,%esp
+    45d8:	68 94 90 00 00       	push   $0x9094
+    45dd:	ff 35 a4 a0 00 00    	push   0xa0a4
+    45e3:	e8 6d 22 00 00       	call   6855 <printf>
+    exit();
+    45e8:	e8 8b 20 00 00       	call   6678 <exit>
+    printf(stdout, "shm: recreated segment not zero\n");
+    45ed:	83 ec 08             	sub    $0x8,%esp
+    45f0:	68 bc 90 00 00       	push   $0x90bc
+    45f5:	ff 35 a4 a0 00 00    	push   0xa0a4
+    45fb:	e8 55 22 00 00       	call   6855 <printf>
+    exit();
+    4600:	e8 73 20 00 00       	call   6678 <exit>
+
+00004605 <hugetest>:
+
+// MAP_HUGE regions: 4MB aligned, zeroed, copied by fork.
+void
+hugetest(void)
+{
+    4605:	55                   	push   %ebp
+    4606:	89 e5                	mov    %esp,%ebp
+    4608:	53                   	push   %ebx
+    4609:	83 ec 0c             	sub    $0xc,%esp
+  char *p;
+  int pid, i;
+
+  printf(stdout, "huge test\n");
+    460c:	68 90 7e 00 00       	push   $0x7e90
+    4611:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4617:	e8 39 22 00 00       	call   6855 <printf>
+
+  p = mmap(0, 8*1024*1024, PROT_READ|PROT_WRITE,
+    461c:	83 c4 08             	add    $0x8,%esp
+    461f:	6a 00                	push   $0x0
+    4621:	6a ff                	push   $0xffffffff
+    4623:	6a 62                	push   $0x62
+    4625:	6a 03                	push   $0x3
+    4627:	68 00 00 80 00       	push   $0x800000
+    462c:	6a 00                	push   $0x0
+    462e:	e8 05 21 00 00       	call   6738 <mmap>
+           MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGE, -1, 0);
+  if(p == MAP_FAILED){
+    4633:	83 c4 20             	add    $0x20,%esp
+    4636:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4639:	74 2b                	je     4666 <hugetest+0x61>
+    463b:	89 c3                	mov    %eax,%ebx
+    printf(stdout, "huge: mmap failed\n");
+    exit();
+  }
+  if((uint)p % (4*1024*1024) != 0){
+    463d:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+    4642:	75 3a                	jne    467e <hugetest+0x79>
+    printf(stdout, "huge: region not 4MB aligned\n");
+    exit();
+  }
+  for(i = 0; i < 8*1024*1024; i += 4096){
+    4644:	b8 00 00 00 00       	mov    $0x0,%eax
+    4649:	3d ff ff 7f 00       	cmp    $0x7fffff,%eax
+    464e:	7f 5e                	jg     46ae <hugetest+0xa9>
+    if(p[i] != 0){
+    4650:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+    4653:	80 3a 00             	cmpb   $0x0,(%edx)
+    4656:	75 3e                	jne    4696 <hugetest+0x91>
+      printf(stdout, "huge: page not zero\n");
+      exit();
+    }
+    p[i] = i >> 12;
+    4658:	89 c1                	mov    %eax,%ecx
+    465a:	c1 f9 0c             	sar    $0xc,%ecx
+    465d:	88 0a                	mov    %cl,(%edx)
+  for(i = 0; i < 8*1024*1024; i += 4096){
+    465f:	05 00 10 00 00       	add    $0x1000,%eax
+    4664:	eb e3                	jmp    4649 <hugetest+0x44>
+    printf(stdout, "huge: mmap failed\n");
+    4666:	83 ec 08             	sub    $0x8,%esp
+    4669:	68 9b 7e 00 00       	push   $0x7e9b
+    466e:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4674:	e8 dc 21 00 00       	call   6855 <printf>
+    exit();
+    4679:	e8 fa 1f 00 00       	call   6678 <exit>
+    printf(stdout, "huge: region not 4MB aligned\n");
+    467e:	83 ec 08             	sub    $0x8,%esp
+    4681:	68 ae 7e 00 00       	push   $0x7eae
+    4686:	ff 35 a4 a0 00 00    	push   0xa0a4
+    468c:	e8 c4 21 00 00       	call   6855 <printf>
+    exit();
+    4691:	e8 e2 1f 00 00       	call   6678 <exit>
+      printf(stdout, "huge: page not zero\n");
+    4696:	83 ec 08             	sub    $0x8,%esp
+    4699:	68 cc 7e 00 00       	push   $0x7ecc
+    469e:	ff 35 a4 a0 00 00    	push   0xa0a4
+    46a4:	e8 ac 21 00 00       	call   6855 <printf>
+      exit();
+    46a9:	e8 ca 1f 00 00       	call   6678 <exit>
+  }
+
+  pid = fork();
+    46ae:	e8 bd 1f 00 00       	call   6670 <fork>
+  if(pid < 0){
+    46b3:	85 c0                	test   %eax,%eax
+    46b5:	78 1a                	js     46d1 <hugetest+0xcc>
+    printf(stdout, "huge: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    46b7:	75 50                	jne    4709 <hugetest+0x104>
+    for(i = 0; i < 8*1024*1024; i += 4096){
+    46b9:	3d ff ff 7f 00       	cmp    $0x7fffff,%eax
+    46be:	7f 41                	jg     4701 <hugetest+0xfc>
+      if(p[i] != (char)(i >> 12)){
+    46c0:	89 c2                	mov    %eax,%edx
+    46c2:	c1 fa 0c             	sar    $0xc,%edx
+    46c5:	38 14 03             	cmp    %dl,(%ebx,%eax,1)
+    46c8:	75 1f                	jne    46e9 <hugetest+0xe4>
+    for(i = 0; i < 8*1024*1024; i += 4096){
+    46ca:	05 00 10 00 00       	add    $0x1000,%eax
+    46cf:	eb e8                	jmp    46b9 <hugetest+0xb4>
+    printf(stdout, "huge: fork failed\n");
+    46d1:	83 ec 08             	sub    $0x8,%esp
+    46d4:	68 e1 7e 00 00       	push   $0x7ee1
+    46d9:	ff 35 a4 a0 00 00    	push   0xa0a4
+    46df:	e8 71 21 00 00       	call   6855 <printf>
+    exit();
+    46e4:	e8 8f 1f 00 00       	call   6678 <exit>
+        printf(stdout, "huge: child sees wrong data\n");
+    46e9:	83 ec 08             	sub    $0x8,%esp
+    46ec:	68 f4 7e 00 00       	push   $0x7ef4
+    46f1:	ff 35 a4 a0 00 00    	push   0xa0a4
+    46f7:	e8 59 21 00 00       	call   6855 <printf>
+        exit();
+    46fc:	e8 77 1f 00 00       	call   6678 <exit>
+      }
+    }
+    p[0] = 'C';
+    4701:	c6 03 43             	movb   $0x43,(%ebx)
+    exit();
+    4704:	e8 6f 1f 00 00       	call   6678 <exit>
+  }
+  wait();
+    4709:	e8 72 1f 00 00       	call   6680 <wait>
+  if(p[0] != 0){
+    470e:	80 3b 00             	cmpb   $0x0,(%ebx)
+    4711:	75 68                	jne    477b <hugetest+0x176>
+    printf(stdout, "huge: child store leaked into parent\n");
+    exit();
+  }
+  // huge regions can only be cut at 4MB boundaries
+  if(munmap(p + 4096, 4096) == 0){
+    4713:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    4719:	83 ec 08             	sub    $0x8,%esp
+    471c:	68 00 10 00 00       	push   $0x1000
+    4721:	50                   	push   %eax
+    4722:	e8 19 20 00 00       	call   6740 <munmap>
+    4727:	83 c4 10             	add    $0x10,%esp
+    472a:	85 c0                	test   %eax,%eax
+    472c:	74 65                	je     4793 <hugetest+0x18e>
+    printf(stdout, "huge: munmap of a small piece succeeded\n");
+    exit();
+  }
+  if(munmap(p, 4*1024*1024) < 0 || p[4*1024*1024 + 4096] != 1){
+    472e:	83 ec 08             	sub    $0x8,%esp
+    4731:	68 00 00 40 00       	push   $0x400000
+    4736:	53                   	push   %ebx
+    4737:	e8 04 20 00 00       	call   6740 <munmap>
+    473c:	83 c4 10             	add    $0x10,%esp
+    473f:	85 c0                	test   %eax,%eax
+    4741:	78 68                	js     47ab <hugetest+0x1a6>
+    4743:	80 bb 00 10 40 00 01 	cmpb   $0x1,0x401000(%ebx)
+    474a:	75 5f                	jne    47ab <hugetest+0x1a6>
+    printf(stdout, "huge: munmap of first 4MB failed\n");
+    exit();
+  }
+  munmap(p + 4*1024*1024, 4*1024*1024);
+    474c:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+    4752:	83 ec 08             	sub    $0x8,%esp
+    4755:	68 00 00 40 00       	push   $0x400000
+    475a:	53                   	push   %ebx
+    475b:	e8 e0 1f 00 00       	call   6740 <munmap>
+
+  printf(stdout, "huge test ok\n");
+    4760:	83 c4 08             	add    $0x8,%esp
+    4763:	68 11 7f 00 00       	push   $0x7f11
+    4768:	ff 35 a4 a0 00 00    	push   0xa0a4
+    476e:	e8 e2 20 00 00       	call   6855 <printf>
+}
+    4773:	83 c4 10             	add    $0x10,%esp
+    4776:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4779:	c9                   	leave
+    477a:	c3                   	ret
+    printf(stdout, "huge: child store leaked into parent\n");
+    477b:	83 ec 08             	sub    $0x8,%esp
+    477e:	68 e0 90 00 00       	push   $0x90e0
+    4783:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4789:	e8 c7 20 00 00       	call   6855 <printf>
+    exit();
+    478e:	e8 e5 1e 00 00       	call   6678 <exit>
+    printf(stdout, "huge: munmap of a small piece succeeded\n");
+    4793:	83 ec 08             	sub    $0x8,%esp
+    4796:	68 08 91 00 00       	push   $0x9108
+    479b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    47a1:	e8 af 20 00 00       	call   6855 <printf>
+    exit();
+    47a6:	e8 cd 1e 00 00       	call   6678 <exit>
+    printf(stdout, "huge: munmap of first 4MB failed\n");
+    47ab:	83 ec 08             	sub    $0x8,%esp
+    47ae:	68 34 91 00 00       	push   $0x9134
+    47b3:	ff 35 a4 a0 00 00    	push   0xa0a4
+    47b9:	e8 97 20 00 00       	call   6855 <printf>
+    exit();
+    47be:	e8 b5 1e 00 00       	call   6678 <exit>
+
+000047c3 <swaptest>:
+
+// allocate more than physical memory; the excess is paged out
+void
+swaptest(void)
+{
+    47c3:	55                   	push   %ebp
+    47c4:	89 e5                	mov    %esp,%ebp
+    47c6:	57                   	push   %edi
+    47c7:	56                   	push   %esi
+    47c8:	53                   	push   %ebx
+    47c9:	83 ec 64             	sub    $0x64,%esp
+  struct vmstat st0, st1;
+  char *start, *p, c;
+  int pid, pid2, n, i, up[2], down[2];
+
+  printf(stdout, "swap test\n");
+    47cc:	68 1f 7f 00 00       	push   $0x7f1f
+    47d1:	ff 35 a4 a0 00 00    	push   0xa0a4
+    47d7:	e8 79 20 00 00       	call   6855 <printf>
+
+  getvmstat(&st0);
+    47dc:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    47df:	89 04 24             	mov    %eax,(%esp)
+    47e2:	e8 71 1f 00 00       	call   6758 <getvmstat>
+  if(st0.swapsize == 0){
+    47e7:	83 c4 10             	add    $0x10,%esp
+    47ea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    47ee:	0f 84 a6 00 00 00    	je     489a <swaptest+0xd7>
+    printf(stdout, "swap: no swap space, skipped\n");
+    return;
+  }
+  if(pipe(up) != 0 || pipe(down) != 0){
+    47f4:	83 ec 0c             	sub    $0xc,%esp
+    47f7:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    47fa:	50                   	push   %eax
+    47fb:	e8 88 1e 00 00       	call   6688 <pipe>
+    4800:	83 c4 10             	add    $0x10,%esp
+    4803:	85 c0                	test   %eax,%eax
+    4805:	0f 85 ad 00 00 00    	jne    48b8 <swaptest+0xf5>
+    480b:	83 ec 0c             	sub    $0xc,%esp
+    480e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    4811:	50                   	push   %eax
+    4812:	e8 71 1e 00 00       	call   6688 <pipe>
+    4817:	83 c4 10             	add    $0x10,%esp
+    481a:	85 c0                	test   %eax,%eax
+    481c:	0f 85 96 00 00 00    	jne    48b8 <swaptest+0xf5>
+    printf(stdout, "swap: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+    4822:	e8 49 1e 00 00       	call   6670 <fork>
+    4827:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    4829:	85 c0                	test   %eax,%eax
+    482b:	0f 88 9f 00 00 00    	js     48d0 <swaptest+0x10d>
+    printf(stdout, "swap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    4831:	0f 85 65 01 00 00    	jne    499c <swaptest+0x1d9>
+    close(up[0]);
+    4837:	83 ec 0c             	sub    $0xc,%esp
+    483a:	ff 75 b4             	push   -0x4c(%ebp)
+    483d:	e8 5e 1e 00 00       	call   66a0 <close>
+    close(down[1]);
+    4842:	83 c4 04             	add    $0x4,%esp
+    4845:	ff 75 b0             	push   -0x50(%ebp)
+    4848:	e8 53 1e 00 00       	call   66a0 <close>
+    n = st0.freepages + st0.swapsize/2;
+    484d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    4850:	d1 ee                	shr    %esi
+    4852:	03 75 d4             	add    -0x2c(%ebp),%esi
+    start = sbrk(0);
+    4855:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    485c:	e8 9f 1e 00 00       	call   6700 <sbrk>
+    4861:	89 c7                	mov    %eax,%edi
+    for(i = 0; i < n; i++){
+    4863:	83 c4 10             	add    $0x10,%esp
+    4866:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+    4869:	39 75 a4             	cmp    %esi,-0x5c(%ebp)
+    486c:	0f 8d aa 00 00 00    	jge    491c <swaptest+0x159>
+      if((p = sbrk(4096)) == (char*)-1){
+    4872:	83 ec 0c             	sub    $0xc,%esp
+    4875:	68 00 10 00 00       	push   $0x1000
+    487a:	e8 81 1e 00 00       	call   6700 <sbrk>
+    487f:	83 c4 10             	add    $0x10,%esp
+    4882:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4885:	74 61                	je     48e8 <swaptest+0x125>
+        printf(stdout, "swap: sbrk failed after %d pages\n", i);
+        exit();
+      }
+      p[0] = i;
+    4887:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    488a:	88 08                	mov    %cl,(%eax)
+      p[4095] = i >> 8;
+    488c:	88 a8 ff 0f 00 00    	mov    %ch,0xfff(%eax)
+    for(i = 0; i < n; i++){
+    4892:	83 c1 01             	add    $0x1,%ecx
+    4895:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+    4898:	eb cf                	jmp    4869 <swaptest+0xa6>
+    printf(stdout, "swap: no swap space, skipped\n");
+    489a:	83 ec 08             	sub    $0x8,%esp
+    489d:	68 2a 7f 00 00       	push   $0x7f2a
+    48a2:	ff 35 a4 a0 00 00    	push   0xa0a4
+    48a8:	e8 a8 1f 00 00       	call   6855 <printf>
+    return;
+    48ad:	83 c4 10             	add    $0x10,%esp
+  if(st1.swapused != st0.swapused){
+    printf(stdout, "swap: exit leaked swap slots\n");
+    exit();
+  }
+  printf(stdout, "swap test ok\n");
+}
+    48b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    48b3:	5b                   	pop    %ebx
+    48b4:	5e                   	pop    %esi
+    48b5:	5f                   	pop    %edi
+    48b6:	5d                   	pop    %ebp
+    48b7:	c3                   	ret
+    printf(stdout, "swap: pipe failed\n");
+    48b8:	83 ec 08             	sub    $0x8,%esp
+    48bb:	68 48 7f 00 00       	push   $0x7f48
+    48c0:	ff 35 a4 a0 00 00    	push   0xa0a4
+    48c6:	e8 8a 1f 00 00       	call   6855 <printf>
+    exit();
+    48cb:	e8 a8 1d 00 00       	call   6678 <exit>
+    printf(stdout, "swap: fork failed\n");
+    48d0:	83 ec 08             	sub    $0x8,%esp
+    48d3:	68 5b 7f 00 00       	push   $0x7f5b
+    48d8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    48de:	e8 72 1f 00 00       	call   6855 <printf>
+    exit();
+    48e3:	e8 90 1d 00 00       	call   6678 <exit>
+        printf(stdout, "swap: sbrk failed after %d pages\n", i);
+    48e8:	83 ec 04             	sub    $0x4,%esp
+    48eb:	ff 75 a4             	push   -0x5c(%ebp)
+    48ee:	68 58 91 00 00       	push   $0x9158
+    48f3:	ff 35 a4 a0 00 00    	push   0xa0a4
+    48f9:	e8 57 1f 00 00       	call   6855 <printf>
+        exit();
+    48fe:	e8 75 1d 00 00       	call   6678 <exit>
+        printf(stdout, "swap: page %d lost its contents\n", i);
+    4903:	83 ec 04             	sub    $0x4,%esp
+    4906:	53                   	push   %ebx
+    4907:	68 7c 91 00 00       	push   $0x917c
+    490c:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4912:	e8 3e 1f 00 00       	call   6855 <printf>
+        exit();
+    4917:	e8 5c 1d 00 00       	call   6678 <exit>
+    for(i = 0; i < n; i++){
+    491c:	39 f3                	cmp    %esi,%ebx
+    491e:	7d 1d                	jge    493d <swaptest+0x17a>
+      p = start + i*4096;
+    4920:	89 d8                	mov    %ebx,%eax
+    4922:	c1 e0 0c             	shl    $0xc,%eax
+    4925:	01 f8                	add    %edi,%eax
+      if(p[0] != (char)i || p[4095] != (char)(i >> 8)){
+    4927:	38 18                	cmp    %bl,(%eax)
+    4929:	75 d8                	jne    4903 <swaptest+0x140>
+    492b:	89 da                	mov    %ebx,%edx
+    492d:	c1 fa 08             	sar    $0x8,%edx
+    4930:	38 90 ff 0f 00 00    	cmp    %dl,0xfff(%eax)
+    4936:	75 cb                	jne    4903 <swaptest+0x140>
+    for(i = 0; i < n; i++){
+    4938:	83 c3 01             	add    $0x1,%ebx
+    493b:	eb df                	jmp    491c <swaptest+0x159>
+    getvmstat(&st1);
+    493d:	83 ec 0c             	sub    $0xc,%esp
+    4940:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    4943:	50                   	push   %eax
+    4944:	e8 0f 1e 00 00       	call   6758 <getvmstat>
+    if(st1.pageout == st0.pageout || st1.pagein == st0.pagein)
+    4949:	83 c4 10             	add    $0x10,%esp
+    494c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    494f:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+    4952:	74 30                	je     4984 <swaptest+0x1c1>
+    4954:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    4957:	39 45 c4             	cmp    %eax,-0x3c(%ebp)
+    495a:	74 28                	je     4984 <swaptest+0x1c1>
+    write(up[1], "x", 1);
+    495c:	83 ec 04             	sub    $0x4,%esp
+    495f:	6a 01                	push   $0x1
+    4961:	68 10 77 00 00       	push   $0x7710
+    4966:	ff 75 b8             	push   -0x48(%ebp)
+    4969:	e8 2a 1d 00 00       	call   6698 <write>
+    read(down[0], &c, 1);
+    496e:	83 c4 0c             	add    $0xc,%esp
+    4971:	6a 01                	push   $0x1
+    4973:	8d 45 bf             	lea    -0x41(%ebp),%eax
+    4976:	50                   	push   %eax
+    4977:	ff 75 ac             	push   -0x54(%ebp)
+    497a:	e8 11 1d 00 00       	call   6690 <read>
+    exit();
+    497f:	e8 f4 1c 00 00       	call   6678 <exit>
+      printf(stdout, "swap: no paging, test FAILED\n");
+    4984:	83 ec 08             	sub    $0x8,%esp
+    4987:	68 6e 7f 00 00       	push   $0x7f6e
+    498c:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4992:	e8 be 1e 00 00       	call   6855 <printf>
+    4997:	83 c4 10             	add    $0x10,%esp
+    499a:	eb c0                	jmp    495c <swaptest+0x199>
+  close(up[1]);
+    499c:	83 ec 0c             	sub    $0xc,%esp
+    499f:	ff 75 b8             	push   -0x48(%ebp)
+    49a2:	e8 f9 1c 00 00       	call   66a0 <close>
+  close(down[0]);
+    49a7:	83 c4 04             	add    $0x4,%esp
+    49aa:	ff 75 ac             	push   -0x54(%ebp)
+    49ad:	e8 ee 1c 00 00       	call   66a0 <close>
+  if(read(up[0], &c, 1) != 1){
+    49b2:	83 c4 0c             	add    $0xc,%esp
+    49b5:	6a 01                	push   $0x1
+    49b7:	8d 45 bf             	lea    -0x41(%ebp),%eax
+    49ba:	50                   	push   %eax
+    49bb:	ff 75 b4             	push   -0x4c(%ebp)
+    49be:	e8 cd 1c 00 00       	call   6690 <read>
+    49c3:	83 c4 10             	add    $0x10,%esp
+    49c6:	83 f8 01             	cmp    $0x1,%eax
+    49c9:	75 76                	jne    4a41 <swaptest+0x27e>
+  pid2 = fork();
+    49cb:	e8 a0 1c 00 00       	call   6670 <fork>
+  if(pid2 == 0)
+    49d0:	85 c0                	test   %eax,%eax
+    49d2:	0f 84 81 00 00 00    	je     4a59 <swaptest+0x296>
+  if(pid2 < 0)
+    49d8:	0f 88 80 00 00 00    	js     4a5e <swaptest+0x29b>
+    wait();
+    49de:	e8 9d 1c 00 00       	call   6680 <wait>
+  write(down[1], "x", 1);
+    49e3:	83 ec 04             	sub    $0x4,%esp
+    49e6:	6a 01                	push   $0x1
+    49e8:	68 10 77 00 00       	push   $0x7710
+    49ed:	ff 75 b0             	push   -0x50(%ebp)
+    49f0:	e8 a3 1c 00 00       	call   6698 <write>
+  wait();
+    49f5:	e8 86 1c 00 00       	call   6680 <wait>
+  close(up[0]);
+    49fa:	83 c4 04             	add    $0x4,%esp
+    49fd:	ff 75 b4             	push   -0x4c(%ebp)
+    4a00:	e8 9b 1c 00 00       	call   66a0 <close>
+  close(down[1]);
+    4a05:	83 c4 04             	add    $0x4,%esp
+    4a08:	ff 75 b0             	push   -0x50(%ebp)
+    4a0b:	e8 90 1c 00 00       	call   66a0 <close>
+  getvmstat(&st1);
+    4a10:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    4a13:	89 04 24             	mov    %eax,(%esp)
+    4a16:	e8 3d 1d 00 00       	call   6758 <getvmstat>
+  if(st1.swapused != st0.swapused){
+    4a1b:	83 c4 10             	add    $0x10,%esp
+    4a1e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4a21:	39 45 cc             	cmp    %eax,-0x34(%ebp)
+    4a24:	75 53                	jne    4a79 <swaptest+0x2b6>
+  printf(stdout, "swap test ok\n");
+    4a26:	83 ec 08             	sub    $0x8,%esp
+    4a29:	68 bc 7f 00 00       	push   $0x7fbc
+    4a2e:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4a34:	e8 1c 1e 00 00       	call   6855 <printf>
+    4a39:	83 c4 10             	add    $0x10,%esp
+    4a3c:	e9 6f fe ff ff       	jmp    48b0 <swaptest+0xed>
+    printf(stdout, "swap: child died\n");
+    4a41:	83 ec 08             	sub    $0x8,%esp
+    4a44:	68 8c 7f 00 00       	push   $0x7f8c
+    4a49:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4a4f:	e8 01 1e 00 00       	call   6855 <printf>
+    exit();
+    4a54:	e8 1f 1c 00 00       	call   6678 <exit>
+    exit();
+    4a59:	e8 1a 1c 00 00       	call   6678 <exit>
+    printf(stdout, "swap: fork with memory overcommitted failed, test FAILED\n");
+    4a5e:	83 ec 08             	sub    $0x8,%esp
+    4a61:	68 a0 91 00 00       	push   $0x91a0
+    4a66:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4a6c:	e8 e4 1d 00 00       	call   6855 <printf>
+    4a71:	83 c4 10             	add    $0x10,%esp
+    4a74:	e9 6a ff ff ff       	jmp    49e3 <swaptest+0x220>
+    printf(stdout, "swap: exit leaked swap slots\n");
+    4a79:	83 ec 08             	sub    $0x8,%esp
+    4a7c:	68 9e 7f 00 00       	push   $0x7f9e
+    4a81:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4a87:	e8 c9 1d 00 00       	call   6855 <printf>
+    exit();
+    4a8c:	e8 e7 1b 00 00       	call   6678 <exit>
+
+00004a91 <bcachetest>:
+
+// the buffer cache grows past its minimum size and counts hits
+void
+bcachetest(void)
+{
+    4a91:	55                   	push   %ebp
+    4a92:	89 e5                	mov    %esp,%ebp
+    4a94:	56                   	push   %esi
+    4a95:	53                   	push   %ebx
+    4a96:	83 ec 38             	sub    $0x38,%esp
+  struct bstat st0, st1;
+  int fd, i;
+
+  printf(stdout, "bcache test\n");
+    4a99:	68 ca 7f 00 00       	push   $0x7fca
+    4a9e:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4aa4:	e8 ac 1d 00 00       	call   6855 <printf>
+
+  unlink("bcachefile");
+    4aa9:	c7 04 24 d7 7f 00 00 	movl   $0x7fd7,(%esp)
+    4ab0:	e8 13 1c 00 00       	call   66c8 <unlink>
+  fd = open("bcachefile", O_CREATE|O_RDWR);
+    4ab5:	83 c4 08             	add    $0x8,%esp
+    4ab8:	68 02 02 00 00       	push   $0x202
+    4abd:	68 d7 7f 00 00       	push   $0x7fd7
+    4ac2:	e8 f1 1b 00 00       	call   66b8 <open>
+  if(fd < 0){
+    4ac7:	83 c4 10             	add    $0x10,%esp
+    4aca:	85 c0                	test   %eax,%eax
+    4acc:	78 2e                	js     4afc <bcachetest+0x6b>
+    4ace:	89 c6                	mov    %eax,%esi
+    printf(stdout, "bcache: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 80; i++){
+    4ad0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4ad5:	83 fb 4f             	cmp    $0x4f,%ebx
+    4ad8:	7f 52                	jg     4b2c <bcachetest+0x9b>
+    if(write(fd, buf, 512) != 512){
+    4ada:	83 ec 04             	sub    $0x4,%esp
+    4add:	68 00 02 00 00       	push   $0x200
+    4ae2:	68 e0 c7 00 00       	push   $0xc7e0
+    4ae7:	56                   	push   %esi
+    4ae8:	e8 ab 1b 00 00       	call   6698 <write>
+    4aed:	83 c4 10             	add    $0x10,%esp
+    4af0:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4af5:	75 1d                	jne    4b14 <bcachetest+0x83>
+  for(i = 0; i < 80; i++){
+    4af7:	83 c3 01             	add    $0x1,%ebx
+    4afa:	eb d9                	jmp    4ad5 <bcachetest+0x44>
+    printf(stdout, "bcache: create failed\n");
+    4afc:	83 ec 08             	sub    $0x8,%esp
+    4aff:	68 e2 7f 00 00       	push   $0x7fe2
+    4b04:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4b0a:	e8 46 1d 00 00       	call   6855 <printf>
+    exit();
+    4b0f:	e8 64 1b 00 00       	call   6678 <exit>
+      printf(stdout, "bcache: write failed\n");
+    4b14:	83 ec 08             	sub    $0x8,%esp
+    4b17:	68 f9 7f 00 00       	push   $0x7ff9
+    4b1c:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4b22:	e8 2e 1d 00 00       	call   6855 <printf>
+      exit();
+    4b27:	e8 4c 1b 00 00       	call   6678 <exit>
+    }
+  }
+  close(fd);
+    4b2c:	83 ec 0c             	sub    $0xc,%esp
+    4b2f:	56                   	push   %esi
+    4b30:	e8 6b 1b 00 00       	call   66a0 <close>
+
+  getbstat(&st0);
+    4b35:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    4b38:	89 04 24             	mov    %eax,(%esp)
+    4b3b:	e8 20 1c 00 00       	call   6760 <getbstat>
+  for(i = 0; i < 2; i++){
+    4b40:	83 c4 10             	add    $0x10,%esp
+    4b43:	be 00 00 00 00       	mov    $0x0,%esi
+    4b48:	eb 40                	jmp    4b8a <bcachetest+0xf9>
+    fd = open("bcachefile", O_RDONLY);
+    4b4a:	83 ec 08             	sub    $0x8,%esp
+    4b4d:	6a 00                	push   $0x0
+    4b4f:	68 d7 7f 00 00       	push   $0x7fd7
+    4b54:	e8 5f 1b 00 00       	call   66b8 <open>
+    4b59:	89 c3                	mov    %eax,%ebx
+    while(read(fd, buf, 512) == 512)
+    4b5b:	83 c4 10             	add    $0x10,%esp
+    4b5e:	83 ec 04             	sub    $0x4,%esp
+    4b61:	68 00 02 00 00       	push   $0x200
+    4b66:	68 e0 c7 00 00       	push   $0xc7e0
+    4b6b:	53                   	push   %ebx
+    4b6c:	e8 1f 1b 00 00       	call   6690 <read>
+    4b71:	83 c4 10             	add    $0x10,%esp
+    4b74:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4b79:	74 e3                	je     4b5e <bcachetest+0xcd>
+      ;
+    close(fd);
+    4b7b:	83 ec 0c             	sub    $0xc,%esp
+    4b7e:	53                   	push   %ebx
+    4b7f:	e8 1c 1b 00 00       	call   66a0 <close>
+  for(i = 0; i < 2; i++){
+    4b84:	83 c6 01             	add    $0x1,%esi
+    4b87:	83 c4 10             	add    $0x10,%esp
+    4b8a:	83 fe 01             	cmp    $0x1,%esi
+    4b8d:	7e bb                	jle    4b4a <bcachetest+0xb9>
+  }
+  getbstat(&st1);
+    4b8f:	83 ec 0c             	sub    $0xc,%esp
+    4b92:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    4b95:	50                   	push   %eax
+    4b96:	e8 c5 1b 00 00       	call   6760 <getbstat>
+  if(st1.nbuf < 80 || st1.nbuf > st1.maxbuf){
+    4b9b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4b9e:	83 c4 10             	add    $0x10,%esp
+    4ba1:	83 f8 4f             	cmp    $0x4f,%eax
+    4ba4:	76 37                	jbe    4bdd <bcachetest+0x14c>
+    4ba6:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+    4ba9:	72 32                	jb     4bdd <bcachetest+0x14c>
+    printf(stdout, "bcache: cache did not grow (%d buffers)\n", st1.nbuf);
+    exit();
+  }
+  if(st1.hits == st0.hits){
+    4bab:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4bae:	39 45 d8             	cmp    %eax,-0x28(%ebp)
+    4bb1:	74 43                	je     4bf6 <bcachetest+0x165>
+    printf(stdout, "bcache: no hits\n");
+    exit();
+  }
+  unlink("bcachefile");
+    4bb3:	83 ec 0c             	sub    $0xc,%esp
+    4bb6:	68 d7 7f 00 00       	push   $0x7fd7
+    4bbb:	e8 08 1b 00 00       	call   66c8 <unlink>
+  printf(stdout, "bcache test ok\n");
+    4bc0:	83 c4 08             	add    $0x8,%esp
+    4bc3:	68 20 80 00 00       	push   $0x8020
+    4bc8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4bce:	e8 82 1c 00 00       	call   6855 <printf>
+}
+    4bd3:	83 c4 10             	add    $0x10,%esp
+    4bd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4bd9:	5b                   	pop    %ebx
+    4bda:	5e                   	pop    %esi
+    4bdb:	5d                   	pop    %ebp
+    4bdc:	c3                   	ret
+    printf(stdout, "bcache: cache did not grow (%d buffers)\n", st1.nbuf);
+    4bdd:	83 ec 04             	sub    $0x4,%esp
+    4be0:	50                   	push   %eax
+    4be1:	68 dc 91 00 00       	push   $0x91dc
+    4be6:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4bec:	e8 64 1c 00 00       	call   6855 <printf>
+    exit();
+    4bf1:	e8 82 1a 00 00       	call   6678 <exit>
+    printf(stdout, "bcache: no hits\n");
+    4bf6:	83 ec 08             	sub    $0x8,%esp
+    4bf9:	68 0f 80 00 00       	push   $0x800f
+    4bfe:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4c04:	e8 4c 1c 00 00       	call   6855 <printf>
+    exit();
+    4c09:	e8 6a 1a 00 00       	call   6678 <exit>
+
+00004c0e <disktest>:
+
+// concurrent writers keep the disk queue busy; the queue
+// accounts for every request it finishes
+void
+disktest(void)
+{
+    4c0e:	55                   	push   %ebp
+    4c0f:	89 e5                	mov    %esp,%ebp
+    4c11:	56                   	push   %esi
+    4c12:	53                   	push   %ebx
+    4c13:	83 ec 48             	sub    $0x48,%esp
+  struct diskstat st0, st1;
+  char file[] = "disk0";
+    4c16:	c7 45 ba 64 69 73 6b 	movl   $0x6b736964,-0x46(%ebp)
+    4c1d:	66 c7 45 be 30 00    	movw   $0x30,-0x42(%ebp)
+  int fd, i, j, pid;
+
+  printf(stdout, "disk test\n");
+    4c23:	68 30 80 00 00       	push   $0x8030
+    4c28:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4c2e:	e8 22 1c 00 00       	call   6855 <printf>
+
+  getdiskstat(&st0);
+    4c33:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    4c36:	89 04 24             	mov    %eax,(%esp)
+    4c39:	e8 2a 1b 00 00       	call   6768 <getdiskstat>
+  for(i = 0; i < 4; i++){
+    4c3e:	83 c4 10             	add    $0x10,%esp
+    4c41:	be 00 00 00 00       	mov    $0x0,%esi
+    4c46:	83 fe 03             	cmp    $0x3,%esi
+    4c49:	0f 8f b8 00 00 00    	jg     4d07 <disktest+0xf9>
+    file[4] = '0' + i;
+    4c4f:	8d 46 30             	lea    0x30(%esi),%eax
+    4c52:	88 45 be             	mov    %al,-0x42(%ebp)
+    pid = fork();
+    4c55:	e8 16 1a 00 00       	call   6670 <fork>
+    4c5a:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    4c5c:	85 c0                	test   %eax,%eax
+    4c5e:	78 07                	js     4c67 <disktest+0x59>
+      printf(stdout, "disk: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    4c60:	74 1d                	je     4c7f <disktest+0x71>
+  for(i = 0; i < 4; i++){
+    4c62:	83 c6 01             	add    $0x1,%esi
+    4c65:	eb df                	jmp    4c46 <disktest+0x38>
+      printf(stdout, "disk: fork failed\n");
+    4c67:	83 ec 08             	sub    $0x8,%esp
+    4c6a:	68 3b 80 00 00       	push   $0x803b
+    4c6f:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4c75:	e8 db 1b 00 00       	call   6855 <printf>
+      exit();
+    4c7a:	e8 f9 19 00 00       	call   6678 <exit>
+      unlink(file);
+    4c7f:	83 ec 0c             	sub    $0xc,%esp
+    4c82:	8d 75 ba             	lea    -0x46(%ebp),%esi
+    4c85:	56                   	push   %esi
+    4c86:	e8 3d 1a 00 00       	call   66c8 <unlink>
+      fd = open(file, O_CREATE|O_RDWR);
+    4c8b:	83 c4 08             	add    $0x8,%esp
+    4c8e:	68 02 02 00 00       	push   $0x202
+    4c93:	56                   	push   %esi
+    4c94:	e8 1f 1a 00 00       	call   66b8 <open>
+    4c99:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    4c9b:	83 c4 10             	add    $0x10,%esp
+    4c9e:	85 c0                	test   %eax,%eax
+    4ca0:	78 27                	js     4cc9 <disktest+0xbb>
+        printf(stdout, "disk: create failed\n");
+        exit();
+      }
+      for(j = 0; j < 20; j++){
+    4ca2:	83 fb 13             	cmp    $0x13,%ebx
+    4ca5:	7f 52                	jg     4cf9 <disktest+0xeb>
+        if(write(fd, buf, 512) != 512){
+    4ca7:	83 ec 04             	sub    $0x4,%esp
+    4caa:	68 00 02 00 00       	push   $0x200
+    4caf:	68 e0 c7 00 00       	push   $0xc7e0
+    4cb4:	56                   	push   %esi
+    4cb5:	e8 de 19 00 00       	call   6698 <write>
+    4cba:	83 c4 10             	add    $0x10,%esp
+    4cbd:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4cc2:	75 1d                	jne    4ce1 <disktest+0xd3>
+      for(j = 0; j < 20; j++){
+    4cc4:	83 c3 01             	add    $0x1,%ebx
+    4cc7:	eb d9                	jmp    4ca2 <disktest+0x94>
+        printf(stdout, "disk: create failed\n");
+    4cc9:	83 ec 08             	sub    $0x8,%esp
+    4ccc:	68 4e 80 00 00       	push   $0x804e
+    4cd1:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4cd7:	e8 79 1b 00 00       	call   6855 <printf>
+        exit();
+    4cdc:	e8 97 19 00 00       	call   6678 <exit>
+          printf(stdout, "disk: write failed\n");
+    4ce1:	83 ec 08             	sub    $0x8,%esp
+    4ce4:	68 63 80 00 00       	push   $0x8063
+    4ce9:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4cef:	e8 61 1b 00 00       	call   6855 <printf>
+          exit();
+    4cf4:	e8 7f 19 00 00       	call   6678 <exit>
+        }
+      }
+      close(fd);
+    4cf9:	83 ec 0c             	sub    $0xc,%esp
+    4cfc:	56                   	push   %esi
+    4cfd:	e8 9e 19 00 00       	call   66a0 <close>
+      exit();
+    4d02:	e8 71 19 00 00       	call   6678 <exit>
+    }
+  }
+  for(i = 0; i < 4; i++)
+    4d07:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4d0c:	eb 08                	jmp    4d16 <disktest+0x108>
+    wait();
+    4d0e:	e8 6d 19 00 00       	call   6680 <wait>
+  for(i = 0; i < 4; i++)
+    4d13:	83 c3 01             	add    $0x1,%ebx
+    4d16:	83 fb 03             	cmp    $0x3,%ebx
+    4d19:	7e f3                	jle    4d0e <disktest+0x100>
+  getdiskstat(&st1);
+    4d1b:	83 ec 0c             	sub    $0xc,%esp
+    4d1e:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    4d21:	50                   	push   %eax
+    4d22:	e8 41 1a 00 00       	call   6768 <getdiskstat>
+
+  if(st1.reqs <= st0.reqs || st1.cmds <= st0.cmds){
+    4d27:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    4d2a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+    4d2d:	83 c4 10             	add    $0x10,%esp
+    4d30:	39 c1                	cmp    %eax,%ecx
+    4d32:	73 21                	jae    4d55 <disktest+0x147>
+    4d34:	8b 55 c8             	mov    -0x38(%ebp),%edx
+    4d37:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    4d3a:	39 d3                	cmp    %edx,%ebx
+    4d3c:	73 17                	jae    4d55 <disktest+0x147>
+    printf(stdout, "disk: no requests counted\n");
+    exit();
+  }
+  if(st1.cmds - st0.cmds > st1.reqs - st0.reqs || st1.depth > st1.maxdepth){
+    4d3e:	29 da                	sub    %ebx,%edx
+    4d40:	29 c8                	sub    %ecx,%eax
+    4d42:	39 d0                	cmp    %edx,%eax
+    4d44:	72 27                	jb     4d6d <disktest+0x15f>
+    4d46:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4d49:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+    4d4c:	72 1f                	jb     4d6d <disktest+0x15f>
+    printf(stdout, "disk: bad counts\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    4d4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4d53:	eb 48                	jmp    4d9d <disktest+0x18f>
+    printf(stdout, "disk: no requests counted\n");
+    4d55:	83 ec 08             	sub    $0x8,%esp
+    4d58:	68 77 80 00 00       	push   $0x8077
+    4d5d:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4d63:	e8 ed 1a 00 00       	call   6855 <printf>
+    exit();
+    4d68:	e8 0b 19 00 00       	call   6678 <exit>
+    printf(stdout, "disk: bad counts\n");
+    4d6d:	83 ec 08             	sub    $0x8,%esp
+    4d70:	68 92 80 00 00       	push   $0x8092
+    4d75:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4d7b:	e8 d5 1a 00 00       	call   6855 <printf>
+    exit();
+    4d80:	e8 f3 18 00 00       	call   6678 <exit>
+    file[4] = '0' + i;
+    4d85:	8d 43 30             	lea    0x30(%ebx),%eax
+    4d88:	88 45 be             	mov    %al,-0x42(%ebp)
+    unlink(file);
+    4d8b:	83 ec 0c             	sub    $0xc,%esp
+    4d8e:	8d 45 ba             	lea    -0x46(%ebp),%eax
+    4d91:	50                   	push   %eax
+    4d92:	e8 31 19 00 00       	call   66c8 <unlink>
+  for(i = 0; i < 4; i++){
+    4d97:	83 c3 01             	add    $0x1,%ebx
+    4d9a:	83 c4 10             	add    $0x10,%esp
+    4d9d:	83 fb 03             	cmp    $0x3,%ebx
+    4da0:	7e e3                	jle    4d85 <disktest+0x177>
+  }
+  printf(stdout, "disk test ok\n");
+    4da2:	83 ec 08             	sub    $0x8,%esp
+    4da5:	68 a4 80 00 00       	push   $0x80a4
+    4daa:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4db0:	e8 a0 1a 00 00       	call   6855 <printf>
+}
+    4db5:	83 c4 10             	add    $0x10,%esp
+    4db8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4dbb:	5b                   	pop    %ebx
+    4dbc:	5e                   	pop    %esi
+    4dbd:	5d                   	pop    %ebp
+    4dbe:	c3                   	ret
+
+00004dbf <icachetest>:
+
+// many processes hold more files open at once than the
+// inode cache started with
+void
+icachetest(void)
+{
+    4dbf:	55                   	push   %ebp
+    4dc0:	89 e5                	mov    %esp,%ebp
+    4dc2:	57                   	push   %edi
+    4dc3:	56                   	push   %esi
+    4dc4:	53                   	push   %ebx
+    4dc5:	83 ec 34             	sub    $0x34,%esp
+  char file[] = "ic00";
+    4dc8:	c7 45 e3 69 63 30 30 	movl   $0x30306369,-0x1d(%ebp)
+    4dcf:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  int fds[2], ready[2], fd, i, j, n, pid;
+  char c;
+
+  printf(stdout, "icache test\n");
+    4dd3:	68 b2 80 00 00       	push   $0x80b2
+    4dd8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4dde:	e8 72 1a 00 00       	call   6855 <printf>
+
+  if(pipe(fds) != 0 || pipe(ready) != 0){
+    4de3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    4de6:	89 04 24             	mov    %eax,(%esp)
+    4de9:	e8 9a 18 00 00       	call   6688 <pipe>
+    4dee:	83 c4 10             	add    $0x10,%esp
+    4df1:	85 c0                	test   %eax,%eax
+    4df3:	75 32                	jne    4e27 <icachetest+0x68>
+    4df5:	83 ec 0c             	sub    $0xc,%esp
+    4df8:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    4dfb:	50                   	push   %eax
+    4dfc:	e8 87 18 00 00       	call   6688 <pipe>
+    4e01:	89 c7                	mov    %eax,%edi
+    4e03:	83 c4 10             	add    $0x10,%esp
+    4e06:	85 c0                	test   %eax,%eax
+    4e08:	75 1d                	jne    4e27 <icachetest+0x68>
+    printf(stdout, "icache: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 8; i++){
+    4e0a:	89 c6                	mov    %eax,%esi
+    4e0c:	83 fe 07             	cmp    $0x7,%esi
+    4e0f:	0f 8f c9 00 00 00    	jg     4ede <icachetest+0x11f>
+    pid = fork();
+    4e15:	e8 56 18 00 00       	call   6670 <fork>
+    4e1a:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    4e1c:	85 c0                	test   %eax,%eax
+    4e1e:	78 1f                	js     4e3f <icachetest+0x80>
+      printf(stdout, "icache: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    4e20:	74 35                	je     4e57 <icachetest+0x98>
+  for(i = 0; i < 8; i++){
+    4e22:	83 c6 01             	add    $0x1,%esi
+    4e25:	eb e5                	jmp    4e0c <icachetest+0x4d>
+    printf(stdout, "icache: pipe failed\n");
+    4e27:	83 ec 08             	sub    $0x8,%esp
+    4e2a:	68 bf 80 00 00       	push   $0x80bf
+    4e2f:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4e35:	e8 1b 1a 00 00       	call   6855 <printf>
+    exit();
+    4e3a:	e8 39 18 00 00       	call   6678 <exit>
+      printf(stdout, "icache: fork failed\n");
+    4e3f:	83 ec 08             	sub    $0x8,%esp
+    4e42:	68 d4 80 00 00       	push   $0x80d4
+    4e47:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4e4d:	e8 03 1a 00 00       	call   6855 <printf>
+      exit();
+    4e52:	e8 21 18 00 00       	call   6678 <exit>
+      close(fds[1]);
+    4e57:	83 ec 0c             	sub    $0xc,%esp
+    4e5a:	ff 75 dc             	push   -0x24(%ebp)
+    4e5d:	e8 3e 18 00 00       	call   66a0 <close>
+      close(ready[0]);
+    4e62:	83 c4 04             	add    $0x4,%esp
+    4e65:	ff 75 d0             	push   -0x30(%ebp)
+    4e68:	e8 33 18 00 00       	call   66a0 <close>
+      file[2] = '0' + i;
+    4e6d:	8d 46 30             	lea    0x30(%esi),%eax
+    4e70:	88 45 e5             	mov    %al,-0x1b(%ebp)
+      for(j = 0; j < 10; j++){
+    4e73:	83 c4 10             	add    $0x10,%esp
+    4e76:	83 fb 09             	cmp    $0x9,%ebx
+    4e79:	7f 3b                	jg     4eb6 <icachetest+0xf7>
+        file[3] = '0' + j;
+    4e7b:	8d 43 30             	lea    0x30(%ebx),%eax
+    4e7e:	88 45 e6             	mov    %al,-0x1a(%ebp)
+        if(open(file, O_CREATE|O_RDWR) < 0){
+    4e81:	83 ec 08             	sub    $0x8,%esp
+    4e84:	68 02 02 00 00       	push   $0x202
+    4e89:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    4e8c:	50                   	push   %eax
+    4e8d:	e8 26 18 00 00       	call   66b8 <open>
+    4e92:	83 c4 10             	add    $0x10,%esp
+    4e95:	85 c0                	test   %eax,%eax
+    4e97:	78 05                	js     4e9e <icachetest+0xdf>
+      for(j = 0; j < 10; j++){
+    4e99:	83 c3 01             	add    $0x1,%ebx
+    4e9c:	eb d8                	jmp    4e76 <icachetest+0xb7>
+          printf(stdout, "icache: create failed\n");
+    4e9e:	83 ec 08             	sub    $0x8,%esp
+    4ea1:	68 e9 80 00 00       	push   $0x80e9
+    4ea6:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4eac:	e8 a4 19 00 00       	call   6855 <printf>
+          exit();
+    4eb1:	e8 c2 17 00 00       	call   6678 <exit>
+        }
+      }
+      // Hold them until the parent closes the pipe.
+      write(ready[1], "x", 1);
+    4eb6:	83 ec 04             	sub    $0x4,%esp
+    4eb9:	6a 01                	push   $0x1
+    4ebb:	68 10 77 00 00       	push   $0x7710
+    4ec0:	ff 75 d4             	push   -0x2c(%ebp)
+    4ec3:	e8 d0 17 00 00       	call   6698 <write>
+      read(fds[0], &c, 1);
+    4ec8:	83 c4 0c             	add    $0xc,%esp
+    4ecb:	6a 01                	push   $0x1
+    4ecd:	8d 45 cf             	lea    -0x31(%ebp),%eax
+    4ed0:	50                   	push   %eax
+    4ed1:	ff 75 d8             	push   -0x28(%ebp)
+    4ed4:	e8 b7 17 00 00       	call   6690 <read>
+      exit();
+    4ed9:	e8 9a 17 00 00       	call   6678 <exit>
+    }
+  }
+  close(fds[0]);
+    4ede:	83 ec 0c             	sub    $0xc,%esp
+    4ee1:	ff 75 d8             	push   -0x28(%ebp)
+    4ee4:	e8 b7 17 00 00       	call   66a0 <close>
+  close(ready[1]);
+    4ee9:	83 c4 04             	add    $0x4,%esp
+    4eec:	ff 75 d4             	push   -0x2c(%ebp)
+    4eef:	e8 ac 17 00 00       	call   66a0 <close>
+  // All 80 inodes are in use at once once every child is ready.
+  for(n = 0; n < 8 && read(ready[0], &c, 1) == 1; n++)
+    4ef4:	83 c4 10             	add    $0x10,%esp
+    4ef7:	89 fb                	mov    %edi,%ebx
+    4ef9:	eb 03                	jmp    4efe <icachetest+0x13f>
+    4efb:	83 c3 01             	add    $0x1,%ebx
+    4efe:	83 fb 07             	cmp    $0x7,%ebx
+    4f01:	7f 19                	jg     4f1c <icachetest+0x15d>
+    4f03:	83 ec 04             	sub    $0x4,%esp
+    4f06:	6a 01                	push   $0x1
+    4f08:	8d 45 cf             	lea    -0x31(%ebp),%eax
+    4f0b:	50                   	push   %eax
+    4f0c:	ff 75 d0             	push   -0x30(%ebp)
+    4f0f:	e8 7c 17 00 00       	call   6690 <read>
+    4f14:	83 c4 10             	add    $0x10,%esp
+    4f17:	83 f8 01             	cmp    $0x1,%eax
+    4f1a:	74 df                	je     4efb <icachetest+0x13c>
+    ;
+  if(n != 8){
+    4f1c:	83 fb 08             	cmp    $0x8,%ebx
+    4f1f:	75 1d                	jne    4f3e <icachetest+0x17f>
+    printf(stdout, "icache: only %d children opened their files\n", n);
+    exit();
+  }
+  close(ready[0]);
+    4f21:	83 ec 0c             	sub    $0xc,%esp
+    4f24:	ff 75 d0             	push   -0x30(%ebp)
+    4f27:	e8 74 17 00 00       	call   66a0 <close>
+  close(fds[1]);
+    4f2c:	83 c4 04             	add    $0x4,%esp
+    4f2f:	ff 75 dc             	push   -0x24(%ebp)
+    4f32:	e8 69 17 00 00       	call   66a0 <close>
+  for(i = 0; i < 8; i++)
+    4f37:	83 c4 10             	add    $0x10,%esp
+    4f3a:	89 fb                	mov    %edi,%ebx
+    4f3c:	eb 21                	jmp    4f5f <icachetest+0x1a0>
+    printf(stdout, "icache: only %d children opened their files\n", n);
+    4f3e:	83 ec 04             	sub    $0x4,%esp
+    4f41:	53                   	push   %ebx
+    4f42:	68 08 92 00 00       	push   $0x9208
+    4f47:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4f4d:	e8 03 19 00 00       	call   6855 <printf>
+    exit();
+    4f52:	e8 21 17 00 00       	call   6678 <exit>
+    wait();
+    4f57:	e8 24 17 00 00       	call   6680 <wait>
+  for(i = 0; i < 8; i++)
+    4f5c:	83 c3 01             	add    $0x1,%ebx
+    4f5f:	83 fb 07             	cmp    $0x7,%ebx
+    4f62:	7e f3                	jle    4f57 <icachetest+0x198>
+
+  for(i = 0; i < 8; i++){
+    4f64:	89 fe                	mov    %edi,%esi
+    4f66:	eb 1b                	jmp    4f83 <icachetest+0x1c4>
+    file[2] = '0' + i;
+    for(j = 0; j < 10; j++){
+      file[3] = '0' + j;
+      if((fd = open(file, O_RDONLY)) < 0){
+        printf(stdout, "icache: open failed\n");
+    4f68:	83 ec 08             	sub    $0x8,%esp
+    4f6b:	68 00 81 00 00       	push   $0x8100
+    4f70:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4f76:	e8 da 18 00 00       	call   6855 <printf>
+        exit();
+    4f7b:	e8 f8 16 00 00       	call   6678 <exit>
+  for(i = 0; i < 8; i++){
+    4f80:	83 c6 01             	add    $0x1,%esi
+    4f83:	83 fe 07             	cmp    $0x7,%esi
+    4f86:	7f 44                	jg     4fcc <icachetest+0x20d>
+    file[2] = '0' + i;
+    4f88:	8d 46 30             	lea    0x30(%esi),%eax
+    4f8b:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    for(j = 0; j < 10; j++){
+    4f8e:	89 fb                	mov    %edi,%ebx
+    4f90:	83 fb 09             	cmp    $0x9,%ebx
+    4f93:	7f eb                	jg     4f80 <icachetest+0x1c1>
+      file[3] = '0' + j;
+    4f95:	8d 43 30             	lea    0x30(%ebx),%eax
+    4f98:	88 45 e6             	mov    %al,-0x1a(%ebp)
+      if((fd = open(file, O_RDONLY)) < 0){
+    4f9b:	83 ec 08             	sub    $0x8,%esp
+    4f9e:	6a 00                	push   $0x0
+    4fa0:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    4fa3:	50                   	push   %eax
+    4fa4:	e8 0f 17 00 00       	call   66b8 <open>
+    4fa9:	83 c4 10             	add    $0x10,%esp
+    4fac:	85 c0                	test   %eax,%eax
+    4fae:	78 b8                	js     4f68 <icachetest+0x1a9>
+      }
+      close(fd);
+    4fb0:	83 ec 0c             	sub    $0xc,%esp
+    4fb3:	50                   	push   %eax
+    4fb4:	e8 e7 16 00 00       	call   66a0 <close>
+      unlink(file);
+    4fb9:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    4fbc:	89 04 24             	mov    %eax,(%esp)
+    4fbf:	e8 04 17 00 00       	call   66c8 <unlink>
+    for(j = 0; j < 10; j++){
+    4fc4:	83 c3 01             	add    $0x1,%ebx
+    4fc7:	83 c4 10             	add    $0x10,%esp
+    4fca:	eb c4                	jmp    4f90 <icachetest+0x1d1>
+    }
+  }
+  printf(stdout, "icache test ok\n");
+    4fcc:	83 ec 08             	sub    $0x8,%esp
+    4fcf:	68 15 81 00 00       	push   $0x8115
+    4fd4:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4fda:	e8 76 18 00 00       	call   6855 <printf>
+}
+    4fdf:	83 c4 10             	add    $0x10,%esp
+    4fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4fe5:	5b                   	pop    %ebx
+    4fe6:	5e                   	pop    %esi
+    4fe7:	5f                   	pop    %edi
+    4fe8:	5d                   	pop    %ebp
+    4fe9:	c3                   	ret
+
+00004fea <fdtabletest>:
+
+// a process may have hundreds of descriptors; the lowest free
+// one is always used, and fork copies them all
+void
+fdtabletest(void)
+{
+    4fea:	55                   	push   %ebp
+    4feb:	89 e5                	mov    %esp,%ebp
+    4fed:	57                   	push   %edi
+    4fee:	56                   	push   %esi
+    4fef:	53                   	push   %ebx
+    4ff0:	83 ec 24             	sub    $0x24,%esp
+  int fd0, fd, i, pid;
+
+  printf(stdout, "fd table test\n");
+    4ff3:	68 25 81 00 00       	push   $0x8125
+    4ff8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    4ffe:	e8 52 18 00 00       	call   6855 <printf>
+
+  fd0 = open("fdtabfile", O_CREATE|O_RDWR);
+    5003:	83 c4 08             	add    $0x8,%esp
+    5006:	68 02 02 00 00       	push   $0x202
+    500b:	68 34 81 00 00       	push   $0x8134
+    5010:	e8 a3 16 00 00       	call   66b8 <open>
+  if(fd0 < 0){
+    5015:	83 c4 10             	add    $0x10,%esp
+    5018:	85 c0                	test   %eax,%eax
+    501a:	78 2a                	js     5046 <fdtabletest+0x5c>
+    501c:	89 c6                	mov    %eax,%esi
+    printf(stdout, "fdtable: create failed\n");
+    exit();
+  }
+  for(i = fd0+1; i < fd0+300; i++){
+    501e:	8d 78 01             	lea    0x1(%eax),%edi
+    5021:	8d 9e 2b 01 00 00    	lea    0x12b(%esi),%ebx
+    5027:	39 fb                	cmp    %edi,%ebx
+    5029:	7c 4a                	jl     5075 <fdtabletest+0x8b>
+    if((fd = open("fdtabfile", O_RDONLY)) != i){
+    502b:	83 ec 08             	sub    $0x8,%esp
+    502e:	6a 00                	push   $0x0
+    5030:	68 34 81 00 00       	push   $0x8134
+    5035:	e8 7e 16 00 00       	call   66b8 <open>
+    503a:	83 c4 10             	add    $0x10,%esp
+    503d:	39 c7                	cmp    %eax,%edi
+    503f:	75 1d                	jne    505e <fdtabletest+0x74>
+  for(i = fd0+1; i < fd0+300; i++){
+    5041:	83 c7 01             	add    $0x1,%edi
+    5044:	eb db                	jmp    5021 <fdtabletest+0x37>
+    printf(stdout, "fdtable: create failed\n");
+    5046:	83 ec 08             	sub    $0x8,%esp
+    5049:	68 3e 81 00 00       	push   $0x813e
+    504e:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5054:	e8 fc 17 00 00       	call   6855 <printf>
+    exit();
+    5059:	e8 1a 16 00 00       	call   6678 <exit>
+      printf(stdout, "fdtable: open got fd %d, not %d\n", fd, i);
+    505e:	57                   	push   %edi
+    505f:	50                   	push   %eax
+    5060:	68 38 92 00 00       	push   $0x9238
+    5065:	ff 35 a4 a0 00 00    	push   0xa0a4
+    506b:	e8 e5 17 00 00       	call   6855 <printf>
+      exit();
+    5070:	e8 03 16 00 00       	call   6678 <exit>
+    }
+  }
+  close(fd0+100);
+    5075:	8d 46 64             	lea    0x64(%esi),%eax
+    5078:	83 ec 0c             	sub    $0xc,%esp
+    507b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    507e:	50                   	push   %eax
+    507f:	e8 1c 16 00 00       	call   66a0 <close>
+  close(fd0+7);
+    5084:	8d 7e 07             	lea    0x7(%esi),%edi
+    5087:	89 3c 24             	mov    %edi,(%esp)
+    508a:	e8 11 16 00 00       	call   66a0 <close>
+  if(dup(fd0) != fd0+7 || dup(fd0) != fd0+100 || dup(fd0) != fd0+300){
+    508f:	89 34 24             	mov    %esi,(%esp)
+    5092:	e8 59 16 00 00       	call   66f0 <dup>
+    5097:	83 c4 10             	add    $0x10,%esp
+    509a:	39 c7                	cmp    %eax,%edi
+    509c:	0f 85 86 00 00 00    	jne    5128 <fdtabletest+0x13e>
+    50a2:	83 ec 0c             	sub    $0xc,%esp
+    50a5:	56                   	push   %esi
+    50a6:	e8 45 16 00 00       	call   66f0 <dup>
+    50ab:	83 c4 10             	add    $0x10,%esp
+    50ae:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    50b1:	75 75                	jne    5128 <fdtabletest+0x13e>
+    50b3:	83 ec 0c             	sub    $0xc,%esp
+    50b6:	56                   	push   %esi
+    50b7:	e8 34 16 00 00       	call   66f0 <dup>
+    50bc:	8d be 2c 01 00 00    	lea    0x12c(%esi),%edi
+    50c2:	83 c4 10             	add    $0x10,%esp
+    50c5:	39 f8                	cmp    %edi,%eax
+    50c7:	75 5f                	jne    5128 <fdtabletest+0x13e>
+    printf(stdout, "fdtable: dup did not take the lowest fd\n");
+    exit();
+  }
+
+  pid = fork();
+    50c9:	e8 a2 15 00 00       	call   6670 <fork>
+  if(pid < 0){
+    50ce:	85 c0                	test   %eax,%eax
+    50d0:	78 6e                	js     5140 <fdtabletest+0x156>
+    printf(stdout, "fdtable: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    50d2:	0f 85 85 00 00 00    	jne    515d <fdtabletest+0x173>
+    if(write(fd0+300, "x", 1) != 1 || close(fd0+299) != 0 || dup(fd0) != fd0+299){
+    50d8:	83 ec 04             	sub    $0x4,%esp
+    50db:	6a 01                	push   $0x1
+    50dd:	68 10 77 00 00       	push   $0x7710
+    50e2:	57                   	push   %edi
+    50e3:	e8 b0 15 00 00       	call   6698 <write>
+    50e8:	83 c4 10             	add    $0x10,%esp
+    50eb:	83 f8 01             	cmp    $0x1,%eax
+    50ee:	75 20                	jne    5110 <fdtabletest+0x126>
+    50f0:	83 ec 0c             	sub    $0xc,%esp
+    50f3:	53                   	push   %ebx
+    50f4:	e8 a7 15 00 00       	call   66a0 <close>
+    50f9:	83 c4 10             	add    $0x10,%esp
+    50fc:	85 c0                	test   %eax,%eax
+    50fe:	75 10                	jne    5110 <fdtabletest+0x126>
+    5100:	83 ec 0c             	sub    $0xc,%esp
+    5103:	56                   	push   %esi
+    5104:	e8 e7 15 00 00       	call   66f0 <dup>
+    5109:	83 c4 10             	add    $0x10,%esp
+    510c:	39 c3                	cmp    %eax,%ebx
+    510e:	74 48                	je     5158 <fdtabletest+0x16e>
+      printf(stdout, "fdtable: child lost descriptors\n");
+    5110:	83 ec 08             	sub    $0x8,%esp
+    5113:	68 88 92 00 00       	push   $0x9288
+    5118:	ff 35 a4 a0 00 00    	push   0xa0a4
+    511e:	e8 32 17 00 00       	call   6855 <printf>
+      exit();
+    5123:	e8 50 15 00 00       	call   6678 <exit>
+    printf(stdout, "fdtable: dup did not take the lowest fd\n");
+    5128:	83 ec 08             	sub    $0x8,%esp
+    512b:	68 5c 92 00 00       	push   $0x925c
+    5130:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5136:	e8 1a 17 00 00       	call   6855 <printf>
+    exit();
+    513b:	e8 38 15 00 00       	call   6678 <exit>
+    printf(stdout, "fdtable: fork failed\n");
+    5140:	83 ec 08             	sub    $0x8,%esp
+    5143:	68 56 81 00 00       	push   $0x8156
+    5148:	ff 35 a4 a0 00 00    	push   0xa0a4
+    514e:	e8 02 17 00 00       	call   6855 <printf>
+    exit();
+    5153:	e8 20 15 00 00       	call   6678 <exit>
+    }
+    exit();
+    5158:	e8 1b 15 00 00       	call   6678 <exit>
+  }
+  wait();
+    515d:	e8 1e 15 00 00       	call   6680 <wait>
+
+  for(i = fd0; i <= fd0+300; i++){
+    5162:	89 f3                	mov    %esi,%ebx
+    5164:	39 df                	cmp    %ebx,%edi
+    5166:	7c 2e                	jl     5196 <fdtabletest+0x1ac>
+    if(close(i) != 0){
+    5168:	83 ec 0c             	sub    $0xc,%esp
+    516b:	53                   	push   %ebx
+    516c:	e8 2f 15 00 00       	call   66a0 <close>
+    5171:	83 c4 10             	add    $0x10,%esp
+    5174:	85 c0                	test   %eax,%eax
+    5176:	75 05                	jne    517d <fdtabletest+0x193>
+  for(i = fd0; i <= fd0+300; i++){
+    5178:	83 c3 01             	add    $0x1,%ebx
+    517b:	eb e7                	jmp    5164 <fdtabletest+0x17a>
+      printf(stdout, "fdtable: close %d failed\n", i);
+    517d:	83 ec 04             	sub    $0x4,%esp
+    5180:	53                   	push   %ebx
+    5181:	68 6c 81 00 00       	push   $0x816c
+    5186:	ff 35 a4 a0 00 00    	push   0xa0a4
+    518c:	e8 c4 16 00 00       	call   6855 <printf>
+      exit();
+    5191:	e8 e2 14 00 00       	call   6678 <exit>
+    }
+  }
+  if(close(fd0+300) != -1 || (fd = open("fdtabfile", O_RDONLY)) != fd0){
+    5196:	83 ec 0c             	sub    $0xc,%esp
+    5199:	57                   	push   %edi
+    519a:	e8 01 15 00 00       	call   66a0 <close>
+    519f:	83 c4 10             	add    $0x10,%esp
+    51a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    51a5:	75 49                	jne    51f0 <fdtabletest+0x206>
+    51a7:	83 ec 08             	sub    $0x8,%esp
+    51aa:	6a 00                	push   $0x0
+    51ac:	68 34 81 00 00       	push   $0x8134
+    51b1:	e8 02 15 00 00       	call   66b8 <open>
+    51b6:	83 c4 10             	add    $0x10,%esp
+    51b9:	39 c6                	cmp    %eax,%esi
+    51bb:	75 33                	jne    51f0 <fdtabletest+0x206>
+    printf(stdout, "fdtable: descriptors not freed\n");
+    exit();
+  }
+  close(fd);
+    51bd:	83 ec 0c             	sub    $0xc,%esp
+    51c0:	50                   	push   %eax
+    51c1:	e8 da 14 00 00       	call   66a0 <close>
+  unlink("fdtabfile");
+    51c6:	c7 04 24 34 81 00 00 	movl   $0x8134,(%esp)
+    51cd:	e8 f6 14 00 00       	call   66c8 <unlink>
+  printf(stdout, "fd table test ok\n");
+    51d2:	83 c4 08             	add    $0x8,%esp
+    51d5:	68 86 81 00 00       	push   $0x8186
+    51da:	ff 35 a4 a0 00 00    	push   0xa0a4
+    51e0:	e8 70 16 00 00       	call   6855 <printf>
+}
+    51e5:	83 c4 10             	add    $0x10,%esp
+    51e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    51eb:	5b                   	pop    %ebx
+    51ec:	5e                   	pop    %esi
+    51ed:	5f                   	pop    %edi
+    51ee:	5d                   	pop    %ebp
+    51ef:	c3                   	ret
+    printf(stdout, "fdtable: descriptors not freed\n");
+    51f0:	83 ec 08             	sub    $0x8,%esp
+    51f3:	68 ac 92 00 00       	push   $0x92ac
+    51f8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    51fe:	e8 52 16 00 00       	call   6855 <printf>
+    exit();
+    5203:	e8 70 14 00 00       	call   6678 <exit>
+
+00005208 <preadvtest>:
+
+// pread and pwrite leave the file offset alone; readv and
+// writev move several buffers in one call
+void
+preadvtest(void)
+{
+    5208:	55                   	push   %ebp
+    5209:	89 e5                	mov    %esp,%ebp
+    520b:	57                   	push   %edi
+    520c:	56                   	push   %esi
+    520d:	53                   	push   %ebx
+    520e:	83 ec 44             	sub    $0x44,%esp
+  static char b1[3000], b2[5000], b3[2000];
+  struct iovec iov[3];
+  int fd, i, pid, off, fds[2];
+  char c;
+
+  printf(stdout, "pread/readv test\n");
+    5211:	68 98 81 00 00       	push   $0x8198
+    5216:	ff 35 a4 a0 00 00    	push   0xa0a4
+    521c:	e8 34 16 00 00       	call   6855 <printf>
+
+  for(i = 0; i < sizeof(b1); i++)
+    5221:	83 c4 10             	add    $0x10,%esp
+    5224:	b9 00 00 00 00       	mov    $0x0,%ecx
+    5229:	eb 2e                	jmp    5259 <preadvtest+0x51>
+    b1[i] = 'a' + i % 7;
+    522b:	ba 93 24 49 92       	mov    $0x92492493,%edx
+    5230:	89 c8                	mov    %ecx,%eax
+    5232:	f7 ea                	imul   %edx
+    5234:	01 ca                	add    %ecx,%edx
+    5236:	c1 fa 02             	sar    $0x2,%edx
+    5239:	89 c8                	mov    %ecx,%eax
+    523b:	c1 f8 1f             	sar    $0x1f,%eax
+    523e:	29 c2                	sub    %eax,%edx
+    5240:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+    5247:	29 d0                	sub    %edx,%eax
+    5249:	89 ca                	mov    %ecx,%edx
+    524b:	29 c2                	sub    %eax,%edx
+    524d:	83 c2 61             	add    $0x61,%edx
+    5250:	88 91 60 03 01 00    	mov    %dl,0x10360(%ecx)
+  for(i = 0; i < sizeof(b1); i++)
+    5256:	83 c1 01             	add    $0x1,%ecx
+    5259:	81 f9 b7 0b 00 00    	cmp    $0xbb7,%ecx
+    525f:	76 ca                	jbe    522b <preadvtest+0x23>
+  for(i = 0; i < sizeof(b2); i++)
+    5261:	b9 00 00 00 00       	mov    $0x0,%ecx
+    5266:	eb 28                	jmp    5290 <preadvtest+0x88>
+    b2[i] = 'A' + i % 11;
+    5268:	ba e9 a2 8b 2e       	mov    $0x2e8ba2e9,%edx
+    526d:	89 c8                	mov    %ecx,%eax
+    526f:	f7 ea                	imul   %edx
+    5271:	d1 fa                	sar    %edx
+    5273:	89 c8                	mov    %ecx,%eax
+    5275:	c1 f8 1f             	sar    $0x1f,%eax
+    5278:	29 c2                	sub    %eax,%edx
+    527a:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    527d:	8d 04 42             	lea    (%edx,%eax,2),%eax
+    5280:	89 ca                	mov    %ecx,%edx
+    5282:	29 c2                	sub    %eax,%edx
+    5284:	83 c2 41             	add    $0x41,%edx
+    5287:	88 91 c0 ef 00 00    	mov    %dl,0xefc0(%ecx)
+  for(i = 0; i < sizeof(b2); i++)
+    528d:	83 c1 01             	add    $0x1,%ecx
+    5290:	81 f9 87 13 00 00    	cmp    $0x1387,%ecx
+    5296:	76 d0                	jbe    5268 <preadvtest+0x60>
+  for(i = 0; i < sizeof(b3); i++)
+    5298:	b9 00 00 00 00       	mov    $0x0,%ecx
+    529d:	eb 28                	jmp    52c7 <preadvtest+0xbf>
+    b3[i] = '0' + i % 10;
+    529f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    52a4:	89 c8                	mov    %ecx,%eax
+    52a6:	f7 ea                	imul   %edx
+    52a8:	c1 fa 02             	sar    $0x2,%edx
+    52ab:	89 c8                	mov    %ecx,%eax
+    52ad:	c1 f8 1f             	sar    $0x1f,%eax
+    52b0:	29 c2                	sub    %eax,%edx
+    52b2:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    52b5:	01 c0                	add    %eax,%eax
+    52b7:	89 ca                	mov    %ecx,%edx
+    52b9:	29 c2                	sub    %eax,%edx
+    52bb:	83 c2 30             	add    $0x30,%edx
+    52be:	88 91 e0 e7 00 00    	mov    %dl,0xe7e0(%ecx)
+  for(i = 0; i < sizeof(b3); i++)
+    52c4:	83 c1 01             	add    $0x1,%ecx
+    52c7:	81 f9 cf 07 00 00    	cmp    $0x7cf,%ecx
+    52cd:	76 d0                	jbe    529f <preadvtest+0x97>
+  iov[0].base = b1;
+    52cf:	c7 45 d0 60 03 01 00 	movl   $0x10360,-0x30(%ebp)
+  iov[0].len = sizeof(b1);
+    52d6:	c7 45 d4 b8 0b 00 00 	movl   $0xbb8,-0x2c(%ebp)
+  iov[1].base = b2;
+    52dd:	c7 45 d8 c0 ef 00 00 	movl   $0xefc0,-0x28(%ebp)
+  iov[1].len = sizeof(b2);
+    52e4:	c7 45 dc 88 13 00 00 	movl   $0x1388,-0x24(%ebp)
+  iov[2].base = b3;
+    52eb:	c7 45 e0 e0 e7 00 00 	movl   $0xe7e0,-0x20(%ebp)
+  iov[2].len = sizeof(b3);
+    52f2:	c7 45 e4 d0 07 00 00 	movl   $0x7d0,-0x1c(%ebp)
+
+  unlink("preadfile");
+    52f9:	83 ec 0c             	sub    $0xc,%esp
+    52fc:	68 aa 81 00 00       	push   $0x81aa
+    5301:	e8 c2 13 00 00       	call   66c8 <unlink>
+  fd = open("preadfile", O_CREATE|O_RDWR);
+    5306:	83 c4 08             	add    $0x8,%esp
+    5309:	68 02 02 00 00       	push   $0x202
+    530e:	68 aa 81 00 00       	push   $0x81aa
+    5313:	e8 a0 13 00 00       	call   66b8 <open>
+    5318:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    531a:	83 c4 10             	add    $0x10,%esp
+    531d:	85 c0                	test   %eax,%eax
+    531f:	78 69                	js     538a <preadvtest+0x182>
+    printf(stdout, "preadv: create failed\n");
+    exit();
+  }
+  if(writev(fd, iov, 3) != 10000){
+    5321:	83 ec 04             	sub    $0x4,%esp
+    5324:	6a 03                	push   $0x3
+    5326:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    5329:	50                   	push   %eax
+    532a:	56                   	push   %esi
+    532b:	e8 68 14 00 00       	call   6798 <writev>
+    5330:	83 c4 10             	add    $0x10,%esp
+    5333:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    5338:	75 68                	jne    53a2 <preadvtest+0x19a>
+    printf(stdout, "preadv: writev failed\n");
+    exit();
+  }
+  if(pwrite(fd, "#", 1, 3001) != 1 || write(fd, "$", 1) != 1){
+    533a:	68 b9 0b 00 00       	push   $0xbb9
+    533f:	6a 01                	push   $0x1
+    5341:	68 e2 81 00 00       	push   $0x81e2
+    5346:	56                   	push   %esi
+    5347:	e8 3c 14 00 00       	call   6788 <pwrite>
+    534c:	83 c4 10             	add    $0x10,%esp
+    534f:	83 f8 01             	cmp    $0x1,%eax
+    5352:	75 66                	jne    53ba <preadvtest+0x1b2>
+    5354:	83 ec 04             	sub    $0x4,%esp
+    5357:	6a 01                	push   $0x1
+    5359:	68 e4 81 00 00       	push   $0x81e4
+    535e:	56                   	push   %esi
+    535f:	e8 34 13 00 00       	call   6698 <write>
+    5364:	83 c4 10             	add    $0x10,%esp
+    5367:	83 f8 01             	cmp    $0x1,%eax
+    536a:	75 4e                	jne    53ba <preadvtest+0x1b2>
+    printf(stdout, "preadv: pwrite failed\n");
+    exit();
+  }
+
+  // Children share fd, and its offset, while they pread.
+  for(i = 0; i < 4; i++){
+    536c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5371:	83 fb 03             	cmp    $0x3,%ebx
+    5374:	0f 8f d3 00 00 00    	jg     544d <preadvtest+0x245>
+    pid = fork();
+    537a:	e8 f1 12 00 00       	call   6670 <fork>
+    if(pid < 0){
+    537f:	85 c0                	test   %eax,%eax
+    5381:	78 4f                	js     53d2 <preadvtest+0x1ca>
+      printf(stdout, "preadv: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    5383:	74 65                	je     53ea <preadvtest+0x1e2>
+  for(i = 0; i < 4; i++){
+    5385:	83 c3 01             	add    $0x1,%ebx
+    5388:	eb e7                	jmp    5371 <preadvtest+0x169>
+    printf(stdout, "preadv: create failed\n");
+    538a:	83 ec 08             	sub    $0x8,%esp
+    538d:	68 b4 81 00 00       	push   $0x81b4
+    5392:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5398:	e8 b8 14 00 00       	call   6855 <printf>
+    exit();
+    539d:	e8 d6 12 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: writev failed\n");
+    53a2:	83 ec 08             	sub    $0x8,%esp
+    53a5:	68 cb 81 00 00       	push   $0x81cb
+    53aa:	ff 35 a4 a0 00 00    	push   0xa0a4
+    53b0:	e8 a0 14 00 00       	call   6855 <printf>
+    exit();
+    53b5:	e8 be 12 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: pwrite failed\n");
+    53ba:	83 ec 08             	sub    $0x8,%esp
+    53bd:	68 e6 81 00 00       	push   $0x81e6
+    53c2:	ff 35 a4 a0 00 00    	push   0xa0a4
+    53c8:	e8 88 14 00 00       	call   6855 <printf>
+    exit();
+    53cd:	e8 a6 12 00 00       	call   6678 <exit>
+      printf(stdout, "preadv: fork failed\n");
+    53d2:	83 ec 08             	sub    $0x8,%esp
+    53d5:	68 fd 81 00 00       	push   $0x81fd
+    53da:	ff 35 a4 a0 00 00    	push   0xa0a4
+    53e0:	e8 70 14 00 00       	call   6855 <printf>
+      exit();
+    53e5:	e8 8e 12 00 00       	call   6678 <exit>
+      off = 3000 + i*2000;
+    53ea:	69 db d0 07 00 00    	imul   $0x7d0,%ebx,%ebx
+    53f0:	8d bb b8 0b 00 00    	lea    0xbb8(%ebx),%edi
+      if(pread(fd, &c, 1, off) != 1 ||
+    53f6:	57                   	push   %edi
+    53f7:	6a 01                	push   $0x1
+    53f9:	8d 45 c7             	lea    -0x39(%ebp),%eax
+    53fc:	50                   	push   %eax
+    53fd:	56                   	push   %esi
+    53fe:	e8 7d 13 00 00       	call   6780 <pread>
+    5403:	83 c4 10             	add    $0x10,%esp
+    5406:	83 f8 01             	cmp    $0x1,%eax
+    5409:	75 17                	jne    5422 <preadvtest+0x21a>
+         c != (off < 8000 ? b2[off - 3000] : b3[off - 8000])){
+    540b:	0f be 55 c7          	movsbl -0x39(%ebp),%edx
+    540f:	81 ff 3f 1f 00 00    	cmp    $0x1f3f,%edi
+    5415:	7f 28                	jg     543f <preadvtest+0x237>
+    5417:	0f be 83 c0 ef 00 00 	movsbl 0xefc0(%ebx),%eax
+      if(pread(fd, &c, 1, off) != 1 ||
+    541e:	39 c2                	cmp    %eax,%edx
+    5420:	74 26                	je     5448 <preadvtest+0x240>
+        printf(stdout, "preadv: pread got %c\n", c);
+    5422:	83 ec 04             	sub    $0x4,%esp
+    5425:	0f be 45 c7          	movsbl -0x39(%ebp),%eax
+    5429:	50                   	push   %eax
+    542a:	68 12 82 00 00       	push   $0x8212
+    542f:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5435:	e8 1b 14 00 00       	call   6855 <printf>
+        exit();
+    543a:	e8 39 12 00 00       	call   6678 <exit>
+         c != (off < 8000 ? b2[off - 3000] : b3[off - 8000])){
+    543f:	0f be 83 58 d4 00 00 	movsbl 0xd458(%ebx),%eax
+    5446:	eb d6                	jmp    541e <preadvtest+0x216>
+      }
+      exit();
+    5448:	e8 2b 12 00 00       	call   6678 <exit>
+    }
+  }
+  for(i = 0; i < 4; i++)
+    544d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5452:	eb 08                	jmp    545c <preadvtest+0x254>
+    wait();
+    5454:	e8 27 12 00 00       	call   6680 <wait>
+  for(i = 0; i < 4; i++)
+    5459:	83 c3 01             	add    $0x1,%ebx
+    545c:	83 fb 03             	cmp    $0x3,%ebx
+    545f:	7e f3                	jle    5454 <preadvtest+0x24c>
+  if(pread(fd, &c, 1, 3001) != 1 || c != '#' || pread(fd, &c, 1, 10001) != 0){
+    5461:	68 b9 0b 00 00       	push   $0xbb9
+    5466:	6a 01                	push   $0x1
+    5468:	8d 45 c7             	lea    -0x39(%ebp),%eax
+    546b:	50                   	push   %eax
+    546c:	56                   	push   %esi
+    546d:	e8 0e 13 00 00       	call   6780 <pread>
+    5472:	83 c4 10             	add    $0x10,%esp
+    5475:	83 f8 01             	cmp    $0x1,%eax
+    5478:	0f 85 e1 01 00 00    	jne    565f <preadvtest+0x457>
+    547e:	80 7d c7 23          	cmpb   $0x23,-0x39(%ebp)
+    5482:	0f 85 d7 01 00 00    	jne    565f <preadvtest+0x457>
+    5488:	68 11 27 00 00       	push   $0x2711
+    548d:	6a 01                	push   $0x1
+    548f:	8d 45 c7             	lea    -0x39(%ebp),%eax
+    5492:	50                   	push   %eax
+    5493:	56                   	push   %esi
+    5494:	e8 e7 12 00 00       	call   6780 <pread>
+    5499:	83 c4 10             	add    $0x10,%esp
+    549c:	85 c0                	test   %eax,%eax
+    549e:	0f 85 bb 01 00 00    	jne    565f <preadvtest+0x457>
+    printf(stdout, "preadv: pread after pwrite failed\n");
+    exit();
+  }
+  if(pread(fd, &c, 1, 10000) != 1 || c != '$'){
+    54a4:	68 10 27 00 00       	push   $0x2710
+    54a9:	6a 01                	push   $0x1
+    54ab:	8d 45 c7             	lea    -0x39(%ebp),%eax
+    54ae:	50                   	push   %eax
+    54af:	56                   	push   %esi
+    54b0:	e8 cb 12 00 00       	call   6780 <pread>
+    54b5:	83 c4 10             	add    $0x10,%esp
+    54b8:	83 f8 01             	cmp    $0x1,%eax
+    54bb:	0f 85 b6 01 00 00    	jne    5677 <preadvtest+0x46f>
+    54c1:	80 7d c7 24          	cmpb   $0x24,-0x39(%ebp)
+    54c5:	0f 85 ac 01 00 00    	jne    5677 <preadvtest+0x46f>
+    printf(stdout, "preadv: pwrite moved the offset\n");
+    exit();
+  }
+  close(fd);
+    54cb:	83 ec 0c             	sub    $0xc,%esp
+    54ce:	56                   	push   %esi
+    54cf:	e8 cc 11 00 00       	call   66a0 <close>
+
+  memset(b1, 0, sizeof(b1));
+    54d4:	83 c4 0c             	add    $0xc,%esp
+    54d7:	68 b8 0b 00 00       	push   $0xbb8
+    54dc:	6a 00                	push   $0x0
+    54de:	68 60 03 01 00       	push   $0x10360
+    54e3:	e8 55 10 00 00       	call   653d <memset>
+  memset(b2, 0, sizeof(b2));
+    54e8:	83 c4 0c             	add    $0xc,%esp
+    54eb:	68 88 13 00 00       	push   $0x1388
+    54f0:	6a 00                	push   $0x0
+    54f2:	68 c0 ef 00 00       	push   $0xefc0
+    54f7:	e8 41 10 00 00       	call   653d <memset>
+  memset(b3, 0, sizeof(b3));
+    54fc:	83 c4 0c             	add    $0xc,%esp
+    54ff:	68 d0 07 00 00       	push   $0x7d0
+    5504:	6a 00                	push   $0x0
+    5506:	68 e0 e7 00 00       	push   $0xe7e0
+    550b:	e8 2d 10 00 00       	call   653d <memset>
+  fd = open("preadfile", O_RDONLY);
+    5510:	83 c4 08             	add    $0x8,%esp
+    5513:	6a 00                	push   $0x0
+    5515:	68 aa 81 00 00       	push   $0x81aa
+    551a:	e8 99 11 00 00       	call   66b8 <open>
+    551f:	89 c3                	mov    %eax,%ebx
+  if(readv(fd, iov, 3) != 10000 || read(fd, &c, 1) != 1 || c != '$'){
+    5521:	83 c4 0c             	add    $0xc,%esp
+    5524:	6a 03                	push   $0x3
+    5526:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    5529:	50                   	push   %eax
+    552a:	53                   	push   %ebx
+    552b:	e8 60 12 00 00       	call   6790 <readv>
+    5530:	83 c4 10             	add    $0x10,%esp
+    5533:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    5538:	0f 85 51 01 00 00    	jne    568f <preadvtest+0x487>
+    553e:	83 ec 04             	sub    $0x4,%esp
+    5541:	6a 01                	push   $0x1
+    5543:	8d 45 c7             	lea    -0x39(%ebp),%eax
+    5546:	50                   	push   %eax
+    5547:	53                   	push   %ebx
+    5548:	e8 43 11 00 00       	call   6690 <read>
+    554d:	83 c4 10             	add    $0x10,%esp
+    5550:	83 f8 01             	cmp    $0x1,%eax
+    5553:	0f 85 36 01 00 00    	jne    568f <preadvtest+0x487>
+    5559:	80 7d c7 24          	cmpb   $0x24,-0x39(%ebp)
+    555d:	0f 85 2c 01 00 00    	jne    568f <preadvtest+0x487>
+    printf(stdout, "preadv: readv failed\n");
+    exit();
+  }
+  if(b1[2999] != 'a' + 2999 % 7 || b2[0] != 'A' || b2[1] != '#' ||
+    5563:	80 3d 17 0f 01 00 64 	cmpb   $0x64,0x10f17
+    556a:	0f 85 37 01 00 00    	jne    56a7 <preadvtest+0x49f>
+    5570:	80 3d c0 ef 00 00 41 	cmpb   $0x41,0xefc0
+    5577:	0f 85 2a 01 00 00    	jne    56a7 <preadvtest+0x49f>
+    557d:	80 3d c1 ef 00 00 23 	cmpb   $0x23,0xefc1
+    5584:	0f 85 1d 01 00 00    	jne    56a7 <preadvtest+0x49f>
+    558a:	80 3d 47 03 01 00 46 	cmpb   $0x46,0x10347
+    5591:	0f 85 10 01 00 00    	jne    56a7 <preadvtest+0x49f>
+     b2[4999] != 'A' + 4999 % 11 || b3[1999] != '9'){
+    5597:	80 3d af ef 00 00 39 	cmpb   $0x39,0xefaf
+    559e:	0f 85 03 01 00 00    	jne    56a7 <preadvtest+0x49f>
+    printf(stdout, "preadv: readv got wrong data\n");
+    exit();
+  }
+  close(fd);
+    55a4:	83 ec 0c             	sub    $0xc,%esp
+    55a7:	53                   	push   %ebx
+    55a8:	e8 f3 10 00 00       	call   66a0 <close>
+  unlink("preadfile");
+    55ad:	c7 04 24 aa 81 00 00 	movl   $0x81aa,(%esp)
+    55b4:	e8 0f 11 00 00       	call   66c8 <unlink>
+
+  // readv from a pipe returns what is there once the first
+  // buffer is full, with the write end still open.
+  if(pipe(fds) != 0 || write(fds[1], "xyz", 3) != 3){
+    55b9:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    55bc:	89 04 24             	mov    %eax,(%esp)
+    55bf:	e8 c4 10 00 00       	call   6688 <pipe>
+    55c4:	83 c4 10             	add    $0x10,%esp
+    55c7:	85 c0                	test   %eax,%eax
+    55c9:	0f 85 f0 00 00 00    	jne    56bf <preadvtest+0x4b7>
+    55cf:	83 ec 04             	sub    $0x4,%esp
+    55d2:	6a 03                	push   $0x3
+    55d4:	68 5c 82 00 00       	push   $0x825c
+    55d9:	ff 75 cc             	push   -0x34(%ebp)
+    55dc:	e8 b7 10 00 00       	call   6698 <write>
+    55e1:	83 c4 10             	add    $0x10,%esp
+    55e4:	83 f8 03             	cmp    $0x3,%eax
+    55e7:	0f 85 d2 00 00 00    	jne    56bf <preadvtest+0x4b7>
+    printf(stdout, "preadv: pipe failed\n");
+    exit();
+  }
+  iov[0].len = 3;
+    55ed:	c7 45 d4 03 00 00 00 	movl   $0x3,-0x2c(%ebp)
+  if(readv(fds[0], iov, 3) != 3 || b1[0] != 'x' || b1[2] != 'z'){
+    55f4:	83 ec 04             	sub    $0x4,%esp
+    55f7:	6a 03                	push   $0x3
+    55f9:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    55fc:	50                   	push   %eax
+    55fd:	ff 75 c8             	push   -0x38(%ebp)
+    5600:	e8 8b 11 00 00       	call   6790 <readv>
+    5605:	83 c4 10             	add    $0x10,%esp
+    5608:	83 f8 03             	cmp    $0x3,%eax
+    560b:	0f 85 c6 00 00 00    	jne    56d7 <preadvtest+0x4cf>
+    5611:	80 3d 60 03 01 00 78 	cmpb   $0x78,0x10360
+    5618:	0f 85 b9 00 00 00    	jne    56d7 <preadvtest+0x4cf>
+    561e:	80 3d 62 03 01 00 7a 	cmpb   $0x7a,0x10362
+    5625:	0f 85 ac 00 00 00    	jne    56d7 <preadvtest+0x4cf>
+    printf(stdout, "preadv: readv from pipe failed\n");
+    exit();
+  }
+  close(fds[0]);
+    562b:	83 ec 0c             	sub    $0xc,%esp
+    562e:	ff 75 c8             	push   -0x38(%ebp)
+    5631:	e8 6a 10 00 00       	call   66a0 <close>
+  close(fds[1]);
+    5636:	83 c4 04             	add    $0x4,%esp
+    5639:	ff 75 cc             	push   -0x34(%ebp)
+    563c:	e8 5f 10 00 00       	call   66a0 <close>
+  printf(stdout, "pread/readv test ok\n");
+    5641:	83 c4 08             	add    $0x8,%esp
+    5644:	68 75 82 00 00       	push   $0x8275
+    5649:	ff 35 a4 a0 00 00    	push   0xa0a4
+    564f:	e8 01 12 00 00       	call   6855 <printf>
+}
+    5654:	83 c4 10             	add    $0x10,%esp
+    5657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    565a:	5b                   	pop    %ebx
+    565b:	5e                   	pop    %esi
+    565c:	5f                   	pop    %edi
+    565d:	5d                   	pop    %ebp
+    565e:	c3                   	ret
+    printf(stdout, "preadv: pread after pwrite failed\n");
+    565f:	83 ec 08             	sub    $0x8,%esp
+    5662:	68 cc 92 00 00       	push   $0x92cc
+    5667:	ff 35 a4 a0 00 00    	push   0xa0a4
+    566d:	e8 e3 11 00 00       	call   6855 <printf>
+    exit();
+    5672:	e8 01 10 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: pwrite moved the offset\n");
+    5677:	83 ec 08             	sub    $0x8,%esp
+    567a:	68 f0 92 00 00       	push   $0x92f0
+    567f:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5685:	e8 cb 11 00 00       	call   6855 <printf>
+    exit();
+    568a:	e8 e9 0f 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: readv failed\n");
+    568f:	83 ec 08             	sub    $0x8,%esp
+    5692:	68 28 82 00 00       	push   $0x8228
+    5697:	ff 35 a4 a0 00 00    	push   0xa0a4
+    569d:	e8 b3 11 00 00       	call   6855 <printf>
+    exit();
+    56a2:	e8 d1 0f 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: readv got wrong data\n");
+    56a7:	83 ec 08             	sub    $0x8,%esp
+    56aa:	68 3e 82 00 00       	push   $0x823e
+    56af:	ff 35 a4 a0 00 00    	push   0xa0a4
+    56b5:	e8 9b 11 00 00       	call   6855 <printf>
+    exit();
+    56ba:	e8 b9 0f 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: pipe failed\n");
+    56bf:	83 ec 08             	sub    $0x8,%esp
+    56c2:	68 60 82 00 00       	push   $0x8260
+    56c7:	ff 35 a4 a0 00 00    	push   0xa0a4
+    56cd:	e8 83 11 00 00       	call   6855 <printf>
+    exit();
+    56d2:	e8 a1 0f 00 00       	call   6678 <exit>
+    printf(stdout, "preadv: readv from pipe failed\n");
+    56d7:	83 ec 08             	sub    $0x8,%esp
+    56da:	68 14 93 00 00       	push   $0x9314
+    56df:	ff 35 a4 a0 00 00    	push   0xa0a4
+    56e5:	e8 6b 11 00 00       	call   6855 <printf>
+    exit();
+    56ea:	e8 89 0f 00 00       	call   6678 <exit>
+
+000056ef <splicetest>:
+
+// sendfile and splice copy between files and pipes inside
+// the kernel
+void
+splicetest(void)
+{
+    56ef:	55                   	push   %ebp
+    56f0:	89 e5                	mov    %esp,%ebp
+    56f2:	57                   	push   %edi
+    56f3:	56                   	push   %esi
+    56f4:	53                   	push   %ebx
+    56f5:	83 ec 24             	sub    $0x24,%esp
+  int fd, fd2, fds[2], i, n, off, pid;
+  char c;
+
+  printf(stdout, "splice test\n");
+    56f8:	68 8a 82 00 00       	push   $0x828a
+    56fd:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5703:	e8 4d 11 00 00       	call   6855 <printf>
+
+  unlink("splicein");
+    5708:	c7 04 24 97 82 00 00 	movl   $0x8297,(%esp)
+    570f:	e8 b4 0f 00 00       	call   66c8 <unlink>
+  unlink("spliceout");
+    5714:	c7 04 24 a0 82 00 00 	movl   $0x82a0,(%esp)
+    571b:	e8 a8 0f 00 00       	call   66c8 <unlink>
+  fd = open("splicein", O_CREATE|O_RDWR);
+    5720:	83 c4 08             	add    $0x8,%esp
+    5723:	68 02 02 00 00       	push   $0x202
+    5728:	68 97 82 00 00       	push   $0x8297
+    572d:	e8 86 0f 00 00       	call   66b8 <open>
+    5732:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 10000; i += n){
+    5734:	83 c4 10             	add    $0x10,%esp
+    5737:	be 00 00 00 00       	mov    $0x0,%esi
+    573c:	eb 4b                	jmp    5789 <splicetest+0x9a>
+    for(n = 0; n < 1000; n++)
+      buf[n] = 'a' + (i + n) % 23;
+    573e:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    5741:	ba c9 42 16 b2       	mov    $0xb21642c9,%edx
+    5746:	89 c8                	mov    %ecx,%eax
+    5748:	f7 ea                	imul   %edx
+    574a:	01 ca                	add    %ecx,%edx
+    574c:	c1 fa 04             	sar    $0x4,%edx
+    574f:	89 c8                	mov    %ecx,%eax
+    5751:	c1 f8 1f             	sar    $0x1f,%eax
+    5754:	29 c2                	sub    %eax,%edx
+    5756:	6b c2 17             	imul   $0x17,%edx,%eax
+    5759:	29 c1                	sub    %eax,%ecx
+    575b:	89 ca                	mov    %ecx,%edx
+    575d:	83 c2 61             	add    $0x61,%edx
+    5760:	88 93 e0 c7 00 00    	mov    %dl,0xc7e0(%ebx)
+    for(n = 0; n < 1000; n++)
+    5766:	83 c3 01             	add    $0x1,%ebx
+    5769:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    576f:	7e cd                	jle    573e <splicetest+0x4f>
+    if(write(fd, buf, n) != n){
+    5771:	83 ec 04             	sub    $0x4,%esp
+    5774:	53                   	push   %ebx
+    5775:	68 e0 c7 00 00       	push   $0xc7e0
+    577a:	57                   	push   %edi
+    577b:	e8 18 0f 00 00       	call   6698 <write>
+    5780:	83 c4 10             	add    $0x10,%esp
+    5783:	39 d8                	cmp    %ebx,%eax
+    5785:	75 11                	jne    5798 <splicetest+0xa9>
+  for(i = 0; i < 10000; i += n){
+    5787:	01 de                	add    %ebx,%esi
+    5789:	81 fe 0f 27 00 00    	cmp    $0x270f,%esi
+    578f:	7f 1f                	jg     57b0 <splicetest+0xc1>
+    for(n = 0; n < 1000; n++)
+    5791:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5796:	eb d1                	jmp    5769 <splicetest+0x7a>
+      printf(stdout, "splice: write failed\n");
+    5798:	83 ec 08             	sub    $0x8,%esp
+    579b:	68 aa 82 00 00       	push   $0x82aa
+    57a0:	ff 35 a4 a0 00 00    	push   0xa0a4
+    57a6:	e8 aa 10 00 00       	call   6855 <printf>
+      exit();
+    57ab:	e8 c8 0e 00 00       	call   6678 <exit>
+    }
+  }
+  close(fd);
+    57b0:	83 ec 0c             	sub    $0xc,%esp
+    57b3:	57                   	push   %edi
+    57b4:	e8 e7 0e 00 00       	call   66a0 <close>
+
+  // file to pipe in a child, pipe to file here
+  if(pipe(fds) != 0){
+    57b9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    57bc:	89 04 24             	mov    %eax,(%esp)
+    57bf:	e8 c4 0e 00 00       	call   6688 <pipe>
+    57c4:	89 c7                	mov    %eax,%edi
+    57c6:	83 c4 10             	add    $0x10,%esp
+    57c9:	85 c0                	test   %eax,%eax
+    57cb:	75 5b                	jne    5828 <splicetest+0x139>
+    printf(stdout, "splice: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+    57cd:	e8 9e 0e 00 00       	call   6670 <fork>
+  if(pid < 0){
+    57d2:	85 c0                	test   %eax,%eax
+    57d4:	78 6a                	js     5840 <splicetest+0x151>
+    printf(stdout, "splice: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    57d6:	0f 85 81 00 00 00    	jne    585d <splicetest+0x16e>
+    close(fds[0]);
+    57dc:	83 ec 0c             	sub    $0xc,%esp
+    57df:	ff 75 e0             	push   -0x20(%ebp)
+    57e2:	e8 b9 0e 00 00       	call   66a0 <close>
+    fd = open("splicein", O_RDONLY);
+    57e7:	83 c4 08             	add    $0x8,%esp
+    57ea:	6a 00                	push   $0x0
+    57ec:	68 97 82 00 00       	push   $0x8297
+    57f1:	e8 c2 0e 00 00       	call   66b8 <open>
+    if(sendfile(fds[1], fd, 0, 20000) != 10000){
+    57f6:	68 20 4e 00 00       	push   $0x4e20
+    57fb:	6a 00                	push   $0x0
+    57fd:	50                   	push   %eax
+    57fe:	ff 75 e4             	push   -0x1c(%ebp)
+    5801:	e8 9a 0f 00 00       	call   67a0 <sendfile>
+    5806:	83 c4 20             	add    $0x20,%esp
+    5809:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    580e:	74 48                	je     5858 <splicetest+0x169>
+      printf(stdout, "splice: sendfile to pipe failed\n");
+    5810:	83 ec 08             	sub    $0x8,%esp
+    5813:	68 34 93 00 00       	push   $0x9334
+    5818:	ff 35 a4 a0 00 00    	push   0xa0a4
+    581e:	e8 32 10 00 00       	call   6855 <printf>
+      exit();
+    5823:	e8 50 0e 00 00       	call   6678 <exit>
+    printf(stdout, "splice: pipe failed\n");
+    5828:	83 ec 08             	sub    $0x8,%esp
+    582b:	68 c0 82 00 00       	push   $0x82c0
+    5830:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5836:	e8 1a 10 00 00       	call   6855 <printf>
+    exit();
+    583b:	e8 38 0e 00 00       	call   6678 <exit>
+    printf(stdout, "splice: fork failed\n");
+    5840:	83 ec 08             	sub    $0x8,%esp
+    5843:	68 d5 82 00 00       	push   $0x82d5
+    5848:	ff 35 a4 a0 00 00    	push   0xa0a4
+    584e:	e8 02 10 00 00       	call   6855 <printf>
+    exit();
+    5853:	e8 20 0e 00 00       	call   6678 <exit>
+    }
+    exit();
+    5858:	e8 1b 0e 00 00       	call   6678 <exit>
+  }
+  close(fds[1]);
+    585d:	83 ec 0c             	sub    $0xc,%esp
+    5860:	ff 75 e4             	push   -0x1c(%ebp)
+    5863:	e8 38 0e 00 00       	call   66a0 <close>
+  fd2 = open("spliceout", O_CREATE|O_RDWR);
+    5868:	83 c4 08             	add    $0x8,%esp
+    586b:	68 02 02 00 00       	push   $0x202
+    5870:	68 a0 82 00 00       	push   $0x82a0
+    5875:	e8 3e 0e 00 00       	call   66b8 <open>
+    587a:	89 c6                	mov    %eax,%esi
+  n = 0;
+  while((i = splice(fds[0], fd2, 3000)) > 0)
+    587c:	83 c4 10             	add    $0x10,%esp
+    587f:	eb 02                	jmp    5883 <splicetest+0x194>
+    n += i;
+    5881:	01 df                	add    %ebx,%edi
+  while((i = splice(fds[0], fd2, 3000)) > 0)
+    5883:	83 ec 04             	sub    $0x4,%esp
+    5886:	68 b8 0b 00 00       	push   $0xbb8
+    588b:	56                   	push   %esi
+    588c:	ff 75 e0             	push   -0x20(%ebp)
+    588f:	e8 14 0f 00 00       	call   67a8 <splice>
+    5894:	89 c3                	mov    %eax,%ebx
+    5896:	83 c4 10             	add    $0x10,%esp
+    5899:	85 c0                	test   %eax,%eax
+    589b:	7f e4                	jg     5881 <splicetest+0x192>
+  close(fds[0]);
+    589d:	83 ec 0c             	sub    $0xc,%esp
+    58a0:	ff 75 e0             	push   -0x20(%ebp)
+    58a3:	e8 f8 0d 00 00       	call   66a0 <close>
+  wait();
+    58a8:	e8 d3 0d 00 00       	call   6680 <wait>
+  if(i < 0 || n != 10000){
+    58ad:	c1 eb 1f             	shr    $0x1f,%ebx
+    58b0:	83 c4 10             	add    $0x10,%esp
+    58b3:	81 ff 10 27 00 00    	cmp    $0x2710,%edi
+    58b9:	0f 95 c0             	setne  %al
+    58bc:	08 d8                	or     %bl,%al
+    58be:	0f 85 b3 00 00 00    	jne    5977 <splicetest+0x288>
+    printf(stdout, "splice: pipe to file copied %d\n", n);
+    exit();
+  }
+
+  // file to file, from an offset
+  fd = open("splicein", O_RDONLY);
+    58c4:	83 ec 08             	sub    $0x8,%esp
+    58c7:	6a 00                	push   $0x0
+    58c9:	68 97 82 00 00       	push   $0x8297
+    58ce:	e8 e5 0d 00 00       	call   66b8 <open>
+    58d3:	89 c7                	mov    %eax,%edi
+  off = 5000;
+    58d5:	c7 45 dc 88 13 00 00 	movl   $0x1388,-0x24(%ebp)
+  if(sendfile(fd2, fd, &off, 100) != 100 || off != 5100 ||
+    58dc:	6a 64                	push   $0x64
+    58de:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    58e1:	50                   	push   %eax
+    58e2:	57                   	push   %edi
+    58e3:	56                   	push   %esi
+    58e4:	e8 b7 0e 00 00       	call   67a0 <sendfile>
+    58e9:	83 c4 20             	add    $0x20,%esp
+    58ec:	83 f8 64             	cmp    $0x64,%eax
+    58ef:	0f 85 9b 00 00 00    	jne    5990 <splicetest+0x2a1>
+    58f5:	81 7d dc ec 13 00 00 	cmpl   $0x13ec,-0x24(%ebp)
+    58fc:	0f 85 8e 00 00 00    	jne    5990 <splicetest+0x2a1>
+     read(fd, &c, 1) != 1 || c != 'a'){
+    5902:	83 ec 04             	sub    $0x4,%esp
+    5905:	6a 01                	push   $0x1
+    5907:	8d 45 db             	lea    -0x25(%ebp),%eax
+    590a:	50                   	push   %eax
+    590b:	57                   	push   %edi
+    590c:	e8 7f 0d 00 00       	call   6690 <read>
+  if(sendfile(fd2, fd, &off, 100) != 100 || off != 5100 ||
+    5911:	83 c4 10             	add    $0x10,%esp
+    5914:	83 f8 01             	cmp    $0x1,%eax
+    5917:	75 77                	jne    5990 <splicetest+0x2a1>
+     read(fd, &c, 1) != 1 || c != 'a'){
+    5919:	80 7d db 61          	cmpb   $0x61,-0x25(%ebp)
+    591d:	75 71                	jne    5990 <splicetest+0x2a1>
+    printf(stdout, "splice: sendfile with offset failed\n");
+    exit();
+  }
+  if(splice(fd, fd2, 20000) != 9999 || splice(fd, fd2, 10) != 0){
+    591f:	83 ec 04             	sub    $0x4,%esp
+    5922:	68 20 4e 00 00       	push   $0x4e20
+    5927:	56                   	push   %esi
+    5928:	57                   	push   %edi
+    5929:	e8 7a 0e 00 00       	call   67a8 <splice>
+    592e:	83 c4 10             	add    $0x10,%esp
+    5931:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    5936:	75 70                	jne    59a8 <splicetest+0x2b9>
+    5938:	83 ec 04             	sub    $0x4,%esp
+    593b:	6a 0a                	push   $0xa
+    593d:	56                   	push   %esi
+    593e:	57                   	push   %edi
+    593f:	e8 64 0e 00 00       	call   67a8 <splice>
+    5944:	89 c3                	mov    %eax,%ebx
+    5946:	83 c4 10             	add    $0x10,%esp
+    5949:	85 c0                	test   %eax,%eax
+    594b:	75 5b                	jne    59a8 <splicetest+0x2b9>
+    printf(stdout, "splice: file to file failed\n");
+    exit();
+  }
+  close(fd);
+    594d:	83 ec 0c             	sub    $0xc,%esp
+    5950:	57                   	push   %edi
+    5951:	e8 4a 0d 00 00       	call   66a0 <close>
+  close(fd2);
+    5956:	89 34 24             	mov    %esi,(%esp)
+    5959:	e8 42 0d 00 00       	call   66a0 <close>
+
+  fd = open("spliceout", O_RDONLY);
+    595e:	83 c4 08             	add    $0x8,%esp
+    5961:	6a 00                	push   $0x0
+    5963:	68 a0 82 00 00       	push   $0x82a0
+    5968:	e8 4b 0d 00 00       	call   66b8 <open>
+    596d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20099; i++){
+    596f:	83 c4 10             	add    $0x10,%esp
+    5972:	e9 96 00 00 00       	jmp    5a0d <splicetest+0x31e>
+    printf(stdout, "splice: pipe to file copied %d\n", n);
+    5977:	83 ec 04             	sub    $0x4,%esp
+    597a:	57                   	push   %edi
+    597b:	68 58 93 00 00       	push   $0x9358
+    5980:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5986:	e8 ca 0e 00 00       	call   6855 <printf>
+    exit();
+    598b:	e8 e8 0c 00 00       	call   6678 <exit>
+    printf(stdout, "splice: sendfile with offset failed\n");
+    5990:	83 ec 08             	sub    $0x8,%esp
+    5993:	68 78 93 00 00       	push   $0x9378
+    5998:	ff 35 a4 a0 00 00    	push   0xa0a4
+    599e:	e8 b2 0e 00 00       	call   6855 <printf>
+    exit();
+    59a3:	e8 d0 0c 00 00       	call   6678 <exit>
+    printf(stdout, "splice: file to file failed\n");
+    59a8:	83 ec 08             	sub    $0x8,%esp
+    59ab:	68 ea 82 00 00       	push   $0x82ea
+    59b0:	ff 35 a4 a0 00 00    	push   0xa0a4
+    59b6:	e8 9a 0e 00 00       	call   6855 <printf>
+    exit();
+    59bb:	e8 b8 0c 00 00       	call   6678 <exit>
+    if(read(fd, &c, 1) != 1){
+      printf(stdout, "splice: short output\n");
+    59c0:	83 ec 08             	sub    $0x8,%esp
+    59c3:	68 07 83 00 00       	push   $0x8307
+    59c8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    59ce:	e8 82 0e 00 00       	call   6855 <printf>
+      exit();
+    59d3:	e8 a0 0c 00 00       	call   6678 <exit>
+    }
+    n = i < 10000 ? i : i < 10100 ? i - 10000 + 5000 : i - 10100 + 1;
+    59d8:	8d 8b 8d d8 ff ff    	lea    -0x2773(%ebx),%ecx
+    59de:	eb 02                	jmp    59e2 <splicetest+0x2f3>
+    59e0:	89 d9                	mov    %ebx,%ecx
+    if(c != 'a' + n % 23){
+    59e2:	0f be 7d db          	movsbl -0x25(%ebp),%edi
+    59e6:	ba c9 42 16 b2       	mov    $0xb21642c9,%edx
+    59eb:	89 c8                	mov    %ecx,%eax
+    59ed:	f7 ea                	imul   %edx
+    59ef:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+    59f2:	c1 f8 04             	sar    $0x4,%eax
+    59f5:	89 ca                	mov    %ecx,%edx
+    59f7:	c1 fa 1f             	sar    $0x1f,%edx
+    59fa:	29 d0                	sub    %edx,%eax
+    59fc:	6b d0 17             	imul   $0x17,%eax,%edx
+    59ff:	89 c8                	mov    %ecx,%eax
+    5a01:	29 d0                	sub    %edx,%eax
+    5a03:	83 c0 61             	add    $0x61,%eax
+    5a06:	39 c7                	cmp    %eax,%edi
+    5a08:	75 3a                	jne    5a44 <splicetest+0x355>
+  for(i = 0; i < 20099; i++){
+    5a0a:	83 c3 01             	add    $0x1,%ebx
+    5a0d:	81 fb 82 4e 00 00    	cmp    $0x4e82,%ebx
+    5a13:	7f 48                	jg     5a5d <splicetest+0x36e>
+    if(read(fd, &c, 1) != 1){
+    5a15:	83 ec 04             	sub    $0x4,%esp
+    5a18:	6a 01                	push   $0x1
+    5a1a:	8d 45 db             	lea    -0x25(%ebp),%eax
+    5a1d:	50                   	push   %eax
+    5a1e:	56                   	push   %esi
+    5a1f:	e8 6c 0c 00 00       	call   6690 <read>
+    5a24:	83 c4 10             	add    $0x10,%esp
+    5a27:	83 f8 01             	cmp    $0x1,%eax
+    5a2a:	75 94                	jne    59c0 <splicetest+0x2d1>
+    n = i < 10000 ? i : i < 10100 ? i - 10000 + 5000 : i - 10100 + 1;
+    5a2c:	81 fb 0f 27 00 00    	cmp    $0x270f,%ebx
+    5a32:	7e ac                	jle    59e0 <splicetest+0x2f1>
+    5a34:	81 fb 73 27 00 00    	cmp    $0x2773,%ebx
+    5a3a:	7f 9c                	jg     59d8 <splicetest+0x2e9>
+    5a3c:	8d 8b 78 ec ff ff    	lea    -0x1388(%ebx),%ecx
+    5a42:	eb 9e                	jmp    59e2 <splicetest+0x2f3>
+      printf(stdout, "splice: wrong byte %d\n", i);
+    5a44:	83 ec 04             	sub    $0x4,%esp
+    5a47:	53                   	push   %ebx
+    5a48:	68 1d 83 00 00       	push   $0x831d
+    5a4d:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5a53:	e8 fd 0d 00 00       	call   6855 <printf>
+      exit();
+    5a58:	e8 1b 0c 00 00       	call   6678 <exit>
+    }
+  }
+  if(read(fd, &c, 1) != 0){
+    5a5d:	83 ec 04             	sub    $0x4,%esp
+    5a60:	6a 01                	push   $0x1
+    5a62:	8d 45 db             	lea    -0x25(%ebp),%eax
+    5a65:	50                   	push   %eax
+    5a66:	56                   	push   %esi
+    5a67:	e8 24 0c 00 00       	call   6690 <read>
+    5a6c:	83 c4 10             	add    $0x10,%esp
+    5a6f:	85 c0                	test   %eax,%eax
+    5a71:	75 3f                	jne    5ab2 <splicetest+0x3c3>
+    printf(stdout, "splice: long output\n");
+    exit();
+  }
+  close(fd);
+    5a73:	83 ec 0c             	sub    $0xc,%esp
+    5a76:	56                   	push   %esi
+    5a77:	e8 24 0c 00 00       	call   66a0 <close>
+  unlink("splicein");
+    5a7c:	c7 04 24 97 82 00 00 	movl   $0x8297,(%esp)
+    5a83:	e8 40 0c 00 00       	call   66c8 <unlink>
+  unlink("spliceout");
+    5a88:	c7 04 24 a0 82 00 00 	movl   $0x82a0,(%esp)
+    5a8f:	e8 34 0c 00 00       	call   66c8 <unlink>
+  printf(stdout, "splice test ok\n");
+    5a94:	83 c4 08             	add    $0x8,%esp
+    5a97:	68 49 83 00 00       	push   $0x8349
+    5a9c:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5aa2:	e8 ae 0d 00 00       	call   6855 <printf>
+}
+    5aa7:	83 c4 10             	add    $0x10,%esp
+    5aaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5aad:	5b                   	pop    %ebx
+    5aae:	5e                   	pop    %esi
+    5aaf:	5f                   	pop    %edi
+    5ab0:	5d                   	pop    %ebp
+    5ab1:	c3                   	ret
+    printf(stdout, "splice: long output\n");
+    5ab2:	83 ec 08             	sub    $0x8,%esp
+    5ab5:	68 34 83 00 00       	push   $0x8334
+    5aba:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5ac0:	e8 90 0d 00 00       	call   6855 <printf>
+    exit();
+    5ac5:	e8 ae 0b 00 00       	call   6678 <exit>
+
+00005aca <writebacktest>:
+// small appends are held in memory and written back later;
+// the file reads back the same before and after, and fsync
+// and the flusher both write it
+void
+writebacktest(void)
+{
+    5aca:	55                   	push   %ebp
+    5acb:	89 e5                	mov    %esp,%ebp
+    5acd:	57                   	push   %edi
+    5ace:	56                   	push   %esi
+    5acf:	53                   	push   %ebx
+    5ad0:	83 ec 74             	sub    $0x74,%esp
+  struct diskstat ds0, ds1;
+  struct stat st;
+  int fd, i, j;
+  char c;
+
+  printf(stdout, "writeback test\n");
+    5ad3:	68 59 83 00 00       	push   $0x8359
+    5ad8:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5ade:	e8 72 0d 00 00       	call   6855 <printf>
+
+  unlink("wbfile");
+    5ae3:	c7 04 24 69 83 00 00 	movl   $0x8369,(%esp)
+    5aea:	e8 d9 0b 00 00       	call   66c8 <unlink>
+  fd = open("wbfile", O_CREATE|O_RDWR);
+    5aef:	83 c4 08             	add    $0x8,%esp
+    5af2:	68 02 02 00 00       	push   $0x202
+    5af7:	68 69 83 00 00       	push   $0x8369
+    5afc:	e8 b7 0b 00 00       	call   66b8 <open>
+  if(fd < 0){
+    5b01:	83 c4 10             	add    $0x10,%esp
+    5b04:	85 c0                	test   %eax,%eax
+    5b06:	78 09                	js     5b11 <writebacktest+0x47>
+    5b08:	89 c6                	mov    %eax,%esi
+    printf(stdout, "writeback: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 300; i++){
+    5b0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5b0f:	eb 6e                	jmp    5b7f <writebacktest+0xb5>
+    printf(stdout, "writeback: create failed\n");
+    5b11:	83 ec 08             	sub    $0x8,%esp
+    5b14:	68 70 83 00 00       	push   $0x8370
+    5b19:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5b1f:	e8 31 0d 00 00       	call   6855 <printf>
+    exit();
+    5b24:	e8 4f 0b 00 00       	call   6678 <exit>
+    for(j = 0; j < 37; j++)
+      buf[j] = 'a' + (i*37 + j) % 26;
+    5b29:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+    5b2c:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+    5b2f:	01 f9                	add    %edi,%ecx
+    5b31:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    5b36:	89 c8                	mov    %ecx,%eax
+    5b38:	f7 ea                	imul   %edx
+    5b3a:	c1 fa 03             	sar    $0x3,%edx
+    5b3d:	89 c8                	mov    %ecx,%eax
+    5b3f:	c1 f8 1f             	sar    $0x1f,%eax
+    5b42:	29 c2                	sub    %eax,%edx
+    5b44:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    5b47:	29 c1                	sub    %eax,%ecx
+    5b49:	89 ca                	mov    %ecx,%edx
+    5b4b:	83 c2 61             	add    $0x61,%edx
+    5b4e:	88 97 e0 c7 00 00    	mov    %dl,0xc7e0(%edi)
+    for(j = 0; j < 37; j++)
+    5b54:	83 c7 01             	add    $0x1,%edi
+    5b57:	83 ff 24             	cmp    $0x24,%edi
+    5b5a:	7e cd                	jle    5b29 <writebacktest+0x5f>
+    if(write(fd, buf, 37) != 37){
+    5b5c:	83 ec 04             	sub    $0x4,%esp
+    5b5f:	6a 25                	push   $0x25
+    5b61:	68 e0 c7 00 00       	push   $0xc7e0
+    5b66:	56                   	push   %esi
+    5b67:	e8 2c 0b 00 00       	call   6698 <write>
+    5b6c:	83 c4 10             	add    $0x10,%esp
+    5b6f:	83 f8 25             	cmp    $0x25,%eax
+    5b72:	75 1e                	jne    5b92 <writebacktest+0xc8>
+      printf(stdout, "writeback: write failed\n");
+      exit();
+    }
+    if(i == 150){
+    5b74:	81 fb 96 00 00 00    	cmp    $0x96,%ebx
+    5b7a:	74 2e                	je     5baa <writebacktest+0xe0>
+  for(i = 0; i < 300; i++){
+    5b7c:	83 c3 01             	add    $0x1,%ebx
+    5b7f:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+    5b85:	0f 8f 81 00 00 00    	jg     5c0c <writebacktest+0x142>
+    for(j = 0; j < 37; j++)
+    5b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+    5b90:	eb c5                	jmp    5b57 <writebacktest+0x8d>
+      printf(stdout, "writeback: write failed\n");
+    5b92:	83 ec 08             	sub    $0x8,%esp
+    5b95:	68 8a 83 00 00       	push   $0x838a
+    5b9a:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5ba0:	e8 b0 0c 00 00       	call   6855 <printf>
+      exit();
+    5ba5:	e8 ce 0a 00 00       	call   6678 <exit>
+      getdiskstat(&ds0);
+    5baa:	83 ec 0c             	sub    $0xc,%esp
+    5bad:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    5bb0:	50                   	push   %eax
+    5bb1:	e8 b2 0b 00 00       	call   6768 <getdiskstat>
+      if(fsync(fd) != 0){
+    5bb6:	89 34 24             	mov    %esi,(%esp)
+    5bb9:	e8 b2 0b 00 00       	call   6770 <fsync>
+    5bbe:	83 c4 10             	add    $0x10,%esp
+    5bc1:	85 c0                	test   %eax,%eax
+    5bc3:	75 2f                	jne    5bf4 <writebacktest+0x12a>
+        printf(stdout, "writeback: fsync failed\n");
+        exit();
+      }
+      getdiskstat(&ds1);
+    5bc5:	83 ec 0c             	sub    $0xc,%esp
+    5bc8:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    5bcb:	50                   	push   %eax
+    5bcc:	e8 97 0b 00 00       	call   6768 <getdiskstat>
+      if(ds1.writes == ds0.writes){
+    5bd1:	83 c4 10             	add    $0x10,%esp
+    5bd4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5bd7:	39 45 b4             	cmp    %eax,-0x4c(%ebp)
+    5bda:	75 a0                	jne    5b7c <writebacktest+0xb2>
+        printf(stdout, "writeback: fsync wrote nothing\n");
+    5bdc:	83 ec 08             	sub    $0x8,%esp
+    5bdf:	68 a0 93 00 00       	push   $0x93a0
+    5be4:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5bea:	e8 66 0c 00 00       	call   6855 <printf>
+        exit();
+    5bef:	e8 84 0a 00 00       	call   6678 <exit>
+        printf(stdout, "writeback: fsync failed\n");
+    5bf4:	83 ec 08             	sub    $0x8,%esp
+    5bf7:	68 a3 83 00 00       	push   $0x83a3
+    5bfc:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5c02:	e8 4e 0c 00 00       	call   6855 <printf>
+        exit();
+    5c07:	e8 6c 0a 00 00       	call   6678 <exit>
+      }
+    }
+  }
+  if(fstat(fd, &st) < 0 || st.size != 300*37){
+    5c0c:	83 ec 08             	sub    $0x8,%esp
+    5c0f:	8d 45 98             	lea    -0x68(%ebp),%eax
+    5c12:	50                   	push   %eax
+    5c13:	56                   	push   %esi
+    5c14:	e8 b7 0a 00 00       	call   66d0 <fstat>
+    5c19:	83 c4 10             	add    $0x10,%esp
+    5c1c:	85 c0                	test   %eax,%eax
+    5c1e:	78 38                	js     5c58 <writebacktest+0x18e>
+    5c20:	81 7d a8 5c 2b 00 00 	cmpl   $0x2b5c,-0x58(%ebp)
+    5c27:	75 2f                	jne    5c58 <writebacktest+0x18e>
+    printf(stdout, "writeback: size %d\n", st.size);
+    exit();
+  }
+  // overwrite across the end of what fsync wrote
+  if(pwrite(fd, "XYZ", 3, 151*37 - 1) != 3){
+    5c29:	68 d2 15 00 00       	push   $0x15d2
+    5c2e:	6a 03                	push   $0x3
+    5c30:	68 d0 83 00 00       	push   $0x83d0
+    5c35:	56                   	push   %esi
+    5c36:	e8 4d 0b 00 00       	call   6788 <pwrite>
+    5c3b:	83 c4 10             	add    $0x10,%esp
+    5c3e:	83 f8 03             	cmp    $0x3,%eax
+    5c41:	75 30                	jne    5c73 <writebacktest+0x1a9>
+    printf(stdout, "writeback: pwrite failed\n");
+    exit();
+  }
+
+  for(j = 0; j < 2; j++){
+    5c43:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5c48:	83 fb 01             	cmp    $0x1,%ebx
+    5c4b:	0f 8f 93 01 00 00    	jg     5de4 <writebacktest+0x31a>
+    for(i = 0; i < (300 + j)*37; i++){
+    5c51:	bf 00 00 00 00       	mov    $0x0,%edi
+    5c56:	eb 71                	jmp    5cc9 <writebacktest+0x1ff>
+    printf(stdout, "writeback: size %d\n", st.size);
+    5c58:	83 ec 04             	sub    $0x4,%esp
+    5c5b:	ff 75 a8             	push   -0x58(%ebp)
+    5c5e:	68 bc 83 00 00       	push   $0x83bc
+    5c63:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5c69:	e8 e7 0b 00 00       	call   6855 <printf>
+    exit();
+    5c6e:	e8 05 0a 00 00       	call   6678 <exit>
+    printf(stdout, "writeback: pwrite failed\n");
+    5c73:	83 ec 08             	sub    $0x8,%esp
+    5c76:	68 d4 83 00 00       	push   $0x83d4
+    5c7b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5c81:	e8 cf 0b 00 00       	call   6855 <printf>
+    exit();
+    5c86:	e8 ed 09 00 00       	call   6678 <exit>
+      if(pread(fd, &c, 1, i) != 1){
+        printf(stdout, "writeback: short file\n");
+    5c8b:	83 ec 08             	sub    $0x8,%esp
+    5c8e:	68 ee 83 00 00       	push   $0x83ee
+    5c93:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5c99:	e8 b7 0b 00 00       	call   6855 <printf>
+        exit();
+    5c9e:	e8 d5 09 00 00       	call   6678 <exit>
+      }
+      if(c != (i >= 151*37 - 1 && i < 151*37 + 2 ? "XYZ"[i - (151*37 - 1)] : 'a' + i % 26)){
+    5ca3:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    5ca8:	89 f8                	mov    %edi,%eax
+    5caa:	f7 ea                	imul   %edx
+    5cac:	89 d0                	mov    %edx,%eax
+    5cae:	c1 f8 03             	sar    $0x3,%eax
+    5cb1:	89 fa                	mov    %edi,%edx
+    5cb3:	c1 fa 1f             	sar    $0x1f,%edx
+    5cb6:	29 d0                	sub    %edx,%eax
+    5cb8:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    5cbb:	89 f8                	mov    %edi,%eax
+    5cbd:	29 d0                	sub    %edx,%eax
+    5cbf:	83 c0 61             	add    $0x61,%eax
+    5cc2:	39 c1                	cmp    %eax,%ecx
+    5cc4:	75 40                	jne    5d06 <writebacktest+0x23c>
+    for(i = 0; i < (300 + j)*37; i++){
+    5cc6:	83 c7 01             	add    $0x1,%edi
+    5cc9:	8d 83 2c 01 00 00    	lea    0x12c(%ebx),%eax
+    5ccf:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+    5cd2:	8d 04 90             	lea    (%eax,%edx,4),%eax
+    5cd5:	39 f8                	cmp    %edi,%eax
+    5cd7:	7e 46                	jle    5d1f <writebacktest+0x255>
+      if(pread(fd, &c, 1, i) != 1){
+    5cd9:	57                   	push   %edi
+    5cda:	6a 01                	push   $0x1
+    5cdc:	8d 45 97             	lea    -0x69(%ebp),%eax
+    5cdf:	50                   	push   %eax
+    5ce0:	56                   	push   %esi
+    5ce1:	e8 9a 0a 00 00       	call   6780 <pread>
+    5ce6:	83 c4 10             	add    $0x10,%esp
+    5ce9:	83 f8 01             	cmp    $0x1,%eax
+    5cec:	75 9d                	jne    5c8b <writebacktest+0x1c1>
+      if(c != (i >= 151*37 - 1 && i < 151*37 + 2 ? "XYZ"[i - (151*37 - 1)] : 'a' + i % 26)){
+    5cee:	0f be 4d 97          	movsbl -0x69(%ebp),%ecx
+    5cf2:	8d 87 2e ea ff ff    	lea    -0x15d2(%edi),%eax
+    5cf8:	83 f8 02             	cmp    $0x2,%eax
+    5cfb:	77 a6                	ja     5ca3 <writebacktest+0x1d9>
+    5cfd:	0f be 87 fe 6d 00 00 	movsbl 0x6dfe(%edi),%eax
+    5d04:	eb bc                	jmp    5cc2 <writebacktest+0x1f8>
+        printf(stdout, "writeback: wrong byte %d\n", i);
+    5d06:	83 ec 04             	sub    $0x4,%esp
+    5d09:	57                   	push   %edi
+    5d0a:	68 05 84 00 00       	push   $0x8405
+    5d0f:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5d15:	e8 3b 0b 00 00       	call   6855 <printf>
+        exit();
+    5d1a:	e8 59 09 00 00       	call   6678 <exit>
+      }
+    }
+    if(j == 1)
+    5d1f:	83 fb 01             	cmp    $0x1,%ebx
+    5d22:	0f 84 bc 00 00 00    	je     5de4 <writebacktest+0x31a>
+      break;
+    // Append one more piece, which stays in memory until the
+    // flusher runs, then check everything again.
+    getdiskstat(&ds0);
+    5d28:	83 ec 0c             	sub    $0xc,%esp
+    5d2b:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    5d2e:	50                   	push   %eax
+    5d2f:	e8 34 0a 00 00       	call   6768 <getdiskstat>
+    for(i = 0; i < 37; i++)
+    5d34:	83 c4 10             	add    $0x10,%esp
+    5d37:	b9 00 00 00 00       	mov    $0x0,%ecx
+    5d3c:	eb 2e                	jmp    5d6c <writebacktest+0x2a2>
+      buf[i] = 'a' + (300*37 + i) % 26;
+    5d3e:	8d b9 5c 2b 00 00    	lea    0x2b5c(%ecx),%edi
+    5d44:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    5d49:	89 f8                	mov    %edi,%eax
+    5d4b:	f7 ea                	imul   %edx
+    5d4d:	89 d0                	mov    %edx,%eax
+    5d4f:	c1 f8 03             	sar    $0x3,%eax
+    5d52:	89 fa                	mov    %edi,%edx
+    5d54:	c1 fa 1f             	sar    $0x1f,%edx
+    5d57:	29 d0                	sub    %edx,%eax
+    5d59:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    5d5c:	89 f8                	mov    %edi,%eax
+    5d5e:	29 d0                	sub    %edx,%eax
+    5d60:	83 c0 61             	add    $0x61,%eax
+    5d63:	88 81 e0 c7 00 00    	mov    %al,0xc7e0(%ecx)
+    for(i = 0; i < 37; i++)
+    5d69:	83 c1 01             	add    $0x1,%ecx
+    5d6c:	83 f9 24             	cmp    $0x24,%ecx
+    5d6f:	7e cd                	jle    5d3e <writebacktest+0x274>
+    if(write(fd, buf, 37) != 37){
+    5d71:	83 ec 04             	sub    $0x4,%esp
+    5d74:	6a 25                	push   $0x25
+    5d76:	68 e0 c7 00 00       	push   $0xc7e0
+    5d7b:	56                   	push   %esi
+    5d7c:	e8 17 09 00 00       	call   6698 <write>
+    5d81:	83 c4 10             	add    $0x10,%esp
+    5d84:	83 f8 25             	cmp    $0x25,%eax
+    5d87:	75 2b                	jne    5db4 <writebacktest+0x2ea>
+      printf(stdout, "writeback: write failed\n");
+      exit();
+    }
+    sleep(150);
+    5d89:	83 ec 0c             	sub    $0xc,%esp
+    5d8c:	68 96 00 00 00       	push   $0x96
+    5d91:	e8 72 09 00 00       	call   6708 <sleep>
+    getdiskstat(&ds1);
+    5d96:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    5d99:	89 04 24             	mov    %eax,(%esp)
+    5d9c:	e8 c7 09 00 00       	call   6768 <getdiskstat>
+    if(ds1.writes == ds0.writes){
+    5da1:	83 c4 10             	add    $0x10,%esp
+    5da4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5da7:	39 45 b4             	cmp    %eax,-0x4c(%ebp)
+    5daa:	74 20                	je     5dcc <writebacktest+0x302>
+  for(j = 0; j < 2; j++){
+    5dac:	83 c3 01             	add    $0x1,%ebx
+    5daf:	e9 94 fe ff ff       	jmp    5c48 <writebacktest+0x17e>
+      printf(stdout, "writeback: write failed\n");
+    5db4:	83 ec 08             	sub    $0x8,%esp
+    5db7:	68 8a 83 00 00       	push   $0x838a
+    5dbc:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5dc2:	e8 8e 0a 00 00       	call   6855 <printf>
+      exit();
+    5dc7:	e8 ac 08 00 00       	call   6678 <exit>
+      printf(stdout, "writeback: flusher wrote nothing\n");
+    5dcc:	83 ec 08             	sub    $0x8,%esp
+    5dcf:	68 c0 93 00 00       	push   $0x93c0
+    5dd4:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5dda:	e8 76 0a 00 00       	call   6855 <printf>
+      exit();
+    5ddf:	e8 94 08 00 00       	call   6678 <exit>
+    }
+  }
+  close(fd);
+    5de4:	83 ec 0c             	sub    $0xc,%esp
+    5de7:	56                   	push   %esi
+    5de8:	e8 b3 08 00 00       	call   66a0 <close>
+  unlink("wbfile");
+    5ded:	c7 04 24 69 83 00 00 	movl   $0x8369,(%esp)
+    5df4:	e8 cf 08 00 00       	call   66c8 <unlink>
+  printf(stdout, "writeback test ok\n");
+    5df9:	83 c4 08             	add    $0x8,%esp
+    5dfc:	68 1f 84 00 00       	push   $0x841f
+    5e01:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5e07:	e8 49 0a 00 00       	call   6855 <printf>
+}
+    5e0c:	83 c4 10             	add    $0x10,%esp
+    5e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5e12:	5b                   	pop    %ebx
+    5e13:	5e                   	pop    %esi
+    5e14:	5f                   	pop    %edi
+    5e15:	5d                   	pop    %ebp
+    5e16:	c3                   	ret
+
+00005e17 <dcachetest>:
+
+// repeated lookups are answered by the dentry cache, misses
+// too; link and unlink keep it right
+void
+dcachetest(void)
+{
+    5e17:	55                   	push   %ebp
+    5e18:	89 e5                	mov    %esp,%ebp
+    5e1a:	53                   	push   %ebx
+    5e1b:	83 ec 2c             	sub    $0x2c,%esp
+  struct dcstat st0, st1;
+  int fd, i;
+
+  printf(stdout, "dcache test\n");
+    5e1e:	68 32 84 00 00       	push   $0x8432
+    5e23:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5e29:	e8 27 0a 00 00       	call   6855 <printf>
+
+  mkdir("dcdir");
+    5e2e:	c7 04 24 3f 84 00 00 	movl   $0x843f,(%esp)
+    5e35:	e8 a6 08 00 00       	call   66e0 <mkdir>
+  fd = open("dcdir/f", O_CREATE|O_RDWR);
+    5e3a:	83 c4 08             	add    $0x8,%esp
+    5e3d:	68 02 02 00 00       	push   $0x202
+    5e42:	68 45 84 00 00       	push   $0x8445
+    5e47:	e8 6c 08 00 00       	call   66b8 <open>
+  if(fd < 0){
+    5e4c:	83 c4 10             	add    $0x10,%esp
+    5e4f:	85 c0                	test   %eax,%eax
+    5e51:	78 1e                	js     5e71 <dcachetest+0x5a>
+    printf(stdout, "dcache: create failed\n");
+    exit();
+  }
+  close(fd);
+    5e53:	83 ec 0c             	sub    $0xc,%esp
+    5e56:	50                   	push   %eax
+    5e57:	e8 44 08 00 00       	call   66a0 <close>
+
+  getdcstat(&st0);
+    5e5c:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    5e5f:	89 04 24             	mov    %eax,(%esp)
+    5e62:	e8 11 09 00 00       	call   6778 <getdcstat>
+  for(i = 0; i < 10; i++){
+    5e67:	83 c4 10             	add    $0x10,%esp
+    5e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5e6f:	eb 33                	jmp    5ea4 <dcachetest+0x8d>
+    printf(stdout, "dcache: create failed\n");
+    5e71:	83 ec 08             	sub    $0x8,%esp
+    5e74:	68 4d 84 00 00       	push   $0x844d
+    5e79:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5e7f:	e8 d1 09 00 00       	call   6855 <printf>
+    exit();
+    5e84:	e8 ef 07 00 00       	call   6678 <exit>
+    if((fd = open("dcdir/f", O_RDONLY)) < 0){
+      printf(stdout, "dcache: open failed\n");
+    5e89:	83 ec 08             	sub    $0x8,%esp
+    5e8c:	68 64 84 00 00       	push   $0x8464
+    5e91:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5e97:	e8 b9 09 00 00       	call   6855 <printf>
+      exit();
+    5e9c:	e8 d7 07 00 00       	call   6678 <exit>
+  for(i = 0; i < 10; i++){
+    5ea1:	83 c3 01             	add    $0x1,%ebx
+    5ea4:	83 fb 09             	cmp    $0x9,%ebx
+    5ea7:	7f 4d                	jg     5ef6 <dcachetest+0xdf>
+    if((fd = open("dcdir/f", O_RDONLY)) < 0){
+    5ea9:	83 ec 08             	sub    $0x8,%esp
+    5eac:	6a 00                	push   $0x0
+    5eae:	68 45 84 00 00       	push   $0x8445
+    5eb3:	e8 00 08 00 00       	call   66b8 <open>
+    5eb8:	83 c4 10             	add    $0x10,%esp
+    5ebb:	85 c0                	test   %eax,%eax
+    5ebd:	78 ca                	js     5e89 <dcachetest+0x72>
+    }
+    close(fd);
+    5ebf:	83 ec 0c             	sub    $0xc,%esp
+    5ec2:	50                   	push   %eax
+    5ec3:	e8 d8 07 00 00       	call   66a0 <close>
+    if(open("dcdir/nofile", O_RDONLY) >= 0){
+    5ec8:	83 c4 08             	add    $0x8,%esp
+    5ecb:	6a 00                	push   $0x0
+    5ecd:	68 79 84 00 00       	push   $0x8479
+    5ed2:	e8 e1 07 00 00       	call   66b8 <open>
+    5ed7:	83 c4 10             	add    $0x10,%esp
+    5eda:	85 c0                	test   %eax,%eax
+    5edc:	78 c3                	js     5ea1 <dcachetest+0x8a>
+      printf(stdout, "dcache: opened nofile\n");
+    5ede:	83 ec 08             	sub    $0x8,%esp
+    5ee1:	68 86 84 00 00       	push   $0x8486
+    5ee6:	ff 35 a4 a0 00 00    	push   0xa0a4
+    5eec:	e8 64 09 00 00       	call   6855 <printf>
+      exit();
+    5ef1:	e8 82 07 00 00       	call   6678 <exit>
+    }
+  }
+  getdcstat(&st1);
+    5ef6:	83 ec 0c             	sub    $0xc,%esp
+    5ef9:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    5efc:	50                   	push   %eax
+    5efd:	e8 76 08 00 00       	call   6778 <getdcstat>
+  if(st1.hits < st0.hits + 10 || st1.neghits < st0.neghits + 9){
+    5f02:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    5f05:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    5f08:	8d 41 0a             	lea    0xa(%ecx),%eax
+    5f0b:	83 c4 10             	add    $0x10,%esp
+    5f0e:	39 c2                	cmp    %eax,%edx
+    5f10:	0f 82 24 01 00 00    	jb     603a <dcachetest+0x223>
+    5f16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5f19:	83 c0 09             	add    $0x9,%eax
+    5f1c:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+    5f1f:	0f 82 15 01 00 00    	jb     603a <dcachetest+0x223>
+    exit();
+  }
+
+  // A cached miss must not hide a new name, nor a cached
+  // hit a removed one.
+  if(link("dcdir/f", "dcdir/nofile") < 0 || (fd = open("dcdir/nofile", O_RDONLY)) < 0){
+    5f25:	83 ec 08             	sub    $0x8,%esp
+    5f28:	68 79 84 00 00       	push   $0x8479
+    5f2d:	68 45 84 00 00       	push   $0x8445
+    5f32:	e8 a1 07 00 00       	call   66d8 <link>
+    5f37:	83 c4 10             	add    $0x10,%esp
+    5f3a:	85 c0                	test   %eax,%eax
+    5f3c:	0f 88 17 01 00 00    	js     6059 <dcachetest+0x242>
+    5f42:	83 ec 08             	sub    $0x8,%esp
+    5f45:	6a 00                	push   $0x0
+    5f47:	68 79 84 00 00       	push   $0x8479
+    5f4c:	e8 67 07 00 00       	call   66b8 <open>
+    5f51:	83 c4 10             	add    $0x10,%esp
+    5f54:	85 c0                	test   %eax,%eax
+    5f56:	0f 88 fd 00 00 00    	js     6059 <dcachetest+0x242>
+    printf(stdout, "dcache: link not seen\n");
+    exit();
+  }
+  close(fd);
+    5f5c:	83 ec 0c             	sub    $0xc,%esp
+    5f5f:	50                   	push   %eax
+    5f60:	e8 3b 07 00 00       	call   66a0 <close>
+  if(unlink("dcdir/nofile") < 0 || open("dcdir/nofile", O_RDONLY) >= 0){
+    5f65:	c7 04 24 79 84 00 00 	movl   $0x8479,(%esp)
+    5f6c:	e8 57 07 00 00       	call   66c8 <unlink>
+    5f71:	83 c4 10             	add    $0x10,%esp
+    5f74:	85 c0                	test   %eax,%eax
+    5f76:	0f 88 f5 00 00 00    	js     6071 <dcachetest+0x25a>
+    5f7c:	83 ec 08             	sub    $0x8,%esp
+    5f7f:	6a 00                	push   $0x0
+    5f81:	68 79 84 00 00       	push   $0x8479
+    5f86:	e8 2d 07 00 00       	call   66b8 <open>
+    5f8b:	83 c4 10             	add    $0x10,%esp
+    5f8e:	85 c0                	test   %eax,%eax
+    5f90:	0f 89 db 00 00 00    	jns    6071 <dcachetest+0x25a>
+    printf(stdout, "dcache: unlink not seen\n");
+    exit();
+  }
+  if(unlink("dcdir/f") < 0 || unlink("dcdir") < 0){
+    5f96:	83 ec 0c             	sub    $0xc,%esp
+    5f99:	68 45 84 00 00       	push   $0x8445
+    5f9e:	e8 25 07 00 00       	call   66c8 <unlink>
+    5fa3:	83 c4 10             	add    $0x10,%esp
+    5fa6:	85 c0                	test   %eax,%eax
+    5fa8:	0f 88 db 00 00 00    	js     6089 <dcachetest+0x272>
+    5fae:	83 ec 0c             	sub    $0xc,%esp
+    5fb1:	68 3f 84 00 00       	push   $0x843f
+    5fb6:	e8 0d 07 00 00       	call   66c8 <unlink>
+    5fbb:	83 c4 10             	add    $0x10,%esp
+    5fbe:	85 c0                	test   %eax,%eax
+    5fc0:	0f 88 c3 00 00 00    	js     6089 <dcachetest+0x272>
+    printf(stdout, "dcache: unlink failed\n");
+    exit();
+  }
+  if(open("dcdir/f", O_RDONLY) >= 0 || mkdir("dcdir") < 0 || open("dcdir/f", O_RDONLY) >= 0){
+    5fc6:	83 ec 08             	sub    $0x8,%esp
+    5fc9:	6a 00                	push   $0x0
+    5fcb:	68 45 84 00 00       	push   $0x8445
+    5fd0:	e8 e3 06 00 00       	call   66b8 <open>
+    5fd5:	83 c4 10             	add    $0x10,%esp
+    5fd8:	85 c0                	test   %eax,%eax
+    5fda:	0f 89 c1 00 00 00    	jns    60a1 <dcachetest+0x28a>
+    5fe0:	83 ec 0c             	sub    $0xc,%esp
+    5fe3:	68 3f 84 00 00       	push   $0x843f
+    5fe8:	e8 f3 06 00 00       	call   66e0 <mkdir>
+    5fed:	83 c4 10             	add    $0x10,%esp
+    5ff0:	85 c0                	test   %eax,%eax
+    5ff2:	0f 88 a9 00 00 00    	js     60a1 <dcachetest+0x28a>
+    5ff8:	83 ec 08             	sub    $0x8,%esp
+    5ffb:	6a 00                	push   $0x0
+    5ffd:	68 45 84 00 00       	push   $0x8445
+    6002:	e8 b1 06 00 00       	call   66b8 <open>
+    6007:	83 c4 10             	add    $0x10,%esp
+    600a:	85 c0                	test   %eax,%eax
+    600c:	0f 89 8f 00 00 00    	jns    60a1 <dcachetest+0x28a>
+    printf(stdout, "dcache: stale names in new dcdir\n");
+    exit();
+  }
+  unlink("dcdir");
+    6012:	83 ec 0c             	sub    $0xc,%esp
+    6015:	68 3f 84 00 00       	push   $0x843f
+    601a:	e8 a9 06 00 00       	call   66c8 <unlink>
+  printf(stdout, "dcache test ok\n");
+    601f:	83 c4 08             	add    $0x8,%esp
+    6022:	68 e4 84 00 00       	push   $0x84e4
+    6027:	ff 35 a4 a0 00 00    	push   0xa0a4
+    602d:	e8 23 08 00 00       	call   6855 <printf>
+}
+    6032:	83 c4 10             	add    $0x10,%esp
+    6035:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6038:	c9                   	leave
+    6039:	c3                   	ret
+    printf(stdout, "dcache: %d hits, %d negative hits\n",
+    603a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    603d:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    6040:	50                   	push   %eax
+    6041:	29 ca                	sub    %ecx,%edx
+    6043:	52                   	push   %edx
+    6044:	68 e4 93 00 00       	push   $0x93e4
+    6049:	ff 35 a4 a0 00 00    	push   0xa0a4
+    604f:	e8 01 08 00 00       	call   6855 <printf>
+    exit();
+    6054:	e8 1f 06 00 00       	call   6678 <exit>
+    printf(stdout, "dcache: link not seen\n");
+    6059:	83 ec 08             	sub    $0x8,%esp
+    605c:	68 9d 84 00 00       	push   $0x849d
+    6061:	ff 35 a4 a0 00 00    	push   0xa0a4
+    6067:	e8 e9 07 00 00       	call   6855 <printf>
+    exit();
+    606c:	e8 07 06 00 00       	call   6678 <exit>
+    printf(stdout, "dcache: unlink not seen\n");
+    6071:	83 ec 08             	sub    $0x8,%esp
+    6074:	68 b4 84 00 00       	push   $0x84b4
+    6079:	ff 35 a4 a0 00 00    	push   0xa0a4
+    607f:	e8 d1 07 00 00       	call   6855 <printf>
+    exit();
+    6084:	e8 ef 05 00 00       	call   6678 <exit>
+    printf(stdout, "dcache: unlink failed\n");
+    6089:	83 ec 08             	sub    $0x8,%esp
+    608c:	68 cd 84 00 00       	push   $0x84cd
+    6091:	ff 35 a4 a0 00 00    	push   0xa0a4
+    6097:	e8 b9 07 00 00       	call   6855 <printf>
+    exit();
+    609c:	e8 d7 05 00 00       	call   6678 <exit>
+    printf(stdout, "dcache: stale names in new dcdir\n");
+    60a1:	83 ec 08             	sub    $0x8,%esp
+    60a4:	68 08 94 00 00       	push   $0x9408
+    60a9:	ff 35 a4 a0 00 00    	push   0xa0a4
+    60af:	e8 a1 07 00 00       	call   6855 <printf>
+    exit();
+    60b4:	e8 bf 05 00 00       	call   6678 <exit>
+
+000060b9 <fsynctest>:
+
+// many processes creating files share commits; fsync waits
+// for them and rejects bad descriptors
+void
+fsynctest(void)
+{
+    60b9:	55                   	push   %ebp
+    60ba:	89 e5                	mov    %esp,%ebp
+    60bc:	57                   	push   %edi
+    60bd:	56                   	push   %esi
+    60be:	53                   	push   %ebx
+    60bf:	83 ec 24             	sub    $0x24,%esp
+  char file[] = "fsync00";
+    60c2:	c7 45 e0 66 73 79 6e 	movl   $0x6e797366,-0x20(%ebp)
+    60c9:	c7 45 e4 63 30 30 00 	movl   $0x303063,-0x1c(%ebp)
+  int fd, i, j, pid;
+
+  printf(stdout, "fsync test\n");
+    60d0:	68 f4 84 00 00       	push   $0x84f4
+    60d5:	ff 35 a4 a0 00 00    	push   0xa0a4
+    60db:	e8 75 07 00 00       	call   6855 <printf>
+
+  for(i = 0; i < 4; i++){
+    60e0:	83 c4 10             	add    $0x10,%esp
+    60e3:	be 00 00 00 00       	mov    $0x0,%esi
+    60e8:	83 fe 03             	cmp    $0x3,%esi
+    60eb:	0f 8f 9b 00 00 00    	jg     618c <fsynctest+0xd3>
+    pid = fork();
+    60f1:	e8 7a 05 00 00       	call   6670 <fork>
+    60f6:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    60f8:	85 c0                	test   %eax,%eax
+    60fa:	78 07                	js     6103 <fsynctest+0x4a>
+      printf(stdout, "fsync: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    60fc:	74 1d                	je     611b <fsynctest+0x62>
+  for(i = 0; i < 4; i++){
+    60fe:	83 c6 01             	add    $0x1,%esi
+    6101:	eb e5                	jmp    60e8 <fsynctest+0x2f>
+      printf(stdout, "fsync: fork failed\n");
+    6103:	83 ec 08             	sub    $0x8,%esp
+    6106:	68 00 85 00 00       	push   $0x8500
+    610b:	ff 35 a4 a0 00 00    	push   0xa0a4
+    6111:	e8 3f 07 00 00       	call   6855 <printf>
+      exit();
+    6116:	e8 5d 05 00 00       	call   6678 <exit>
+      file[5] = '0' + i;
+    611b:	8d 46 30             	lea    0x30(%esi),%eax
+    611e:	88 45 e5             	mov    %al,-0x1b(%ebp)
+      for(j = 0; j < 10; j++){
+    6121:	83 fb 09             	cmp    $0x9,%ebx
+    6124:	7f 61                	jg     6187 <fsynctest+0xce>
+        file[6] = '0' + j;
+    6126:	8d 43 30             	lea    0x30(%ebx),%eax
+    6129:	88 45 e6             	mov    %al,-0x1a(%ebp)
+        fd = open(file, O_CREATE|O_RDWR);
+    612c:	83 ec 08             	sub    $0x8,%esp
+    612f:	68 02 02 00 00       	push   $0x202
+    6134:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    6137:	50                   	push   %eax
+    6138:	e8 7b 05 00 00       	call   66b8 <open>
+    613d:	89 c6                	mov    %eax,%esi
+        if(fd < 0 || write(fd, "x", 1) != 1){
+    613f:	83 c4 10             	add    $0x10,%esp
+    6142:	85 c0                	test   %eax,%eax
+    6144:	78 29                	js     616f <fsynctest+0xb6>
+    6146:	83 ec 04             	sub    $0x4,%esp
+    6149:	6a 01                	push   $0x1
+    614b:	68 10 77 00 00       	push   $0x7710
+    6150:	50                   	push   %eax
+    6151:	e8 42 05 00 00       	call   6698 <write>
+    6156:	83 c4 10             	add    $0x10,%esp
+    6159:	83 f8 01             	cmp    $0x1,%eax
+    615c:	75 11                	jne    616f <fsynctest+0xb6>
+          printf(stdout, "fsync: create failed\n");
+          exit();
+        }
+        close(fd);
+    615e:	83 ec 0c             	sub    $0xc,%esp
+    6161:	56                   	push   %esi
+    6162:	e8 39 05 00 00       	call   66a0 <close>
+      for(j = 0; j < 10; j++){
+    6167:	83 c3 01             	add    $0x1,%ebx
+    616a:	83 c4 10             	add    $0x10,%esp
+    616d:	eb b2                	jmp    6121 <fsynctest+0x68>
+          printf(stdout, "fsync: create failed\n");
+    616f:	83 ec 08             	sub    $0x8,%esp
+    6172:	68 14 85 00 00       	push   $0x8514
+    6177:	ff 35 a4 a0 00 00    	push   0xa0a4
+    617d:	e8 d3 06 00 00       	call   6855 <printf>
+          exit();
+    6182:	e8 f1 04 00 00       	call   6678 <exit>
+      }
+      exit();
+    6187:	e8 ec 04 00 00       	call   6678 <exit>
+    }
+  }
+  for(i = 0; i < 4; i++)
+    618c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    6191:	eb 08                	jmp    619b <fsynctest+0xe2>
+    wait();
+    6193:	e8 e8 04 00 00       	call   6680 <wait>
+  for(i = 0; i < 4; i++)
+    6198:	83 c3 01             	add    $0x1,%ebx
+    619b:	83 fb 03             	cmp    $0x3,%ebx
+    619e:	7e f3                	jle    6193 <fsynctest+0xda>
+
+  fd = open("fsync00", O_RDONLY);
+    61a0:	83 ec 08             	sub    $0x8,%esp
+    61a3:	6a 00                	push   $0x0
+    61a5:	68 2a 85 00 00       	push   $0x852a
+    61aa:	e8 09 05 00 00       	call   66b8 <open>
+    61af:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || fsync(fd) != 0){
+    61b1:	83 c4 10             	add    $0x10,%esp
+    61b4:	85 c0                	test   %eax,%eax
+    61b6:	78 2f                	js     61e7 <fsynctest+0x12e>
+    61b8:	83 ec 0c             	sub    $0xc,%esp
+    61bb:	50                   	push   %eax
+    61bc:	e8 af 05 00 00       	call   6770 <fsync>
+    61c1:	89 c7                	mov    %eax,%edi
+    61c3:	83 c4 10             	add    $0x10,%esp
+    61c6:	85 c0                	test   %eax,%eax
+    61c8:	75 1d                	jne    61e7 <fsynctest+0x12e>
+    printf(stdout, "fsync: fsync failed\n");
+    exit();
+  }
+  close(fd);
+    61ca:	83 ec 0c             	sub    $0xc,%esp
+    61cd:	53                   	push   %ebx
+    61ce:	e8 cd 04 00 00       	call   66a0 <close>
+  if(fsync(fd) != -1){
+    61d3:	89 1c 24             	mov    %ebx,(%esp)
+    61d6:	e8 95 05 00 00       	call   6770 <fsync>
+    61db:	83 c4 10             	add    $0x10,%esp
+    61de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    61e1:	75 1c                	jne    61ff <fsynctest+0x146>
+    printf(stdout, "fsync: fsync of closed fd succeeded\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    61e3:	89 fe                	mov    %edi,%esi
+    61e5:	eb 4b                	jmp    6232 <fsynctest+0x179>
+    printf(stdout, "fsync: fsync failed\n");
+    61e7:	83 ec 08             	sub    $0x8,%esp
+    61ea:	68 32 85 00 00       	push   $0x8532
+    61ef:	ff 35 a4 a0 00 00    	push   0xa0a4
+    61f5:	e8 5b 06 00 00       	call   6855 <printf>
+    exit();
+    61fa:	e8 79 04 00 00       	call   6678 <exit>
+    printf(stdout, "fsync: fsync of closed fd succeeded\n");
+    61ff:	83 ec 08             	sub    $0x8,%esp
+    6202:	68 2c 94 00 00       	push   $0x942c
+    6207:	ff 35 a4 a0 00 00    	push   0xa0a4
+    620d:	e8 43 06 00 00       	call   6855 <printf>
+    exit();
+    6212:	e8 61 04 00 00       	call   6678 <exit>
+    file[5] = '0' + i;
+    for(j = 0; j < 10; j++){
+      file[6] = '0' + j;
+      if(unlink(file) != 0){
+        printf(stdout, "fsync: unlink failed\n");
+    6217:	83 ec 08             	sub    $0x8,%esp
+    621a:	68 47 85 00 00       	push   $0x8547
+    621f:	ff 35 a4 a0 00 00    	push   0xa0a4
+    6225:	e8 2b 06 00 00       	call   6855 <printf>
+        exit();
+    622a:	e8 49 04 00 00       	call   6678 <exit>
+  for(i = 0; i < 4; i++){
+    622f:	83 c6 01             	add    $0x1,%esi
+    6232:	83 fe 03             	cmp    $0x3,%esi
+    6235:	7f 2b                	jg     6262 <fsynctest+0x1a9>
+    file[5] = '0' + i;
+    6237:	8d 46 30             	lea    0x30(%esi),%eax
+    623a:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    for(j = 0; j < 10; j++){
+    623d:	89 fb                	mov    %edi,%ebx
+    623f:	83 fb 09             	cmp    $0x9,%ebx
+    6242:	7f eb                	jg     622f <fsynctest+0x176>
+      file[6] = '0' + j;
+    6244:	8d 43 30             	lea    0x30(%ebx),%eax
+    6247:	88 45 e6             	mov    %al,-0x1a(%ebp)
+      if(unlink(file) != 0){
+    624a:	83 ec 0c             	sub    $0xc,%esp
+    624d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    6250:	50                   	push   %eax
+    6251:	e8 72 04 00 00       	call   66c8 <unlink>
+    6256:	83 c4 10             	add    $0x10,%esp
+    6259:	85 c0                	test   %eax,%eax
+    625b:	75 ba                	jne    6217 <fsynctest+0x15e>
+    for(j = 0; j < 10; j++){
+    625d:	83 c3 01             	add    $0x1,%ebx
+    6260:	eb dd                	jmp    623f <fsynctest+0x186>
+      }
+    }
+  }
+  printf(stdout, "fsync test ok\n");
+    6262:	83 ec 08             	sub    $0x8,%esp
+    6265:	68 5d 85 00 00       	push   $0x855d
+    626a:	ff 35 a4 a0 00 00    	push   0xa0a4
+    6270:	e8 e0 05 00 00       	call   6855 <printf>
+}
+    6275:	83 c4 10             	add    $0x10,%esp
+    6278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    627b:	5b                   	pop    %ebx
+    627c:	5e                   	pop    %esi
+    627d:	5f                   	pop    %edi
+    627e:	5d                   	pop    %ebp
+    627f:	c3                   	ret
+
+00006280 <uio>:
+
+void
+uio()
+{
+    6280:	55                   	push   %ebp
+    6281:	89 e5                	mov    %esp,%ebp
+    6283:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    6286:	68 6c 85 00 00       	push   $0x856c
+    628b:	6a 01                	push   $0x1
+    628d:	e8 c3 05 00 00       	call   6855 <printf>
+  pid = fork();
+    6292:	e8 d9 03 00 00       	call   6670 <fork>
+  if(pid == 0){
+    6297:	83 c4 10             	add    $0x10,%esp
+    629a:	85 c0                	test   %eax,%eax
+    629c:	74 1b                	je     62b9 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    629e:	78 3e                	js     62de <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    62a0:	e8 db 03 00 00       	call   6680 <wait>
+  printf(1, "uio test done\n");
+    62a5:	83 ec 08             	sub    $0x8,%esp
+    62a8:	68 76 85 00 00       	push   $0x8576
+    62ad:	6a 01                	push   $0x1
+    62af:	e8 a1 05 00 00       	call   6855 <printf>
+}
+    62b4:	83 c4 10             	add    $0x10,%esp
+    62b7:	c9                   	leave
+    62b8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    62b9:	b8 09 00 00 00       	mov    $0x9,%eax
+    62be:	ba 70 00 00 00       	mov    $0x70,%edx
+    62c3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    62c4:	ba 71 00 00 00       	mov    $0x71,%edx
+    62c9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    62ca:	83 ec 08             	sub    $0x8,%esp
+    62cd:	68 54 94 00 00       	push   $0x9454
+    62d2:	6a 01                	push   $0x1
+    62d4:	e8 7c 05 00 00       	call   6855 <printf>
+    exit();
+    62d9:	e8 9a 03 00 00       	call   6678 <exit>
+    printf (1, "fork failed\n");
+    62de:	83 ec 08             	sub    $0x8,%esp
+    62e1:	68 07 85 00 00       	push   $0x8507
+    62e6:	6a 01                	push   $0x1
+    62e8:	e8 68 05 00 00       	call   6855 <printf>
+    exit();
+    62ed:	e8 86 03 00 00       	call   6678 <exit>
+
+000062f2 <argptest>:
+
+void argptest()
+{
+    62f2:	55                   	push   %ebp
+    62f3:	89 e5                	mov    %esp,%ebp
+    62f5:	53                   	push   %ebx
+    62f6:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    62f9:	6a 00                	push   $0x0
+    62fb:	68 85 85 00 00       	push   $0x8585
+    6300:	e8 b3 03 00 00       	call   66b8 <open>
+  if (fd < 0) {
+    6305:	83 c4 10             	add    $0x10,%esp
+    6308:	85 c0                	test   %eax,%eax
+    630a:	78 3a                	js     6346 <argptest+0x54>
+    630c:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    630e:	83 ec 0c             	sub    $0xc,%esp
+    6311:	6a 00                	push   $0x0
+    6313:	e8 e8 03 00 00       	call   6700 <sbrk>
+    6318:	83 e8 01             	sub    $0x1,%eax
+    631b:	83 c4 0c             	add    $0xc,%esp
+    631e:	6a ff                	push   $0xffffffff
+    6320:	50                   	push   %eax
+    6321:	53                   	push   %ebx
+    6322:	e8 69 03 00 00       	call   6690 <read>
+  close(fd);
+    6327:	89 1c 24             	mov    %ebx,(%esp)
+    632a:	e8 71 03 00 00       	call   66a0 <close>
+  printf(1, "arg test passed\n");
+    632f:	83 c4 08             	add    $0x8,%esp
+    6332:	68 8a 85 00 00       	push   $0x858a
+    6337:	6a 01                	push   $0x1
+    6339:	e8 17 05 00 00       	call   6855 <printf>
+}
+    633e:	83 c4 10             	add    $0x10,%esp
+    6341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6344:	c9                   	leave
+    6345:	c3                   	ret
+    printf(2, "open failed\n");
+    6346:	83 ec 08             	sub    $0x8,%esp
+    6349:	68 6c 84 00 00       	push   $0x846c
+    634e:	6a 02                	push   $0x2
+    6350:	e8 00 05 00 00       	call   6855 <printf>
+    exit();
+    6355:	e8 1e 03 00 00       	call   6678 <exit>
+
+0000635a <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    635a:	69 05 a0 a0 00 00 0d 	imul   $0x19660d,0xa0a0,%eax
+    6361:	66 19 00 
+    6364:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    6369:	a3 a0 a0 00 00       	mov    %eax,0xa0a0
+  return randstate;
+}
+    636e:	c3                   	ret
+
+0000636f <main>:
+
+int
+main(int argc, char *argv[])
+{
+    636f:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    6373:	83 e4 f0             	and    $0xfffffff0,%esp
+    6376:	ff 71 fc             	push   -0x4(%ecx)
+    6379:	55                   	push   %ebp
+    637a:	89 e5                	mov    %esp,%ebp
+    637c:	51                   	push   %ecx
+    637d:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    6380:	68 9b 85 00 00       	push   $0x859b
+    6385:	6a 01                	push   $0x1
+    6387:	e8 c9 04 00 00       	call   6855 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    638c:	83 c4 08             	add    $0x8,%esp
+    638f:	6a 00                	push   $0x0
+    6391:	68 af 85 00 00       	push   $0x85af
+    6396:	e8 1d 03 00 00       	call   66b8 <open>
+    639b:	83 c4 10             	add    $0x10,%esp
+    639e:	85 c0                	test   %eax,%eax
+    63a0:	78 14                	js     63b6 <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    63a2:	83 ec 08             	sub    $0x8,%esp
+    63a5:	68 78 94 00 00       	push   $0x9478
+    63aa:	6a 01                	push   $0x1
+    63ac:	e8 a4 04 00 00       	call   6855 <printf>
+    exit();
+    63b1:	e8 c2 02 00 00       	call   6678 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    63b6:	83 ec 08             	sub    $0x8,%esp
+    63b9:	68 00 02 00 00       	push   $0x200
+    63be:	68 af 85 00 00       	push   $0x85af
+    63c3:	e8 f0 02 00 00       	call   66b8 <open>
+    63c8:	89 04 24             	mov    %eax,(%esp)
+    63cb:	e8 d0 02 00 00       	call   66a0 <close>
+
+  argptest();
+    63d0:	e8 1d ff ff ff       	call   62f2 <argptest>
+  createdelete();
+    63d5:	e8 b8 b1 ff ff       	call   1592 <createdelete>
+  linkunlink();
+    63da:	e8 51 ba ff ff       	call   1e30 <linkunlink>
+  concreate();
+    63df:	e8 62 b7 ff ff       	call   1b46 <concreate>
+  fourfiles();
+    63e4:	e8 c3 af ff ff       	call   13ac <fourfiles>
+  sharedfd();
+    63e9:	e8 21 ae ff ff       	call   120f <sharedfd>
+
+  bigargtest();
+    63ee:	e8 c0 d7 ff ff       	call   3bb3 <bigargtest>
+  bigwrite();
+    63f3:	e8 55 c9 ff ff       	call   2d4d <bigwrite>
+  bigargtest();
+    63f8:	e8 b6 d7 ff ff       	call   3bb3 <bigargtest>
+  bsstest();
+    63fd:	e8 4e d7 ff ff       	call   3b50 <bsstest>
+  sbrktest();
+    6402:	e8 81 d2 ff ff       	call   3688 <sbrktest>
+  validatetest();
+    6407:	e8 96 d6 ff ff       	call   3aa2 <validatetest>
+
+  opentest();
+    640c:	e8 9b 9e ff ff       	call   2ac <opentest>
+  writetest();
+    6411:	e8 29 9f ff ff       	call   33f <writetest>
+  writetest1();
+    6416:	e8 ec a0 ff ff       	call   507 <writetest1>
+  fragtest();
+    641b:	e8 97 a2 ff ff       	call   6b7 <fragtest>
+  rsvtest();
+    6420:	e8 0c a6 ff ff       	call   a31 <rsvtest>
+  createtest();
+    6425:	e8 0d a8 ff ff       	call   c37 <createtest>
+
+  openiputtest();
+    642a:	e8 94 9d ff ff       	call   1c3 <openiputtest>
+  exitiputtest();
+    642f:	e8 a9 9c ff ff       	call   dd <exitiputtest>
+  iputtest();
+    6434:	e8 c7 9b ff ff       	call   0 <iputtest>
+
+  mem();
+    6439:	e8 16 ad ff ff       	call   1154 <mem>
+  pipe1();
+    643e:	e8 c6 a9 ff ff       	call   e09 <pipe1>
+  preempt();
+    6443:	e8 61 ab ff ff       	call   fa9 <preempt>
+  exitwait();
+    6448:	e8 97 ac ff ff       	call   10e4 <exitwait>
+
+  rmdot();
+    644d:	e8 c0 cc ff ff       	call   3112 <rmdot>
+  fourteen();
+    6452:	e8 7e cb ff ff       	call   2fd5 <fourteen>
+  bigfile();
+    6457:	e8 c3 c9 ff ff       	call   2e1f <bigfile>
+  subdir();
+    645c:	e8 be c1 ff ff       	call   261f <subdir>
+  linktest();
+    6461:	e8 ba b4 ff ff       	call   1920 <linktest>
+  unlinkread();
+    6466:	e8 1c b3 ff ff       	call   1787 <unlinkread>
+  dirfile();
+    646b:	e8 27 ce ff ff       	call   3297 <dirfile>
+  iref();
+    6470:	e8 3c d0 ff ff       	call   34b1 <iref>
+  forktest();
+    6475:	e8 5f d1 ff ff       	call   35d9 <forktest>
+  bigdir(); // slow
+    647a:	e8 a5 ba ff ff       	call   1f24 <bigdir>
+  dirfull(); // slow
+    647f:	e8 51 bf ff ff       	call   23d5 <dirfull>
+  hashdir();
+    6484:	e8 ef bb ff ff       	call   2078 <hashdir>
+  dcachetest();
+    6489:	e8 89 f9 ff ff       	call   5e17 <dcachetest>
+  icachetest();
+    648e:	e8 2c e9 ff ff       	call   4dbf <icachetest>
+  fdtabletest();
+    6493:	e8 52 eb ff ff       	call   4fea <fdtabletest>
+
+  mmaptest();
+    6498:	e8 02 da ff ff       	call   3e9f <mmaptest>
+  shmtest();
+    649d:	e8 58 df ff ff       	call   43fa <shmtest>
+  hugetest();
+    64a2:	e8 5e e1 ff ff       	call   4605 <hugetest>
+  swaptest();
+    64a7:	e8 17 e3 ff ff       	call   47c3 <swaptest>
+  bcachetest();
+    64ac:	e8 e0 e5 ff ff       	call   4a91 <bcachetest>
+  disktest();
+    64b1:	e8 58 e7 ff ff       	call   4c0e <disktest>
+  fsynctest();
+    64b6:	e8 fe fb ff ff       	call   60b9 <fsynctest>
+  preadvtest();
+    64bb:	e8 48 ed ff ff       	call   5208 <preadvtest>
+  splicetest();
+    64c0:	e8 2a f2 ff ff       	call   56ef <splicetest>
+  writebacktest();
+    64c5:	e8 00 f6 ff ff       	call   5aca <writebacktest>
+  uio();
+    64ca:	e8 b1 fd ff ff       	call   6280 <uio>
+
+  exectest();
+    64cf:	e8 ec a8 ff ff       	call   dc0 <exectest>
+
+  exit();
+    64d4:	e8 9f 01 00 00       	call   6678 <exit>
+
+000064d9 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    64d9:	55                   	push   %ebp
+    64da:	89 e5                	mov    %esp,%ebp
+    64dc:	56                   	push   %esi
+    64dd:	53                   	push   %ebx
+    64de:	8b 75 08             	mov    0x8(%ebp),%esi
+    64e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    64e4:	89 f0                	mov    %esi,%eax
+    64e6:	89 d1                	mov    %edx,%ecx
+    64e8:	83 c2 01             	add    $0x1,%edx
+    64eb:	89 c3                	mov    %eax,%ebx
+    64ed:	83 c0 01             	add    $0x1,%eax
+    64f0:	0f b6 09             	movzbl (%ecx),%ecx
+    64f3:	88 0b                	mov    %cl,(%ebx)
+    64f5:	84 c9                	test   %cl,%cl
+    64f7:	75 ed                	jne    64e6 <strcpy+0xd>
+    ;
+  return os;
+}
+    64f9:	89 f0                	mov    %esi,%eax
+    64fb:	5b                   	pop    %ebx
+    64fc:	5e                   	pop    %esi
+    64fd:	5d                   	pop    %ebp
+    64fe:	c3                   	ret
+
+000064ff <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    64ff:	55                   	push   %ebp
+    6500:	89 e5                	mov    %esp,%ebp
+    6502:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    6505:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    6508:	eb 06                	jmp    6510 <strcmp+0x11>
+    p++, q++;
+    650a:	83 c1 01             	add    $0x1,%ecx
+    650d:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    6510:	0f b6 01             	movzbl (%ecx),%eax
+    6513:	84 c0                	test   %al,%al
+    6515:	74 04                	je     651b <strcmp+0x1c>
+    6517:	3a 02                	cmp    (%edx),%al
+    6519:	74 ef                	je     650a <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+    651b:	0f b6 c0             	movzbl %al,%eax
+    651e:	0f b6 12             	movzbl (%edx),%edx
+    6521:	29 d0                	sub    %edx,%eax
+}
+    6523:	5d                   	pop    %ebp
+    6524:	c3                   	ret
+
+00006525 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    6525:	55                   	push   %ebp
+    6526:	89 e5                	mov    %esp,%ebp
+    6528:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    652b:	b8 00 00 00 00       	mov    $0x0,%eax
+    6530:	eb 03                	jmp    6535 <strlen+0x10>
+    6532:	83 c0 01             	add    $0x1,%eax
+    6535:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    6539:	75 f7                	jne    6532 <strlen+0xd>
+    ;
+  return n;
+}
+    653b:	5d                   	pop    %ebp
+    653c:	c3                   	ret
+
+0000653d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    653d:	55                   	push   %ebp
+    653e:	89 e5                	mov    %esp,%ebp
+    6540:	57                   	push   %edi
+    6541:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    6544:	89 d7                	mov    %edx,%edi
+    6546:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    6549:	8b 45 0c             	mov    0xc(%ebp),%eax
+    654c:	fc                   	cld
+    654d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    654f:	89 d0                	mov    %edx,%eax
+    6551:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    6554:	c9                   	leave
+    6555:	c3                   	ret
+
+00006556 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    6556:	55                   	push   %ebp
+    6557:	89 e5                	mov    %esp,%ebp
+    6559:	8b 45 08             	mov    0x8(%ebp),%eax
+    655c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    6560:	eb 03                	jmp    6565 <strchr+0xf>
+    6562:	83 c0 01             	add    $0x1,%eax
+    6565:	0f b6 10             	movzbl (%eax),%edx
+    6568:	84 d2                	test   %dl,%dl
+    656a:	74 06                	je     6572 <strchr+0x1c>
+    if(*s == c)
+    656c:	38 ca                	cmp    %cl,%dl
+    656e:	75 f2                	jne    6562 <strchr+0xc>
+    6570:	eb 05                	jmp    6577 <strchr+0x21>
+      return (char*)s;
+  return 0;
+    6572:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    6577:	5d                   	pop    %ebp
+    6578:	c3                   	ret
+
+00006579 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    6579:	55                   	push   %ebp
+    657a:	89 e5                	mov    %esp,%ebp
+    657c:	57                   	push   %edi
+    657d:	56                   	push   %esi
+    657e:	53                   	push   %ebx
+    657f:	83 ec 1c             	sub    $0x1c,%esp
+    6582:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    6585:	bb 00 00 00 00       	mov    $0x0,%ebx
+    658a:	89 de                	mov    %ebx,%esi
+    658c:	83 c3 01             	add    $0x1,%ebx
+    658f:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    6592:	7d 2e                	jge    65c2 <gets+0x49>
+    cc = read(0, &c, 1);
+    6594:	83 ec 04             	sub    $0x4,%esp
+    6597:	6a 01                	push   $0x1
+    6599:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    659c:	50                   	push   %eax
+    659d:	6a 00                	push   $0x0
+    659f:	e8 ec 00 00 00       	call   6690 <read>
+    if(cc < 1)
+    65a4:	83 c4 10             	add    $0x10,%esp
+    65a7:	85 c0                	test   %eax,%eax
+    65a9:	7e 17                	jle    65c2 <gets+0x49>
+      break;
+    buf[i++] = c;
+    65ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    65af:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    65b2:	3c 0a                	cmp    $0xa,%al
+    65b4:	0f 94 c2             	sete   %dl
+    65b7:	3c 0d                	cmp    $0xd,%al
+    65b9:	0f 94 c0             	sete   %al
+    65bc:	08 c2                	or     %al,%dl
+    65be:	74 ca                	je     658a <gets+0x11>
+    buf[i++] = c;
+    65c0:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+    65c2:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+    65c6:	89 f8                	mov    %edi,%eax
+    65c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    65cb:	5b                   	pop    %ebx
+    65cc:	5e                   	pop    %esi
+    65cd:	5f                   	pop    %edi
+    65ce:	5d                   	pop    %ebp
+    65cf:	c3                   	ret
+
+000065d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    65d0:	55                   	push   %ebp
+    65d1:	89 e5                	mov    %esp,%ebp
+    65d3:	56                   	push   %esi
+    65d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    65d5:	83 ec 08             	sub    $0x8,%esp
+    65d8:	6a 00                	push   $0x0
+    65da:	ff 75 08             	push   0x8(%ebp)
+    65dd:	e8 d6 00 00 00       	call   66b8 <open>
+  if(fd < 0)
+    65e2:	83 c4 10             	add    $0x10,%esp
+    65e5:	85 c0                	test   %eax,%eax
+    65e7:	78 24                	js     660d <stat+0x3d>
+    65e9:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    65eb:	83 ec 08             	sub    $0x8,%esp
+    65ee:	ff 75 0c             	push   0xc(%ebp)
+    65f1:	50                   	push   %eax
+    65f2:	e8 d9 00 00 00       	call   66d0 <fstat>
+    65f7:	89 c6                	mov    %eax,%esi
+  close(fd);
+    65f9:	89 1c 24             	mov    %ebx,(%esp)
+    65fc:	e8 9f 00 00 00       	call   66a0 <close>
+  return r;
+    6601:	83 c4 10             	add    $0x10,%esp
+}
+    6604:	89 f0                	mov    %esi,%eax
+    6606:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6609:	5b                   	pop    %ebx
+    660a:	5e                   	pop    %esi
+    660b:	5d                   	pop    %ebp
+    660c:	c3                   	ret
+    return -1;
+    660d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    6612:	eb f0                	jmp    6604 <stat+0x34>
+
+00006614 <atoi>:
+
+int
+atoi(const char *s)
+{
+    6614:	55                   	push   %ebp
+    6615:	89 e5                	mov    %esp,%ebp
+    6617:	53                   	push   %ebx
+    6618:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+    661b:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+    6620:	eb 10                	jmp    6632 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+    6622:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+    6625:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+    6628:	83 c1 01             	add    $0x1,%ecx
+    662b:	0f be c0             	movsbl %al,%eax
+    662e:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+    6632:	0f b6 01             	movzbl (%ecx),%eax
+    6635:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    6638:	80 fb 09             	cmp    $0x9,%bl
+    663b:	76 e5                	jbe    6622 <atoi+0xe>
+  return n;
+}
+    663d:	89 d0                	mov    %edx,%eax
+    663f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6642:	c9                   	leave
+    6643:	c3                   	ret
+
+00006644 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    6644:	55                   	push   %ebp
+    6645:	89 e5                	mov    %esp,%ebp
+    6647:	56                   	push   %esi
+    6648:	53                   	push   %ebx
+    6649:	8b 75 08             	mov    0x8(%ebp),%esi
+    664c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    664f:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+    6652:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+    6654:	eb 0d                	jmp    6663 <memmove+0x1f>
+    *dst++ = *src++;
+    6656:	0f b6 01             	movzbl (%ecx),%eax
+    6659:	88 02                	mov    %al,(%edx)
+    665b:	8d 49 01             	lea    0x1(%ecx),%ecx
+    665e:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+    6661:	89 d8                	mov    %ebx,%eax
+    6663:	8d 58 ff             	lea    -0x1(%eax),%ebx
+    6666:	85 c0                	test   %eax,%eax
+    6668:	7f ec                	jg     6656 <memmove+0x12>
+  return vdst;
+}
+    666a:	89 f0                	mov    %esi,%eax
+    666c:	5b                   	pop    %ebx
+    666d:	5e                   	pop    %esi
+    666e:	5d                   	pop    %ebp
+    666f:	c3                   	ret
+
+00006670 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    6670:	b8 01 00 00 00       	mov    $0x1,%eax
+    6675:	cd 40                	int    $0x40
+    6677:	c3                   	ret
+
+00006678 <exit>:
+SYSCALL(exit)
+    6678:	b8 02 00 00 00       	mov    $0x2,%eax
+    667d:	cd 40                	int    $0x40
+    667f:	c3                   	ret
+
+00006680 <wait>:
+SYSCALL(wait)
+    6680:	b8 03 00 00 00       	mov    $0x3,%eax
+    6685:	cd 40                	int    $0x40
+    6687:	c3                   	ret
+
+00006688 <pipe>:
+SYSCALL(pipe)
+    6688:	b8 04 00 00 00       	mov    $0x4,%eax
+    668d:	cd 40                	int    $0x40
+    668f:	c3                   	ret
+
+00006690 <read>:
+SYSCALL(read)
+    6690:	b8 05 00 00 00       	mov    $0x5,%eax
+    6695:	cd 40                	int    $0x40
+    6697:	c3                   	ret
+
+00006698 <write>:
+SYSCALL(write)
+    6698:	b8 10 00 00 00       	mov    $0x10,%eax
+    669d:	cd 40                	int    $0x40
+    669f:	c3                   	ret
+
+000066a0 <close>:
+SYSCALL(close)
+    66a0:	b8 15 00 00 00       	mov    $0x15,%eax
+    66a5:	cd 40                	int    $0x40
+    66a7:	c3                   	ret
+
+000066a8 <kill>:
+SYSCALL(kill)
+    66a8:	b8 06 00 00 00       	mov    $0x6,%eax
+    66ad:	cd 40                	int    $0x40
+    66af:	c3                   	ret
+
+000066b0 <exec>:
+SYSCALL(exec)
+    66b0:	b8 07 00 00 00       	mov    $0x7,%eax
+    66b5:	cd 40                	int    $0x40
+    66b7:	c3                   	ret
+
+000066b8 <open>:
+SYSCALL(open)
+    66b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    66bd:	cd 40                	int    $0x40
+    66bf:	c3                   	ret
+
+000066c0 <mknod>:
+SYSCALL(mknod)
+    66c0:	b8 11 00 00 00       	mov    $0x11,%eax
+    66c5:	cd 40                	int    $0x40
+    66c7:	c3                   	ret
+
+000066c8 <unlink>:
+SYSCALL(unlink)
+    66c8:	b8 12 00 00 00       	mov    $0x12,%eax
+    66cd:	cd 40                	int    $0x40
+    66cf:	c3                   	ret
+
+000066d0 <fstat>:
+SYSCALL(fstat)
+    66d0:	b8 08 00 00 00       	mov    $0x8,%eax
+    66d5:	cd 40                	int    $0x40
+    66d7:	c3                   	ret
+
+000066d8 <link>:
+SYSCALL(link)
+    66d8:	b8 13 00 00 00       	mov    $0x13,%eax
+    66dd:	cd 40                	int    $0x40
+    66df:	c3                   	ret
+
+000066e0 <mkdir>:
+SYSCALL(mkdir)
+    66e0:	b8 14 00 00 00       	mov    $0x14,%eax
+    66e5:	cd 40                	int    $0x40
+    66e7:	c3                   	ret
+
+000066e8 <chdir>:
+SYSCALL(chdir)
+    66e8:	b8 09 00 00 00       	mov    $0x9,%eax
+    66ed:	cd 40                	int    $0x40
+    66ef:	c3                   	ret
+
+000066f0 <dup>:
+SYSCALL(dup)
+    66f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+    66f5:	cd 40                	int    $0x40
+    66f7:	c3                   	ret
+
+000066f8 <getpid>:
+SYSCALL(getpid)
+    66f8:	b8 0b 00 00 00       	mov    $0xb,%eax
+    66fd:	cd 40                	int    $0x40
+    66ff:	c3                   	ret
+
+00006700 <sbrk>:
+SYSCALL(sbrk)
+    6700:	b8 0c 00 00 00       	mov    $0xc,%eax
+    6705:	cd 40                	int    $0x40
+    6707:	c3                   	ret
+
+00006708 <sleep>:
+SYSCALL(sleep)
+    6708:	b8 0d 00 00 00       	mov    $0xd,%eax
+    670d:	cd 40                	int    $0x40
+    670f:	c3                   	ret
+
+00006710 <uptime>:
+SYSCALL(uptime)
+    6710:	b8 0e 00 00 00       	mov    $0xe,%eax
+    6715:	cd 40                	int    $0x40
+    6717:	c3                   	ret
+
+00006718 <setpri>:
+SYSCALL(setpri)
+    6718:	b8 16 00 00 00       	mov    $0x16,%eax
+    671d:	cd 40                	int    $0x40
+    671f:	c3                   	ret
+
+00006720 <getpri>:
+SYSCALL(getpri)
+    6720:	b8 17 00 00 00       	mov    $0x17,%eax
+    6725:	cd 40                	int    $0x40
+    6727:	c3                   	ret
+
+00006728 <fork2>:
+SYSCALL(fork2)
+    6728:	b8 18 00 00 00       	mov    $0x18,%eax
+    672d:	cd 40                	int    $0x40
+    672f:	c3                   	ret
+
+00006730 <getpinfo>:
+SYSCALL(getpinfo)
+    6730:	b8 19 00 00 00       	mov    $0x19,%eax
+    6735:	cd 40                	int    $0x40
+    6737:	c3                   	ret
+
+00006738 <mmap>:
+SYSCALL(mmap)
+    6738:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    673d:	cd 40                	int    $0x40
+    673f:	c3                   	ret
+
+00006740 <munmap>:
+SYSCALL(munmap)
+    6740:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    6745:	cd 40                	int    $0x40
+    6747:	c3                   	ret
+
+00006748 <shmat>:
+SYSCALL(shmat)
+    6748:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    674d:	cd 40                	int    $0x40
+    674f:	c3                   	ret
+
+00006750 <shmdt>:
+SYSCALL(shmdt)
+    6750:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    6755:	cd 40                	int    $0x40
+    6757:	c3                   	ret
+
+00006758 <getvmstat>:
+SYSCALL(getvmstat)
+    6758:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    675d:	cd 40                	int    $0x40
+    675f:	c3                   	ret
+
+00006760 <getbstat>:
+SYSCALL(getbstat)
+    6760:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    6765:	cd 40                	int    $0x40
+    6767:	c3                   	ret
+
+00006768 <getdiskstat>:
+SYSCALL(getdiskstat)
+    6768:	b8 20 00 00 00       	mov    $0x20,%eax
+    676d:	cd 40                	int    $0x40
+    676f:	c3                   	ret
+
+00006770 <fsync>:
+SYSCALL(fsync)
+    6770:	b8 21 00 00 00       	mov    $0x21,%eax
+    6775:	cd 40                	int    $0x40
+    6777:	c3                   	ret
+
+00006778 <getdcstat>:
+SYSCALL(getdcstat)
+    6778:	b8 22 00 00 00       	mov    $0x22,%eax
+    677d:	cd 40                	int    $0x40
+    677f:	c3                   	ret
+
+00006780 <pread>:
+SYSCALL(pread)
+    6780:	b8 23 00 00 00       	mov    $0x23,%eax
+    6785:	cd 40                	int    $0x40
+    6787:	c3                   	ret
+
+00006788 <pwrite>:
+SYSCALL(pwrite)
+    6788:	b8 24 00 00 00       	mov    $0x24,%eax
+    678d:	cd 40                	int    $0x40
+    678f:	c3                   	ret
+
+00006790 <readv>:
+SYSCALL(readv)
+    6790:	b8 25 00 00 00       	mov    $0x25,%eax
+    6795:	cd 40                	int    $0x40
+    6797:	c3                   	ret
+
+00006798 <writev>:
+SYSCALL(writev)
+    6798:	b8 26 00 00 00       	mov    $0x26,%eax
+    679d:	cd 40                	int    $0x40
+    679f:	c3                   	ret
+
+000067a0 <sendfile>:
+SYSCALL(sendfile)
+    67a0:	b8 27 00 00 00       	mov    $0x27,%eax
+    67a5:	cd 40                	int    $0x40
+    67a7:	c3                   	ret
+
+000067a8 <splice>:
+SYSCALL(splice)
+    67a8:	b8 28 00 00 00       	mov    $0x28,%eax
+    67ad:	cd 40                	int    $0x40
+    67af:	c3                   	ret
+
+000067b0 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    67b0:	55                   	push   %ebp
+    67b1:	89 e5                	mov    %esp,%ebp
+    67b3:	83 ec 1c             	sub    $0x1c,%esp
+    67b6:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+    67b9:	6a 01                	push   $0x1
+    67bb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+    67be:	52                   	push   %edx
+    67bf:	50                   	push   %eax
+    67c0:	e8 d3 fe ff ff       	call   6698 <write>
+}
+    67c5:	83 c4 10             	add    $0x10,%esp
+    67c8:	c9                   	leave
+    67c9:	c3                   	ret
+
+000067ca <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    67ca:	55                   	push   %ebp
+    67cb:	89 e5                	mov    %esp,%ebp
+    67cd:	57                   	push   %edi
+    67ce:	56                   	push   %esi
+    67cf:	53                   	push   %ebx
+    67d0:	83 ec 2c             	sub    $0x2c,%esp
+    67d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    67d6:	89 d0                	mov    %edx,%eax
+    67d8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    67da:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    67de:	0f 95 c1             	setne  %cl
+    67e1:	c1 ea 1f             	shr    $0x1f,%edx
+    67e4:	84 d1                	test   %dl,%cl
+    67e6:	74 44                	je     682c <printint+0x62>
+    neg = 1;
+    x = -xx;
+    67e8:	f7 d8                	neg    %eax
+    67ea:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    67ec:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    67f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    67f8:	89 c8                	mov    %ecx,%eax
+    67fa:	ba 00 00 00 00       	mov    $0x0,%edx
+    67ff:	f7 f6                	div    %esi
+    6801:	89 df                	mov    %ebx,%edi
+    6803:	83 c3 01             	add    $0x1,%ebx
+    6806:	0f b6 92 04 95 00 00 	movzbl 0x9504(%edx),%edx
+    680d:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    6811:	89 ca                	mov    %ecx,%edx
+    6813:	89 c1                	mov    %eax,%ecx
+    6815:	39 f2                	cmp    %esi,%edx
+    6817:	73 df                	jae    67f8 <printint+0x2e>
+  if(neg)
+    6819:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    681d:	74 31                	je     6850 <printint+0x86>
+    buf[i++] = '-';
+    681f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    6824:	8d 5f 02             	lea    0x2(%edi),%ebx
+    6827:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    682a:	eb 17                	jmp    6843 <printint+0x79>
+    x = xx;
+    682c:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    682e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    6835:	eb bc                	jmp    67f3 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    6837:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    683c:	89 f0                	mov    %esi,%eax
+    683e:	e8 6d ff ff ff       	call   67b0 <putc>
+  while(--i >= 0)
+    6843:	83 eb 01             	sub    $0x1,%ebx
+    6846:	79 ef                	jns    6837 <printint+0x6d>
+}
+    6848:	83 c4 2c             	add    $0x2c,%esp
+    684b:	5b                   	pop    %ebx
+    684c:	5e                   	pop    %esi
+    684d:	5f                   	pop    %edi
+    684e:	5d                   	pop    %ebp
+    684f:	c3                   	ret
+    6850:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    6853:	eb ee                	jmp    6843 <printint+0x79>
+
+00006855 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    6855:	55                   	push   %ebp
+    6856:	89 e5                	mov    %esp,%ebp
+    6858:	57                   	push   %edi
+    6859:	56                   	push   %esi
+    685a:	53                   	push   %ebx
+    685b:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    685e:	8d 45 10             	lea    0x10(%ebp),%eax
+    6861:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+    6864:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    6869:	bb 00 00 00 00       	mov    $0x0,%ebx
+    686e:	eb 14                	jmp    6884 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    6870:	89 fa                	mov    %edi,%edx
+    6872:	8b 45 08             	mov    0x8(%ebp),%eax
+    6875:	e8 36 ff ff ff       	call   67b0 <putc>
+    687a:	eb 05                	jmp    6881 <printf+0x2c>
+      }
+    } else if(state == '%'){
+    687c:	83 fe 25             	cmp    $0x25,%esi
+    687f:	74 25                	je     68a6 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+    6881:	83 c3 01             	add    $0x1,%ebx
+    6884:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6887:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    688b:	84 c0                	test   %al,%al
+    688d:	0f 84 20 01 00 00    	je     69b3 <printf+0x15e>
+    c = fmt[i] & 0xff;
+    6893:	0f be f8             	movsbl %al,%edi
+    6896:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    6899:	85 f6                	test   %esi,%esi
+    689b:	75 df                	jne    687c <printf+0x27>
+      if(c == '%'){
+    689d:	83 f8 25             	cmp    $0x25,%eax
+    68a0:	75 ce                	jne    6870 <printf+0x1b>
+        state = '%';
+    68a2:	89 c6                	mov    %eax,%esi
+    68a4:	eb db                	jmp    6881 <printf+0x2c>
+      if(c == 'd'){
+    68a6:	83 f8 25             	cmp    $0x25,%eax
+    68a9:	0f 84 cf 00 00 00    	je     697e <printf+0x129>
+    68af:	0f 8c dd 00 00 00    	jl     6992 <printf+0x13d>
+    68b5:	83 f8 78             	cmp    $0x78,%eax
+    68b8:	0f 8f d4 00 00 00    	jg     6992 <printf+0x13d>
+    68be:	83 f8 63             	cmp    $0x63,%eax
+    68c1:	0f 8c cb 00 00 00    	jl     6992 <printf+0x13d>
+    68c7:	83 e8 63             	sub    $0x63,%eax
+    68ca:	83 f8 15             	cmp    $0x15,%eax
+    68cd:	0f 87 bf 00 00 00    	ja     6992 <printf+0x13d>
+    68d3:	ff 24 85 ac 94 00 00 	jmp    *0x94ac(,%eax,4)
+        printint(fd, *ap, 10, 1);
+    68da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    68dd:	8b 17                	mov    (%edi),%edx
+    68df:	83 ec 0c             	sub    $0xc,%esp
+    68e2:	6a 01                	push   $0x1
+    68e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    68e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    68ec:	e8 d9 fe ff ff       	call   67ca <printint>
+        ap++;
+    68f1:	83 c7 04             	add    $0x4,%edi
+    68f4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    68f7:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    68fa:	be 00 00 00 00       	mov    $0x0,%esi
+    68ff:	eb 80                	jmp    6881 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+    6901:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    6904:	8b 17                	mov    (%edi),%edx
+    6906:	83 ec 0c             	sub    $0xc,%esp
+    6909:	6a 00                	push   $0x0
+    690b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    6910:	8b 45 08             	mov    0x8(%ebp),%eax
+    6913:	e8 b2 fe ff ff       	call   67ca <printint>
+        ap++;
+    6918:	83 c7 04             	add    $0x4,%edi
+    691b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    691e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    6921:	be 00 00 00 00       	mov    $0x0,%esi
+    6926:	e9 56 ff ff ff       	jmp    6881 <printf+0x2c>
+        s = (char*)*ap;
+    692b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    692e:	8b 30                	mov    (%eax),%esi
+        ap++;
+    6930:	83 c0 04             	add    $0x4,%eax
+    6933:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    6936:	85 f6                	test   %esi,%esi
+    6938:	75 15                	jne    694f <printf+0xfa>
+          s = "(null)";
+    693a:	be a2 94 00 00       	mov    $0x94a2,%esi
+    693f:	eb 0e                	jmp    694f <printf+0xfa>
+          putc(fd, *s);
+    6941:	0f be d2             	movsbl %dl,%edx
+    6944:	8b 45 08             	mov    0x8(%ebp),%eax
+    6947:	e8 64 fe ff ff       	call   67b0 <putc>
+          s++;
+    694c:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    694f:	0f b6 16             	movzbl (%esi),%edx
+    6952:	84 d2                	test   %dl,%dl
+    6954:	75 eb                	jne    6941 <printf+0xec>
+      state = 0;
+    6956:	be 00 00 00 00       	mov    $0x0,%esi
+    695b:	e9 21 ff ff ff       	jmp    6881 <printf+0x2c>
+        putc(fd, *ap);
+    6960:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    6963:	0f be 17             	movsbl (%edi),%edx
+    6966:	8b 45 08             	mov    0x8(%ebp),%eax
+    6969:	e8 42 fe ff ff       	call   67b0 <putc>
+        ap++;
+    696e:	83 c7 04             	add    $0x4,%edi
+    6971:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+    6974:	be 00 00 00 00       	mov    $0x0,%esi
+    6979:	e9 03 ff ff ff       	jmp    6881 <printf+0x2c>
+        putc(fd, c);
+    697e:	89 fa                	mov    %edi,%edx
+    6980:	8b 45 08             	mov    0x8(%ebp),%eax
+    6983:	e8 28 fe ff ff       	call   67b0 <putc>
+      state = 0;
+    6988:	be 00 00 00 00       	mov    $0x0,%esi
+    698d:	e9 ef fe ff ff       	jmp    6881 <printf+0x2c>
+        putc(fd, '%');
+    6992:	ba 25 00 00 00       	mov    $0x25,%edx
+    6997:	8b 45 08             	mov    0x8(%ebp),%eax
+    699a:	e8 11 fe ff ff       	call   67b0 <putc>
+        putc(fd, c);
+    699f:	89 fa                	mov    %edi,%edx
+    69a1:	8b 45 08             	mov    0x8(%ebp),%eax
+    69a4:	e8 07 fe ff ff       	call   67b0 <putc>
+      state = 0;
+    69a9:	be 00 00 00 00       	mov    $0x0,%esi
+    69ae:	e9 ce fe ff ff       	jmp    6881 <printf+0x2c>
+    }
+  }
+}
+    69b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    69b6:	5b                   	pop    %ebx
+    69b7:	5e                   	pop    %esi
+    69b8:	5f                   	pop    %edi
+    69b9:	5d                   	pop    %ebp
+    69ba:	c3                   	ret
+
+000069bb <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    69bb:	55                   	push   %ebp
+    69bc:	89 e5                	mov    %esp,%ebp
+    69be:	57                   	push   %edi
+    69bf:	56                   	push   %esi
+    69c0:	53                   	push   %ebx
+    69c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    69c4:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    69c7:	a1 a0 0f 01 00       	mov    0x10fa0,%eax
+    69cc:	eb 02                	jmp    69d0 <free+0x15>
+    69ce:	89 d0                	mov    %edx,%eax
+    69d0:	39 c8                	cmp    %ecx,%eax
+    69d2:	73 04                	jae    69d8 <free+0x1d>
+    69d4:	3b 08                	cmp    (%eax),%ecx
+    69d6:	72 12                	jb     69ea <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    69d8:	8b 10                	mov    (%eax),%edx
+    69da:	39 d0                	cmp    %edx,%eax
+    69dc:	72 f0                	jb     69ce <free+0x13>
+    69de:	39 c8                	cmp    %ecx,%eax
+    69e0:	72 08                	jb     69ea <free+0x2f>
+    69e2:	39 d1                	cmp    %edx,%ecx
+    69e4:	72 04                	jb     69ea <free+0x2f>
+    69e6:	89 d0                	mov    %edx,%eax
+    69e8:	eb e6                	jmp    69d0 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    69ea:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    69ed:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    69f0:	8b 10                	mov    (%eax),%edx
+    69f2:	39 d7                	cmp    %edx,%edi
+    69f4:	74 19                	je     6a0f <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    69f6:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    69f9:	8b 50 04             	mov    0x4(%eax),%edx
+    69fc:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    69ff:	39 ce                	cmp    %ecx,%esi
+    6a01:	74 1b                	je     6a1e <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    6a03:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    6a05:	a3 a0 0f 01 00       	mov    %eax,0x10fa0
+}
+    6a0a:	5b                   	pop    %ebx
+    6a0b:	5e                   	pop    %esi
+    6a0c:	5f                   	pop    %edi
+    6a0d:	5d                   	pop    %ebp
+    6a0e:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    6a0f:	03 72 04             	add    0x4(%edx),%esi
+    6a12:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    6a15:	8b 10                	mov    (%eax),%edx
+    6a17:	8b 12                	mov    (%edx),%edx
+    6a19:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    6a1c:	eb db                	jmp    69f9 <free+0x3e>
+    p->s.size += bp->s.size;
+    6a1e:	03 53 fc             	add    -0x4(%ebx),%edx
+    6a21:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    6a24:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    6a27:	89 10                	mov    %edx,(%eax)
+    6a29:	eb da                	jmp    6a05 <free+0x4a>
+
+00006a2b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    6a2b:	55                   	push   %ebp
+    6a2c:	89 e5                	mov    %esp,%ebp
+    6a2e:	53                   	push   %ebx
+    6a2f:	83 ec 04             	sub    $0x4,%esp
+    6a32:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    6a34:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    6a39:	77 05                	ja     6a40 <morecore+0x15>
+    nu = 4096;
+    6a3b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    6a40:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    6a47:	83 ec 0c             	sub    $0xc,%esp
+    6a4a:	50                   	push   %eax
+    6a4b:	e8 b0 fc ff ff       	call   6700 <sbrk>
+  if(p == (char*)-1)
+    6a50:	83 c4 10             	add    $0x10,%esp
+    6a53:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6a56:	74 1c                	je     6a74 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    6a58:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    6a5b:	83 c0 08             	add    $0x8,%eax
+    6a5e:	83 ec 0c             	sub    $0xc,%esp
+    6a61:	50                   	push   %eax
+    6a62:	e8 54 ff ff ff       	call   69bb <free>
+  return freep;
+    6a67:	a1 a0 0f 01 00       	mov    0x10fa0,%eax
+    6a6c:	83 c4 10             	add    $0x10,%esp
+}
+    6a6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6a72:	c9                   	leave
+    6a73:	c3                   	ret
+    return 0;
+    6a74:	b8 00 00 00 00       	mov    $0x0,%eax
+    6a79:	eb f4                	jmp    6a6f <morecore+0x44>
+
+00006a7b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    6a7b:	55                   	push   %ebp
+    6a7c:	89 e5                	mov    %esp,%ebp
+    6a7e:	53                   	push   %ebx
+    6a7f:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    6a82:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a85:	8d 58 07             	lea    0x7(%eax),%ebx
+    6a88:	c1 eb 03             	shr    $0x3,%ebx
+    6a8b:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    6a8e:	8b 0d a0 0f 01 00    	mov    0x10fa0,%ecx
+    6a94:	85 c9                	test   %ecx,%ecx
+    6a96:	74 04                	je     6a9c <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6a98:	8b 01                	mov    (%ecx),%eax
+    6a9a:	eb 4a                	jmp    6ae6 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    6a9c:	c7 05 a0 0f 01 00 a4 	movl   $0x10fa4,0x10fa0
+    6aa3:	0f 01 00 
+    6aa6:	c7 05 a4 0f 01 00 a4 	movl   $0x10fa4,0x10fa4
+    6aad:	0f 01 00 
+    base.s.size = 0;
+    6ab0:	c7 05 a8 0f 01 00 00 	movl   $0x0,0x10fa8
+    6ab7:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    6aba:	b9 a4 0f 01 00       	mov    $0x10fa4,%ecx
+    6abf:	eb d7                	jmp    6a98 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    6ac1:	74 19                	je     6adc <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    6ac3:	29 da                	sub    %ebx,%edx
+    6ac5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    6ac8:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    6acb:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    6ace:	89 0d a0 0f 01 00    	mov    %ecx,0x10fa0
+      return (void*)(p + 1);
+    6ad4:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    6ad7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6ada:	c9                   	leave
+    6adb:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    6adc:	8b 10                	mov    (%eax),%edx
+    6ade:	89 11                	mov    %edx,(%ecx)
+    6ae0:	eb ec                	jmp    6ace <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6ae2:	89 c1                	mov    %eax,%ecx
+    6ae4:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    6ae6:	8b 50 04             	mov    0x4(%eax),%edx
+    6ae9:	39 da                	cmp    %ebx,%edx
+    6aeb:	73 d4                	jae    6ac1 <malloc+0x46>
+    if(p == freep)
+    6aed:	39 05 a0 0f 01 00    	cmp    %eax,0x10fa0
+    6af3:	75 ed                	jne    6ae2 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    6af5:	89 d8                	mov    %ebx,%eax
+    6af7:	e8 2f ff ff ff       	call   6a2b <morecore>
+    6afc:	85 c0                	test   %eax,%eax
+    6afe:	75 e2                	jne    6ae2 <malloc+0x67>
+    6b00:	eb d5                	jmp    6ad7 <malloc+0x5c>
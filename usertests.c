@@ -7,6 +7,12 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "mman.h"
+#include "vmstat.h"
+#include "bstat.h"
+#include "diskstat.h"
+#include "dcstat.h"
+#include "uio.h"
 
 char buf[8192];
 char name[3];
@@ -184,6 +190,10 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// More than the old 12 direct + 128 indirect blocks, and
+// enough to need an extent block if the disk is fragmented.
+#define BIGBLOCKS 400
+
 void
 writetest1(void)
 {
@@ -197,7 +207,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +227,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -241,6 +251,150 @@ writetest1(void)
   printf(stdout, "big files ok\n");
 }
 
+// A file written into fragmented free space needs more extents
+// than fit in its inode, so it gets an extent tree.
+#define FRAGFILES 60
+#define FRAGBIG   300
+
+void
+fragtest(void)
+{
+  char name[8];
+  int i, fd, sfd, n;
+
+  printf(stdout, "fragmented file test\n");
+
+  // The first block of fragbig, so that its reservation sits
+  // in front of the small files.
+  unlink("fragbig");
+  fd = open("fragbig", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "frag: create fragbig failed\n");
+    exit();
+  }
+  ((int*)buf)[0] = 0;
+  if(write(fd, buf, 512) != 512 || fsync(fd) != 0){
+    printf(stdout, "frag: write fragbig failed\n");
+    exit();
+  }
+
+  // One-block files after it; every other one goes away.
+  name[0] = 'f';
+  name[1] = 'r';
+  name[4] = '\0';
+  for(i = 0; i < FRAGFILES; i++){
+    name[2] = '0' + i/10;
+    name[3] = '0' + i%10;
+    sfd = open(name, O_CREATE|O_RDWR);
+    if(sfd < 0 || write(sfd, "x", 1) != 1 || fsync(sfd) != 0){
+      printf(stdout, "frag: create %s failed\n", name);
+      exit();
+    }
+    close(sfd);
+  }
+  for(i = 1; i < FRAGFILES; i += 2){
+    name[2] = '0' + i/10;
+    name[3] = '0' + i%10;
+    if(unlink(name) < 0){
+      printf(stdout, "frag: unlink %s failed\n", name);
+      exit();
+    }
+  }
+
+  for(i = 1; i < FRAGBIG; i++){
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, 512) != 512){
+      printf(stdout, "frag: write fragbig failed\n");
+      exit();
+    }
+  }
+  if(fsync(fd) != 0){
+    printf(stdout, "frag: fsync fragbig failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("fragbig", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "frag: open fragbig failed\n");
+    exit();
+  }
+  for(n = 0; (i = read(fd, buf, 512)) == 512; n++){
+    if(((int*)buf)[0] != n){
+      printf(stdout, "frag: block %d of fragbig reads as %d\n", n, ((int*)buf)[0]);
+      exit();
+    }
+  }
+  if(i != 0 || n != FRAGBIG){
+    printf(stdout, "frag: read only %d blocks of fragbig\n", n);
+    exit();
+  }
+  close(fd);
+
+  // Freeing the tree must not free anything twice.
+  if(unlink("fragbig") < 0){
+    printf(stdout, "frag: unlink fragbig failed\n");
+    exit();
+  }
+  for(i = 0; i < FRAGFILES; i += 2){
+    name[2] = '0' + i/10;
+    name[3] = '0' + i%10;
+    unlink(name);
+  }
+  printf(stdout, "fragmented file ok\n");
+}
+
+// Files appended to in turn each keep blocks reserved after
+// their last, so they do not end up interleaved on the disk.
+#define RSVROUNDS 32
+
+void
+rsvtest(void)
+{
+  struct stat sta, stb;
+  int fa, fb, i;
+
+  printf(stdout, "block reservation test\n");
+
+  unlink("rsva");
+  unlink("rsvb");
+  fa = open("rsva", O_CREATE|O_RDWR);
+  fb = open("rsvb", O_CREATE|O_RDWR);
+  if(fa < 0 || fb < 0){
+    printf(stdout, "rsv: create failed\n");
+    exit();
+  }
+  // fsync allocates each piece's blocks before the other
+  // file's next piece.
+  for(i = 0; i < RSVROUNDS; i++){
+    if(write(fa, buf, 4096) != 4096 || fsync(fa) != 0 ||
+       write(fb, buf, 4096) != 4096 || fsync(fb) != 0){
+      printf(stdout, "rsv: write failed\n");
+      exit();
+    }
+  }
+  if(fstat(fa, &sta) < 0 || fstat(fb, &stb) < 0){
+    printf(stdout, "rsv: fstat failed\n");
+    exit();
+  }
+  if(sta.size != RSVROUNDS*4096 || stb.size != RSVROUNDS*4096){
+    printf(stdout, "rsv: sizes %d %d\n", sta.size, stb.size);
+    exit();
+  }
+  // Interleaved, each file would have an extent per piece.
+  if(sta.nextent == 0 || stb.nextent == 0 ||
+     2*sta.nextent > RSVROUNDS || 2*stb.nextent > RSVROUNDS){
+    printf(stdout, "rsv: files interleaved, %d and %d extents\n",
+           sta.nextent, stb.nextent);
+    exit();
+  }
+  close(fa);
+  close(fb);
+  unlink("rsva");
+  unlink("rsvb");
+  printf(stdout, "block reservation ok\n");
+}
+
 void
 createtest(void)
 {
@@ -931,6 +1085,140 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// a directory with hundreds of entries is hashed; every name
+// must still be found, read back by a linear reader like ls,
+// and the directory must count as empty once they are gone
+void
+hashdir(void)
+{
+  int i, fd, n;
+  char name[16];
+  struct dirent de;
+
+  printf(1, "hashdir test\n");
+  if(mkdir("hd") != 0){
+    printf(1, "hashdir mkdir failed\n");
+    exit();
+  }
+  fd = open("hd/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "hashdir create failed\n");
+    exit();
+  }
+  close(fd);
+
+  strcpy(name, "hd/n");
+  for(i = 0; i < 300; i++){
+    name[4] = 'a' + i/26/26;
+    name[5] = 'a' + i/26%26;
+    name[6] = 'a' + i%26;
+    name[7] = '\0';
+    if(link("hd/f", name) != 0){
+      printf(1, "hashdir link %s failed\n", name);
+      exit();
+    }
+  }
+  for(i = 0; i < 300; i++){
+    name[4] = 'a' + i/26/26;
+    name[5] = 'a' + i/26%26;
+    name[6] = 'a' + i%26;
+    if((fd = open(name, 0)) < 0){
+      printf(1, "hashdir open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if(link("hd/f", "hd/naaa") == 0){
+    printf(1, "hashdir duplicate link succeeded\n");
+    exit();
+  }
+
+  fd = open("hd", 0);
+  n = 0;
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    if(de.inum != 0)
+      n++;
+  close(fd);
+  if(n != 300 + 3){
+    printf(1, "hashdir read %d entries\n", n);
+    exit();
+  }
+
+  for(i = 0; i < 300; i++){
+    name[4] = 'a' + i/26/26;
+    name[5] = 'a' + i/26%26;
+    name[6] = 'a' + i%26;
+    if(unlink(name) != 0){
+      printf(1, "hashdir unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("hd") == 0){
+    printf(1, "hashdir unlinked non-empty dir\n");
+    exit();
+  }
+  if(unlink("hd/f") != 0 || unlink("hd") != 0){
+    printf(1, "hashdir cleanup failed\n");
+    exit();
+  }
+  printf(1, "hashdir ok\n");
+}
+
+// a hashed directory has a limited index; once it is full,
+// creating an entry in a full leaf fails instead of panicking
+void
+dirfull(void)
+{
+  int i, n, fd;
+  char name[16];
+
+  printf(1, "dirfull test\n");
+  if(mkdir("df") != 0){
+    printf(1, "dirfull mkdir failed\n");
+    exit();
+  }
+  fd = open("df/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "dirfull create failed\n");
+    exit();
+  }
+  close(fd);
+
+  strcpy(name, "df/n");
+  name[7] = '\0';
+  for(n = 0; n < 26*26*26; n++){
+    name[4] = 'a' + n/26/26;
+    name[5] = 'a' + n/26%26;
+    name[6] = 'a' + n%26;
+    if(link("df/f", name) != 0)
+      break;
+  }
+  if(n == 26*26*26){
+    printf(1, "dirfull: directory never filled\n");
+    exit();
+  }
+  // name's leaf is full and cannot be split
+  if(open(name, O_CREATE|O_RDWR) >= 0 || mkdir(name) == 0){
+    printf(1, "dirfull: created %s in a full directory\n", name);
+    exit();
+  }
+
+  for(i = 0; i < n; i++){
+    name[4] = 'a' + i/26/26;
+    name[5] = 'a' + i/26%26;
+    name[6] = 'a' + i%26;
+    if(unlink(name) != 0){
+      printf(1, "dirfull unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("df/f") != 0 || unlink("df") != 0){
+    printf(1, "dirfull cleanup failed\n");
+    exit();
+  }
+  printf(1, "dirfull ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1695,98 +1983,1066 @@ fsfull()
   printf(1, "fsfull test finished\n");
 }
 
+// mmap() of a file, privately and shared, and of anonymous memory.
 void
-uio()
+mmaptest(void)
 {
-  #define RTC_ADDR 0x70
-  #define RTC_DATA 0x71
+  int fd, i, pid;
+  char *p, *q;
 
-  ushort port = 0;
-  uchar val = 0;
-  int pid;
+  printf(stdout, "mmap test\n");
 
-  printf(1, "uio test\n");
+  unlink("mmapfile");
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "mmap: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 6000; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf, 6000) != 6000){
+    printf(stdout, "mmap: write failed\n");
+    exit();
+  }
+
+  // private: contents match, writes stay private
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED){
+    printf(stdout, "mmap: private mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < 6000; i++){
+    if(p[i] != 'a' + i % 26){
+      printf(stdout, "mmap: private content wrong at %d\n", i);
+      exit();
+    }
+  }
+  if(p[6000] != 0 || p[8191] != 0){
+    printf(stdout, "mmap: tail of last page not zero\n");
+    exit();
+  }
+  p[0] = 'Z';
+  if(munmap(p, 6000) < 0){
+    printf(stdout, "mmap: munmap failed\n");
+    exit();
+  }
+
+  // shared: a store is seen by read() and by a child
+  q = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(q == MAP_FAILED){
+    printf(stdout, "mmap: shared mmap failed\n");
+    exit();
+  }
+  if(q[0] != 'a'){
+    printf(stdout, "mmap: private store leaked into file\n");
+    exit();
+  }
+  q[1] = 'X';
   pid = fork();
-  if(pid == 0){
-    port = RTC_ADDR;
-    val = 0x09;  /* year */
-    /* http://wiki.osdev.org/Inline_Assembly/Examples */
-    asm volatile("outb %0,%1"::"a"(val), "d" (port));
-    port = RTC_DATA;
-    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
-    printf(1, "uio: uio succeeded; test FAILED\n");
+  if(pid < 0){
+    printf(stdout, "mmap: fork failed\n");
     exit();
-  } else if(pid < 0){
-    printf (1, "fork failed\n");
+  }
+  if(pid == 0){
+    if(q[1] != 'X')
+      printf(stdout, "mmap: child does not see store\n");
+    q[4097] = 'Y';
     exit();
   }
   wait();
-  printf(1, "uio test done\n");
-}
-
-void argptest()
-{
-  int fd;
-  fd = open("init", O_RDONLY);
-  if (fd < 0) {
-    printf(2, "open failed\n");
+  if(q[4097] != 'Y'){
+    printf(stdout, "mmap: parent does not see child store\n");
     exit();
   }
-  read(fd, sbrk(0) - 1, -1);
+  // write() from a mapped buffer
+  if(write(fd, q, 10) != 10){
+    printf(stdout, "mmap: write from mapping failed\n");
+    exit();
+  }
+  munmap(q, 6000);
   close(fd);
-  printf(1, "arg test passed\n");
-}
-
-unsigned long randstate = 1;
-unsigned int
-rand()
-{
-  randstate = randstate * 1664525 + 1013904223;
-  return randstate;
-}
 
-int
-main(int argc, char *argv[])
-{
-  printf(1, "usertests starting\n");
+  fd = open("mmapfile", O_RDONLY);
+  if(read(fd, buf, 6000) != 6000 || buf[1] != 'X' || buf[4097] != 'Y'){
+    printf(stdout, "mmap: shared stores not written back\n");
+    exit();
+  }
+  // shared writable mapping needs a writable descriptor
+  if(mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED){
+    printf(stdout, "mmap: shared writable mapping of read-only file\n");
+    exit();
+  }
+  close(fd);
+  unlink("mmapfile");
 
-  if(open("usertests.ran", 0) >= 0){
-    printf(1, "already ran user tests -- rebuild fs.img\n");
+  // anonymous: zeroed, and gone after munmap
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED){
+    printf(stdout, "mmap: anonymous mmap failed\n");
     exit();
   }
-  close(open("usertests.ran", O_CREATE));
+  for(i = 0; i < 3*4096; i++){
+    if(p[i] != 0){
+      printf(stdout, "mmap: anonymous page not zero\n");
+      exit();
+    }
+    p[i] = i;
+  }
+  munmap(p + 4096, 4096);
+  if(p[0] != 0 || p[2*4096+1] != 1){
+    printf(stdout, "mmap: munmap of middle page clobbered neighbours\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    p[4096] = 1;
+    printf(stdout, "mmap: store to unmapped page succeeded\n");
+    exit();
+  }
+  wait();
+  munmap(p, 3*4096);
 
-  argptest();
-  createdelete();
-  linkunlink();
-  concreate();
-  fourfiles();
-  sharedfd();
+  // shared anonymous: shared with a child forked before any
+  // page was touched
+  p = mmap(0, 2*4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED){
+    printf(stdout, "mmap: shared anonymous mmap failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "mmap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    p[0] = 'C';
+    p[4096+7] = 'D';
+    exit();
+  }
+  wait();
+  if(p[0] != 'C' || p[4096+7] != 'D'){
+    printf(stdout, "mmap: parent does not see child store to shared anonymous page\n");
+    exit();
+  }
+  munmap(p, 2*4096);
 
-  bigargtest();
-  bigwrite();
-  bigargtest();
-  bsstest();
-  sbrktest();
-  validatetest();
+  printf(stdout, "mmap test ok\n");
+}
 
-  opentest();
-  writetest();
-  writetest1();
-  createtest();
+// named shared memory between unrelated attachments
+void
+shmtest(void)
+{
+  char *p, *q;
+  int pid, i;
 
-  openiputtest();
-  exitiputtest();
-  iputtest();
+  printf(stdout, "shm test\n");
 
-  mem();
-  pipe1();
-  preempt();
-  exitwait();
+  p = shmat("shmtest", 2);
+  if(p == (char*)-1){
+    printf(stdout, "shm: shmat failed\n");
+    exit();
+  }
+  for(i = 0; i < 2*4096; i++){
+    if(p[i] != 0){
+      printf(stdout, "shm: new segment not zero\n");
+      exit();
+    }
+  }
+  p[0] = 'P';
 
-  rmdot();
-  fourteen();
-  bigfile();
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "shm: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // drop the inherited attachment and attach by name
+    shmdt(p);
+    q = shmat("shmtest", 0);
+    if(q == (char*)-1 || q[0] != 'P'){
+      printf(stdout, "shm: child cannot see segment\n");
+      exit();
+    }
+    q[4096+5] = 'C';
+    shmdt(q);
+    exit();
+  }
+  wait();
+  if(p[4096+5] != 'C'){
+    printf(stdout, "shm: parent does not see child store\n");
+    exit();
+  }
+  if(shmat("shmtest", 3) != (char*)-1){
+    printf(stdout, "shm: attached more pages than the segment has\n");
+    exit();
+  }
+  if(shmdt(p) < 0){
+    printf(stdout, "shm: shmdt failed\n");
+    exit();
+  }
+
+  // the last detach freed it
+  if(shmat("shmtest", 0) != (char*)-1){
+    printf(stdout, "shm: segment outlived its last detach\n");
+    exit();
+  }
+  p = shmat("shmtest", 1);
+  if(p == (char*)-1 || p[0] != 0){
+    printf(stdout, "shm: recreated segment not zero\n");
+    exit();
+  }
+  shmdt(p);
+
+  printf(stdout, "shm test ok\n");
+}
+
+// MAP_HUGE regions: 4MB aligned, zeroed, copied by fork.
+void
+hugetest(void)
+{
+  char *p;
+  int pid, i;
+
+  printf(stdout, "huge test\n");
+
+  p = mmap(0, 8*1024*1024, PROT_READ|PROT_WRITE,
+           MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGE, -1, 0);
+  if(p == MAP_FAILED){
+    printf(stdout, "huge: mmap failed\n");
+    exit();
+  }
+  if((uint)p % (4*1024*1024) != 0){
+    printf(stdout, "huge: region not 4MB aligned\n");
+    exit();
+  }
+  for(i = 0; i < 8*1024*1024; i += 4096){
+    if(p[i] != 0){
+      printf(stdout, "huge: page not zero\n");
+      exit();
+    }
+    p[i] = i >> 12;
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "huge: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < 8*1024*1024; i += 4096){
+      if(p[i] != (char)(i >> 12)){
+        printf(stdout, "huge: child sees wrong data\n");
+        exit();
+      }
+    }
+    p[0] = 'C';
+    exit();
+  }
+  wait();
+  if(p[0] != 0){
+    printf(stdout, "huge: child store leaked into parent\n");
+    exit();
+  }
+  // huge regions can only be cut at 4MB boundaries
+  if(munmap(p + 4096, 4096) == 0){
+    printf(stdout, "huge: munmap of a small piece succeeded\n");
+    exit();
+  }
+  if(munmap(p, 4*1024*1024) < 0 || p[4*1024*1024 + 4096] != 1){
+    printf(stdout, "huge: munmap of first 4MB failed\n");
+    exit();
+  }
+  munmap(p + 4*1024*1024, 4*1024*1024);
+
+  printf(stdout, "huge test ok\n");
+}
+
+// allocate more than physical memory; the excess is paged out
+void
+swaptest(void)
+{
+  struct vmstat st0, st1;
+  char *start, *p, c;
+  int pid, pid2, n, i, up[2], down[2];
+
+  printf(stdout, "swap test\n");
+
+  getvmstat(&st0);
+  if(st0.swapsize == 0){
+    printf(stdout, "swap: no swap space, skipped\n");
+    return;
+  }
+  if(pipe(up) != 0 || pipe(down) != 0){
+    printf(stdout, "swap: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "swap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(up[0]);
+    close(down[1]);
+    n = st0.freepages + st0.swapsize/2;
+    start = sbrk(0);
+    for(i = 0; i < n; i++){
+      if((p = sbrk(4096)) == (char*)-1){
+        printf(stdout, "swap: sbrk failed after %d pages\n", i);
+        exit();
+      }
+      p[0] = i;
+      p[4095] = i >> 8;
+    }
+    for(i = 0; i < n; i++){
+      p = start + i*4096;
+      if(p[0] != (char)i || p[4095] != (char)(i >> 8)){
+        printf(stdout, "swap: page %d lost its contents\n", i);
+        exit();
+      }
+    }
+    getvmstat(&st1);
+    if(st1.pageout == st0.pageout || st1.pagein == st0.pagein)
+      printf(stdout, "swap: no paging, test FAILED\n");
+    // Hold on to the memory while the parent forks.
+    write(up[1], "x", 1);
+    read(down[0], &c, 1);
+    exit();
+  }
+  close(up[1]);
+  close(down[0]);
+  // Memory is overcommitted now: the new process's kernel
+  // stack and page tables have to come from paging out.
+  if(read(up[0], &c, 1) != 1){
+    printf(stdout, "swap: child died\n");
+    exit();
+  }
+  pid2 = fork();
+  if(pid2 == 0)
+    exit();
+  if(pid2 < 0)
+    printf(stdout, "swap: fork with memory overcommitted failed, test FAILED\n");
+  else
+    wait();
+  write(down[1], "x", 1);
+  wait();
+  close(up[0]);
+  close(down[1]);
+  getvmstat(&st1);
+  if(st1.swapused != st0.swapused){
+    printf(stdout, "swap: exit leaked swap slots\n");
+    exit();
+  }
+  printf(stdout, "swap test ok\n");
+}
+
+// the buffer cache grows past its minimum size and counts hits
+void
+bcachetest(void)
+{
+  struct bstat st0, st1;
+  int fd, i;
+
+  printf(stdout, "bcache test\n");
+
+  unlink("bcachefile");
+  fd = open("bcachefile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "bcache: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 80; i++){
+    if(write(fd, buf, 512) != 512){
+      printf(stdout, "bcache: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  getbstat(&st0);
+  for(i = 0; i < 2; i++){
+    fd = open("bcachefile", O_RDONLY);
+    while(read(fd, buf, 512) == 512)
+      ;
+    close(fd);
+  }
+  getbstat(&st1);
+  if(st1.nbuf < 80 || st1.nbuf > st1.maxbuf){
+    printf(stdout, "bcache: cache did not grow (%d buffers)\n", st1.nbuf);
+    exit();
+  }
+  if(st1.hits == st0.hits){
+    printf(stdout, "bcache: no hits\n");
+    exit();
+  }
+  unlink("bcachefile");
+  printf(stdout, "bcache test ok\n");
+}
+
+// concurrent writers keep the disk queue busy; the queue
+// accounts for every request it finishes
+void
+disktest(void)
+{
+  struct diskstat st0, st1;
+  char file[] = "disk0";
+  int fd, i, j, pid;
+
+  printf(stdout, "disk test\n");
+
+  getdiskstat(&st0);
+  for(i = 0; i < 4; i++){
+    file[4] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "disk: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      unlink(file);
+      fd = open(file, O_CREATE|O_RDWR);
+      if(fd < 0){
+        printf(stdout, "disk: create failed\n");
+        exit();
+      }
+      for(j = 0; j < 20; j++){
+        if(write(fd, buf, 512) != 512){
+          printf(stdout, "disk: write failed\n");
+          exit();
+        }
+      }
+      close(fd);
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+  getdiskstat(&st1);
+
+  if(st1.reqs <= st0.reqs || st1.cmds <= st0.cmds){
+    printf(stdout, "disk: no requests counted\n");
+    exit();
+  }
+  if(st1.cmds - st0.cmds > st1.reqs - st0.reqs || st1.depth > st1.maxdepth){
+    printf(stdout, "disk: bad counts\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    file[4] = '0' + i;
+    unlink(file);
+  }
+  printf(stdout, "disk test ok\n");
+}
+
+// many processes hold more files open at once than the
+// inode cache started with
+void
+icachetest(void)
+{
+  char file[] = "ic00";
+  int fds[2], ready[2], fd, i, j, n, pid;
+  char c;
+
+  printf(stdout, "icache test\n");
+
+  if(pipe(fds) != 0 || pipe(ready) != 0){
+    printf(stdout, "icache: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 8; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "icache: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(fds[1]);
+      close(ready[0]);
+      file[2] = '0' + i;
+      for(j = 0; j < 10; j++){
+        file[3] = '0' + j;
+        if(open(file, O_CREATE|O_RDWR) < 0){
+          printf(stdout, "icache: create failed\n");
+          exit();
+        }
+      }
+      // Hold them until the parent closes the pipe.
+      write(ready[1], "x", 1);
+      read(fds[0], &c, 1);
+      exit();
+    }
+  }
+  close(fds[0]);
+  close(ready[1]);
+  // All 80 inodes are in use at once once every child is ready.
+  for(n = 0; n < 8 && read(ready[0], &c, 1) == 1; n++)
+    ;
+  if(n != 8){
+    printf(stdout, "icache: only %d children opened their files\n", n);
+    exit();
+  }
+  close(ready[0]);
+  close(fds[1]);
+  for(i = 0; i < 8; i++)
+    wait();
+
+  for(i = 0; i < 8; i++){
+    file[2] = '0' + i;
+    for(j = 0; j < 10; j++){
+      file[3] = '0' + j;
+      if((fd = open(file, O_RDONLY)) < 0){
+        printf(stdout, "icache: open failed\n");
+        exit();
+      }
+      close(fd);
+      unlink(file);
+    }
+  }
+  printf(stdout, "icache test ok\n");
+}
+
+// a process may have hundreds of descriptors; the lowest free
+// one is always used, and fork copies them all
+void
+fdtabletest(void)
+{
+  int fd0, fd, i, pid;
+
+  printf(stdout, "fd table test\n");
+
+  fd0 = open("fdtabfile", O_CREATE|O_RDWR);
+  if(fd0 < 0){
+    printf(stdout, "fdtable: create failed\n");
+    exit();
+  }
+  for(i = fd0+1; i < fd0+300; i++){
+    if((fd = open("fdtabfile", O_RDONLY)) != i){
+      printf(stdout, "fdtable: open got fd %d, not %d\n", fd, i);
+      exit();
+    }
+  }
+  close(fd0+100);
+  close(fd0+7);
+  if(dup(fd0) != fd0+7 || dup(fd0) != fd0+100 || dup(fd0) != fd0+300){
+    printf(stdout, "fdtable: dup did not take the lowest fd\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fdtable: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(write(fd0+300, "x", 1) != 1 || close(fd0+299) != 0 || dup(fd0) != fd0+299){
+      printf(stdout, "fdtable: child lost descriptors\n");
+      exit();
+    }
+    exit();
+  }
+  wait();
+
+  for(i = fd0; i <= fd0+300; i++){
+    if(close(i) != 0){
+      printf(stdout, "fdtable: close %d failed\n", i);
+      exit();
+    }
+  }
+  if(close(fd0+300) != -1 || (fd = open("fdtabfile", O_RDONLY)) != fd0){
+    printf(stdout, "fdtable: descriptors not freed\n");
+    exit();
+  }
+  close(fd);
+  unlink("fdtabfile");
+  printf(stdout, "fd table test ok\n");
+}
+
+// pread and pwrite leave the file offset alone; readv and
+// writev move several buffers in one call
+void
+preadvtest(void)
+{
+  static char b1[3000], b2[5000], b3[2000];
+  struct iovec iov[3];
+  int fd, i, pid, off, fds[2];
+  char c;
+
+  printf(stdout, "pread/readv test\n");
+
+  for(i = 0; i < sizeof(b1); i++)
+    b1[i] = 'a' + i % 7;
+  for(i = 0; i < sizeof(b2); i++)
+    b2[i] = 'A' + i % 11;
+  for(i = 0; i < sizeof(b3); i++)
+    b3[i] = '0' + i % 10;
+  iov[0].base = b1;
+  iov[0].len = sizeof(b1);
+  iov[1].base = b2;
+  iov[1].len = sizeof(b2);
+  iov[2].base = b3;
+  iov[2].len = sizeof(b3);
+
+  unlink("preadfile");
+  fd = open("preadfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "preadv: create failed\n");
+    exit();
+  }
+  if(writev(fd, iov, 3) != 10000){
+    printf(stdout, "preadv: writev failed\n");
+    exit();
+  }
+  if(pwrite(fd, "#", 1, 3001) != 1 || write(fd, "$", 1) != 1){
+    printf(stdout, "preadv: pwrite failed\n");
+    exit();
+  }
+
+  // Children share fd, and its offset, while they pread.
+  for(i = 0; i < 4; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "preadv: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      off = 3000 + i*2000;
+      if(pread(fd, &c, 1, off) != 1 ||
+         c != (off < 8000 ? b2[off - 3000] : b3[off - 8000])){
+        printf(stdout, "preadv: pread got %c\n", c);
+        exit();
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+  if(pread(fd, &c, 1, 3001) != 1 || c != '#' || pread(fd, &c, 1, 10001) != 0){
+    printf(stdout, "preadv: pread after pwrite failed\n");
+    exit();
+  }
+  if(pread(fd, &c, 1, 10000) != 1 || c != '$'){
+    printf(stdout, "preadv: pwrite moved the offset\n");
+    exit();
+  }
+  close(fd);
+
+  memset(b1, 0, sizeof(b1));
+  memset(b2, 0, sizeof(b2));
+  memset(b3, 0, sizeof(b3));
+  fd = open("preadfile", O_RDONLY);
+  if(readv(fd, iov, 3) != 10000 || read(fd, &c, 1) != 1 || c != '$'){
+    printf(stdout, "preadv: readv failed\n");
+    exit();
+  }
+  if(b1[2999] != 'a' + 2999 % 7 || b2[0] != 'A' || b2[1] != '#' ||
+     b2[4999] != 'A' + 4999 % 11 || b3[1999] != '9'){
+    printf(stdout, "preadv: readv got wrong data\n");
+    exit();
+  }
+  close(fd);
+  unlink("preadfile");
+
+  // readv from a pipe returns what is there once the first
+  // buffer is full, with the write end still open.
+  if(pipe(fds) != 0 || write(fds[1], "xyz", 3) != 3){
+    printf(stdout, "preadv: pipe failed\n");
+    exit();
+  }
+  iov[0].len = 3;
+  if(readv(fds[0], iov, 3) != 3 || b1[0] != 'x' || b1[2] != 'z'){
+    printf(stdout, "preadv: readv from pipe failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  printf(stdout, "pread/readv test ok\n");
+}
+
+// sendfile and splice copy between files and pipes inside
+// the kernel
+void
+splicetest(void)
+{
+  int fd, fd2, fds[2], i, n, off, pid;
+  char c;
+
+  printf(stdout, "splice test\n");
+
+  unlink("splicein");
+  unlink("spliceout");
+  fd = open("splicein", O_CREATE|O_RDWR);
+  for(i = 0; i < 10000; i += n){
+    for(n = 0; n < 1000; n++)
+      buf[n] = 'a' + (i + n) % 23;
+    if(write(fd, buf, n) != n){
+      printf(stdout, "splice: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  // file to pipe in a child, pipe to file here
+  if(pipe(fds) != 0){
+    printf(stdout, "splice: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "splice: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    fd = open("splicein", O_RDONLY);
+    if(sendfile(fds[1], fd, 0, 20000) != 10000){
+      printf(stdout, "splice: sendfile to pipe failed\n");
+      exit();
+    }
+    exit();
+  }
+  close(fds[1]);
+  fd2 = open("spliceout", O_CREATE|O_RDWR);
+  n = 0;
+  while((i = splice(fds[0], fd2, 3000)) > 0)
+    n += i;
+  close(fds[0]);
+  wait();
+  if(i < 0 || n != 10000){
+    printf(stdout, "splice: pipe to file copied %d\n", n);
+    exit();
+  }
+
+  // file to file, from an offset
+  fd = open("splicein", O_RDONLY);
+  off = 5000;
+  if(sendfile(fd2, fd, &off, 100) != 100 || off != 5100 ||
+     read(fd, &c, 1) != 1 || c != 'a'){
+    printf(stdout, "splice: sendfile with offset failed\n");
+    exit();
+  }
+  if(splice(fd, fd2, 20000) != 9999 || splice(fd, fd2, 10) != 0){
+    printf(stdout, "splice: file to file failed\n");
+    exit();
+  }
+  close(fd);
+  close(fd2);
+
+  fd = open("spliceout", O_RDONLY);
+  for(i = 0; i < 20099; i++){
+    if(read(fd, &c, 1) != 1){
+      printf(stdout, "splice: short output\n");
+      exit();
+    }
+    n = i < 10000 ? i : i < 10100 ? i - 10000 + 5000 : i - 10100 + 1;
+    if(c != 'a' + n % 23){
+      printf(stdout, "splice: wrong byte %d\n", i);
+      exit();
+    }
+  }
+  if(read(fd, &c, 1) != 0){
+    printf(stdout, "splice: long output\n");
+    exit();
+  }
+  close(fd);
+  unlink("splicein");
+  unlink("spliceout");
+  printf(stdout, "splice test ok\n");
+}
+
+// small appends are held in memory and written back later;
+// the file reads back the same before and after, and fsync
+// and the flusher both write it
+void
+writebacktest(void)
+{
+  struct diskstat ds0, ds1;
+  struct stat st;
+  int fd, i, j;
+  char c;
+
+  printf(stdout, "writeback test\n");
+
+  unlink("wbfile");
+  fd = open("wbfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "writeback: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 300; i++){
+    for(j = 0; j < 37; j++)
+      buf[j] = 'a' + (i*37 + j) % 26;
+    if(write(fd, buf, 37) != 37){
+      printf(stdout, "writeback: write failed\n");
+      exit();
+    }
+    if(i == 150){
+      getdiskstat(&ds0);
+      if(fsync(fd) != 0){
+        printf(stdout, "writeback: fsync failed\n");
+        exit();
+      }
+      getdiskstat(&ds1);
+      if(ds1.writes == ds0.writes){
+        printf(stdout, "writeback: fsync wrote nothing\n");
+        exit();
+      }
+    }
+  }
+  if(fstat(fd, &st) < 0 || st.size != 300*37){
+    printf(stdout, "writeback: size %d\n", st.size);
+    exit();
+  }
+  // overwrite across the end of what fsync wrote
+  if(pwrite(fd, "XYZ", 3, 151*37 - 1) != 3){
+    printf(stdout, "writeback: pwrite failed\n");
+    exit();
+  }
+
+  for(j = 0; j < 2; j++){
+    for(i = 0; i < (300 + j)*37; i++){
+      if(pread(fd, &c, 1, i) != 1){
+        printf(stdout, "writeback: short file\n");
+        exit();
+      }
+      if(c != (i >= 151*37 - 1 && i < 151*37 + 2 ? "XYZ"[i - (151*37 - 1)] : 'a' + i % 26)){
+        printf(stdout, "writeback: wrong byte %d\n", i);
+        exit();
+      }
+    }
+    if(j == 1)
+      break;
+    // Append one more piece, which stays in memory until the
+    // flusher runs, then check everything again.
+    getdiskstat(&ds0);
+    for(i = 0; i < 37; i++)
+      buf[i] = 'a' + (300*37 + i) % 26;
+    if(write(fd, buf, 37) != 37){
+      printf(stdout, "writeback: write failed\n");
+      exit();
+    }
+    sleep(150);
+    getdiskstat(&ds1);
+    if(ds1.writes == ds0.writes){
+      printf(stdout, "writeback: flusher wrote nothing\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("wbfile");
+  printf(stdout, "writeback test ok\n");
+}
+
+// repeated lookups are answered by the dentry cache, misses
+// too; link and unlink keep it right
+void
+dcachetest(void)
+{
+  struct dcstat st0, st1;
+  int fd, i;
+
+  printf(stdout, "dcache test\n");
+
+  mkdir("dcdir");
+  fd = open("dcdir/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "dcache: create failed\n");
+    exit();
+  }
+  close(fd);
+
+  getdcstat(&st0);
+  for(i = 0; i < 10; i++){
+    if((fd = open("dcdir/f", O_RDONLY)) < 0){
+      printf(stdout, "dcache: open failed\n");
+      exit();
+    }
+    close(fd);
+    if(open("dcdir/nofile", O_RDONLY) >= 0){
+      printf(stdout, "dcache: opened nofile\n");
+      exit();
+    }
+  }
+  getdcstat(&st1);
+  if(st1.hits < st0.hits + 10 || st1.neghits < st0.neghits + 9){
+    printf(stdout, "dcache: %d hits, %d negative hits\n",
+           st1.hits - st0.hits, st1.neghits - st0.neghits);
+    exit();
+  }
+
+  // A cached miss must not hide a new name, nor a cached
+  // hit a removed one.
+  if(link("dcdir/f", "dcdir/nofile") < 0 || (fd = open("dcdir/nofile", O_RDONLY)) < 0){
+    printf(stdout, "dcache: link not seen\n");
+    exit();
+  }
+  close(fd);
+  if(unlink("dcdir/nofile") < 0 || open("dcdir/nofile", O_RDONLY) >= 0){
+    printf(stdout, "dcache: unlink not seen\n");
+    exit();
+  }
+  if(unlink("dcdir/f") < 0 || unlink("dcdir") < 0){
+    printf(stdout, "dcache: unlink failed\n");
+    exit();
+  }
+  if(open("dcdir/f", O_RDONLY) >= 0 || mkdir("dcdir") < 0 || open("dcdir/f", O_RDONLY) >= 0){
+    printf(stdout, "dcache: stale names in new dcdir\n");
+    exit();
+  }
+  unlink("dcdir");
+  printf(stdout, "dcache test ok\n");
+}
+
+// many processes creating files share commits; fsync waits
+// for them and rejects bad descriptors
+void
+fsynctest(void)
+{
+  char file[] = "fsync00";
+  int fd, i, j, pid;
+
+  printf(stdout, "fsync test\n");
+
+  for(i = 0; i < 4; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fsync: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      file[5] = '0' + i;
+      for(j = 0; j < 10; j++){
+        file[6] = '0' + j;
+        fd = open(file, O_CREATE|O_RDWR);
+        if(fd < 0 || write(fd, "x", 1) != 1){
+          printf(stdout, "fsync: create failed\n");
+          exit();
+        }
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+
+  fd = open("fsync00", O_RDONLY);
+  if(fd < 0 || fsync(fd) != 0){
+    printf(stdout, "fsync: fsync failed\n");
+    exit();
+  }
+  close(fd);
+  if(fsync(fd) != -1){
+    printf(stdout, "fsync: fsync of closed fd succeeded\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    file[5] = '0' + i;
+    for(j = 0; j < 10; j++){
+      file[6] = '0' + j;
+      if(unlink(file) != 0){
+        printf(stdout, "fsync: unlink failed\n");
+        exit();
+      }
+    }
+  }
+  printf(stdout, "fsync test ok\n");
+}
+
+void
+uio()
+{
+  #define RTC_ADDR 0x70
+  #define RTC_DATA 0x71
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+  pid = fork();
+  if(pid == 0){
+    port = RTC_ADDR;
+    val = 0x09;  /* year */
+    /* http://wiki.osdev.org/Inline_Assembly/Examples */
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+  printf(1, "uio test done\n");
+}
+
+void argptest()
+{
+  int fd;
+  fd = open("init", O_RDONLY);
+  if (fd < 0) {
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+  close(fd);
+  printf(1, "arg test passed\n");
+}
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "usertests starting\n");
+
+  if(open("usertests.ran", 0) >= 0){
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    exit();
+  }
+  close(open("usertests.ran", O_CREATE));
+
+  argptest();
+  createdelete();
+  linkunlink();
+  concreate();
+  fourfiles();
+  sharedfd();
+
+  bigargtest();
+  bigwrite();
+  bigargtest();
+  bsstest();
+  sbrktest();
+  validatetest();
+
+  opentest();
+  writetest();
+  writetest1();
+  fragtest();
+  rsvtest();
+  createtest();
+
+  openiputtest();
+  exitiputtest();
+  iputtest();
+
+  mem();
+  pipe1();
+  preempt();
+  exitwait();
+
+  rmdot();
+  fourteen();
+  bigfile();
   subdir();
   linktest();
   unlinkread();
@@ -1794,7 +3050,22 @@ main(int argc, char *argv[])
   iref();
   forktest();
   bigdir(); // slow
-
+  dirfull(); // slow
+  hashdir();
+  dcachetest();
+  icachetest();
+  fdtabletest();
+
+  mmaptest();
+  shmtest();
+  hugetest();
+  swaptest();
+  bcachetest();
+  disktest();
+  fsynctest();
+  preadvtest();
+  splicetest();
+  writebacktest();
   uio();
 
   exectest();
@@ -0,0 +1,341 @@
+// Driver for a virtio block device (legacy PCI interface),
+// such as QEMU's virtio-blk-pci.  When one is present it
+// takes over the file system disk from ide.c (see bdevsw).
+//
+// Requests go on a single virtqueue, each as a chain of three
+// descriptors: the request header, the buf's data, and a
+// status byte the device fills in.  The device works on all
+// queued requests at once and interrupts as they finish, so
+// there is no need for an elevator as in ide.c.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "diskstat.h"
+#include "pci.h"
+#include "traps.h"
+
+#define VIRTIO_VENDOR  0x1af4
+#define VIRTIO_BLK     0x1001  // legacy block device
+
+// Legacy virtio registers, from BAR0.
+#define VIO_HOSTFEAT   0x00  // device features
+#define VIO_GUESTFEAT  0x04  // features the driver accepts
+#define VIO_QADDR      0x08  // physical page number of the queue
+#define VIO_QSIZE      0x0c  // entries in the selected queue
+#define VIO_QSEL       0x0e  // queue select
+#define VIO_QNOTIFY    0x10  // queue notify
+#define VIO_STATUS     0x12  // device status
+#define VIO_ISR        0x13  // interrupt status; reading acknowledges
+
+#define VS_ACK         0x01
+#define VS_DRIVER      0x02
+#define VS_DRIVER_OK   0x04
+
+#define SECTOR_SIZE    512
+
+// Descriptor table entry.
+struct vdesc {
+  uint addr;    // physical address, low 32 bits
+  uint addrhi;  // high 32 bits; always 0 here
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VD_NEXT   0x1  // chained with next
+#define VD_WRITE  0x2  // device writes (vs read)
+
+struct vusedelem {
+  uint id;   // head descriptor of the finished chain
+  uint len;
+};
+
+// Request header.
+struct vblkreq {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+};
+#define VBLK_IN   0  // read the disk
+#define VBLK_OUT  1  // write the disk
+
+// The legacy interface wants the descriptor table and the
+// available ring, then on the next page the used ring, all in
+// physically contiguous memory: a static array does.
+#define VQMAX     256
+#define VQALIGN(x)  (((x) + PGSIZE - 1) & ~(PGSIZE - 1))
+#define VQBYTES(n)  (VQALIGN(16*(n) + 2*(3+(n))) + VQALIGN(2*3 + 8*(n)))
+
+static char vqmem[VQBYTES(VQMAX)] __attribute__((aligned(PGSIZE)));
+
+static struct {
+  struct spinlock lock;
+  uint iobase;
+  int irq;
+  int qsize;
+
+  struct vdesc *desc;
+  ushort *avail;     // flags, idx, ring[qsize]
+  ushort *usedhdr;   // flags, idx
+  struct vusedelem *used;
+  ushort lastused;   // used ring entries already handled
+
+  char free[VQMAX];  // descriptor is free
+  int nfree;
+
+  // Per request, indexed by its head descriptor.
+  struct {
+    struct buf *b;
+    struct vblkreq hdr;
+    uchar status;
+  } info[VQMAX];
+
+  struct diskstat stat;
+} vio;
+
+static void virtiorw(struct buf*);
+static void virtiosubmit(struct buf*);
+static void virtiogetstat(struct diskstat*);
+
+// Look for a virtio block device and, if there is one,
+// make it the root disk.
+void
+virtioinit(void)
+{
+  struct pcidev pd;
+  int i, n;
+
+  if(pcifind(VIRTIO_VENDOR, VIRTIO_BLK, &pd) < 0)
+    return;
+  if((vio.iobase = pciiobase(&pd, 0)) == 0)
+    return;
+  // trap() only hands the BIOS's PCI lines to virtiointr.
+  vio.irq = pciread(&pd, PCI_INTLINE) & 0xff;
+  if(vio.irq != IRQ_PCI0 && vio.irq != IRQ_PCI1 && vio.irq != IRQ_PCI2){
+    cprintf("virtio: irq %d not handled; using ide\n", vio.irq);
+    vio.iobase = 0;
+    return;
+  }
+  pcienable(&pd, PCI_CMD_IO|PCI_CMD_MASTER);
+
+  outb(vio.iobase+VIO_STATUS, 0);  // reset
+  outb(vio.iobase+VIO_STATUS, VS_ACK);
+  outb(vio.iobase+VIO_STATUS, VS_ACK|VS_DRIVER);
+  inl(vio.iobase+VIO_HOSTFEAT);
+  outl(vio.iobase+VIO_GUESTFEAT, 0);  // need no optional features
+
+  outw(vio.iobase+VIO_QSEL, 0);
+  n = inw(vio.iobase+VIO_QSIZE);
+  if(n == 0 || n > VQMAX){
+    cprintf("virtio: bad queue size %d; using ide\n", n);
+    outb(vio.iobase+VIO_STATUS, 0);
+    return;
+  }
+  vio.qsize = n;
+  vio.desc = (struct vdesc*)vqmem;
+  vio.avail = (ushort*)(vqmem + 16*n);
+  vio.usedhdr = (ushort*)(vqmem + VQALIGN(16*n + 2*(3+n)));
+  vio.used = (struct vusedelem*)(vio.usedhdr + 2);
+  for(i = 0; i < n; i++)
+    vio.free[i] = 1;
+  vio.nfree = n;
+  outl(vio.iobase+VIO_QADDR, V2P(vqmem) / PGSIZE);
+
+  initlock(&vio.lock, "virtio");
+  ioapicenable(vio.irq, ncpu - 1);
+  outb(vio.iobase+VIO_STATUS, VS_ACK|VS_DRIVER|VS_DRIVER_OK);
+
+  bdevsw[ROOTDEV].rw = virtiorw;
+  bdevsw[ROOTDEV].submit = virtiosubmit;
+  bdevsw[ROOTDEV].stat = virtiogetstat;
+}
+
+// Take a free descriptor.
+// Caller must hold vio.lock.
+static int
+allocdesc(void)
+{
+  int i;
+
+  for(i = 0; i < vio.qsize; i++){
+    if(vio.free[i]){
+      vio.free[i] = 0;
+      vio.nfree--;
+      return i;
+    }
+  }
+  panic("allocdesc");
+}
+
+// Free the chain of descriptors starting at i.
+// Caller must hold vio.lock.
+static void
+freechain(int i)
+{
+  int flags;
+
+  for(;;){
+    flags = vio.desc[i].flags;
+    vio.free[i] = 1;
+    vio.nfree++;
+    if((flags & VD_NEXT) == 0)
+      break;
+    i = vio.desc[i].next;
+  }
+  wakeup(vio.free);
+}
+
+// Put a request for b on the queue and tell the device.
+// Sleeps until the queue has room for it.
+// Caller must hold vio.lock, and no other spinlock.
+static void
+virtiostart(struct buf *b)
+{
+  int d0, d1, d2;
+  ushort idx;
+
+  if(!holdingsleep(&b->lock))
+    panic("virtiorw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("virtiorw: nothing to do");
+
+  // Wait for a whole chain, so that no one sits on part
+  // of one while others wait for the rest.
+  while(vio.nfree < 3)
+    sleep(vio.free, &vio.lock);
+  d0 = allocdesc();
+  d1 = allocdesc();
+  d2 = allocdesc();
+
+  vio.info[d0].b = b;
+  vio.info[d0].hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+  vio.info[d0].hdr.reserved = 0;
+  vio.info[d0].hdr.sector = b->blockno * (bsize/SECTOR_SIZE);
+  vio.info[d0].hdr.sectorhi = 0;
+  vio.info[d0].status = 0xff;
+
+  vio.desc[d0].addr = V2P(&vio.info[d0].hdr);
+  vio.desc[d0].addrhi = 0;
+  vio.desc[d0].len = sizeof(struct vblkreq);
+  vio.desc[d0].flags = VD_NEXT;
+  vio.desc[d0].next = d1;
+
+  vio.desc[d1].addr = V2P(b->data);
+  vio.desc[d1].addrhi = 0;
+  vio.desc[d1].len = bsize;
+  vio.desc[d1].flags = VD_NEXT | ((b->flags & B_DIRTY) ? 0 : VD_WRITE);
+  vio.desc[d1].next = d2;
+
+  vio.desc[d2].addr = V2P(&vio.info[d0].status);
+  vio.desc[d2].addrhi = 0;
+  vio.desc[d2].len = 1;
+  vio.desc[d2].flags = VD_WRITE;
+  vio.desc[d2].next = 0;
+
+  b->qtime = ticks;
+  if(++vio.stat.depth > vio.stat.maxdepth)
+    vio.stat.maxdepth = vio.stat.depth;
+  vio.stat.cmds++;
+
+  // The device must see the descriptors before the ring
+  // entry, and the ring entry before the new index.
+  idx = vio.avail[1];
+  vio.avail[2 + idx % vio.qsize] = d0;
+  __sync_synchronize();
+  vio.avail[1] = idx + 1;
+  __sync_synchronize();
+  outw(vio.iobase+VIO_QNOTIFY, 0);
+}
+
+// Sync buf with disk, like iderw.
+static void
+virtiorw(struct buf *b)
+{
+  acquire(&vio.lock);
+  b->done = 0;
+  virtiostart(b);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vio.lock);
+  release(&vio.lock);
+}
+
+// Start reading or writing buf like virtiorw, without waiting
+// for it to finish, like idesubmit.  Unlike idesubmit, it may
+// sleep until the queue has three free descriptors.  That only
+// takes finishing requests, which the interrupt handler does
+// without any lock but vio.lock, so callers may hold sleep-locks:
+// breadahead() holds the inode being read, the committer's
+// logio() nothing.  They must not hold spinlocks.
+static void
+virtiosubmit(struct buf *b)
+{
+  acquire(&vio.lock);
+  virtiostart(b);
+  release(&vio.lock);
+}
+
+static void
+virtiogetstat(struct diskstat *st)
+{
+  acquire(&vio.lock);
+  *st = vio.stat;
+  release(&vio.lock);
+}
+
+// Interrupt handler.  PCI interrupt lines may be shared, so
+// there may be nothing to do.
+void
+virtiointr(void)
+{
+  struct buf *b, *donelist;
+  void (*done)(struct buf*);
+  int id;
+
+  if(vio.iobase == 0)
+    return;
+  acquire(&vio.lock);
+  inb(vio.iobase+VIO_ISR);  // acknowledge
+
+  donelist = 0;
+  while(vio.lastused != vio.usedhdr[1]){
+    __sync_synchronize();
+    id = vio.used[vio.lastused % vio.qsize].id;
+    vio.lastused++;
+    if(vio.info[id].status != 0)
+      panic("virtio: disk error");
+    b = vio.info[id].b;
+    vio.info[id].b = 0;
+    freechain(id);
+
+    if(b->flags & B_DIRTY)
+      vio.stat.writes++;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    vio.stat.reqs++;
+    vio.stat.depth--;
+    vio.stat.waitticks += ticks - b->qtime;
+    if(b->done){
+      b->qnext = donelist;
+      donelist = b;
+    } else
+      wakeup(b);
+  }
+  release(&vio.lock);
+
+  // Finish asynchronous requests outside vio.lock.
+  while((b = donelist) != 0){
+    donelist = b->qnext;
+    done = b->done;
+    b->done = 0;
+    done(b);
+  }
+}
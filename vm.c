@@ -31,18 +31,22 @@ seginit(void)
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
-static pte_t *
+// create any required page table pages, which may sleep in
+// kallocswap().  If va is in a 4MB page, return its page directory entry, which has
+// PTE_PS set and otherwise looks like a PTE.
+pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
   pde_t *pde;
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    if(!alloc || (pgtab = (pte_t*)kallocswap()) == 0)
       return 0;
     // Make sure all those PTE_P bits are zero.
     memset(pgtab, 0, PGSIZE);
@@ -57,7 +61,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned.
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 {
   char *a, *last;
@@ -79,6 +83,37 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Like mappages, but use 4MB pages for the parts of the range
+// that are 4MB aligned in both va and pa.  This saves TLB entries
+// and, since every page table has the kernel's mappings, a page
+// table page per 4MB of physical memory per process.
+static int
+mapkvm(pde_t *pgdir, char *va, uint size, uint pa, int perm)
+{
+  uint n;
+
+  while(size > 0){
+    if((uint)va % SUPERPGSIZE == 0 && pa % SUPERPGSIZE == 0 &&
+       size >= SUPERPGSIZE){
+      if(pgdir[PDX(va)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+      n = SUPERPGSIZE;
+    } else {
+      // 4096-byte pages up to the next 4MB boundary.
+      n = SUPERPGSIZE - (uint)va % SUPERPGSIZE;
+      if(n > size)
+        n = size;
+      if(mappages(pgdir, va, n, pa, perm) < 0)
+        return -1;
+    }
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
@@ -96,6 +131,10 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
+// Wherever a range is 4MB aligned it is mapped with 4MB pages
+// (see mapkvm); the kernel text and the first 4MB stay in
+// 4096-byte pages so that the text can be read-only.
+//
 // The kernel allocates physical memory for its heap and for user memory
 // between V2P(end) and the end of physical memory (PHYSTOP)
 // (directly addressable from end..P2V(PHYSTOP)).
@@ -121,14 +160,14 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kallocswap()) == 0)
     return 0;
   memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
+    if(mapkvm(pgdir, k->virt, k->phys_end - k->phys_start,
+              (uint)k->phys_start, k->perm) < 0) {
       freevm(pgdir);
       return 0;
     }
@@ -231,7 +270,7 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kallocswap();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -263,10 +302,20 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS){
+      // A 4MB page (MAP_HUGE) is only ever freed whole.
+      kfreesuper(P2V(PTE_ADDR(pgdir[PDX(a)])));
+      pgdir[PDX(a)] = 0;
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
+    else if(*pte & PTE_SWAP){
+      swapfree(PTE_SLOT(*pte));
+      *pte = 0;
+    } else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
@@ -289,7 +338,7 @@ freevm(pde_t *pgdir)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
   for(i = 0; i < NPDENTRIES; i++){
-    if(pgdir[i] & PTE_P){
+    if((pgdir[i] & (PTE_P|PTE_PS)) == PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
     }
@@ -310,6 +359,29 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Map the 4MB page at va of pgdir into d as well: the same
+// page if share, otherwise a copy.  Returns 0 or -1.
+int
+copysuper(pde_t *pgdir, pde_t *d, uint va, int share)
+{
+  pde_t pde;
+  char *mem;
+
+  pde = pgdir[PDX(va)];
+  if(share){
+    mem = P2V(PTE_ADDR(pde));
+    krefsuper(mem);
+  } else {
+    if((mem = kallocsuper()) == 0)
+      return -1;
+    memmove(mem, P2V(PTE_ADDR(pde)), SUPERPGSIZE);
+  }
+  if(d[PDX(va)] & PTE_P)
+    panic("copysuper: remap");
+  d[PDX(va)] = V2P(mem) | (PTE_FLAGS(pde) & ~(PTE_A|PTE_D));
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
 // of it for a child.
 pde_t*
@@ -323,15 +395,28 @@ copyuvm(pde_t *pgdir, uint sz)
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
+    if(pgdir[PDX(i)] & PTE_PS){
+      if(copysuper(pgdir, d, i, 0) < 0)
+        goto bad;
+      i += SUPERPGSIZE - PGSIZE;
+      continue;
+    }
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
       panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
+    // Allocate first: kallocswap() may page out this very page.
+    if((mem = kallocswap()) == 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
+    if(*pte & PTE_SWAP){
+      // Paged out: read the child's copy straight from swap.
+      flags = (PTE_FLAGS(*pte) & ~PTE_SWAP) | PTE_P;
+      swapread(PTE_SLOT(*pte), mem);
+    } else {
+      if(!(*pte & PTE_P))
+        panic("copyuvm: page not present");
+      pa = PTE_ADDR(*pte);
+      flags = PTE_FLAGS(*pte);
+      memmove(mem, (char*)P2V(pa), PGSIZE);
+    }
     if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
       kfree(mem);
       goto bad;
@@ -351,10 +436,12 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
+  if(*pte & PTE_PS)
+    return (char*)P2V(PTE_ADDR(*pte) + PGROUNDDOWN((uint)uva % SUPERPGSIZE));
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
@@ -384,6 +471,64 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+// Read the page at va back in from swap, if it was paged
+// out.  Returns 0 if it was, -1 if not (or no memory).
+static int
+uvmpagein(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) == 0 || (*pte & PTE_SWAP) == 0)
+    return -1;
+  if((mem = kallocswap()) == 0)
+    return -1;
+  swapread(PTE_SLOT(*pte), mem);
+  swapfree(PTE_SLOT(*pte));
+  *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_SWAP) | PTE_P;
+  return 0;
+}
+
+// Handle a page fault by the current process at user
+// address va.  err is the fault's error code.
+// Returns 0 if the page is now mapped, -1 if the
+// access was invalid.
+int
+pagefault(uint va, uint err)
+{
+  struct proc *curproc = myproc();
+
+  if(va >= KERNBASE)
+    return -1;
+  if(va < curproc->sz)
+    return uvmpagein(curproc->pgdir, va);
+  return vmafault(curproc, va, err & FEC_WR);
+}
+
+// Check that the current process may access the n bytes
+// at user address va, making sure the pages are mapped so
+// that the kernel can read them (or write them, if write)
+// directly.  Returns 0 if so, -1 if not.
+int
+uvmcheck(uint va, uint n, int write)
+{
+  struct proc *curproc = myproc();
+  pte_t *pte;
+  uint a;
+
+  if(va < curproc->sz && va + n <= curproc->sz && va + n >= va){
+    // Page in anything that was paged out.  It stays in
+    // until the system call is over (see swap.c).
+    for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+      pte = walkpgdir(curproc->pgdir, (char*)a, 0);
+      if(pte && (*pte & PTE_SWAP) && uvmpagein(curproc->pgdir, a) < 0)
+        return -1;
+    }
+    return 0;
+  }
+  return vmacheck(curproc, va, n, write);
+}
+
 // Blank page.
 // Blank page.
 // Blank page.
@@ -0,0 +1,10 @@
+// Virtual memory statistics, returned by getvmstat().
+// Both the kernel and user programs use this header file.
+
+struct vmstat {
+  uint freepages;  // free physical pages
+  uint pagein;     // pages read back from swap
+  uint pageout;    // pages written to swap
+  uint swapused;   // swap slots holding a page
+  uint swapsize;   // swap slots in all
+};
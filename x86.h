@@ -24,12 +24,36 @@ outb(ushort port, uchar data)
   asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline ushort
+inw(ushort port)
+{
+  ushort data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
 static inline void
 outw(ushort port, ushort data)
 {
   asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline uint
+inl(ushort port)
+{
+  uint data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
+static inline void
+outl(ushort port, uint data)
+{
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+}
+
 static inline void
 outsl(int port, const void *addr, int cnt)
 {
@@ -130,6 +154,16 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Index of the lowest set bit of x, which must not be 0.
+static inline uint
+bsf(uint x)
+{
+  uint r;
+
+  asm volatile("bsfl %1, %0" : "=r" (r) : "rm" (x) : "cc");
+  return r;
+}
+
 static inline uint
 rcr2(void)
 {